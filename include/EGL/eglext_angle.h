@@ -477,6 +477,16 @@ EGLAPI void EGLAPIENTRY eglSetValidationEnabledANGLE(EGLBoolean validationState)
 #define EGL_CONTEXT_PASSTHROUGH_SHADERS_ANGLE 0x3463
 #endif /* EGL_ANGLE_create_context_passthrough_shaders */
 
+#ifndef EGL_ANGLE_disk_program_cache
+#define EGL_ANGLE_disk_program_cache 1
+#define EGL_DISK_PROGRAM_CACHE_DIRECTORY_ANGLE 0x34F9
+#endif /* EGL_ANGLE_disk_program_cache */
+
+#ifndef EGL_ANGLE_context_threaded_commands
+#define EGL_ANGLE_context_threaded_commands 1
+#define EGL_CONTEXT_THREADED_COMMANDS_ANGLE 0x34FA
+#endif /* EGL_ANGLE_context_threaded_commands */
+
 // clang-format on
 
 #endif  // INCLUDE_EGL_EGLEXT_ANGLE_
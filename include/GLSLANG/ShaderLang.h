@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 422
+#define ANGLE_SH_VERSION 425
 
 enum ShShaderSpec
 {
@@ -474,6 +474,14 @@ struct ShCompileOptions
     // Whether ESSL300 fragment outputs should be expanded to vec4s.
     uint64_t expandFragmentOutputsToVec4 : 1;
 
+    // Record the time and pool memory taken by each stage of the compilation, to be queried with
+    // sh::GetCompileStageRecords().
+    uint64_t recordCompileStages : 1;
+
+    // With useIR, generate SPIR-V directly from the IR instead of from the AST made out of it, if
+    // the shader uses only the features the IR's SPIR-V generator supports.
+    uint64_t generateSpirvFromIR : 1;
+
     ShCompileOptionsMetal metal;
     ShPixelLocalStorageOptions pls;
 };
@@ -749,6 +757,22 @@ struct ShBuiltInResources
     int MaxCombinedDrawBuffersAndPixelLocalStoragePlanes;
 };
 
+// One stage of a compilation recorded with the recordCompileStages compile option: preprocessing,
+// parsing, an AST transformation, code generation, etc.
+struct ShCompileStageRecord
+{
+    const char *name;
+    // Time spent in the stage.  Preprocessing is interleaved with parsing, and is not included in
+    // the time of the parse stage.
+    uint64_t timeNs;
+    // Bytes allocated from the compiler's pool allocator by the end of the stage.  Pool memory is
+    // only released at the end of the compilation, so this is its high-water mark so far.
+    size_t poolBytes;
+    // For an AST transformation, whether a traverser applied changes to the tree.  Changes made to
+    // the tree directly instead of through TIntermTraverser::updateTree are not detected.
+    bool changedTree;
+};
+
 //
 // ShHandle held by but opaque to the driver.  It is allocated,
 // managed, and de-allocated by the compiler. Its contents
@@ -888,6 +912,9 @@ int GetVertexShaderNumViews(const ShHandle handle);
 // Returns the pixel local storage uniform format at each binding index, or "NotPLS" if there is
 // not one.
 const std::vector<ShPixelLocalStorageLayout> *GetPixelLocalStorageLayouts(const ShHandle handle);
+// Returns the stages of the last compilation in the order they ran, or an empty list if it was not
+// compiled with the recordCompileStages option.
+const std::vector<ShCompileStageRecord> *GetCompileStageRecords(const ShHandle handle);
 
 // Returns true if the passed in variables pack in maxVectors followingthe packing rules from the
 // GLSL 1.017 spec, Appendix A, section 7.
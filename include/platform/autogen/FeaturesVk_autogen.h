@@ -398,6 +398,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo forceGenerateMipmapOnCPU = {
+        "forceGenerateMipmapOnCPU",
+        FeatureCategory::VulkanWorkarounds,
+        &members,
+    };
+
     FeatureInfo supportsRenderPassStoreOpNone = {
         "supportsRenderPassStoreOpNone",
         FeatureCategory::VulkanFeatures,
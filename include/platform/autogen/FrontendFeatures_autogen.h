@@ -63,6 +63,12 @@ struct FrontendFeatures : FeatureSetBase
         &members,
     };
 
+    FeatureInfo disableSimdImageLoad = {
+        "disableSimdImageLoad",
+        FeatureCategory::FrontendWorkarounds,
+        &members,
+    };
+
     FeatureInfo forceDepthAttachmentInitOnClear = {
         "forceDepthAttachmentInitOnClear",
         FeatureCategory::FrontendWorkarounds,
@@ -165,6 +171,12 @@ struct FrontendFeatures : FeatureSetBase
         &members,
     };
 
+    FeatureInfo alwaysRunCompileJobsThreaded = {
+        "alwaysRunCompileJobsThreaded",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
     FeatureInfo uncurrentEglSurfaceUponSurfaceDestroy = {
         "uncurrentEglSurfaceUponSurfaceDestroy",
         FeatureCategory::FrontendWorkarounds,
@@ -249,6 +261,30 @@ struct FrontendFeatures : FeatureSetBase
         &members,
     };
 
+    FeatureInfo useWorkStealingThreadPool = {
+        "useWorkStealingThreadPool",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo useFastBlobCacheCompression = {
+        "useFastBlobCacheCompression",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo compressBlobCacheAsynchronously = {
+        "compressBlobCacheAsynchronously",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo coalesceDrawElements = {
+        "coalesceDrawElements",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
 };
 
 inline FrontendFeatures::FrontendFeatures()  = default;
@@ -18,6 +18,7 @@ CL_STUBS_HEADER_PATH = "../src/libGLESv2/cl_stubs_autogen.h"
 EGL_GET_LABELED_OBJECT_DATA_PATH = "../src/libGLESv2/egl_get_labeled_object_data.json"
 EGL_STUBS_HEADER_PATH = "../src/libGLESv2/egl_stubs_autogen.h"
 EGL_EXT_STUBS_HEADER_PATH = "../src/libGLESv2/egl_ext_stubs_autogen.h"
+COMMAND_STREAM_DATA_PATH = "entry_point_command_stream.json"
 
 # List of GLES1 extensions for which we don't need to add Context.h decls.
 GLES1_NO_CONTEXT_DECL_EXTENSIONS = [
@@ -416,7 +417,7 @@ void GL_APIENTRY GL_{name}({params})
     {event_comment}ANGLE_UNSAFE_TODO(EVENT(context, GL{name_enum}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params}));
 
     if ({valid_context_check})
-    {{{packed_gl_enum_conversions}
+    {{{command_stream_queue}{packed_gl_enum_conversions}
         {context_lock}{implicit_pls_disable}
         {validation_expression}
         if (ANGLE_LIKELY(isCallValid))
@@ -441,7 +442,7 @@ void GL_APIENTRY GL_{name}({params})
     {event_comment}ANGLE_UNSAFE_TODO(EVENT(context, GL{name_enum}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params}));
 
     if ({valid_context_check})
-    {{{packed_gl_enum_conversions}
+    {{{command_stream_queue}{packed_gl_enum_conversions}
         {validation_expression}
         if (ANGLE_LIKELY(isCallValid))
         {{
@@ -521,6 +522,130 @@ TEMPLATE_GLES_CONTEXT_PRIVATE_ENTRY_POINT_WITH_RETURN = """\
 }}
 """
 
+TEMPLATE_COMMAND_STREAM_QUEUE = """
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && Queue{name}({queue_params}))
+        {{
+            return;
+        }}"""
+
+TEMPLATE_COMMAND_STREAM_HEADER = """\
+// GENERATED FILE - DO NOT EDIT.
+// Generated by {script_name} using data from {data_source_name}.
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// command_stream_autogen.h:
+//   Records GL calls in the command stream of a context created with
+//   EGL_CONTEXT_THREADED_COMMANDS_ANGLE.
+
+#ifndef LIBGLESV2_COMMAND_STREAM_AUTOGEN_H_
+#define LIBGLESV2_COMMAND_STREAM_AUTOGEN_H_
+
+#include "angle_gl.h"
+
+namespace gl
+{{
+class Context;
+
+// Each function records its call and returns true.  If the call can't be recorded, it returns
+// false once the recorded calls are executed, so that the call is executed directly.  It also
+// returns true if the context was lost by the recorded calls, after generating the error.
+{prototypes}
+}}  // namespace gl
+
+#endif  // LIBGLESV2_COMMAND_STREAM_AUTOGEN_H_
+"""
+
+TEMPLATE_COMMAND_STREAM_SOURCE = """\
+// GENERATED FILE - DO NOT EDIT.
+// Generated by {script_name} using data from {data_source_name}.
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// command_stream_autogen.cpp:
+//   Records GL calls in the command stream of a context, and executes them on its thread.
+
+#include "libGLESv2/command_stream_autogen.h"
+
+#include "common/entry_points_enum_autogen.h"
+#include "common/mathutil.h"
+#include "libANGLE/CommandStream.h"
+#include "libANGLE/Context.h"
+#include "libGLESv2/entry_points_gles_1_0_autogen.h"
+#include "libGLESv2/entry_points_gles_2_0_autogen.h"
+#include "libGLESv2/entry_points_gles_3_0_autogen.h"
+#include "libGLESv2/entry_points_gles_3_1_autogen.h"
+#include "libGLESv2/entry_points_gles_3_2_autogen.h"
+#include "libGLESv2/entry_points_gles_ext_autogen.h"
+#include "libGLESv2/global_state.h"
+
+namespace gl
+{{
+namespace
+{{
+{executors}
+}}  // anonymous namespace
+
+{queue_functions}
+}}  // namespace gl
+"""
+
+TEMPLATE_COMMAND_STREAM_EXECUTOR = """\
+struct {name}Params
+{{
+{members}
+}};
+
+void Execute{name}(const void *params)
+{{
+    const auto *cmd = static_cast<const {name}Params *>(params);
+    GL_{name}({args});
+}}
+"""
+
+TEMPLATE_COMMAND_STREAM_QUEUE_FUNCTION = """\
+bool Queue{name}(Context *context, {params})
+{{
+    CommandStream *stream = context->getCommandStream();
+{data_size}
+{allocation}
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {{
+        if (SyncCommandStream(context))
+        {{
+            return false;
+        }}
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GL{name});
+        return true;
+    }}
+
+{assignments}
+    return true;
+}}
+"""
+
+TEMPLATE_COMMAND_STREAM_ALLOCATION = """\
+    auto *cmd = stream->allocate<{name}Params>(Execute{name}{data_args});"""
+
+TEMPLATE_COMMAND_STREAM_CONDITIONAL_ALLOCATION = """\
+    {name}Params *cmd = nullptr;
+    if ({condition})
+    {{
+        cmd = stream->allocate<{name}Params>(Execute{name}{data_args});
+    }}"""
+
+TEMPLATE_COMMAND_STREAM_DATA_SIZE = """\
+    angle::CheckedNumeric<size_t> dataSize({count});
+"""
+
+TEMPLATE_COMMAND_STREAM_DATA_ELEMENT_SIZE = """\
+    dataSize *= {size};
+"""
+
 TEMPLATE_EGL_ENTRY_POINT_NO_RETURN = """\
 void EGLAPIENTRY EGL_{name}({params})
 {{
@@ -1244,6 +1369,7 @@ TEMPLATE_SOURCES_INCLUDES = """\
 #include "libANGLE/capture/capture_{header_version}_autogen.h"
 #include "libANGLE/validation{validation_header_version}.h"
 #include "libANGLE/entry_points_utils.h"
+#include "libGLESv2/command_stream_autogen.h"
 #include "libGLESv2/global_state.h"
 
 using namespace gl;
@@ -2083,6 +2209,36 @@ def is_context_lost_acceptable_cmd(cmd_name):
     return False
 
 
+_command_stream_commands = None
+
+
+def get_command_stream_commands():
+    global _command_stream_commands
+    if _command_stream_commands is None:
+        with open(script_relative(COMMAND_STREAM_DATA_PATH)) as f:
+            _command_stream_commands = json.loads(f.read())
+        del _command_stream_commands["description"]
+    return _command_stream_commands
+
+
+# Commands that can be recorded in the command stream of a context created with
+# EGL_CONTEXT_THREADED_COMMANDS_ANGLE.  The explicit context entry points always execute directly.
+def is_command_stream_cmd(api, cmd_name, explicit_context):
+    return api == apis.GLES and not explicit_context and cmd_name in get_command_stream_commands()
+
+
+# Commands that may defer their draw to submit it with the previous ones.  Every other command
+# flushes the deferred draws when it gets the context.  The explicit context entry points may be
+# called with a context that isn't current, which nothing would flush, so they draw immediately.
+DEFERRED_DRAW_COMMANDS = ["glDrawElements"]
+
+
+def get_context_function_name(cmd_name, name_lower_no_suffix, explicit_context):
+    if explicit_context and cmd_name in DEFERRED_DRAW_COMMANDS:
+        return name_lower_no_suffix + "Immediate"
+    return name_lower_no_suffix
+
+
 def get_context_getter_function(cmd_name, explicit_context):
     if explicit_context:
         if is_context_lost_acceptable_cmd(cmd_name):
@@ -2092,10 +2248,70 @@ def get_context_getter_function(cmd_name, explicit_context):
     else:
         if is_context_lost_acceptable_cmd(cmd_name):
             return "GetGlobalContext()"
+        elif cmd_name in DEFERRED_DRAW_COMMANDS:
+            return "LoadValidGlobalContext()"
+        elif is_command_stream_cmd(apis.GLES, cmd_name, explicit_context):
+            # The calls recorded before are only waited for if this call can't be recorded.
+            return "PeekValidGlobalContext()"
         else:
             return "GetValidGlobalContext()"
 
 
+def get_command_stream_queue(api, cmd_name, params, explicit_context):
+    if not is_command_stream_cmd(api, cmd_name, explicit_context):
+        return ""
+
+    return TEMPLATE_COMMAND_STREAM_QUEUE.format(
+        name=strip_api_prefix(cmd_name),
+        queue_params=", ".join(["context"] + [just_the_name(param) for param in params]))
+
+
+def format_command_stream_functions(cmd_name, params):
+    name = strip_api_prefix(cmd_name)
+    command = get_command_stream_commands()[cmd_name]
+    data = command.get("data", {})
+    assert len(data) <= 1, "Only one parameter of %s can be copied" % cmd_name
+
+    executor = TEMPLATE_COMMAND_STREAM_EXECUTOR.format(
+        name=name,
+        members="\n".join(["    %s;" % param.strip() for param in params]),
+        args=", ".join(["cmd->" + just_the_name(param) for param in params]))
+
+    condition = command.get("condition", None)
+    data_size = ""
+    data_args = ""
+    assignments = []
+    for param in params:
+        param_name = just_the_name(param)
+        if param_name in data:
+            # The copy of the data follows the parameters.
+            data_size = TEMPLATE_COMMAND_STREAM_DATA_SIZE.format(count=data[param_name]["count"])
+            if data[param_name]["size"] != "1":
+                data_size += TEMPLATE_COMMAND_STREAM_DATA_ELEMENT_SIZE.format(
+                    size=data[param_name]["size"])
+            data_args = ", %s, dataSize" % param_name
+            assignments.append("    cmd->%s = reinterpret_cast<%s>(cmd + 1);" %
+                               (param_name, just_the_type(param).strip()))
+        else:
+            assignments.append("    cmd->%s = %s;" % (param_name, param_name))
+
+    if condition:
+        allocation = TEMPLATE_COMMAND_STREAM_CONDITIONAL_ALLOCATION.format(
+            name=name, condition=condition, data_args=data_args)
+    else:
+        allocation = TEMPLATE_COMMAND_STREAM_ALLOCATION.format(name=name, data_args=data_args)
+
+    queue_function = TEMPLATE_COMMAND_STREAM_QUEUE_FUNCTION.format(
+        name=name,
+        params=", ".join(params),
+        data_size=data_size,
+        allocation=allocation,
+        assignments="\n".join(assignments))
+    prototype = "bool Queue%s(Context *context, %s);" % (name, ", ".join(params))
+
+    return prototype, executor, queue_function
+
+
 def get_valid_context_check(cmd_name):
     return "ANGLE_LIKELY(context != nullptr)"
 
@@ -2282,7 +2498,7 @@ def format_entry_point_def(api, command_node, cmd_name, proto, params, cmd_packe
         "name_no_suffix":
             name_no_suffix,
         "name_lower_no_suffix":
-            name_lower_no_suffix,
+            get_context_function_name(cmd_name, name_lower_no_suffix, explicit_context),
         "name_enum":
             strip_api_prefix(cmd_name),
         "return_type":
@@ -2320,6 +2536,8 @@ def format_entry_point_def(api, command_node, cmd_name, proto, params, cmd_packe
             ", ".join(format_params),
         "context_getter":
             get_context_getter_function(cmd_name, explicit_context),
+        "command_stream_queue":
+            get_command_stream_queue(api, cmd_name, params, explicit_context),
         "valid_context_check":
             get_valid_context_check(cmd_name),
         "constext_lost_error_generator":
@@ -2677,6 +2895,9 @@ class ANGLEEntryPoints(registry_xml.EntryPoints):
         self.capture_pointer_funcs = []
         self.explicit_context_decls = []
         self.explicit_context_defs = []
+        self.command_stream_protos = []
+        self.command_stream_executors = []
+        self.command_stream_functions = []
 
         for (cmd_name, command_node, param_text, proto_text) in self.get_infos():
             self.decls.append(
@@ -2716,6 +2937,13 @@ class ANGLEEntryPoints(registry_xml.EntryPoints):
                                       all_param_types, self.capture_pointer_funcs,
                                       cmd_packed_enums, packed_param_types))
 
+            if is_command_stream_cmd(self.api, cmd_name, False):
+                proto, executor, function = format_command_stream_functions(
+                    cmd_name, param_text)
+                self.command_stream_protos.append(proto)
+                self.command_stream_executors.append(executor)
+                self.command_stream_functions.append(function)
+
             if api == apis.GLES:
                 self.explicit_context_decls.append(
                     format_entry_point_decl(self.api, cmd_name, proto_text, param_text, True))
@@ -2996,6 +3224,27 @@ def write_context_private_call_header(protos, source, template):
         out.close()
 
 
+def write_command_stream_files(protos, executors, functions, source):
+    header = TEMPLATE_COMMAND_STREAM_HEADER.format(
+        script_name=os.path.basename(sys.argv[0]),
+        data_source_name=source,
+        prototypes="\n".join(protos))
+
+    with open(path_to("libGLESv2", "command_stream_autogen.h"), "w") as out:
+        out.write(header)
+        out.close()
+
+    source = TEMPLATE_COMMAND_STREAM_SOURCE.format(
+        script_name=os.path.basename(sys.argv[0]),
+        data_source_name=source,
+        executors="\n".join(executors),
+        queue_functions="\n".join(functions))
+
+    with open(path_to("libGLESv2", "command_stream_autogen.cpp"), "w") as out:
+        out.write(source)
+        out.close()
+
+
 def write_context_lock_header(annotation, comment, protos, source, template):
     content = template.format(
         script_name=os.path.basename(sys.argv[0]),
@@ -3741,7 +3990,7 @@ def main():
     if len(sys.argv) > 1:
         inputs = [
             'entry_point_packed_egl_enums.json', 'entry_point_packed_gl_enums.json',
-            EGL_GET_LABELED_OBJECT_DATA_PATH
+            EGL_GET_LABELED_OBJECT_DATA_PATH, COMMAND_STREAM_DATA_PATH
         ] + registry_xml.xml_inputs
         outputs = [
             CL_STUBS_HEADER_PATH,
@@ -3786,6 +4035,8 @@ def main():
             '../src/libEGL/libEGL_autogen.cpp',
             '../src/libEGL/libEGL_autogen.def',
             '../src/libEGL/libEGL_vulkan_secondaries_autogen.def',
+            '../src/libGLESv2/command_stream_autogen.cpp',
+            '../src/libGLESv2/command_stream_autogen.h',
             '../src/libGLESv2/entry_points_cl_autogen.cpp',
             '../src/libGLESv2/entry_points_cl_autogen.h',
             '../src/libGLESv2/entry_points_egl_autogen.cpp',
@@ -3848,6 +4099,11 @@ def main():
     context_private_call_protos = []
     context_private_call_functions = set()
 
+    # Collect the functions that record calls in the command stream
+    command_stream_protos = []
+    command_stream_executors = []
+    command_stream_functions = []
+
     # Build commands cache
     for major_version, minor_version in registry_xml.GLES_VERSIONS:
         version = "{}_{}".format(major_version, minor_version)
@@ -3920,6 +4176,10 @@ def main():
         explicit_context_decls += eps.explicit_context_decls
         explicit_context_defs += eps.explicit_context_defs
 
+        command_stream_protos += eps.command_stream_protos
+        command_stream_executors += eps.command_stream_executors
+        command_stream_functions += eps.command_stream_functions
+
     # After we finish with the main entry points, we process the extensions.
     extension_decls = ["extern \"C\" {"]
     extension_defs = ["extern \"C\" {"]
@@ -3963,6 +4223,10 @@ def main():
         explicit_context_decls += eps.explicit_context_decls
         explicit_context_defs += eps.explicit_context_defs
 
+        command_stream_protos += eps.command_stream_protos
+        command_stream_executors += eps.command_stream_executors
+        command_stream_functions += eps.command_stream_functions
+
         for proto, function in zip(eps.context_private_call_protos,
                                    eps.context_private_call_functions):
             if function not in context_private_call_functions:
@@ -3988,6 +4252,9 @@ def main():
 
     write_context_private_call_header(context_private_call_protos, "gl.xml and gl_angle_ext.xml",
                                       TEMPLATE_CONTEXT_PRIVATE_CALL_HEADER)
+    write_command_stream_files(command_stream_protos, command_stream_executors,
+                               command_stream_functions,
+                               "gl.xml and " + COMMAND_STREAM_DATA_PATH)
 
     for name in extension_commands:
         all_commands_with_suffix.append(name)
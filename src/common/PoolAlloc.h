@@ -104,6 +104,17 @@ class PoolAllocator : angle::NonCopyable
     // user of it, as the model of use is to simultaneously deallocate everything at once by
     // destroying the instance or reset().
 
+    // Returns the number of bytes requested through allocate() since the last reset(), or 0 if the
+    // pool allocator is disabled.
+    size_t getAllocatedBytes() const
+    {
+#if defined(ANGLE_DISABLE_POOL_ALLOC)
+        return 0;
+#else
+        return mTotalBytes;
+#endif
+    }
+
   private:
 #if !defined(ANGLE_DISABLE_POOL_ALLOC)
     // Slow path of allocation when we have to get a new page.
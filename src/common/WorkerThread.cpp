@@ -10,6 +10,8 @@
 
 #include "common/WorkerThread.h"
 
+#include "common/PackedEnums.h"
+#include "common/SimpleMutex.h"
 #include "common/angleutils.h"
 #include "common/system_utils.h"
 
@@ -20,6 +22,8 @@
 #endif  // !defined(ANGLE_STD_ASYNC_WORKERS) && & !defined(ANGLE_ENABLE_WINDOWS_UWP)
 
 #if ANGLE_DELEGATE_WORKERS || ANGLE_STD_ASYNC_WORKERS
+#    include <atomic>
+#    include <deque>
 #    include <future>
 #    include <queue>
 #    include <thread>
@@ -64,6 +68,13 @@ bool AsyncWaitableEvent::isReady()
     return mIsReady;
 }
 
+void AsyncWaitableEvent::reset()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mIsReady = false;
+    mAborted = false;
+}
+
 WorkerThreadPool::WorkerThreadPool()  = default;
 WorkerThreadPool::~WorkerThreadPool() = default;
 
@@ -222,6 +233,310 @@ size_t AsyncWorkerPool::getEnqueuedTaskCount()
     return mTaskQueue.size();
 }
 
+// A pool of AsyncWaitableEvents that are recycled once nobody but the pool references them.  This
+// avoids allocating both the event and its shared_ptr control block for every posted task.
+class WaitableEventPool final : angle::NonCopyable
+{
+  public:
+    std::shared_ptr<AsyncWaitableEvent> acquire();
+
+  private:
+    // Number of recycled events to inspect before giving up and allocating a new one.
+    static constexpr size_t kMaxProbeCount = 8;
+    // Limit on the number of events kept around for reuse.
+    static constexpr size_t kMaxPooledEvents = 256;
+
+    angle::SimpleMutex mMutex;
+    std::vector<std::shared_ptr<AsyncWaitableEvent>> mEvents;
+    size_t mNextProbe = 0;
+};
+
+std::shared_ptr<AsyncWaitableEvent> WaitableEventPool::acquire()
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    const size_t probeCount = std::min(kMaxProbeCount, mEvents.size());
+    for (size_t probe = 0; probe < probeCount; ++probe)
+    {
+        std::shared_ptr<AsyncWaitableEvent> &event = mEvents[mNextProbe];
+        mNextProbe                                 = (mNextProbe + 1) % mEvents.size();
+
+        // If the pool holds the only reference, neither the poster nor the worker can still be
+        // using the event, so it's safe to recycle.  reset() takes the event's mutex, which orders
+        // it after the worker's markAsReady().
+        if (event.use_count() == 1)
+        {
+            event->reset();
+            return event;
+        }
+    }
+
+    std::shared_ptr<AsyncWaitableEvent> event = std::make_shared<AsyncWaitableEvent>();
+    if (mEvents.size() < kMaxPooledEvents)
+    {
+        mEvents.push_back(event);
+    }
+    return event;
+}
+
+// A pool where every thread owns a deque of tasks per priority.  Tasks posted from outside the
+// pool are distributed round-robin over the threads, while tasks posted from a worker go to the
+// worker's own deque.  Threads that run out of work steal from the other threads, always picking
+// the highest priority task available.  Each deque is protected by its own SimpleMutex, so unlike
+// AsyncWorkerPool there is no single lock that every post and every pop contends on.
+class WorkStealingWorkerPool final : public WorkerThreadPool
+{
+  public:
+    WorkStealingWorkerPool(size_t numThreads);
+
+    ~WorkStealingWorkerPool() override;
+
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTaskWithPriority(
+        const std::shared_ptr<Closure> &task,
+        WorkerTaskPriority priority) override;
+
+    bool isAsync() override;
+
+    size_t getEnqueuedTaskCount() override;
+
+  private:
+    using Task = std::pair<std::shared_ptr<AsyncWaitableEvent>, std::shared_ptr<Closure>>;
+
+    struct Worker
+    {
+        // Protects |taskQueues|.  The owning thread pops from the front, thieves from the back.
+        angle::SimpleMutex mutex;
+        angle::PackedEnumMap<WorkerTaskPriority, std::deque<Task>> taskQueues;
+        std::thread thread;
+    };
+
+    void createThreads();
+
+    size_t pickWorkerIndex();
+    bool popTask(size_t workerIndex, Task *taskOut);
+    bool waitForTasks();
+
+    // Thread's main loop
+    void threadLoop(size_t workerIndex);
+
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    std::once_flag mThreadsCreated;
+    std::atomic<size_t> mNextWorker;
+    std::atomic<size_t> mPendingTaskCount;
+
+    // Idle threads park on |mParkCondVar|.  |mParkedThreadCount| lets posters skip taking
+    // |mParkMutex| when every thread is already busy.
+    std::mutex mParkMutex;
+    std::condition_variable mParkCondVar;
+    std::atomic<size_t> mParkedThreadCount;
+    std::atomic<bool> mTerminated;
+
+    WaitableEventPool mEventPool;
+};
+
+namespace
+{
+// The pool and index of the worker the current thread belongs to, if any.
+thread_local const WorkerThreadPool *gCurrentWorkerPool = nullptr;
+thread_local size_t gCurrentWorkerIndex                 = 0;
+}  // anonymous namespace
+
+// WorkStealingWorkerPool implementation.
+
+WorkStealingWorkerPool::WorkStealingWorkerPool(size_t numThreads)
+    : mNextWorker(0), mPendingTaskCount(0), mParkedThreadCount(0), mTerminated(false)
+{
+    ASSERT(numThreads != 0);
+    mWorkers.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i)
+    {
+        mWorkers.push_back(std::make_unique<Worker>());
+    }
+}
+
+WorkStealingWorkerPool::~WorkStealingWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mParkMutex);
+        mTerminated = true;
+    }
+    mParkCondVar.notify_all();
+
+    for (std::unique_ptr<Worker> &worker : mWorkers)
+    {
+        if (worker->thread.joinable())
+        {
+            ASSERT(worker->thread.get_id() != std::this_thread::get_id());
+            worker->thread.join();
+        }
+    }
+
+    // Mark each remaining task's AsyncWaitableEvent as aborted.  The threads are all joined, so no
+    // locking is necessary.
+    for (std::unique_ptr<Worker> &worker : mWorkers)
+    {
+        for (std::deque<Task> &taskQueue : worker->taskQueues)
+        {
+            for (Task &task : taskQueue)
+            {
+                task.first->markAsAborted();
+            }
+            taskQueue.clear();
+        }
+    }
+}
+
+void WorkStealingWorkerPool::createThreads()
+{
+    for (size_t i = 0; i < mWorkers.size(); ++i)
+    {
+        mWorkers[i]->thread = std::thread(&WorkStealingWorkerPool::threadLoop, this, i);
+    }
+}
+
+size_t WorkStealingWorkerPool::pickWorkerIndex()
+{
+    if (gCurrentWorkerPool == this)
+    {
+        return gCurrentWorkerIndex;
+    }
+    return mNextWorker.fetch_add(1, std::memory_order_relaxed) % mWorkers.size();
+}
+
+std::shared_ptr<WaitableEvent> WorkStealingWorkerPool::postWorkerTask(
+    const std::shared_ptr<Closure> &task)
+{
+    return postWorkerTaskWithPriority(task, WorkerTaskPriority::Normal);
+}
+
+std::shared_ptr<WaitableEvent> WorkStealingWorkerPool::postWorkerTaskWithPriority(
+    const std::shared_ptr<Closure> &task,
+    WorkerTaskPriority priority)
+{
+    // Thread safety: This function is thread-safe because access to each worker's task queues is
+    // protected by that worker's mutex.
+    ASSERT(!mTerminated);
+
+    // Lazily create the threads on first task
+    std::call_once(mThreadsCreated, &WorkStealingWorkerPool::createThreads, this);
+
+    std::shared_ptr<AsyncWaitableEvent> waitable = mEventPool.acquire();
+
+    Worker &worker = *mWorkers[pickWorkerIndex()];
+    {
+        // The count is incremented under the queue lock and before the push, so a worker that
+        // pops the task and decrements the count can never observe it before the increment.
+        //
+        // Note: both this increment and the load of |mParkedThreadCount| below need to be
+        // sequentially consistent with the matching operations in waitForTasks(), so that either
+        // the poster sees the parked thread or the parked thread sees the new task.
+        std::lock_guard<angle::SimpleMutex> lock(worker.mutex);
+        mPendingTaskCount.fetch_add(1);
+        worker.taskQueues[priority].emplace_back(waitable, task);
+    }
+
+    if (mParkedThreadCount.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(mParkMutex);
+        mParkCondVar.notify_one();
+    }
+
+    return waitable;
+}
+
+bool WorkStealingWorkerPool::popTask(size_t workerIndex, Task *taskOut)
+{
+    const size_t workerCount = mWorkers.size();
+
+    for (WorkerTaskPriority priority : angle::AllEnums<WorkerTaskPriority>())
+    {
+        // Look in this thread's own queue first.
+        {
+            Worker &self = *mWorkers[workerIndex];
+            std::lock_guard<angle::SimpleMutex> lock(self.mutex);
+            std::deque<Task> &taskQueue = self.taskQueues[priority];
+            if (!taskQueue.empty())
+            {
+                *taskOut = std::move(taskQueue.front());
+                taskQueue.pop_front();
+                mPendingTaskCount.fetch_sub(1);
+                return true;
+            }
+        }
+
+        // Then try to steal from the other threads before looking at lower priority tasks.
+        for (size_t offset = 1; offset < workerCount; ++offset)
+        {
+            Worker &victim = *mWorkers[(workerIndex + offset) % workerCount];
+            std::lock_guard<angle::SimpleMutex> lock(victim.mutex);
+            std::deque<Task> &taskQueue = victim.taskQueues[priority];
+            if (!taskQueue.empty())
+            {
+                *taskOut = std::move(taskQueue.back());
+                taskQueue.pop_back();
+                mPendingTaskCount.fetch_sub(1);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool WorkStealingWorkerPool::waitForTasks()
+{
+    std::unique_lock<std::mutex> lock(mParkMutex);
+    mParkedThreadCount.fetch_add(1);
+    mParkCondVar.wait(lock, [this] { return mPendingTaskCount.load() > 0 || mTerminated; });
+    mParkedThreadCount.fetch_sub(1);
+    return !mTerminated;
+}
+
+void WorkStealingWorkerPool::threadLoop(size_t workerIndex)
+{
+    angle::SetCurrentThreadName("ANGLE-Worker");
+
+    gCurrentWorkerPool  = this;
+    gCurrentWorkerIndex = workerIndex;
+
+    while (!mTerminated)
+    {
+        Task task;
+        if (!popTask(workerIndex, &task))
+        {
+            if (!waitForTasks())
+            {
+                break;
+            }
+            continue;
+        }
+
+        auto &waitable = task.first;
+        auto &closure  = task.second;
+
+        // Note: always add an ANGLE_TRACE_EVENT* macro in the closure.  Then the job will show up
+        // in traces.
+        (*closure)();
+        // Release shared_ptr<Closure> before notifying the event to allow for destructor based
+        // dependencies (example: anglebug.com/42267099)
+        closure.reset();
+        waitable->markAsReady();
+    }
+
+    gCurrentWorkerPool = nullptr;
+}
+
+bool WorkStealingWorkerPool::isAsync()
+{
+    return true;
+}
+
+size_t WorkStealingWorkerPool::getEnqueuedTaskCount()
+{
+    return mPendingTaskCount.load(std::memory_order_relaxed);
+}
+
 #endif  // ANGLE_STD_ASYNC_WORKERS
 
 #if ANGLE_DELEGATE_WORKERS
@@ -312,7 +627,7 @@ std::shared_ptr<WorkerThreadPool> WorkerThreadPool::Create(ThreadPoolType type,
 #if ANGLE_DELEGATE_WORKERS
     ASSERT(platform);
     const bool hasPostWorkerTaskImpl = platform->postWorkerTask != nullptr;
-    if (hasPostWorkerTaskImpl && type == ThreadPoolType::Asynchronous)
+    if (hasPostWorkerTaskImpl && type != ThreadPoolType::Synchronous)
     {
         pool = std::make_shared<DelegateWorkerPool>(platform);
     }
@@ -323,6 +638,11 @@ std::shared_ptr<WorkerThreadPool> WorkerThreadPool::Create(ThreadPoolType type,
         pool = std::make_shared<AsyncWorkerPool>(
             numThreads == 0 ? std::thread::hardware_concurrency() : numThreads);
     }
+    if (!pool && type == ThreadPoolType::WorkStealing)
+    {
+        pool = std::make_shared<WorkStealingWorkerPool>(
+            numThreads == 0 ? std::thread::hardware_concurrency() : numThreads);
+    }
 #endif
     if (!pool)
     {
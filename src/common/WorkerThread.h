@@ -92,6 +92,10 @@ class AsyncWaitableEvent final : public WaitableEvent
     void markAsReady();
     void markAsAborted();
 
+    // Returns the event to the unsignaled state so that it can be reused.  Only valid when no one
+    // else holds a reference to the event.
+    void reset();
+
   private:
     // To protect the concurrent accesses from both main thread and background
     // threads to the member fields.
@@ -106,6 +110,21 @@ enum class ThreadPoolType
 {
     Asynchronous = 0,
     Synchronous  = 1,
+    WorkStealing = 2,
+};
+
+// Priority of a task posted to the pool.  Pools that support priorities run all pending High
+// priority tasks before Normal ones, and Normal before Low.  Other pools ignore the priority.
+enum class WorkerTaskPriority : uint8_t
+{
+    // Work that the application is likely to block on soon, such as compile and link.
+    High = 0,
+    Normal,
+    // Background work, such as pipeline warming and cache compression.
+    Low,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
 };
 
 // Request WorkerThreads from the WorkerThreadPool. Each pool can keep worker threads around so
@@ -127,6 +146,11 @@ class WorkerThreadPool : angle::NonCopyable
     //
     // If <type> is Synchronous, the pool has no additional threads and tasks are executed
     // inline on the calling thread.
+    //
+    // If <type> is WorkStealing, <numThreads> threads are spawned as with Asynchronous, but each
+    // thread owns a set of per-priority task deques.  Idle threads steal from busy ones, and
+    // tasks are prioritized according to WorkerTaskPriority.  When angle_delegate_workers is
+    // enabled, this behaves like Asynchronous.
     static std::shared_ptr<WorkerThreadPool> Create(ThreadPoolType type,
                                                     size_t numThreads,
                                                     PlatformMethods *platform);
@@ -135,6 +159,15 @@ class WorkerThreadPool : angle::NonCopyable
     // returns null.  This function is thread-safe.
     virtual std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) = 0;
 
+    // Same as postWorkerTask, but lets pools that support it schedule the task according to
+    // <priority>.  This function is thread-safe.
+    virtual std::shared_ptr<WaitableEvent> postWorkerTaskWithPriority(
+        const std::shared_ptr<Closure> &task,
+        WorkerTaskPriority priority)
+    {
+        return postWorkerTask(task);
+    }
+
     virtual bool isAsync() = 0;
 
     virtual size_t getEnqueuedTaskCount() { return 0; }
@@ -8,6 +8,8 @@
 
 #include <gtest/gtest.h>
 #include <array>
+#include <atomic>
+#include <thread>
 
 #include "common/WorkerThread.h"
 
@@ -27,9 +29,10 @@ TEST(WorkerPoolTest, SimpleTask)
         bool fired = false;
     };
 
-    std::array<std::shared_ptr<WorkerThreadPool>, 2> pools = {
+    std::array<std::shared_ptr<WorkerThreadPool>, 3> pools = {
         {WorkerThreadPool::Create(ThreadPoolType::Synchronous, 0, ANGLEPlatformCurrent()),
-         WorkerThreadPool::Create(ThreadPoolType::Asynchronous, 0, ANGLEPlatformCurrent())}};
+         WorkerThreadPool::Create(ThreadPoolType::Asynchronous, 0, ANGLEPlatformCurrent()),
+         WorkerThreadPool::Create(ThreadPoolType::WorkStealing, 0, ANGLEPlatformCurrent())}};
     for (auto &pool : pools)
     {
         std::array<std::shared_ptr<TestTask>, 4> tasks = {
@@ -122,4 +125,117 @@ TEST(WorkerPoolTest, AsyncPoolWithOneThreadTest)
     EXPECT_EQ(callCount, kTaskCount * kCallbackSteps);
 }
 
+// Tests that the work-stealing pool runs many tasks posted from multiple threads, and that the
+// waitable events it recycles are not signaled prematurely.
+TEST(WorkerPoolTest, WorkStealingPoolManyTasks)
+{
+    class TestTask : public Closure
+    {
+      public:
+        TestTask(std::atomic<size_t> *counter) : mCounter(counter) {}
+        void operator()() override { mCounter->fetch_add(1); }
+
+      private:
+        std::atomic<size_t> *mCounter;
+    };
+
+    std::shared_ptr<WorkerThreadPool> pool =
+        WorkerThreadPool::Create(ThreadPoolType::WorkStealing, 4, ANGLEPlatformCurrent());
+
+    constexpr size_t kPosterCount    = 4;
+    constexpr size_t kTasksPerPoster = 1000;
+
+    constexpr WorkerTaskPriority kPriorities[] = {
+        WorkerTaskPriority::High, WorkerTaskPriority::Normal, WorkerTaskPriority::Low};
+    std::atomic<size_t> counter(0);
+
+    std::array<std::thread, kPosterCount> posters;
+    for (std::thread &poster : posters)
+    {
+        poster = std::thread([&]() {
+            std::vector<std::shared_ptr<WaitableEvent>> waitables;
+            for (size_t taskIndex = 0; taskIndex < kTasksPerPoster; ++taskIndex)
+            {
+                waitables.push_back(pool->postWorkerTaskWithPriority(
+                    std::make_shared<TestTask>(&counter), kPriorities[taskIndex % 3]));
+            }
+            WaitableEvent::WaitMany(&waitables);
+        });
+    }
+    for (std::thread &poster : posters)
+    {
+        poster.join();
+    }
+
+    EXPECT_EQ(counter.load(), kPosterCount * kTasksPerPoster);
+    EXPECT_EQ(pool->getEnqueuedTaskCount(), 0u);
+}
+
+// Tests that the work-stealing pool runs higher priority tasks first.
+TEST(WorkerPoolTest, WorkStealingPoolPriority)
+{
+    std::shared_ptr<WorkerThreadPool> pool =
+        WorkerThreadPool::Create(ThreadPoolType::WorkStealing, 1, ANGLEPlatformCurrent());
+
+    // Block the only thread so that the following tasks are all queued before any of them runs.
+    class BlockingTask : public Closure
+    {
+      public:
+        void operator()() override
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condVar.wait(lock, [this] { return released; });
+        }
+
+        std::mutex mutex;
+        std::condition_variable condVar;
+        bool released = false;
+    };
+
+    class OrderTask : public Closure
+    {
+      public:
+        OrderTask(std::vector<WorkerTaskPriority> *order, WorkerTaskPriority priority)
+            : mOrder(order), mPriority(priority)
+        {}
+        void operator()() override { mOrder->push_back(mPriority); }
+
+      private:
+        std::vector<WorkerTaskPriority> *mOrder;
+        WorkerTaskPriority mPriority;
+    };
+
+    auto blockingTask = std::make_shared<BlockingTask>();
+    std::vector<std::shared_ptr<WaitableEvent>> waitables;
+    waitables.push_back(pool->postWorkerTask(blockingTask));
+
+    // Wait for the blocking task to be picked up.
+    while (pool->getEnqueuedTaskCount() != 0)
+    {
+        std::this_thread::yield();
+    }
+
+    std::vector<WorkerTaskPriority> order;
+    constexpr WorkerTaskPriority kPostOrder[] = {WorkerTaskPriority::Low,
+                                                 WorkerTaskPriority::Normal,
+                                                 WorkerTaskPriority::High};
+    for (WorkerTaskPriority priority : kPostOrder)
+    {
+        waitables.push_back(pool->postWorkerTaskWithPriority(
+            std::make_shared<OrderTask>(&order, priority), priority));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(blockingTask->mutex);
+        blockingTask->released = true;
+    }
+    blockingTask->condVar.notify_one();
+
+    WaitableEvent::WaitMany(&waitables);
+
+    const std::vector<WorkerTaskPriority> kExpectedOrder = {
+        WorkerTaskPriority::High, WorkerTaskPriority::Normal, WorkerTaskPriority::Low};
+    EXPECT_EQ(order, kExpectedOrder);
+}
+
 }  // anonymous namespace
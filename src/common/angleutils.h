@@ -160,6 +160,9 @@ struct PerfMonitorTriplet
     FN(allocateNewBufferBlockCalls)                \
     FN(bufferSuballocationCalls)                   \
     FN(framebufferCacheSize)                       \
+    FN(vertexConversionCacheHits)                  \
+    FN(vertexConversionCacheMisses)                \
+    FN(vertexConversionCacheTotalSize)             \
     FN(pendingSubmissionGarbageObjects)            \
     FN(graphicsDriverUniformsUpdated)
 
@@ -0,0 +1,261 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// lz_utils.cpp: A fast LZ77 byte compressor.
+
+#include "common/lz_utils.h"
+
+#include <array>
+
+#include "common/debug.h"
+#include "common/span_util.h"
+
+namespace angle
+{
+namespace
+{
+constexpr size_t kMinMatch = 4;
+// The format requires the last bytes of the input to be literals.
+constexpr size_t kLastLiterals = 5;
+// Matches aren't started this close to the end of the input.
+constexpr size_t kMatchSafeDistance = kMinMatch + kLastLiterals + 3;
+constexpr size_t kMaxOffset         = 65535;
+constexpr size_t kLengthMask        = 15;
+constexpr uint32_t kHashBits        = 14;
+
+uint32_t Read32(angle::Span<const uint8_t> data, size_t pos)
+{
+    return static_cast<uint32_t>(data[pos]) | static_cast<uint32_t>(data[pos + 1]) << 8 |
+           static_cast<uint32_t>(data[pos + 2]) << 16 | static_cast<uint32_t>(data[pos + 3]) << 24;
+}
+
+uint32_t HashSequence(uint32_t sequence)
+{
+    // Knuth's multiplicative hash.
+    return (sequence * 2654435761u) >> (32 - kHashBits);
+}
+
+// Writes the continuation bytes of a length that didn't fit in the token's 4 bits.
+bool WriteLengthExtension(size_t length, angle::Span<uint8_t> output, size_t *outPos)
+{
+    ASSERT(length >= kLengthMask);
+    length -= kLengthMask;
+    while (true)
+    {
+        if (*outPos >= output.size())
+        {
+            return false;
+        }
+        const uint8_t byte  = static_cast<uint8_t>(std::min<size_t>(length, 255));
+        output[(*outPos)++] = byte;
+        if (byte != 255)
+        {
+            return true;
+        }
+        length -= 255;
+    }
+}
+
+bool ReadLengthExtension(angle::Span<const uint8_t> input, size_t *inPos, size_t *lengthInOut)
+{
+    while (true)
+    {
+        if (*inPos >= input.size())
+        {
+            return false;
+        }
+        const uint8_t byte = input[(*inPos)++];
+        *lengthInOut += byte;
+        if (byte != 255)
+        {
+            return true;
+        }
+    }
+}
+
+// Writes a sequence of literals, followed by a match unless |matchLength| is 0.
+bool WriteSequence(angle::Span<const uint8_t> literals,
+                   size_t matchOffset,
+                   size_t matchLength,
+                   angle::Span<uint8_t> output,
+                   size_t *outPos)
+{
+    if (*outPos >= output.size())
+    {
+        return false;
+    }
+
+    const size_t literalLength = literals.size();
+    const size_t matchCode     = matchLength == 0 ? 0 : matchLength - kMinMatch;
+
+    const uint8_t token = static_cast<uint8_t>(std::min(literalLength, kLengthMask) << 4 |
+                                               std::min(matchCode, kLengthMask));
+    output[(*outPos)++] = token;
+
+    if (literalLength >= kLengthMask && !WriteLengthExtension(literalLength, output, outPos))
+    {
+        return false;
+    }
+
+    if (output.size() - *outPos < literalLength)
+    {
+        return false;
+    }
+    SpanMemcpy(output.subspan(*outPos, literalLength), literals);
+    *outPos += literalLength;
+
+    if (matchLength == 0)
+    {
+        return true;
+    }
+
+    if (output.size() - *outPos < 2)
+    {
+        return false;
+    }
+    output[(*outPos)++] = static_cast<uint8_t>(matchOffset & 0xFF);
+    output[(*outPos)++] = static_cast<uint8_t>(matchOffset >> 8);
+
+    return matchCode < kLengthMask || WriteLengthExtension(matchCode, output, outPos);
+}
+}  // anonymous namespace
+
+size_t LZCompressBound(size_t inputSize)
+{
+    return inputSize + inputSize / 255 + 16;
+}
+
+size_t LZCompress(angle::Span<const uint8_t> input, angle::Span<uint8_t> output)
+{
+    const size_t inputSize = input.size();
+    size_t outPos          = 0;
+    size_t anchor          = 0;
+
+    if (inputSize > kMatchSafeDistance)
+    {
+        // Positions of the last sequence seen with each hash, offset by one so that 0 means none.
+        std::array<uint32_t, 1 << kHashBits> hashTable = {};
+
+        const size_t matchLimit = inputSize - kLastLiterals;
+        const size_t searchEnd  = inputSize - kMatchSafeDistance;
+        size_t pos              = 0;
+
+        while (pos < searchEnd)
+        {
+            const uint32_t sequence = Read32(input, pos);
+            const uint32_t hash     = HashSequence(sequence);
+            const size_t candidate  = hashTable[hash];
+            hashTable[hash]         = static_cast<uint32_t>(pos + 1);
+
+            if (candidate == 0 || pos - (candidate - 1) > kMaxOffset ||
+                Read32(input, candidate - 1) != sequence)
+            {
+                ++pos;
+                continue;
+            }
+
+            // Extend the match forward and backward.
+            size_t matchStart = candidate - 1;
+            size_t matchEnd   = pos + kMinMatch;
+            while (matchEnd < matchLimit && input[matchEnd] == input[matchStart + (matchEnd - pos)])
+            {
+                ++matchEnd;
+            }
+            while (pos > anchor && matchStart > 0 && input[pos - 1] == input[matchStart - 1])
+            {
+                --pos;
+                --matchStart;
+            }
+
+            if (!WriteSequence(input.subspan(anchor, pos - anchor), pos - matchStart,
+                               matchEnd - pos, output, &outPos))
+            {
+                return 0;
+            }
+
+            pos    = matchEnd;
+            anchor = pos;
+        }
+    }
+
+    // The remaining bytes are emitted as literals.
+    if (!WriteSequence(input.subspan(anchor), 0, 0, output, &outPos))
+    {
+        return 0;
+    }
+
+    return outPos;
+}
+
+bool LZDecompress(angle::Span<const uint8_t> input, angle::Span<uint8_t> output)
+{
+    size_t inPos  = 0;
+    size_t outPos = 0;
+
+    while (inPos < input.size())
+    {
+        const uint8_t token = input[inPos++];
+
+        size_t literalLength = token >> 4;
+        if (literalLength == kLengthMask && !ReadLengthExtension(input, &inPos, &literalLength))
+        {
+            return false;
+        }
+        if (input.size() - inPos < literalLength || output.size() - outPos < literalLength)
+        {
+            return false;
+        }
+        SpanMemcpy(output.subspan(outPos, literalLength), input.subspan(inPos, literalLength));
+        inPos += literalLength;
+        outPos += literalLength;
+
+        // The last sequence has no match.
+        if (inPos == input.size())
+        {
+            break;
+        }
+
+        if (input.size() - inPos < 2)
+        {
+            return false;
+        }
+        const size_t offset = input[inPos] | static_cast<size_t>(input[inPos + 1]) << 8;
+        inPos += 2;
+        if (offset == 0 || offset > outPos)
+        {
+            return false;
+        }
+
+        size_t matchLength = token & kLengthMask;
+        if (matchLength == kLengthMask && !ReadLengthExtension(input, &inPos, &matchLength))
+        {
+            return false;
+        }
+        matchLength += kMinMatch;
+        if (output.size() - outPos < matchLength)
+        {
+            return false;
+        }
+
+        // The match may overlap the bytes being written, in which case it repeats a pattern.
+        const size_t matchStart = outPos - offset;
+        if (offset >= matchLength)
+        {
+            SpanMemcpy(output.subspan(outPos, matchLength),
+                       output.subspan(matchStart, matchLength));
+        }
+        else
+        {
+            for (size_t i = 0; i < matchLength; ++i)
+            {
+                output[outPos + i] = output[matchStart + i];
+            }
+        }
+        outPos += matchLength;
+    }
+
+    return outPos == output.size();
+}
+}  // namespace angle
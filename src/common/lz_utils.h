@@ -0,0 +1,33 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// lz_utils.h: A fast LZ77 byte compressor, used where compression speed matters more than ratio.
+//   The format is the LZ4 block format: a sequence of (literals, match) pairs, each starting with
+//   a token byte holding the literal and match lengths, with a 16-bit match offset.  It carries
+//   no header; the caller is responsible for storing the uncompressed size.
+
+#ifndef COMMON_LZ_UTILS_H_
+#define COMMON_LZ_UTILS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/span.h"
+
+namespace angle
+{
+// Returns the output size needed to compress |inputSize| bytes in the worst case.
+size_t LZCompressBound(size_t inputSize);
+
+// Compresses |input| into |output|.  Returns the compressed size, or 0 if |output| is too small.
+// An output of LZCompressBound(input.size()) bytes is always large enough.
+size_t LZCompress(angle::Span<const uint8_t> input, angle::Span<uint8_t> output);
+
+// Decompresses |input| into |output|, which must be exactly the size of the uncompressed data.
+// Returns false if the input is malformed, truncated or doesn't fill |output| exactly.
+bool LZDecompress(angle::Span<const uint8_t> input, angle::Span<uint8_t> output);
+}  // namespace angle
+
+#endif  // COMMON_LZ_UTILS_H_
@@ -0,0 +1,140 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// lz_utils_unittest:
+//   Tests for the fast LZ compressor.
+//
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "common/lz_utils.h"
+
+namespace angle
+{
+namespace
+{
+std::vector<uint8_t> Compress(const std::vector<uint8_t> &input)
+{
+    std::vector<uint8_t> compressed(LZCompressBound(input.size()));
+    const size_t compressedSize = LZCompress(input, compressed);
+    EXPECT_NE(compressedSize, 0u);
+    compressed.resize(compressedSize);
+    return compressed;
+}
+
+void ExpectRoundTrip(const std::vector<uint8_t> &input)
+{
+    std::vector<uint8_t> compressed = Compress(input);
+
+    std::vector<uint8_t> decompressed(input.size());
+    EXPECT_TRUE(LZDecompress(compressed, decompressed));
+    EXPECT_EQ(input, decompressed);
+}
+
+std::vector<uint8_t> MakeRandomData(size_t size, uint32_t seed)
+{
+    std::mt19937 generator(seed);
+    std::vector<uint8_t> data(size);
+    for (uint8_t &byte : data)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+    return data;
+}
+
+// A mix of random runs and repeats at various distances, similar to serialized shaders.
+std::vector<uint8_t> MakeCompressibleData(size_t size)
+{
+    std::vector<uint8_t> data = MakeRandomData(size, 1);
+    for (size_t pos = 1024; pos + 300 < size; pos += 1000)
+    {
+        const size_t distance = (pos * 7) % 70000 + 1;
+        for (size_t i = 0; i < 300 && distance <= pos; ++i)
+        {
+            data[pos + i] = data[pos + i - distance];
+        }
+    }
+    return data;
+}
+
+// Tests round trips of small and empty inputs.
+TEST(LZUtilsTest, SmallInputs)
+{
+    for (size_t size = 0; size < 64; ++size)
+    {
+        ExpectRoundTrip(MakeRandomData(size, static_cast<uint32_t>(size)));
+        ExpectRoundTrip(std::vector<uint8_t>(size, 0xAB));
+    }
+}
+
+// Tests round trips of incompressible data, which must fit in the bound.
+TEST(LZUtilsTest, RandomData)
+{
+    ExpectRoundTrip(MakeRandomData(100'000, 2));
+}
+
+// Tests round trips of data with long runs and overlapping matches.
+TEST(LZUtilsTest, RepetitiveData)
+{
+    std::vector<uint8_t> data(100'000, 7);
+    std::vector<uint8_t> compressed = Compress(data);
+    EXPECT_LT(compressed.size(), data.size() / 100);
+    ExpectRoundTrip(data);
+
+    // A short repeated pattern exercises overlapping matches.
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i % 3);
+    }
+    ExpectRoundTrip(data);
+
+    ExpectRoundTrip(MakeCompressibleData(300'000));
+}
+
+// Tests that compression fails cleanly if the output is too small.
+TEST(LZUtilsTest, OutputTooSmall)
+{
+    const std::vector<uint8_t> input = MakeRandomData(1000, 3);
+    std::vector<uint8_t> compressed(input.size() / 2);
+    EXPECT_EQ(LZCompress(input, compressed), 0u);
+}
+
+// Tests that malformed input is rejected.
+TEST(LZUtilsTest, MalformedInput)
+{
+    const std::vector<uint8_t> input = MakeCompressibleData(10'000);
+    const std::vector<uint8_t> compressed = Compress(input);
+    std::vector<uint8_t> decompressed(input.size());
+
+    // Truncated input.
+    for (size_t size : {size_t(0), size_t(1), compressed.size() / 2, compressed.size() - 1})
+    {
+        const std::vector<uint8_t> truncated(compressed.begin(), compressed.begin() + size);
+        EXPECT_FALSE(LZDecompress(truncated, decompressed));
+    }
+
+    // Wrong output size.
+    std::vector<uint8_t> tooSmall(input.size() - 1);
+    EXPECT_FALSE(LZDecompress(compressed, tooSmall));
+    std::vector<uint8_t> tooLarge(input.size() + 1);
+    EXPECT_FALSE(LZDecompress(compressed, tooLarge));
+
+    // A match that refers to before the start of the output.
+    const std::vector<uint8_t> badOffset = {0x10, 'a', 0x10, 0x00, 0x00};
+    std::vector<uint8_t> output(5);
+    EXPECT_FALSE(LZDecompress(badOffset, output));
+
+    // Random garbage must not crash.
+    for (uint32_t seed = 0; seed < 100; ++seed)
+    {
+        (void)LZDecompress(MakeRandomData(200, seed), decompressed);
+    }
+}
+
+}  // anonymous namespace
+}  // namespace angle
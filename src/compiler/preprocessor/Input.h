@@ -39,6 +39,7 @@ class Input
         Location() : sIndex(0), cIndex(0) {}
     };
     const Location &readLoc() const { return mReadLoc; }
+    void setReadLoc(const Location &location) { mReadLoc = location; }
 
   private:
     // Skip a character and return the next character after the one that was skipped.
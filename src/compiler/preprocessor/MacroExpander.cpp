@@ -209,7 +209,7 @@ void MacroExpander::getToken(Token *token)
 
     if (!mContextStack.empty())
     {
-        *token = mContextStack.back().get();
+        mContextStack.back().get(token);
     }
     else
     {
@@ -224,7 +224,7 @@ void MacroExpander::ungetToken(const Token &token)
     {
         MacroContext &context = mContextStack.back();
         context.unget();
-        ASSERT(context.replacements[context.index] == token);
+        ASSERT(context.peek() == token);
     }
     else
     {
@@ -252,14 +252,16 @@ bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identif
     ASSERT(identifier.text == macro->name);
 
     std::vector<Token> replacements;
-    if (!expandMacro(*macro, identifier, &replacements))
+    SourceLocation replacementLocation;
+    if (!expandMacro(*macro, identifier, &replacements, &replacementLocation))
         return false;
 
     // Macro is disabled for expansion until it is popped off the stack.
     macro->disabled = true;
 
-    mTotalTokensInContexts += replacements.size();
-    mContextStack.emplace_back(std::move(macro), std::move(replacements));
+    mContextStack.emplace_back(std::move(macro), std::move(replacements), identifier,
+                               replacementLocation);
+    mTotalTokensInContexts += mContextStack.back().tokens().size();
     return true;
 }
 
@@ -282,12 +284,13 @@ void MacroExpander::popMacro()
         context.macro->disabled = false;
     }
     context.macro->expansionCount--;
-    mTotalTokensInContexts -= context.replacements.size();
+    mTotalTokensInContexts -= context.tokens().size();
 }
 
 bool MacroExpander::expandMacro(const Macro &macro,
                                 const Token &identifier,
-                                std::vector<Token> *replacements)
+                                std::vector<Token> *replacements,
+                                SourceLocation *replacementLocation)
 {
     replacements->clear();
 
@@ -295,16 +298,16 @@ bool MacroExpander::expandMacro(const Macro &macro,
     // from the identifier, but in the case of a function-like macro, the replacement
     // list gets its location from the closing parenthesis of the macro invocation.
     // This is tested by dEQP-GLES3.functional.shaders.preprocessor.predefined_macros.*
-    SourceLocation replacementLocation = identifier.location;
+    *replacementLocation = identifier.location;
     if (macro.type == Macro::kTypeObj)
     {
-        replacements->assign(macro.replacements.begin(), macro.replacements.end());
-
+        // The replacement list of other object-like macros is read in place by the context.
         if (macro.predefined)
         {
             const char kLine[] = "__LINE__";
             const char kFile[] = "__FILE__";
 
+            replacements->assign(macro.replacements.begin(), macro.replacements.end());
             ASSERT(replacements->size() == 1);
             Token &repl = replacements->front();
             if (macro.name == kLine)
@@ -322,24 +325,11 @@ bool MacroExpander::expandMacro(const Macro &macro,
         ASSERT(macro.type == Macro::kTypeFunc);
         std::vector<MacroArg> args;
         args.reserve(macro.parameters.size());
-        if (!collectMacroArgs(macro, identifier, &args, &replacementLocation))
+        if (!collectMacroArgs(macro, identifier, &args, replacementLocation))
             return false;
 
         replaceMacroParams(macro, args, replacements);
     }
-
-    for (std::size_t i = 0; i < replacements->size(); ++i)
-    {
-        Token &repl = replacements->at(i);
-        if (i == 0)
-        {
-            // The first token in the replacement list inherits the padding
-            // properties of the identifier token.
-            repl.setAtStartOfLine(identifier.atStartOfLine());
-            repl.setHasLeadingSpace(identifier.hasLeadingSpace());
-        }
-        repl.location = replacementLocation;
-    }
     return true;
 }
 
@@ -503,14 +493,53 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
     }
 }
 
+MacroExpander::MacroContext::MacroContext(std::shared_ptr<Macro> macroIn,
+                                          std::vector<Token> &&replacementsIn,
+                                          const Token &identifier,
+                                          const SourceLocation &replacementLocation)
+    : macro(std::move(macroIn)),
+      readsMacroReplacements(macro->type == Macro::kTypeObj && !macro->predefined),
+      replacements(std::move(replacementsIn)),
+      location(replacementLocation),
+      atStartOfLine(identifier.atStartOfLine()),
+      hasLeadingSpace(identifier.hasLeadingSpace())
+{
+    ASSERT(!readsMacroReplacements || replacements.empty());
+}
+
+const std::vector<Token> &MacroExpander::MacroContext::tokens() const
+{
+    return readsMacroReplacements ? macro->replacements : replacements;
+}
+
 bool MacroExpander::MacroContext::empty() const
 {
-    return index == replacements.size();
+    return index == tokens().size();
+}
+
+Token MacroExpander::MacroContext::peek() const
+{
+    Token token;
+    copyToken(index, &token);
+    return token;
+}
+
+void MacroExpander::MacroContext::get(Token *token)
+{
+    copyToken(index++, token);
 }
 
-const Token &MacroExpander::MacroContext::get()
+void MacroExpander::MacroContext::copyToken(std::size_t tokenIndex, Token *token) const
 {
-    return replacements[index++];
+    *token          = tokens()[tokenIndex];
+    token->location = location;
+    if (tokenIndex == 0)
+    {
+        // The first token in the replacement list inherits the padding
+        // properties of the identifier token.
+        token->setAtStartOfLine(atStartOfLine);
+        token->setHasLeadingSpace(hasLeadingSpace);
+    }
 }
 
 void MacroExpander::MacroContext::unget()
@@ -44,7 +44,10 @@ class MacroExpander : public Lexer
     bool pushMacro(std::shared_ptr<Macro> macro, const Token &identifier);
     void popMacro();
 
-    bool expandMacro(const Macro &macro, const Token &identifier, std::vector<Token> *replacements);
+    bool expandMacro(const Macro &macro,
+                     const Token &identifier,
+                     std::vector<Token> *replacements,
+                     SourceLocation *replacementLocation);
 
     typedef std::vector<Token> MacroArg;
     bool collectMacroArgs(const Macro &macro,
@@ -57,15 +60,27 @@ class MacroExpander : public Lexer
 
     struct MacroContext
     {
-        MacroContext(std::shared_ptr<Macro> macro, std::vector<Token> &&replacements)
-            : macro(std::move(macro)), replacements(std::move(replacements))
-        {}
+        MacroContext(std::shared_ptr<Macro> macro,
+                     std::vector<Token> &&replacements,
+                     const Token &identifier,
+                     const SourceLocation &replacementLocation);
+        const std::vector<Token> &tokens() const;
         bool empty() const;
-        const Token &get();
+        Token peek() const;
+        void get(Token *token);
         void unget();
+        void copyToken(std::size_t tokenIndex, Token *token) const;
 
         std::shared_ptr<Macro> macro;
+        // The replacement list of an object-like macro is read in place instead of being copied for
+        // every invocation, and replacements is left empty.
+        bool readsMacroReplacements;
         std::vector<Token> replacements;
+        // Every token gets its location from the invocation, and the first token also gets the
+        // padding of the identifier.
+        SourceLocation location;
+        bool atStartOfLine;
+        bool hasLeadingSpace;
         std::size_t index = 0;
     };
 
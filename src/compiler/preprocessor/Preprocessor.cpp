@@ -7,6 +7,7 @@
 #include "compiler/preprocessor/Preprocessor.h"
 
 #include "common/debug.h"
+#include "common/system_utils.h"
 #include "compiler/preprocessor/DiagnosticsBase.h"
 #include "compiler/preprocessor/DirectiveParser.h"
 #include "compiler/preprocessor/Macro.h"
@@ -35,13 +36,15 @@ struct PreprocessorImpl
           tokenizer(diag),
           directiveParser(&tokenizer, &macroSet, diag, directiveHandler, settings),
           macroExpander(&directiveParser, &macroSet, diag, settings, false)
-    {}
+    {
+        tokenizer.setTokenStreamCacheMinStringLength(settings.tokenStreamCacheMinStringLength);
+    }
 };
 
 Preprocessor::Preprocessor(Diagnostics *diagnostics,
                            DirectiveHandler *directiveHandler,
                            const PreprocessorSettings &settings)
-    : mForceEOF(false)
+    : mForceEOF(false), mMeasureLexTime(settings.measureLexTime), mLexTimeNs(0)
 {
     mImpl = new PreprocessorImpl(diagnostics, directiveHandler, settings);
 }
@@ -67,6 +70,19 @@ void Preprocessor::predefineMacro(const char *name, int value)
 }
 
 void Preprocessor::lex(Token *token)
+{
+    if (!mMeasureLexTime)
+    {
+        lexToken(token);
+        return;
+    }
+
+    const uint64_t startTimeNs = GetCurrentSystemTimeNs();
+    lexToken(token);
+    mLexTimeNs += GetCurrentSystemTimeNs() - startTimeNs;
+}
+
+void Preprocessor::lexToken(Token *token)
 {
     if (mForceEOF)
     {
@@ -34,7 +34,9 @@ struct PreprocessorSettings final
     PreprocessorSettings(ShShaderSpec shaderSpec, WebGLExtensionDisableBehavior disableBehavior)
         : maxMacroExpansionDepth(1000),
           shaderSpec(shaderSpec),
-          webglExtensionDisableBehavior(disableBehavior)
+          webglExtensionDisableBehavior(disableBehavior),
+          tokenStreamCacheMinStringLength(0),
+          measureLexTime(false)
     {}
 
     PreprocessorSettings(const PreprocessorSettings &other) = default;
@@ -42,6 +44,11 @@ struct PreprocessorSettings final
     int maxMacroExpansionDepth;
     ShShaderSpec shaderSpec;
     WebGLExtensionDisableBehavior webglExtensionDisableBehavior;
+    // Leading strings at least this long are lexed once per process and their tokens are reused by
+    // later shaders. 0 disables the cache.
+    size_t tokenStreamCacheMinStringLength;
+    // Whether lex() accumulates the time it takes, to be queried with getLexTimeNs().
+    bool measureLexTime;
 };
 
 class Preprocessor : angle::NonCopyable
@@ -72,9 +79,16 @@ class Preprocessor : angle::NonCopyable
 
     void forceEOF();
 
+    // The total time spent in lex(), if PreprocessorSettings::measureLexTime is set.
+    uint64_t getLexTimeNs() const { return mLexTimeNs; }
+
   private:
+    void lexToken(Token *token);
+
     PreprocessorImpl *mImpl;
     bool mForceEOF;
+    bool mMeasureLexTime;
+    uint64_t mLexTimeNs;
 };
 
 }  // namespace pp
@@ -0,0 +1,240 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TokenStreamCache.cpp: Implements the process-wide cache of lexed strings and their replay.
+//
+
+#include "compiler/preprocessor/TokenStreamCache.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <string_view>
+
+#include "common/SimpleMutex.h"
+#include "common/base/anglebase/no_destructor.h"
+#include "common/debug.h"
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/Tokenizer.h"
+
+namespace angle
+{
+
+namespace pp
+{
+
+namespace
+{
+
+// Shaders usually share a handful of prologues.
+constexpr size_t kMaxCachedTokenStreams = 16;
+
+struct TokenStreamCacheEntry
+{
+    size_t hash;
+    std::shared_ptr<const TokenStream> stream;
+};
+
+struct TokenStreamCacheStorage
+{
+    angle::SimpleMutex mutex;
+    // Ordered from least to most recently used.
+    std::vector<TokenStreamCacheEntry> entries;
+};
+
+TokenStreamCacheStorage &GetTokenStreamCacheStorage()
+{
+    static angle::base::NoDestructor<TokenStreamCacheStorage> sStorage;
+    return *sStorage;
+}
+
+class RecordingDiagnostics : public Diagnostics
+{
+  public:
+    bool hasReports() const { return mHasReports; }
+
+  protected:
+    void print(ID id, const SourceLocation &loc, const std::string &text) override
+    {
+        mHasReports = true;
+    }
+
+  private:
+    bool mHasReports = false;
+};
+
+// A string can be lexed on its own if it ends on a line break outside of any comment, and has no
+// line continuations, which would make the line numbers run ahead of the tokens.
+bool CanLexOnItsOwn(const char *string, size_t length)
+{
+    return length > 0 && length <= static_cast<size_t>(INT_MAX) &&
+           ANGLE_UNSAFE_TODO(string[length - 1]) == '\n' &&
+           std::memchr(string, '\\', length) == nullptr;
+}
+
+std::shared_ptr<TokenStream> LexOnItsOwn(const char *string, size_t length)
+{
+    auto stream = std::make_shared<TokenStream>();
+    stream->source.assign(string, length);
+
+    if (!CanLexOnItsOwn(string, length))
+    {
+        return stream;
+    }
+
+    RecordingDiagnostics diagnostics;
+    Tokenizer tokenizer(&diagnostics);
+    const int stringLength = static_cast<int>(length);
+    if (!tokenizer.init(1, &string, &stringLength))
+    {
+        return stream;
+    }
+    tokenizer.setMaxTokenSize(std::numeric_limits<size_t>::max());
+
+    Token token;
+    for (tokenizer.lex(&token); token.type != Token::LAST; tokenizer.lex(&token))
+    {
+        stream->maxTokenLength = std::max(stream->maxTokenLength, token.text.size());
+        stream->tokenEnds.push_back(tokenizer.scanLocation().cIndex);
+        stream->tokens.push_back(std::move(token));
+    }
+
+    // An unterminated comment is reported at the end of the string.
+    stream->replayable = !diagnostics.hasReports();
+    return stream;
+}
+}  // anonymous namespace
+
+// static
+std::shared_ptr<const TokenStream> TokenStreamCache::Get(const char *string, size_t length)
+{
+    const std::string_view source(string, length);
+    const size_t hash = std::hash<std::string_view>()(source);
+
+    TokenStreamCacheStorage &storage = GetTokenStreamCacheStorage();
+    {
+        std::lock_guard<angle::SimpleMutex> lock(storage.mutex);
+        for (auto iter = storage.entries.begin(); iter != storage.entries.end(); ++iter)
+        {
+            if (iter->hash == hash && iter->stream->source == source)
+            {
+                std::shared_ptr<const TokenStream> stream = iter->stream;
+                std::rotate(iter, iter + 1, storage.entries.end());
+                return stream->replayable ? stream : nullptr;
+            }
+        }
+    }
+
+    // Lex the string outside the lock, so other threads don't wait for it. If several threads lex
+    // the same string, the last one replaces the others' entries.
+    std::shared_ptr<const TokenStream> stream = LexOnItsOwn(string, length);
+
+    std::lock_guard<angle::SimpleMutex> lock(storage.mutex);
+    for (auto iter = storage.entries.begin(); iter != storage.entries.end(); ++iter)
+    {
+        if (iter->hash == hash && iter->stream->source == source)
+        {
+            storage.entries.erase(iter);
+            break;
+        }
+    }
+    if (storage.entries.size() == kMaxCachedTokenStreams)
+    {
+        storage.entries.erase(storage.entries.begin());
+    }
+    storage.entries.push_back({hash, stream});
+    return stream->replayable ? stream : nullptr;
+}
+
+// static
+void TokenStreamCache::Clear()
+{
+    TokenStreamCacheStorage &storage = GetTokenStreamCacheStorage();
+    std::lock_guard<angle::SimpleMutex> lock(storage.mutex);
+    storage.entries.clear();
+}
+
+TokenStreamReplay::TokenStreamReplay()
+    : mMinStringLength(0), mActive(false), mStringIndex(0), mTokenIndex(0)
+{}
+
+TokenStreamReplay::~TokenStreamReplay() {}
+
+void TokenStreamReplay::init(const Input &input)
+{
+    mStreams.clear();
+    mStringIndex = 0;
+    mTokenIndex  = 0;
+
+    if (mMinStringLength > 0)
+    {
+        for (size_t index = 0; index + 1 < input.count(); ++index)
+        {
+            if (input.length(index) < mMinStringLength)
+            {
+                break;
+            }
+            std::shared_ptr<const TokenStream> stream =
+                TokenStreamCache::Get(input.string(index), input.length(index));
+            if (!stream)
+            {
+                break;
+            }
+            mStreams.push_back(std::move(stream));
+        }
+    }
+
+    mActive = !mStreams.empty();
+}
+
+bool TokenStreamReplay::lex(Token *token, size_t maxTokenSize)
+{
+    if (!mActive)
+    {
+        return false;
+    }
+
+    while (mStringIndex < mStreams.size() && mTokenIndex == mStreams[mStringIndex]->tokens.size())
+    {
+        ++mStringIndex;
+        mTokenIndex = 0;
+    }
+    if (mStringIndex == mStreams.size() || mStreams[mStringIndex]->maxTokenLength > maxTokenSize)
+    {
+        return false;
+    }
+
+    *token               = mStreams[mStringIndex]->tokens[mTokenIndex++];
+    token->location.file = static_cast<int>(mStringIndex);
+    return true;
+}
+
+void TokenStreamReplay::stop(Input::Location *location, int *file, int *line)
+{
+    ASSERT(mActive);
+
+    location->sIndex = mStringIndex;
+    location->cIndex = 0;
+    *file            = static_cast<int>(mStringIndex);
+    *line            = 1;
+
+    if (mStringIndex < mStreams.size() && mTokenIndex > 0)
+    {
+        const TokenStream &stream = *mStreams[mStringIndex];
+        const Token &lastToken    = stream.tokens[mTokenIndex - 1];
+        location->cIndex          = stream.tokenEnds[mTokenIndex - 1];
+        *line = lastToken.type == '\n' ? lastToken.location.line + 1 : lastToken.location.line;
+    }
+
+    mActive = false;
+    mStreams.clear();
+}
+
+}  // namespace pp
+
+}  // namespace angle
@@ -0,0 +1,89 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TokenStreamCache.h: A process-wide cache of the tokens of the strings passed to the preprocessor,
+// so that prologues shared by many shaders are only lexed once.
+//
+
+#ifndef COMPILER_PREPROCESSOR_TOKENSTREAMCACHE_H_
+#define COMPILER_PREPROCESSOR_TOKENSTREAMCACHE_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "compiler/preprocessor/Input.h"
+#include "compiler/preprocessor/Token.h"
+
+namespace angle
+{
+
+namespace pp
+{
+
+// The tokens of a string lexed on its own. They are the same wherever the string appears in the
+// input, as long as no token or comment crosses its boundaries and no #line directive changes the
+// locations.
+struct TokenStream
+{
+    std::string source;
+    std::vector<Token> tokens;
+    // The character index right after each token.
+    std::vector<size_t> tokenEnds;
+    size_t maxTokenLength = 0;
+    // False if the tokens may depend on the strings around it or if lexing it reported a
+    // diagnostic. Only the source is kept then.
+    bool replayable = false;
+};
+
+class TokenStreamCache
+{
+  public:
+    // Returns the tokens of the string, lexing it if it is not cached yet. Returns nullptr if the
+    // tokens may depend on the strings around it or if lexing it reports a diagnostic.
+    static std::shared_ptr<const TokenStream> Get(const char *string, size_t length);
+
+    static void Clear();
+};
+
+// Hands out the cached tokens of the leading strings of the input to the Tokenizer, and tells it
+// where to continue scanning once they run out.
+class TokenStreamReplay
+{
+  public:
+    TokenStreamReplay();
+    ~TokenStreamReplay();
+
+    // Strings shorter than this are always scanned. 0 disables the cache.
+    void setMinStringLength(size_t minLength) { mMinStringLength = minLength; }
+
+    // Looks up the tokens of the leading strings of the input. The last string is always scanned,
+    // which takes care of the end of the input.
+    void init(const Input &input);
+
+    bool active() const { return mActive; }
+
+    // Gets the next cached token. Returns false once the cached strings run out or if a token is
+    // longer than maxTokenSize, in which case the rest of the input must be scanned.
+    bool lex(Token *token, size_t maxTokenSize);
+
+    // Stops replaying, and returns the location right after the last token and the file and line
+    // numbers there.
+    void stop(Input::Location *location, int *file, int *line);
+
+  private:
+    size_t mMinStringLength;
+    bool mActive;
+    std::vector<std::shared_ptr<const TokenStream>> mStreams;
+    size_t mStringIndex;
+    size_t mTokenIndex;
+};
+
+}  // namespace pp
+
+}  // namespace angle
+
+#endif  // COMPILER_PREPROCESSOR_TOKENSTREAMCACHE_H_
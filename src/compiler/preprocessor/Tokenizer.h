@@ -10,6 +10,7 @@
 #include "common/angleutils.h"
 #include "compiler/preprocessor/Input.h"
 #include "compiler/preprocessor/Lexer.h"
+#include "compiler/preprocessor/TokenStreamCache.h"
 
 namespace angle
 {
@@ -45,15 +46,27 @@ class Tokenizer : public Lexer
     void setLineNumber(int line);
     void setMaxTokenSize(size_t maxTokenSize);
 
+    // Leading strings of at least minLength characters are replayed from the TokenStreamCache
+    // instead of being scanned. Must be set before init. 0 disables the cache.
+    void setTokenStreamCacheMinStringLength(size_t minLength)
+    {
+        mReplay.setMinStringLength(minLength);
+    }
+
     void lex(Token *token) override;
 
+    // The location right after the last scanned token.
+    const Input::Location &scanLocation() const { return mContext.scanLoc; }
+
   private:
     bool initScanner();
     void destroyScanner();
+    void resumeScanner();
 
-    void *mHandle;         // Scanner handle.
-    Context mContext;      // Scanner extra.
-    size_t mMaxTokenSize;  // Maximum token size
+    void *mHandle;              // Scanner handle.
+    Context mContext;           // Scanner extra.
+    size_t mMaxTokenSize;       // Maximum token size
+    TokenStreamReplay mReplay;  // Cached tokens of the leading strings.
 };
 
 }  // namespace pp
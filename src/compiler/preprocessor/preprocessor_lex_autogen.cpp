@@ -728,8 +728,6 @@ typedef angle::pp::SourceLocation YYLTYPE;
 #define YY_USER_INIT                   \
     do                                 \
     {                                  \
-        yyfileno              = 0;     \
-        yylineno              = 1;     \
         yyextra->leadingSpace = false; \
         yyextra->lineStart    = true;  \
     } while (0);
@@ -2647,6 +2645,7 @@ bool Tokenizer::init(size_t count, const char *const string[], const int length[
     }
 
     mContext.input = Input(count, string, length);
+    mReplay.init(mContext.input);
     return initScanner();
 }
 
@@ -2654,11 +2653,13 @@ void Tokenizer::setFileNumber(int file)
 {
     // We use column number as file number.
     // See macro yyfileno.
+    resumeScanner();
     yyset_column(file, mHandle);
 }
 
 void Tokenizer::setLineNumber(int line)
 {
+    resumeScanner();
     yyset_lineno(line, mHandle);
 }
 
@@ -2669,6 +2670,13 @@ void Tokenizer::setMaxTokenSize(size_t maxTokenSize)
 
 void Tokenizer::lex(Token *token)
 {
+    if (mReplay.lex(token, mMaxTokenSize))
+    {
+        mContext.lineStart = token->type == '\n';
+        return;
+    }
+    resumeScanner();
+
     int tokenType = yylex(&token->text, &token->location, mHandle);
 
     if (tokenType == Token::GOT_ERROR)
@@ -2704,9 +2712,28 @@ bool Tokenizer::initScanner()
     }
 
     yyrestart(0, mHandle);
+    // Not in YY_USER_INIT, which only runs on the first yylex, after replayed tokens may have moved
+    // the scanner.
+    yyset_column(0, mHandle);
+    yyset_lineno(1, mHandle);
     return true;
 }
 
+void Tokenizer::resumeScanner()
+{
+    if (!mReplay.active())
+    {
+        return;
+    }
+
+    // Continue scanning right after the last replayed token.
+    int file = 0, line = 0;
+    mReplay.stop(&mContext.scanLoc, &file, &line);
+    mContext.input.setReadLoc(mContext.scanLoc);
+    yyset_column(file, mHandle);
+    yyset_lineno(line, mHandle);
+}
+
 void Tokenizer::destroyScanner()
 {
     if (mHandle == nullptr)
@@ -408,7 +408,8 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       mHasAnyPreciseType(false),
       mAdvancedBlendEquations(0),
       mUsesDerivatives(false),
-      mCompileOptions{}
+      mCompileOptions{},
+      mASTChangeCount(0)
 {}
 
 TCompiler::~TCompiler() {}
@@ -431,7 +432,6 @@ bool TCompiler::Init(const ShBuiltInResources &resources)
     }
 
     mResources = resources;
-    setResourceString();
 
     InitExtensionBehavior(resources, mExtensionBehavior);
     return true;
@@ -474,6 +474,7 @@ TIntermBlock *TCompiler::compileTreeImpl(angle::Span<const char *const> shaderSt
     ASSERT(mSymbolTable.atGlobalLevel());
 
     // Parse shader.
+    const uint64_t parseStartTimeNs = angle::GetCurrentSystemTimeNs();
     if (PaParseStrings(shaderStrings.subspan(firstSource), nullptr, &parseContext) != 0)
     {
         return nullptr;
@@ -484,6 +485,12 @@ TIntermBlock *TCompiler::compileTreeImpl(angle::Span<const char *const> shaderSt
         return nullptr;
     }
 
+    // The parser pulls the tokens from the preprocessor, which measures the time it takes.
+    const uint64_t preprocessTimeNs = parseContext.getPreprocessor().getLexTimeNs();
+    recordCompileStage("Preprocess", preprocessTimeNs);
+    recordCompileStage("Parse",
+                       angle::GetCurrentSystemTimeNs() - parseStartTimeNs - preprocessTimeNs);
+
     setShaderMetadata(parseContext);
 
     TIntermBlock *root = parseContext.getTreeRoot();
@@ -493,9 +500,16 @@ TIntermBlock *TCompiler::compileTreeImpl(angle::Span<const char *const> shaderSt
         ASSERT(root == nullptr);
         ir::IR ir = parseContext.getIR();
 
-        // Create an AST out of the IR while the rest of the translator is still AST based.
+        // Create an AST out of the IR while the rest of the translator is still AST based.  The
+        // SPIR-V output may instead be generated directly from the IR, in which case an empty tree
+        // is passed on and translate() outputs the already generated binary.
         ir::Output output = ir::GenerateAST(std::move(ir), this, compileOptions);
         root              = output.root;
+        if (!output.spirv.empty())
+        {
+            mSpirvFromIR = std::move(output.spirv);
+            root         = new TIntermBlock;
+        }
 
         // Vertex shader inputs and compute shader built-ins are gathered as "inputs" in IR, but are
         // exposed as an "attributes" list.
@@ -678,6 +692,15 @@ bool TCompiler::getShaderBinary(const ShHandle compilerHandle,
     return true;
 }
 
+void TCompiler::recordCompileStage(const char *name, uint64_t timeNs, bool changedTree)
+{
+    if (mCompileOptions.recordCompileStages)
+    {
+        mCompileStageRecords.push_back(
+            {name, timeNs, GetGlobalPoolAllocator()->getAllocatedBytes(), changedTree});
+    }
+}
+
 bool TCompiler::validateAST(TIntermNode *root)
 {
     if (mCompileOptions.validateAST)
@@ -762,7 +785,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
          IsExtensionEnabled(mExtensionBehavior,
                             TExtension::EXT_shader_framebuffer_fetch_non_coherent)))
     {
-        if (!RemoveUnusedFramebufferFetch(this, root, &mSymbolTable))
+        if (!runASTPass("RemoveUnusedFramebufferFetch",
+                        [&] { return RemoveUnusedFramebufferFetch(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -770,7 +794,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     // Fold expressions that could not be folded before validation that was done as a part of
     // parsing.
-    if (!FoldExpressions(this, root, &mDiagnostics))
+    if (!runASTPass("FoldExpressions", [&] { return FoldExpressions(this, root, &mDiagnostics); }))
     {
         return false;
     }
@@ -789,15 +813,19 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         // The translator treats them as having the maximum allowed size and this pass
         // applies the actual sizes if needed.
         if (mClipDistanceSize > 0 && !parseContext.isClipDistanceRedeclared() &&
-            !SizeClipCullDistance(this, root, ImmutableString("gl_ClipDistance"),
-                                  mClipDistanceSize))
+            !runASTPass("SizeClipCullDistance", [&] {
+                return SizeClipCullDistance(this, root, ImmutableString("gl_ClipDistance"),
+                                            mClipDistanceSize);
+            }))
         {
 
             return false;
         }
         if (mCullDistanceSize > 0 && !parseContext.isCullDistanceRedeclared() &&
-            !SizeClipCullDistance(this, root, ImmutableString("gl_CullDistance"),
-                                  mCullDistanceSize))
+            !runASTPass("SizeClipCullDistance", [&] {
+                return SizeClipCullDistance(this, root, ImmutableString("gl_CullDistance"),
+                                            mCullDistanceSize);
+            }))
         {
             return false;
         }
@@ -811,7 +839,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     //      invalid ESSL.
     //   3. Any unreachable statement after a discard, return, break or continue.
     // After this empty declarations are not allowed in the AST.
-    if (!PruneNoOps(this, root, &mSymbolTable))
+    if (!runASTPass("PruneNoOps", [&] { return PruneNoOps(this, root, &mSymbolTable); }))
     {
         return false;
     }
@@ -823,10 +851,14 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     bool enableNonConstantInitializers = IsExtensionEnabled(
         mExtensionBehavior, TExtension::EXT_shader_non_constant_global_initializers);
 
+    auto deferGlobalInitializers = [&] {
+        return DeferGlobalInitializers(this, root, initializeLocalsAndGlobals,
+                                       canUseLoopsToInitialize,
+                                       compileOptions.forceDeferNonConstGlobalInitializers,
+                                       &mSymbolTable);
+    };
     if (enableNonConstantInitializers &&
-        !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 compileOptions.forceDeferNonConstGlobalInitializers,
-                                 &mSymbolTable))
+        !runASTPass("DeferGlobalInitializers", deferGlobalInitializers))
     {
         return false;
     }
@@ -839,14 +871,15 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     mFunctionMetadata.resize(mCallDag.size());
     tagUsedFunctions();
 
-    if (!pruneUnusedFunctions(root))
+    if (!runASTPass("PruneUnusedFunctions", [&] { return pruneUnusedFunctions(root); }))
     {
         return false;
     }
 
     if (IsSpecWithFunctionBodyNewScope(mShaderSpec, mShaderVersion))
     {
-        if (!ReplaceShadowingVariables(this, root, &mSymbolTable))
+        if (!runASTPass("ReplaceShadowingVariables",
+                        [&] { return ReplaceShadowingVariables(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -863,8 +896,10 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         ASSERT(
             IsExtensionEnabled(mExtensionBehavior, TExtension::ANGLE_shader_pixel_local_storage));
-        if (!RewritePixelLocalStorage(this, root, getSymbolTable(), compileOptions,
-                                      getShaderVersion()))
+        if (!runASTPass("RewritePixelLocalStorage", [&] {
+                return RewritePixelLocalStorage(this, root, getSymbolTable(), compileOptions,
+                                                getShaderVersion());
+            }))
         {
             return false;
         }
@@ -875,9 +910,11 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
          parseContext.isExtensionEnabled(TExtension::OVR_multiview)))
     {
         // Note: if multiview is enabled via #extension all, num_views may not be set.
-        if (!DeclareAndInitBuiltinsForInstancedMultiview(this, root, std::max(mNumViews, 1),
-                                                         mShaderType, compileOptions, mOutputType,
-                                                         &mSymbolTable))
+        if (!runASTPass("DeclareAndInitBuiltinsForInstancedMultiview", [&] {
+                return DeclareAndInitBuiltinsForInstancedMultiview(
+                    this, root, std::max(mNumViews, 1), mShaderType, compileOptions, mOutputType,
+                    &mSymbolTable);
+            }))
         {
             return false;
         }
@@ -885,7 +922,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.addAndTrueToLoopCondition)
     {
-        if (!AddAndTrueToLoopCondition(this, root))
+        if (!runASTPass("AddAndTrueToLoopCondition",
+                        [&] { return AddAndTrueToLoopCondition(this, root); }))
         {
             return false;
         }
@@ -893,27 +931,26 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.unfoldShortCircuit)
     {
-        if (!UnfoldShortCircuitAST(this, root))
+        if (!runASTPass("UnfoldShortCircuitAST", [&] { return UnfoldShortCircuitAST(this, root); }))
         {
             return false;
         }
     }
 
-    if (compileOptions.emulateGLDrawID &&
-        IsExtensionEnabled(mExtensionBehavior, TExtension::ANGLE_multi_draw))
-    {
-        if (!EmulateGLDrawID(this, root, &mSymbolTable))
-        {
-            return false;
-        }
-    }
-
-    if (compileOptions.emulateGLBaseVertexBaseInstance &&
+    const bool emulateGLDrawID =
+        compileOptions.emulateGLDrawID &&
+        IsExtensionEnabled(mExtensionBehavior, TExtension::ANGLE_multi_draw);
+    const bool emulateGLBaseVertexBaseInstance =
+        compileOptions.emulateGLBaseVertexBaseInstance &&
         IsExtensionEnabled(mExtensionBehavior,
-                           TExtension::ANGLE_base_vertex_base_instance_shader_builtin))
-    {
-        if (!EmulateGLBaseVertexBaseInstance(this, root, &mSymbolTable,
-                                             compileOptions.addBaseVertexToVertexID))
+                           TExtension::ANGLE_base_vertex_base_instance_shader_builtin);
+    if (emulateGLDrawID || emulateGLBaseVertexBaseInstance)
+    {
+        if (!runASTPass("EmulateMultiDrawShaderBuiltins", [&] {
+                return EmulateMultiDrawShaderBuiltins(this, root, &mSymbolTable, emulateGLDrawID,
+                                                      emulateGLBaseVertexBaseInstance,
+                                                      compileOptions.addBaseVertexToVertexID);
+            }))
         {
             return false;
         }
@@ -926,15 +963,17 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         // In WebGL2, gl_FragData has only one element.  But in WebGL2, EXT_draw_buffers is not a
         // supported extension.
         ASSERT(mShaderSpec != SH_WEBGL2_SPEC);
-        if (!EmulateGLFragColorBroadcast(this, root, mResources.MaxDrawBuffers,
-                                         mResources.MaxDualSourceDrawBuffers, &mSymbolTable,
-                                         mShaderVersion))
+        if (!runASTPass("EmulateGLFragColorBroadcast", [&] {
+                return EmulateGLFragColorBroadcast(this, root, mResources.MaxDrawBuffers,
+                                                   mResources.MaxDualSourceDrawBuffers,
+                                                   &mSymbolTable, mShaderVersion);
+            }))
         {
             return false;
         }
     }
 
-    if (!sortUniforms(root))
+    if (!runASTPass("SortUniforms", [&] { return sortUniforms(root); }))
     {
         return false;
     }
@@ -942,7 +981,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Needs to run before SimplifyLoopConditions to be able to detect |for| loops correctly.
     if (compileOptions.ensureLoopForwardProgress)
     {
-        if (!EnsureLoopForwardProgress(this, root))
+        if (!runASTPass("EnsureLoopForwardProgress",
+                        [&] { return EnsureLoopForwardProgress(this, root); }))
         {
             return false;
         }
@@ -950,7 +990,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.simplifyLoopConditions)
     {
-        if (!SimplifyLoopConditions(this, root, &getSymbolTable()))
+        if (!runASTPass("SimplifyLoopConditions",
+                        [&] { return SimplifyLoopConditions(this, root, &getSymbolTable()); }))
         {
             return false;
         }
@@ -960,10 +1001,12 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         // Split multi declarations and remove calls to array length().
         // Note that SimplifyLoopConditions needs to be run before any other AST transformations
         // that may need to generate new statements from loop conditions or loop expressions.
-        if (!SimplifyLoopConditions(this, root,
-                                    IntermNodePatternMatcher::kMultiDeclaration |
-                                        IntermNodePatternMatcher::kArrayLengthMethod,
-                                    &getSymbolTable()))
+        if (!runASTPass("SimplifyLoopConditions", [&] {
+                return SimplifyLoopConditions(this, root,
+                                              IntermNodePatternMatcher::kMultiDeclaration |
+                                                  IntermNodePatternMatcher::kArrayLengthMethod,
+                                              &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -971,33 +1014,46 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
-    if (!SeparateDeclarations(*this, *root, mCompileOptions.separateCompoundStructDeclarations))
+    if (!runASTPass("SeparateDeclarations", [&] {
+            return SeparateDeclarations(*this, *root,
+                                        mCompileOptions.separateCompoundStructDeclarations);
+        }))
     {
         return false;
     }
     mValidateASTOptions.validateMultiDeclarations = true;
 
     // Move declarations before functions to simplify transformations.
-    MoveDeclarationsBeforeFunctions(root);
+    if (!runASTPass("MoveDeclarationsBeforeFunctions", [&] {
+            MoveDeclarationsBeforeFunctions(root);
+            return true;
+        }))
+    {
+        return false;
+    }
 
-    if (!SplitSequenceOperator(this, root, IntermNodePatternMatcher::kArrayLengthMethod,
-                               &getSymbolTable()))
+    if (!runASTPass("SplitSequenceOperator", [&] {
+            return SplitSequenceOperator(this, root, IntermNodePatternMatcher::kArrayLengthMethod,
+                                         &getSymbolTable());
+        }))
     {
         return false;
     }
 
-    if (!RemoveArrayLengthMethod(this, root))
+    if (!runASTPass("RemoveArrayLengthMethod",
+                    [&] { return RemoveArrayLengthMethod(this, root); }))
     {
         return false;
     }
     // Fold the expressions again, because |RemoveArrayLengthMethod| can introduce new
     // constants.
-    if (!FoldExpressions(this, root, &mDiagnostics))
+    if (!runASTPass("FoldExpressions", [&] { return FoldExpressions(this, root, &mDiagnostics); }))
     {
         return false;
     }
 
-    if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
+    if (!runASTPass("RemoveUnreferencedVariables",
+                    [&] { return RemoveUnreferencedVariables(this, root, &mSymbolTable); }))
     {
         return false;
     }
@@ -1008,7 +1064,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // RemoveUnreferencedVariables may have left switch statements that only contained an empty
     // declaration inside the final case in an invalid state. Relies on that PruneNoOps and
     // RemoveUnreferencedVariables have already been run.
-    if (!PruneEmptyCases(this, root))
+    if (!runASTPass("PruneEmptyCases", [&] { return PruneEmptyCases(this, root); }))
     {
         return false;
     }
@@ -1017,7 +1073,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.useUnusedStandardSharedBlocks)
     {
-        if (!useAllMembersInUnusedStandardAndSharedBlocks(root))
+        if (!runASTPass("UseAllMembersInUnusedStandardAndSharedBlocks",
+                        [&] { return useAllMembersInUnusedStandardAndSharedBlocks(root); }))
         {
             return false;
         }
@@ -1025,7 +1082,9 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.scalarizeVecAndMatConstructorArgs)
     {
-        if (!ScalarizeVecAndMatConstructorArgs(this, root, &mSymbolTable))
+        if (!runASTPass("ScalarizeVecAndMatConstructorArgs", [&] {
+                return ScalarizeVecAndMatConstructorArgs(this, root, &mSymbolTable);
+            }))
         {
             return false;
         }
@@ -1033,7 +1092,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.avoidComplexExpressionsInStructConstructor)
     {
-        if (!WrapStructConstructors(this, root, &mSymbolTable))
+        if (!runASTPass("WrapStructConstructors",
+                        [&] { return WrapStructConstructors(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -1041,7 +1101,9 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.clampIndirectArrayBounds)
     {
-        if (!ClampIndirectIndices(this, root, &mSymbolTable, mExtensionBehavior))
+        if (!runASTPass("ClampIndirectIndices", [&] {
+                return ClampIndirectIndices(this, root, &mSymbolTable, mExtensionBehavior);
+            }))
         {
             return false;
         }
@@ -1055,10 +1117,12 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // For the MSL output, keep the inactive fragment outputs, but remove them otherwise.
     if (compileOptions.removeInactiveVariables)
     {
-        if (!RemoveInactiveInterfaceVariables(this, root, &getSymbolTable(), getAttributes(),
-                                              getInputVaryings(), getOutputVariables(),
-                                              getUniforms(), getInterfaceBlocks(),
-                                              !compileOptions.retainInactiveFragmentOutputs))
+        if (!runASTPass("RemoveInactiveInterfaceVariables", [&] {
+                return RemoveInactiveInterfaceVariables(
+                    this, root, &getSymbolTable(), getAttributes(), getInputVaryings(),
+                    getOutputVariables(), getUniforms(), getInterfaceBlocks(),
+                    !compileOptions.retainInactiveFragmentOutputs);
+            }))
         {
             return false;
         }
@@ -1066,7 +1130,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.initOutputVariables)
     {
-        if (!initializeOutputVariables(root))
+        if (!runASTPass("InitializeOutputVariables",
+                        [&] { return initializeOutputVariables(root); }))
         {
             return false;
         }
@@ -1076,7 +1141,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // we don't need to initialize it twice.
     if (!mGLPositionInitialized && compileOptions.initGLPosition)
     {
-        if (!initializeGLPosition(root))
+        if (!runASTPass("InitializeGLPosition", [&] { return initializeGLPosition(root); }))
         {
             return false;
         }
@@ -1091,9 +1156,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // must generate global initializers before we generate the DAG, since initializers may call
     // functions which must not be optimized out
     if (!enableNonConstantInitializers &&
-        !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 compileOptions.forceDeferNonConstGlobalInitializers,
-                                 &mSymbolTable))
+        !runASTPass("DeferGlobalInitializers", deferGlobalInitializers))
     {
         return false;
     }
@@ -1110,17 +1173,22 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
         if (!shouldRunLoopAndIndexingValidation())
         {
-            if (!SimplifyLoopConditions(this, root,
-                                        IntermNodePatternMatcher::kArrayDeclaration |
-                                            IntermNodePatternMatcher::kNamelessStructDeclaration,
-                                        &getSymbolTable()))
+            if (!runASTPass("SimplifyLoopConditions", [&] {
+                    return SimplifyLoopConditions(
+                        this, root,
+                        IntermNodePatternMatcher::kArrayDeclaration |
+                            IntermNodePatternMatcher::kNamelessStructDeclaration,
+                        &getSymbolTable());
+                }))
             {
                 return false;
             }
         }
 
-        if (!InitializeUninitializedLocals(this, root, getShaderVersion(), canUseLoopsToInitialize,
-                                           &getSymbolTable()))
+        if (!runASTPass("InitializeUninitializedLocals", [&] {
+                return InitializeUninitializedLocals(this, root, getShaderVersion(),
+                                                     canUseLoopsToInitialize, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -1128,8 +1196,10 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.clampPointSize)
     {
-        if (!ClampPointSize(this, root, mResources.MinPointSize, mResources.MaxPointSize,
-                            &getSymbolTable()))
+        if (!runASTPass("ClampPointSize", [&] {
+                return ClampPointSize(this, root, mResources.MinPointSize,
+                                      mResources.MaxPointSize, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -1137,7 +1207,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.clampFragDepth)
     {
-        if (!ClampFragDepth(this, root, &getSymbolTable()))
+        if (!runASTPass("ClampFragDepth",
+                        [&] { return ClampFragDepth(this, root, &getSymbolTable()); }))
         {
             return false;
         }
@@ -1145,13 +1216,16 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.rewriteRepeatedAssignToSwizzled)
     {
-        if (!sh::RewriteRepeatedAssignToSwizzled(this, root))
+        if (!runASTPass("RewriteRepeatedAssignToSwizzled",
+                        [&] { return sh::RewriteRepeatedAssignToSwizzled(this, root); }))
         {
             return false;
         }
     }
 
-    return true;
+    // Passes that change nodes in place without queueing the changes are not validated by
+    // TIntermTraverser::updateTree, so validate the result of all the passes once more.
+    return validateAST(root);
 }
 
 ShCompileOptions TCompiler::adjustOptions(const ShCompileOptions &compileOptionsIn)
@@ -1233,11 +1307,24 @@ bool TCompiler::compile(angle::Span<const char *const> shaderStrings,
 
         if (compileOptions.objectCode)
         {
+            const size_t stageCountBeforeTranslate = mCompileStageRecords.size();
+            const uint64_t translateStartTimeNs    = angle::GetCurrentSystemTimeNs();
+
             PerformanceDiagnostics perfDiagnostics(&mDiagnostics);
             if (!translate(root, compileOptions, &perfDiagnostics))
             {
                 return false;
             }
+
+            // Translators may record their own stages.  The rest of the time is recorded as a
+            // stage of its own.
+            uint64_t translateTimeNs = angle::GetCurrentSystemTimeNs() - translateStartTimeNs;
+            for (size_t stageIndex = stageCountBeforeTranslate;
+                 stageIndex < mCompileStageRecords.size(); ++stageIndex)
+            {
+                translateTimeNs -= mCompileStageRecords[stageIndex].timeNs;
+            }
+            recordCompileStage("Translate", translateTimeNs);
         }
 
         // For simplicity, this substitution of the name is done after all the transformations are
@@ -1296,6 +1383,15 @@ bool TCompiler::initBuiltInSymbolTable(const ShBuiltInResources &resources)
     return true;
 }
 
+const std::string &TCompiler::getBuiltInResourcesString()
+{
+    if (mBuiltInResourcesString.empty())
+    {
+        setResourceString();
+    }
+    return mBuiltInResourcesString;
+}
+
 void TCompiler::setResourceString()
 {
     std::ostringstream strstream = sh::InitializeStream<std::ostringstream>();
@@ -1479,6 +1575,7 @@ void TCompiler::clearResults()
     mInterfaceBlocks.clear();
     mUniformBlocks.clear();
     mShaderStorageBlocks.clear();
+    mSpirvFromIR.clear();
     mVariablesCollected    = false;
     mGLPositionInitialized = false;
 
@@ -1502,6 +1599,8 @@ void TCompiler::clearResults()
 
     mSourcePath = nullptr;
 
+    mCompileStageRecords.clear();
+
     mSymbolTable.clearCompilationResults();
 }
 
@@ -18,6 +18,7 @@
 
 #include "common/PackedEnums.h"
 #include "common/span.h"
+#include "common/system_utils.h"
 #include "compiler/translator/CallDAG.h"
 #include "compiler/translator/Diagnostics.h"
 #include "compiler/translator/ExtensionBehavior.h"
@@ -132,7 +133,7 @@ class TCompiler : public TShHandleBase
     ShShaderSpec getShaderSpec() const { return mShaderSpec; }
     ShShaderOutput getOutputType() const { return mOutputType; }
     const ShBuiltInResources &getBuiltInResources() const { return mResources; }
-    const std::string &getBuiltInResourcesString() const { return mBuiltInResourcesString; }
+    const std::string &getBuiltInResourcesString();
 
     bool shouldRunLoopAndIndexingValidation() const;
 
@@ -196,6 +197,16 @@ class TCompiler : public TShHandleBase
 
     // Validate the AST and produce errors if it is inconsistent.
     bool validateAST(TIntermNode *root);
+    // The stages of the last compilation, in order, if the recordCompileStages option is set.
+    const std::vector<ShCompileStageRecord> &getCompileStageRecords() const
+    {
+        return mCompileStageRecords;
+    }
+    // Records a stage of the compilation that just ended, along with the memory allocated from the
+    // pool so far, if the recordCompileStages option is set.
+    void recordCompileStage(const char *name, uint64_t timeNs, bool changedTree = false);
+    // Called by TIntermTraverser::updateTree when it applies changes to the tree.
+    void onASTChanged() { ++mASTChangeCount; }
     // Some transformations may need to temporarily disable validation until they are complete.  A
     // set of disable/enable helpers are used for this purpose.
     bool disableValidateFunctionCall();
@@ -236,6 +247,24 @@ class TCompiler : public TShHandleBase
 
     virtual bool shouldFlattenPragmaStdglInvariantAll() = 0;
 
+    // Runs a transformation of the AST.  If the recordCompileStages option is set, also records how
+    // long it took and whether it changed the tree.
+    template <typename Pass>
+    [[nodiscard]] bool runASTPass(const char *name, Pass &&pass)
+    {
+        if (!mCompileOptions.recordCompileStages)
+        {
+            return pass();
+        }
+
+        const uint32_t changeCount = mASTChangeCount;
+        const uint64_t startTimeNs = angle::GetCurrentSystemTimeNs();
+        const bool result          = pass();
+        recordCompileStage(name, angle::GetCurrentSystemTimeNs() - startTimeNs,
+                           mASTChangeCount != changeCount);
+        return result;
+    }
+
     std::vector<sh::ShaderVariable> mAttributes;
     std::vector<sh::ShaderVariable> mOutputVariables;
     std::vector<sh::ShaderVariable> mUniforms;
@@ -246,6 +275,11 @@ class TCompiler : public TShHandleBase
     std::vector<sh::InterfaceBlock> mUniformBlocks;
     std::vector<sh::InterfaceBlock> mShaderStorageBlocks;
 
+    // SPIR-V generated directly from the IR, if the generateSpirvFromIR option is set and the
+    // shader is supported by the IR's SPIR-V generator.  Output by translate() in place of
+    // translating the tree.
+    std::vector<uint32_t> mSpirvFromIR;
+
     // Track what should be validated given passes currently applied.
     ValidateASTOptions mValidateASTOptions;
 
@@ -304,6 +338,7 @@ class TCompiler : public TShHandleBase
     std::vector<TFunctionMetadata> mFunctionMetadata;
 
     ShBuiltInResources mResources;
+    // Built on first use, since few users of the compiler need it.
     std::string mBuiltInResourcesString;
 
     // Built-in symbol table for the given language, spec, and resources.
@@ -366,6 +401,10 @@ class TCompiler : public TShHandleBase
     TPragma mPragma;
 
     ShCompileOptions mCompileOptions;
+
+    // The number of times changes were applied to the AST, to tell which passes changed it.
+    uint32_t mASTChangeCount;
+    std::vector<ShCompileStageRecord> mCompileStageRecords;
 };
 
 //
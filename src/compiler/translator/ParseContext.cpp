@@ -472,6 +472,22 @@ enum class StructureOriginalScope
     FunctionLocal,
 };
 
+// Prologues shared by many shaders are usually at least a few kilobytes long, while the tokens of
+// shorter strings aren't worth keeping.
+constexpr size_t kTokenStreamCacheMinStringLength = 4096;
+
+angle::pp::PreprocessorSettings GetPreprocessorSettings(ShShaderSpec spec,
+                                                        const ShCompileOptions &options)
+{
+    angle::pp::PreprocessorSettings settings(
+        spec, options.allowExtensionDisableAfterNonPPTokensInWebGL
+                  ? angle::pp::WebGLExtensionDisableBehavior::AnywhereInShader
+                  : angle::pp::WebGLExtensionDisableBehavior::Standard);
+    settings.tokenStreamCacheMinStringLength = kTokenStreamCacheMinStringLength;
+    settings.measureLexTime                  = options.recordCompileStages;
+    return settings;
+}
+
 TIntermDeclaration *RenameAndDeclareStruct(TSymbolTable *symbolTable,
                                            TStructure *structure,
                                            StructureOriginalScope scope)
@@ -611,13 +627,7 @@ TParseContext::TParseContext(TSymbolTable &symt,
       mDefaultBufferBlockStorage(sh::IsWebGLBasedSpec(spec) ? EbsStd140 : EbsShared),
       mDiagnostics(diagnostics),
       mDirectiveHandler(ext, *mDiagnostics, *this, mShaderType),
-      mPreprocessor(mDiagnostics,
-                    &mDirectiveHandler,
-                    angle::pp::PreprocessorSettings(
-                        spec,
-                        options.allowExtensionDisableAfterNonPPTokensInWebGL
-                            ? angle::pp::WebGLExtensionDisableBehavior::AnywhereInShader
-                            : angle::pp::WebGLExtensionDisableBehavior::Standard)),
+      mPreprocessor(mDiagnostics, &mDirectiveHandler, GetPreprocessorSettings(spec, options)),
       mScanner(nullptr),
       mComputeShaderLocalSizeDeclared(false),
       mComputeShaderLocalSize(-1),
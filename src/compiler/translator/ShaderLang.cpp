@@ -14,6 +14,7 @@
 #include "common/PackedEnums.h"
 #include "common/span.h"
 #include "common/unsafe_buffers.h"
+#include "compiler/preprocessor/TokenStreamCache.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
 #include "compiler/translator/length_limits.h"
@@ -166,6 +167,8 @@ bool Finalize()
 {
     if (isInitialized)
     {
+        TSharedBuiltInVariables::ReleaseAll();
+        angle::pp::TokenStreamCache::Clear();
         FreePoolIndex();
 #ifdef ANGLE_IR
         ir::ffi::free_global_pool_index_workaround();
@@ -642,6 +645,14 @@ const std::vector<ShPixelLocalStorageLayout> *GetPixelLocalStorageLayouts(const
     return &compiler->getPixelLocalStorageLayouts();
 }
 
+const std::vector<ShCompileStageRecord> *GetCompileStageRecords(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    return &compiler->getCompileStageRecords();
+}
+
 bool CheckVariablesWithinPackingLimits(int maxVectors, const std::vector<ShaderVariable> &variables)
 {
     return CheckVariablesInPackingLimits(maxVectors, variables);
@@ -15,6 +15,9 @@
 #include "common/unsafe_buffers.h"
 
 #include "angle_gl.h"
+#include "common/SimpleMutex.h"
+#include "common/base/anglebase/no_destructor.h"
+#include "common/hash_utils.h"
 #include "compiler/translator/ImmutableString.h"
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/StaticType.h"
@@ -57,8 +60,148 @@ bool CheckExtension(uint32_t extensionIndex, const ShBuiltInResources &resources
     const int *resourcePtr = reinterpret_cast<const int *>(&resources);
     return ANGLE_UNSAFE_TODO(resourcePtr[extensionIndex]) > 0;
 }
+
+// Contexts usually create all their compilers with the same resources, so only a few sets of shared
+// built-in variables are in use at a time.
+constexpr size_t kMaxCachedSharedBuiltInVariables = 8;
+
+struct SharedBuiltInVariablesCache
+{
+    angle::SimpleMutex mutex;
+    // Ordered from least to most recently used.
+    std::vector<std::shared_ptr<const TSharedBuiltInVariables>> entries;
+};
+
+SharedBuiltInVariablesCache &GetSharedBuiltInVariablesCache()
+{
+    static angle::base::NoDestructor<SharedBuiltInVariablesCache> sCache;
+    return *sCache;
+}
+
+void RealizeType(const TType &type);
+
+void RealizeFields(const TFieldListCollection &collection)
+{
+    for (const TField *field : collection.fields())
+    {
+        RealizeType(*field->type());
+    }
+    collection.objectSize();
+    collection.deepestNesting();
+    collection.mangledFieldList();
+}
+
+// Computes the lazily computed properties of a shared type, which would otherwise be written by
+// several threads and allocated from the pool of whichever compiler first used them.
+void RealizeType(const TType &type)
+{
+    type.getMangledName();
+    if (type.getStruct() != nullptr)
+    {
+        RealizeFields(*type.getStruct());
+    }
+    if (type.getInterfaceBlock() != nullptr)
+    {
+        RealizeFields(*type.getInterfaceBlock());
+    }
+}
+
+void RealizeSymbol(const TSymbol *symbol)
+{
+    if (symbol == nullptr)
+    {
+        return;
+    }
+    if (symbol->isVariable())
+    {
+        RealizeType(static_cast<const TVariable *>(symbol)->getType());
+    }
+    else if (symbol->isStruct())
+    {
+        RealizeFields(*static_cast<const TStructure *>(symbol));
+    }
+    else if (symbol->isInterfaceBlock())
+    {
+        RealizeFields(*static_cast<const TInterfaceBlock *>(symbol));
+    }
+}
 }  // namespace
 
+TSharedBuiltInVariables::TSharedBuiltInVariables(ShShaderSpec spec,
+                                                 const ShBuiltInResources &resources,
+                                                 size_t hash)
+    : mShaderSpec(spec), mResources(resources), mHash(hash)
+{
+    angle::PoolAllocator *previousAllocator = GetGlobalPoolAllocator();
+    SetGlobalPoolAllocator(&mAllocator);
+
+    // The generated code creates the variables in a symbol table, and the shader type doesn't
+    // affect them.
+    TSymbolTable symbolTable;
+    symbolTable.initializeBuiltInVariables(GL_FRAGMENT_SHADER, spec, resources);
+    mVariables = static_cast<const TSymbolTableBase &>(symbolTable);
+
+    // TSymbolTableBase only holds pointers to the variables.
+    static_assert(sizeof(TSymbolTableBase) % sizeof(TSymbol *) == 0,
+                  "TSymbolTableBase should only contain symbols");
+    const TSymbol *const *symbols = reinterpret_cast<const TSymbol *const *>(&mVariables);
+    for (size_t index = 0; index < sizeof(TSymbolTableBase) / sizeof(TSymbol *); ++index)
+    {
+        RealizeSymbol(ANGLE_UNSAFE_TODO(symbols[index]));
+    }
+
+    SetGlobalPoolAllocator(previousAllocator);
+}
+
+TSharedBuiltInVariables::~TSharedBuiltInVariables() = default;
+
+// static
+std::shared_ptr<const TSharedBuiltInVariables> TSharedBuiltInVariables::Get(
+    ShShaderSpec spec,
+    const ShBuiltInResources &resources)
+{
+    // ShBuiltInResources is zero-initialized and copied with memcpy so it can be compared by bytes.
+    const size_t hash = angle::ComputeGenericHash(angle::Span<const uint8_t>(
+        reinterpret_cast<const uint8_t *>(&resources), sizeof(resources)));
+
+    SharedBuiltInVariablesCache &cache = GetSharedBuiltInVariablesCache();
+    std::lock_guard<angle::SimpleMutex> lock(cache.mutex);
+
+    for (auto iter = cache.entries.begin(); iter != cache.entries.end(); ++iter)
+    {
+        if ((*iter)->matches(spec, resources, hash))
+        {
+            std::shared_ptr<const TSharedBuiltInVariables> variables = *iter;
+            cache.entries.erase(iter);
+            cache.entries.push_back(variables);
+            return variables;
+        }
+    }
+
+    if (cache.entries.size() == kMaxCachedSharedBuiltInVariables)
+    {
+        cache.entries.erase(cache.entries.begin());
+    }
+    cache.entries.push_back(std::make_shared<TSharedBuiltInVariables>(spec, resources, hash));
+    return cache.entries.back();
+}
+
+// static
+void TSharedBuiltInVariables::ReleaseAll()
+{
+    SharedBuiltInVariablesCache &cache = GetSharedBuiltInVariablesCache();
+    std::lock_guard<angle::SimpleMutex> lock(cache.mutex);
+    cache.entries.clear();
+}
+
+bool TSharedBuiltInVariables::matches(ShShaderSpec spec,
+                                      const ShBuiltInResources &resources,
+                                      size_t hash) const
+{
+    return mHash == hash && mShaderSpec == spec &&
+           ANGLE_UNSAFE_TODO(memcmp(&mResources, &resources, sizeof(resources))) == 0;
+}
+
 class TSymbolTable::TSymbolTableLevel
 {
   public:
@@ -481,7 +624,9 @@ void TSymbolTable::initializeBuiltIns(sh::GLenum type,
 
     setDefaultPrecision(EbtAtomicCounter, EbpHigh);
 
-    initializeBuiltInVariables(type, spec, resources);
+    mSharedBuiltInVariables                = TSharedBuiltInVariables::Get(spec, resources);
+    static_cast<TSymbolTableBase &>(*this) = mSharedBuiltInVariables->variables();
+
     mUniqueIdCounter = kFirstUserDefinedSymbolId;
 }
 
@@ -195,6 +195,37 @@ constexpr UnmangledEntry::UnmangledEntry(const char *name,
                                    : static_cast<uint16_t>(esslVersion))
 {}
 
+// The built-in variables whose values or types depend on ShBuiltInResources, such as
+// gl_MaxDrawBuffers.  Creating them is most of the work of initializing a compiler, so they are
+// created once for each shader spec and set of resources, and shared by all the symbol tables that
+// are initialized with them, on any thread.  They are immutable once created.
+class TSharedBuiltInVariables : angle::NonCopyable
+{
+  public:
+    TSharedBuiltInVariables(ShShaderSpec spec, const ShBuiltInResources &resources, size_t hash);
+    ~TSharedBuiltInVariables();
+
+    // Returns the variables of |spec| and |resources|, creating them if no symbol table has
+    // recently used them.
+    static std::shared_ptr<const TSharedBuiltInVariables> Get(ShShaderSpec spec,
+                                                              const ShBuiltInResources &resources);
+    // Stops caching the variables.  Symbol tables that use them keep them alive.
+    static void ReleaseAll();
+
+    const TSymbolTableBase &variables() const { return mVariables; }
+
+  private:
+    bool matches(ShShaderSpec spec, const ShBuiltInResources &resources, size_t hash) const;
+
+    ShShaderSpec mShaderSpec;
+    ShBuiltInResources mResources;
+    size_t mHash;
+
+    // The variables, and their types and constant values, are allocated from this pool.
+    angle::PoolAllocator mAllocator;
+    TSymbolTableBase mVariables;
+};
+
 class TSymbolTable : angle::NonCopyable, TSymbolTableBase
 {
   public:
@@ -291,6 +322,7 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
 
   private:
     friend class TSymbolUniqueId;
+    friend class TSharedBuiltInVariables;
 
     struct VariableMetadata
     {
@@ -327,6 +359,7 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
     sh::GLenum mShaderType;
     ShShaderSpec mShaderSpec;
     ShBuiltInResources mResources;
+    std::shared_ptr<const TSharedBuiltInVariables> mSharedBuiltInVariables;
 
     // Indexed by unique id. Map instead of vector since the variables are fairly sparse.
     std::map<int, VariableMetadata> mVariableMetadata;
@@ -166,6 +166,17 @@ void SetOptions(TCompiler *compiler, const ShCompileOptions &options, ffi::Compi
 
     // MSL-specific flags
     opt->ensure_loop_forward_progress = options.ensureLoopForwardProgress;
+
+    // SPIR-V-specific flags.  The SPIR-V generator of the IR supports none of the options that
+    // alter the SPIR-V output of the AST-based translator beyond the default.
+    opt->generate_spirv_from_ir =
+        options.generateSpirvFromIR && compiler->getOutputType() == SH_SPIRV_VULKAN_OUTPUT &&
+        !options.emitSPIRV14 && !options.outputDebugInfo &&
+        !options.addVulkanXfbEmulationSupportCode && !options.addVulkanXfbExtensionSupportCode &&
+        !options.addAdvancedBlendEquationsEmulation && !options.ignorePrecisionQualifiers &&
+        !options.useDemoteToHelperInvocation && !options.wrapSwitchInIfTrue &&
+        !compiler->getPragma().stdgl.invariantAll && !compiler->hasAnyPreciseType();
+    opt->add_vulkan_depth_correction = options.addVulkanDepthCorrection;
 }
 
 std::vector<ShaderVariable> ConvertShaderVariables(const rust::Vec<ffi::ShaderVariable> &variables)
@@ -256,6 +267,7 @@ Output GenerateAST(IR ir, TCompiler *compiler, const ShCompileOptions &options)
     out.shared        = ConvertShaderVariables(output.shared);
     out.uniformBlocks = ConvertInterfaceBlocks(output.uniform_blocks);
     out.storageBlocks = ConvertInterfaceBlocks(output.storage_blocks);
+    out.spirv.assign(output.spirv.begin(), output.spirv.end());
 
     return out;
 }
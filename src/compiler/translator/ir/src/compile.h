@@ -35,6 +35,8 @@ struct Output
     std::vector<ShaderVariable> shared;
     std::vector<InterfaceBlock> uniformBlocks;
     std::vector<InterfaceBlock> storageBlocks;
+    // If SPIR-V is generated directly from the IR, root is nullptr and this holds the binary.
+    std::vector<uint32_t> spirv;
 };
 
 #ifdef ANGLE_IR
@@ -227,6 +227,13 @@ mod ffi {
 
         // MSL: Ensure all loops execute side-effects or terminate.
         ensure_loop_forward_progress: bool,
+
+        // SPIR-V: Generate SPIR-V directly from the IR instead of through the AST when the shader
+        // only uses features the direct generator supports.
+        generate_spirv_from_ir: bool,
+        // SPIR-V: Whether ANGLETransformPosition should map the depth range from [-1, 1] to [0, 1]
+        // when the driver uniforms ask for it.
+        add_vulkan_depth_correction: bool,
     }
 
     // Matching sh::InterpolationType
@@ -344,9 +351,10 @@ mod ffi {
     }
 
     struct Output {
-        // Note: For now, generate always results in an AST. Eventually either text or binary
-        // should be returned.
+        // Note: For now, generate results in an AST, unless SPIR-V could be generated directly
+        // from the IR, in which case `ast` is null and `spirv` holds the binary.
         ast: *mut TIntermBlock,
+        spirv: Vec<u32>,
 
         // Reflection info
         inputs: Vec<ShaderVariable>,
@@ -476,7 +484,24 @@ unsafe fn generate_ast(
     // transformations might have left around are removed.
     transform::run!(dead_code_eliminate, &mut ir);
 
-    let reflection_info = ir.meta.take_reflection_info();
+    #[cfg_attr(not(angle_enable_spirv), allow(unused_mut))]
+    let mut reflection_info = ir.meta.take_reflection_info();
+
+    #[cfg(angle_enable_spirv)]
+    if options.generate_spirv_from_ir && options.output == OutputLanguage::Spirv {
+        if let Some(spirv) = output::spirv_direct::generate(&ir, options, &mut reflection_info) {
+            return ffi::Output {
+                ast: std::ptr::null_mut(),
+                spirv,
+                inputs: reflection_info.inputs,
+                outputs: reflection_info.outputs,
+                uniforms: reflection_info.uniforms,
+                shared: reflection_info.shared,
+                uniform_blocks: reflection_info.uniform_blocks,
+                storage_blocks: reflection_info.storage_blocks,
+            };
+        }
+    }
 
     // Passes required before AST can be generated:
     transform::run!(dealias, &mut ir);
@@ -491,6 +516,7 @@ unsafe fn generate_ast(
 
     ffi::Output {
         ast,
+        spirv: vec![],
         inputs: reflection_info.inputs,
         outputs: reflection_info.outputs,
         uniforms: reflection_info.uniforms,
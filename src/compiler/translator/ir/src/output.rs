@@ -15,5 +15,7 @@ pub mod hlsl;
 pub mod msl;
 #[cfg(angle_enable_spirv)]
 pub mod spirv;
+#[cfg(angle_enable_spirv)]
+pub mod spirv_direct;
 #[cfg(angle_enable_wgsl)]
 pub mod wgsl;
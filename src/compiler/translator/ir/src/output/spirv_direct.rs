@@ -0,0 +1,3245 @@
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Generates SPIR-V directly from the IR, without going through the AST.
+//
+// Only the common subset of vertex and fragment shaders is supported: user varyings and
+// attributes of scalar, vector and matrix types, gl_Position, gl_PointSize, gl_VertexID,
+// gl_InstanceID, gl_FrontFacing and gl_FragColor, default uniforms, 2D, 3D, cube and 2D array
+// samplers, and control flow and arithmetic on these.  Anything else makes `generate` return
+// `None`, in which case the IR is turned into AST and the AST-based generator produces the SPIR-V.
+//
+// The output follows the conventions of the AST-based generator, as the SPIR-V transformer in
+// the Vulkan backend relies on them:
+//
+// - The ids reserved in vk::spirv::ReservedIds are used for the common types and constants, the
+//   driver and default uniform blocks, the gl_PerVertex output block and ANGLETransformPosition.
+// - Shader interface variables are given ids in declaration order starting from
+//   kIdFirstUnreserved, and the ids are recorded in the reflection info.
+// - Non-semantic instructions mark the end of the types section, the start of main() and the
+//   points where the shader outputs are finalized.
+
+use crate::ir::*;
+use crate::*;
+
+// The SPIR-V version, 1.3, and the generator id, matching the AST-based generator.
+const SPIRV_MAGIC: u32 = 0x07230203;
+const SPIRV_VERSION: u32 = 0x00010300;
+const SPIRV_GENERATOR: u32 = (24 << 16) | 1;
+
+// Reserved ids, see vk::spirv::ReservedIds in ShaderLang.h.
+mod reserved {
+    pub const NON_SEMANTIC_INSTRUCTION_SET: u32 = 1;
+    pub const GLSL_STD_INSTRUCTION_SET: u32 = 2;
+    pub const ENTRY_POINT: u32 = 3;
+    pub const VOID: u32 = 4;
+    pub const FLOAT: u32 = 5;
+    pub const VEC2: u32 = 6;
+    pub const VEC3: u32 = 7;
+    pub const VEC4: u32 = 8;
+    pub const MAT2: u32 = 9;
+    pub const INT: u32 = 12;
+    pub const IVEC2: u32 = 13;
+    pub const IVEC4: u32 = 14;
+    pub const UINT: u32 = 15;
+    // Followed by the constants 1 to 7.
+    pub const INT_ZERO: u32 = 16;
+    pub const FLOAT_TWO: u32 = 24;
+    pub const VEC4_ZERO: u32 = 25;
+    pub const IVEC4_ZERO: u32 = 26;
+    pub const INT_INPUT_TYPE_POINTER: u32 = 27;
+    pub const VEC4_INPUT_TYPE_POINTER: u32 = 28;
+    pub const VEC4_OUTPUT_TYPE_POINTER: u32 = 29;
+    pub const VEC3_OUTPUT_TYPE_POINTER: u32 = 30;
+    pub const IVEC4_FUNCTION_TYPE_POINTER: u32 = 31;
+    pub const OUTPUT_PER_VERTEX_TYPE_POINTER: u32 = 32;
+    pub const TRANSFORM_POSITION_FUNCTION: u32 = 33;
+    pub const OUTPUT_PER_VERTEX_VAR: u32 = 36;
+    pub const OUTPUT_PER_VERTEX_BLOCK: u32 = 46;
+    pub const DRIVER_UNIFORMS_BLOCK: u32 = 47;
+    pub const DEFAULT_UNIFORMS_BLOCK: u32 = 48;
+    pub const FIRST_UNRESERVED: u32 = 72;
+}
+
+// Non-semantic instructions, see vk::spirv::NonSemanticInstruction in ShaderLang.h.
+const NON_SEMANTIC_OVERVIEW: u32 = 0;
+const NON_SEMANTIC_ENTER: u32 = 1;
+const NON_SEMANTIC_OUTPUT: u32 = 2;
+const OVERVIEW_HAS_OUTPUT_PER_VERTEX_MASK: u32 = 0x40;
+
+// The fields of the driver uniforms used by the generated code, see DriverUniform.cpp.
+const DRIVER_UNIFORMS_FLIP_XY: u32 = 2;
+const DRIVER_UNIFORMS_MISC: u32 = 3;
+const DRIVER_UNIFORMS_BASE_INSTANCE: u32 = 4;
+const DRIVER_UNIFORMS_MISC_SWAP_XY_MASK: u32 = 0x1;
+const DRIVER_UNIFORMS_MISC_TRANSFORM_DEPTH_OFFSET: u32 = 20;
+const DRIVER_UNIFORMS_MISC_TRANSFORM_DEPTH_MASK: u32 = 0x1;
+
+// SPIR-V opcodes.
+mod op {
+    pub const UNDEF: u32 = 1;
+    pub const SOURCE: u32 = 3;
+    pub const EXTENSION: u32 = 10;
+    pub const EXT_INST_IMPORT: u32 = 11;
+    pub const EXT_INST: u32 = 12;
+    pub const MEMORY_MODEL: u32 = 14;
+    pub const ENTRY_POINT: u32 = 15;
+    pub const EXECUTION_MODE: u32 = 16;
+    pub const CAPABILITY: u32 = 17;
+    pub const TYPE_VOID: u32 = 19;
+    pub const TYPE_BOOL: u32 = 20;
+    pub const TYPE_INT: u32 = 21;
+    pub const TYPE_FLOAT: u32 = 22;
+    pub const TYPE_VECTOR: u32 = 23;
+    pub const TYPE_MATRIX: u32 = 24;
+    pub const TYPE_IMAGE: u32 = 25;
+    pub const TYPE_SAMPLED_IMAGE: u32 = 27;
+    pub const TYPE_ARRAY: u32 = 28;
+    pub const TYPE_STRUCT: u32 = 30;
+    pub const TYPE_POINTER: u32 = 32;
+    pub const TYPE_FUNCTION: u32 = 33;
+    pub const CONSTANT_TRUE: u32 = 41;
+    pub const CONSTANT_FALSE: u32 = 42;
+    pub const CONSTANT: u32 = 43;
+    pub const CONSTANT_COMPOSITE: u32 = 44;
+    pub const CONSTANT_NULL: u32 = 46;
+    pub const FUNCTION: u32 = 54;
+    pub const FUNCTION_PARAMETER: u32 = 55;
+    pub const FUNCTION_END: u32 = 56;
+    pub const FUNCTION_CALL: u32 = 57;
+    pub const VARIABLE: u32 = 59;
+    pub const LOAD: u32 = 61;
+    pub const STORE: u32 = 62;
+    pub const ACCESS_CHAIN: u32 = 65;
+    pub const DECORATE: u32 = 71;
+    pub const MEMBER_DECORATE: u32 = 72;
+    pub const VECTOR_EXTRACT_DYNAMIC: u32 = 77;
+    pub const VECTOR_SHUFFLE: u32 = 79;
+    pub const COMPOSITE_CONSTRUCT: u32 = 80;
+    pub const COMPOSITE_EXTRACT: u32 = 81;
+    pub const TRANSPOSE: u32 = 84;
+    pub const IMAGE_SAMPLE_IMPLICIT_LOD: u32 = 87;
+    pub const IMAGE_SAMPLE_EXPLICIT_LOD: u32 = 88;
+    pub const IMAGE_SAMPLE_PROJ_IMPLICIT_LOD: u32 = 91;
+    pub const IMAGE_SAMPLE_PROJ_EXPLICIT_LOD: u32 = 92;
+    pub const IMAGE_FETCH: u32 = 95;
+    pub const IMAGE: u32 = 100;
+    pub const IMAGE_QUERY_SIZE_LOD: u32 = 103;
+    pub const CONVERT_F_TO_U: u32 = 109;
+    pub const CONVERT_F_TO_S: u32 = 110;
+    pub const CONVERT_S_TO_F: u32 = 111;
+    pub const CONVERT_U_TO_F: u32 = 112;
+    pub const BITCAST: u32 = 124;
+    pub const S_NEGATE: u32 = 126;
+    pub const F_NEGATE: u32 = 127;
+    pub const I_ADD: u32 = 128;
+    pub const F_ADD: u32 = 129;
+    pub const I_SUB: u32 = 130;
+    pub const F_SUB: u32 = 131;
+    pub const I_MUL: u32 = 132;
+    pub const F_MUL: u32 = 133;
+    pub const U_DIV: u32 = 134;
+    pub const S_DIV: u32 = 135;
+    pub const F_DIV: u32 = 136;
+    pub const U_MOD: u32 = 137;
+    pub const S_MOD: u32 = 139;
+    pub const F_MOD: u32 = 141;
+    pub const VECTOR_TIMES_SCALAR: u32 = 142;
+    pub const MATRIX_TIMES_SCALAR: u32 = 143;
+    pub const VECTOR_TIMES_MATRIX: u32 = 144;
+    pub const MATRIX_TIMES_VECTOR: u32 = 145;
+    pub const MATRIX_TIMES_MATRIX: u32 = 146;
+    pub const OUTER_PRODUCT: u32 = 147;
+    pub const DOT: u32 = 148;
+    pub const ANY: u32 = 154;
+    pub const ALL: u32 = 155;
+    pub const IS_NAN: u32 = 156;
+    pub const IS_INF: u32 = 157;
+    pub const LOGICAL_EQUAL: u32 = 164;
+    pub const LOGICAL_NOT_EQUAL: u32 = 165;
+    pub const LOGICAL_NOT: u32 = 168;
+    pub const SELECT: u32 = 169;
+    pub const I_EQUAL: u32 = 170;
+    pub const I_NOT_EQUAL: u32 = 171;
+    pub const U_GREATER_THAN: u32 = 172;
+    pub const S_GREATER_THAN: u32 = 173;
+    pub const U_GREATER_THAN_EQUAL: u32 = 174;
+    pub const S_GREATER_THAN_EQUAL: u32 = 175;
+    pub const U_LESS_THAN: u32 = 176;
+    pub const S_LESS_THAN: u32 = 177;
+    pub const U_LESS_THAN_EQUAL: u32 = 178;
+    pub const S_LESS_THAN_EQUAL: u32 = 179;
+    pub const F_ORD_EQUAL: u32 = 180;
+    pub const F_UNORD_NOT_EQUAL: u32 = 183;
+    pub const F_ORD_LESS_THAN: u32 = 184;
+    pub const F_ORD_GREATER_THAN: u32 = 186;
+    pub const F_ORD_LESS_THAN_EQUAL: u32 = 188;
+    pub const F_ORD_GREATER_THAN_EQUAL: u32 = 190;
+    pub const SHIFT_RIGHT_LOGICAL: u32 = 194;
+    pub const SHIFT_RIGHT_ARITHMETIC: u32 = 195;
+    pub const SHIFT_LEFT_LOGICAL: u32 = 196;
+    pub const BITWISE_OR: u32 = 197;
+    pub const BITWISE_XOR: u32 = 198;
+    pub const BITWISE_AND: u32 = 199;
+    pub const NOT: u32 = 200;
+    pub const BIT_FIELD_INSERT: u32 = 201;
+    pub const BIT_FIELD_S_EXTRACT: u32 = 202;
+    pub const BIT_FIELD_U_EXTRACT: u32 = 203;
+    pub const BIT_REVERSE: u32 = 204;
+    pub const BIT_COUNT: u32 = 205;
+    pub const PHI: u32 = 245;
+    pub const LOOP_MERGE: u32 = 246;
+    pub const SELECTION_MERGE: u32 = 247;
+    pub const LABEL: u32 = 248;
+    pub const BRANCH: u32 = 249;
+    pub const BRANCH_CONDITIONAL: u32 = 250;
+    pub const SWITCH: u32 = 251;
+    pub const KILL: u32 = 252;
+    pub const RETURN: u32 = 253;
+    pub const RETURN_VALUE: u32 = 254;
+    pub const UNREACHABLE: u32 = 255;
+}
+
+// GLSL.std.450 instructions.
+mod glsl {
+    pub const ROUND: u32 = 1;
+    pub const ROUND_EVEN: u32 = 2;
+    pub const TRUNC: u32 = 3;
+    pub const F_ABS: u32 = 4;
+    pub const S_ABS: u32 = 5;
+    pub const F_SIGN: u32 = 6;
+    pub const S_SIGN: u32 = 7;
+    pub const FLOOR: u32 = 8;
+    pub const CEIL: u32 = 9;
+    pub const FRACT: u32 = 10;
+    pub const RADIANS: u32 = 11;
+    pub const DEGREES: u32 = 12;
+    pub const SIN: u32 = 13;
+    pub const COS: u32 = 14;
+    pub const TAN: u32 = 15;
+    pub const ASIN: u32 = 16;
+    pub const ACOS: u32 = 17;
+    pub const ATAN: u32 = 18;
+    pub const SINH: u32 = 19;
+    pub const COSH: u32 = 20;
+    pub const TANH: u32 = 21;
+    pub const ASINH: u32 = 22;
+    pub const ACOSH: u32 = 23;
+    pub const ATANH: u32 = 24;
+    pub const ATAN2: u32 = 25;
+    pub const POW: u32 = 26;
+    pub const EXP: u32 = 27;
+    pub const LOG: u32 = 28;
+    pub const EXP2: u32 = 29;
+    pub const LOG2: u32 = 30;
+    pub const SQRT: u32 = 31;
+    pub const INVERSE_SQRT: u32 = 32;
+    pub const DETERMINANT: u32 = 33;
+    pub const MATRIX_INVERSE: u32 = 34;
+    pub const F_MIN: u32 = 37;
+    pub const U_MIN: u32 = 38;
+    pub const S_MIN: u32 = 39;
+    pub const F_MAX: u32 = 40;
+    pub const U_MAX: u32 = 41;
+    pub const S_MAX: u32 = 42;
+    pub const F_CLAMP: u32 = 43;
+    pub const U_CLAMP: u32 = 44;
+    pub const S_CLAMP: u32 = 45;
+    pub const F_MIX: u32 = 46;
+    pub const STEP: u32 = 48;
+    pub const SMOOTH_STEP: u32 = 49;
+    pub const FMA: u32 = 50;
+    pub const LDEXP: u32 = 53;
+    pub const PACK_SNORM_4X8: u32 = 54;
+    pub const PACK_UNORM_4X8: u32 = 55;
+    pub const PACK_SNORM_2X16: u32 = 56;
+    pub const PACK_UNORM_2X16: u32 = 57;
+    pub const PACK_HALF_2X16: u32 = 58;
+    pub const UNPACK_SNORM_2X16: u32 = 60;
+    pub const UNPACK_UNORM_2X16: u32 = 61;
+    pub const UNPACK_HALF_2X16: u32 = 62;
+    pub const UNPACK_SNORM_4X8: u32 = 63;
+    pub const UNPACK_UNORM_4X8: u32 = 64;
+    pub const LENGTH: u32 = 66;
+    pub const DISTANCE: u32 = 67;
+    pub const CROSS: u32 = 68;
+    pub const NORMALIZE: u32 = 69;
+    pub const FACE_FORWARD: u32 = 70;
+    pub const REFLECT: u32 = 71;
+    pub const REFRACT: u32 = 72;
+    pub const FIND_I_LSB: u32 = 73;
+    pub const FIND_S_MSB: u32 = 74;
+    pub const FIND_U_MSB: u32 = 75;
+}
+
+// Enumerants used by the generator.
+const CAPABILITY_SHADER: u32 = 1;
+const CAPABILITY_IMAGE_QUERY: u32 = 50;
+const EXECUTION_MODEL_VERTEX: u32 = 0;
+const EXECUTION_MODEL_FRAGMENT: u32 = 4;
+const EXECUTION_MODE_ORIGIN_UPPER_LEFT: u32 = 7;
+const EXECUTION_MODE_EARLY_FRAGMENT_TESTS: u32 = 9;
+const SOURCE_LANGUAGE_GLSL: u32 = 2;
+
+const STORAGE_CLASS_UNIFORM_CONSTANT: u32 = 0;
+const STORAGE_CLASS_INPUT: u32 = 1;
+const STORAGE_CLASS_UNIFORM: u32 = 2;
+const STORAGE_CLASS_OUTPUT: u32 = 3;
+const STORAGE_CLASS_PRIVATE: u32 = 6;
+const STORAGE_CLASS_FUNCTION: u32 = 7;
+const STORAGE_CLASS_PUSH_CONSTANT: u32 = 9;
+
+const DECORATION_RELAXED_PRECISION: u32 = 0;
+const DECORATION_BLOCK: u32 = 2;
+const DECORATION_COL_MAJOR: u32 = 5;
+const DECORATION_ARRAY_STRIDE: u32 = 6;
+const DECORATION_MATRIX_STRIDE: u32 = 7;
+const DECORATION_BUILT_IN: u32 = 11;
+const DECORATION_NO_PERSPECTIVE: u32 = 13;
+const DECORATION_FLAT: u32 = 14;
+const DECORATION_CENTROID: u32 = 16;
+const DECORATION_LOCATION: u32 = 30;
+const DECORATION_BINDING: u32 = 33;
+const DECORATION_DESCRIPTOR_SET: u32 = 34;
+const DECORATION_OFFSET: u32 = 35;
+
+const BUILT_IN_POSITION: u32 = 0;
+const BUILT_IN_POINT_SIZE: u32 = 1;
+const BUILT_IN_FRONT_FACING: u32 = 17;
+const BUILT_IN_VERTEX_INDEX: u32 = 42;
+const BUILT_IN_INSTANCE_INDEX: u32 = 43;
+
+const DIM_2D: u32 = 1;
+const DIM_3D: u32 = 2;
+const DIM_CUBE: u32 = 3;
+
+const IMAGE_OPERANDS_BIAS: u32 = 0x1;
+const IMAGE_OPERANDS_LOD: u32 = 0x2;
+const IMAGE_OPERANDS_GRAD: u32 = 0x4;
+const IMAGE_OPERANDS_CONST_OFFSET: u32 = 0x8;
+
+// Any feature that is not supported by this generator results in this error, which is propagated
+// all the way to `generate`.
+struct Unsupported;
+type Result<T> = std::result::Result<T, Unsupported>;
+
+// Generates SPIR-V for the shader, or returns None if the shader uses anything this generator does
+// not support.  On success, the SPIR-V ids of the shader interface variables are recorded in the
+// reflection info.
+pub fn generate(
+    ir: &IR,
+    options: &compile::Options,
+    reflection: &mut reflection::Info,
+) -> Option<Vec<u32>> {
+    if !is_supported_configuration(ir, options) {
+        return None;
+    }
+
+    let mut generator = Generator::new(ir, options, reflection);
+    let spirv = generator.generate().ok()?;
+    for update in generator.reflection_updates() {
+        let variable = match update.list {
+            ReflectionList::Inputs => &mut reflection.inputs[update.index],
+            ReflectionList::Outputs => &mut reflection.outputs[update.index],
+            ReflectionList::Uniforms => &mut reflection.uniforms[update.index],
+        };
+        variable.id = update.id;
+        variable.texel_fetch_static_use |= update.texel_fetch_static_use;
+    }
+
+    Some(spirv)
+}
+
+fn is_supported_configuration(ir: &IR, options: &compile::Options) -> bool {
+    let extensions = &options.extensions;
+    matches!(ir.meta.get_shader_type(), ShaderType::Vertex | ShaderType::Fragment)
+        && !ir.meta.is_per_vertex_out_redeclared()
+        && !options.transform_float_uniform_to_fp16
+        // Extensions whose emulation is done by the AST-based translator.
+        && !extensions.ANGLE_base_vertex_base_instance_shader_builtin
+        && !extensions.ANGLE_clip_cull_distance
+        && !extensions.ANGLE_multi_draw
+        && !extensions.ANGLE_shader_pixel_local_storage
+        && !extensions.APPLE_clip_distance
+        && !extensions.ARM_shader_framebuffer_fetch
+        && !extensions.ARM_shader_framebuffer_fetch_depth_stencil
+        && !extensions.EXT_YUV_target
+        && !extensions.EXT_blend_func_extended
+        && !extensions.EXT_clip_cull_distance
+        && !extensions.EXT_shader_framebuffer_fetch
+        && !extensions.EXT_shader_framebuffer_fetch_non_coherent
+        && !extensions.KHR_blend_equation_advanced
+        && !extensions.NV_EGL_stream_consumer_external
+        && !extensions.OES_EGL_image_external
+        && !extensions.OES_EGL_image_external_essl3
+        && !extensions.OVR_multiview
+        && !extensions.OVR_multiview2
+}
+
+#[derive(Copy, Clone)]
+enum ReflectionList {
+    Inputs,
+    Outputs,
+    Uniforms,
+}
+
+struct ReflectionUpdate {
+    list: ReflectionList,
+    index: usize,
+    id: u32,
+    texel_fetch_static_use: bool,
+}
+
+// The shape of a numeric or boolean type; `columns` is 0 for scalars and vectors, and `size` is
+// the number of rows for matrices.
+#[derive(Copy, Clone, PartialEq)]
+struct Shape {
+    basic: BasicType,
+    size: u32,
+    columns: u32,
+}
+
+// A pointer is kept unresolved until it is loaded from or stored to, so that a chain of access
+// instructions results in a single OpAccessChain.  Swizzles cannot be expressed with access
+// chains, so they are applied after the load or before the store.
+#[derive(Clone)]
+struct Pointer {
+    base: u32,
+    storage: u32,
+    indices: Vec<u32>,
+    // The type the pointer points to, before the swizzle is applied.
+    type_id: TypeId,
+    swizzle: Option<Vec<u32>>,
+    // If this is a pointer to a sampler uniform (or an element of it), the uniform.
+    sampler: Option<VariableId>,
+}
+
+impl Pointer {
+    fn new(base: u32, storage: u32, type_id: TypeId) -> Pointer {
+        Pointer { base, storage, indices: vec![], type_id, swizzle: None, sampler: None }
+    }
+}
+
+// The structured control flow constructs the code being generated is nested in, used to resolve
+// the targets of the IR's branch instructions.
+enum Construct {
+    If { merge: u32 },
+    Switch { merge: u32, case_labels: Vec<u32>, current_case: usize },
+    Loop { merge: u32, continue_target: u32 },
+    LoopContinue { header: u32 },
+    LoopCondition { if_true: u32, merge: u32 },
+}
+
+// The incoming values of a merge block's input.
+#[derive(Default)]
+struct MergeEdges {
+    values: Vec<(u32, u32)>,
+    has_edge_without_value: bool,
+}
+
+fn write_instruction(blob: &mut Vec<u32>, opcode: u32, operands: &[u32]) {
+    blob.push(((operands.len() as u32 + 1) << 16) | opcode);
+    blob.extend_from_slice(operands);
+}
+
+fn write_string(blob: &mut Vec<u32>, string: &str) {
+    // Nul-terminated and padded to a whole word.
+    let mut bytes = string.as_bytes().to_vec();
+    bytes.resize((bytes.len() / 4 + 1) * 4, 0);
+    blob.extend(bytes.chunks(4).map(|chunk| u32::from_le_bytes(chunk.try_into().unwrap())));
+}
+
+struct Generator<'a> {
+    ir: &'a IR,
+    options: &'a compile::Options,
+    reflection: &'a reflection::Info,
+    shader_type: ShaderType,
+
+    next_id: u32,
+    uses_image_query: bool,
+    entry_point_interface: Vec<u32>,
+
+    // The sections of the module that are generated out of order.  Types, constants and global
+    // variables are declared in one section, as they are declared on demand.
+    decorations: Vec<u32>,
+    types_and_constants: Vec<u32>,
+    variables: Vec<u32>,
+    functions: Vec<u32>,
+
+    // Type caches.
+    ir_types: HashMap<TypeId, u32>,
+    vector_types: HashMap<(BasicType, u32), u32>,
+    matrix_types: HashMap<(u32, u32), u32>,
+    array_types: HashMap<(u32, u32), u32>,
+    pointer_types: HashMap<(u32, u32), u32>,
+    function_types: HashMap<Vec<u32>, u32>,
+    image_types: HashMap<(ImageBasicType, u32, bool), u32>,
+    sampled_image_to_image: HashMap<u32, u32>,
+    bool_type: Option<u32>,
+
+    // Constant caches.
+    scalar_constants: HashMap<(u32, u32), u32>,
+    composite_constants: HashMap<(u32, Vec<u32>), u32>,
+    null_constants: HashMap<u32, u32>,
+    ir_constants: HashMap<ConstantId, u32>,
+    constant_ids: HashSet<u32>,
+
+    function_ids: HashMap<FunctionId, u32>,
+    variable_pointers: HashMap<VariableId, Pointer>,
+    reflected_ids: Vec<(VariableId, ReflectionList, usize, u32)>,
+    texel_fetch_samplers: HashSet<VariableId>,
+    driver_uniforms_variable: u32,
+    instance_index_variable: Option<u32>,
+
+    // The state of the function being generated.
+    values: HashMap<RegisterId, u32>,
+    register_pointers: HashMap<RegisterId, Pointer>,
+    sampler_sources: HashMap<RegisterId, VariableId>,
+    locals: Vec<u32>,
+    body: Vec<u32>,
+    current_label: u32,
+    terminated: bool,
+    constructs: Vec<Construct>,
+    merge_edges: HashMap<u32, MergeEdges>,
+    is_main: bool,
+}
+
+impl<'a> Generator<'a> {
+    fn new(
+        ir: &'a IR,
+        options: &'a compile::Options,
+        reflection: &'a reflection::Info,
+    ) -> Generator<'a> {
+        Generator {
+            ir,
+            options,
+            reflection,
+            shader_type: ir.meta.get_shader_type(),
+            next_id: reserved::FIRST_UNRESERVED,
+            uses_image_query: false,
+            entry_point_interface: vec![],
+            decorations: vec![],
+            types_and_constants: vec![],
+            variables: vec![],
+            functions: vec![],
+            ir_types: HashMap::new(),
+            vector_types: HashMap::new(),
+            matrix_types: HashMap::new(),
+            array_types: HashMap::new(),
+            pointer_types: HashMap::new(),
+            function_types: HashMap::new(),
+            image_types: HashMap::new(),
+            sampled_image_to_image: HashMap::new(),
+            bool_type: None,
+            scalar_constants: HashMap::new(),
+            composite_constants: HashMap::new(),
+            null_constants: HashMap::new(),
+            ir_constants: HashMap::new(),
+            constant_ids: HashSet::new(),
+            function_ids: HashMap::new(),
+            variable_pointers: HashMap::new(),
+            reflected_ids: vec![],
+            texel_fetch_samplers: HashSet::new(),
+            driver_uniforms_variable: 0,
+            instance_index_variable: None,
+            values: HashMap::new(),
+            register_pointers: HashMap::new(),
+            sampler_sources: HashMap::new(),
+            locals: vec![],
+            body: vec![],
+            current_label: 0,
+            terminated: false,
+            constructs: vec![],
+            merge_edges: HashMap::new(),
+            is_main: false,
+        }
+    }
+
+    fn generate(&mut self) -> Result<Vec<u32>> {
+        self.declare_common_types();
+        self.declare_global_variables()?;
+        if self.shader_type == ShaderType::Vertex {
+            self.generate_transform_position();
+        }
+        self.generate_functions()?;
+        Ok(self.assemble())
+    }
+
+    fn reflection_updates(&self) -> Vec<ReflectionUpdate> {
+        self.reflected_ids
+            .iter()
+            .map(|&(variable_id, list, index, id)| ReflectionUpdate {
+                list,
+                index,
+                id,
+                texel_fetch_static_use: self.texel_fetch_samplers.contains(&variable_id),
+            })
+            .collect()
+    }
+
+    fn assemble(&mut self) -> Vec<u32> {
+        let mut blob = vec![SPIRV_MAGIC, SPIRV_VERSION, SPIRV_GENERATOR, 0, 0];
+
+        write_instruction(&mut blob, op::CAPABILITY, &[CAPABILITY_SHADER]);
+        if self.uses_image_query {
+            write_instruction(&mut blob, op::CAPABILITY, &[CAPABILITY_IMAGE_QUERY]);
+        }
+
+        // The non-semantic instructions are stripped by the SPIR-V transformer, so the driver
+        // never needs to support this extension.
+        let mut operands = vec![];
+        write_string(&mut operands, "SPV_KHR_non_semantic_info");
+        write_instruction(&mut blob, op::EXTENSION, &operands);
+
+        let mut operands = vec![reserved::GLSL_STD_INSTRUCTION_SET];
+        write_string(&mut operands, "GLSL.std.450");
+        write_instruction(&mut blob, op::EXT_INST_IMPORT, &operands);
+        let mut operands = vec![reserved::NON_SEMANTIC_INSTRUCTION_SET];
+        write_string(&mut operands, "NonSemantic.ANGLE");
+        write_instruction(&mut blob, op::EXT_INST_IMPORT, &operands);
+
+        // Logical addressing, GLSL450 memory model.
+        write_instruction(&mut blob, op::MEMORY_MODEL, &[0, 1]);
+
+        let execution_model = if self.shader_type == ShaderType::Vertex {
+            EXECUTION_MODEL_VERTEX
+        } else {
+            EXECUTION_MODEL_FRAGMENT
+        };
+        let mut operands = vec![execution_model, reserved::ENTRY_POINT];
+        write_string(&mut operands, "main");
+        operands.extend_from_slice(&self.entry_point_interface);
+        write_instruction(&mut blob, op::ENTRY_POINT, &operands);
+
+        if self.shader_type == ShaderType::Fragment {
+            write_instruction(
+                &mut blob,
+                op::EXECUTION_MODE,
+                &[reserved::ENTRY_POINT, EXECUTION_MODE_ORIGIN_UPPER_LEFT],
+            );
+            if self.ir.meta.get_early_fragment_tests() {
+                write_instruction(
+                    &mut blob,
+                    op::EXECUTION_MODE,
+                    &[reserved::ENTRY_POINT, EXECUTION_MODE_EARLY_FRAGMENT_TESTS],
+                );
+            }
+        }
+
+        write_instruction(&mut blob, op::SOURCE, &[SOURCE_LANGUAGE_GLSL, 450]);
+
+        blob.extend_from_slice(&self.decorations);
+        blob.extend_from_slice(&self.types_and_constants);
+        blob.extend_from_slice(&self.variables);
+
+        // The overview marks the end of the types section.
+        let overview_flags = if self.shader_type == ShaderType::Vertex {
+            OVERVIEW_HAS_OUTPUT_PER_VERTEX_MASK
+        } else {
+            0
+        };
+        let overview_id = self.new_id();
+        write_instruction(
+            &mut blob,
+            op::EXT_INST,
+            &[
+                reserved::VOID,
+                overview_id,
+                reserved::NON_SEMANTIC_INSTRUCTION_SET,
+                NON_SEMANTIC_OVERVIEW | overview_flags,
+            ],
+        );
+
+        blob.extend_from_slice(&self.functions);
+
+        blob[3] = self.next_id;
+        blob
+    }
+
+    fn new_id(&mut self) -> u32 {
+        let id = self.next_id;
+        self.next_id += 1;
+        id
+    }
+
+    fn decorate(&mut self, id: u32, decoration: u32, values: &[u32]) {
+        let mut operands = vec![id, decoration];
+        operands.extend_from_slice(values);
+        write_instruction(&mut self.decorations, op::DECORATE, &operands);
+    }
+
+    fn member_decorate(&mut self, id: u32, member: u32, decoration: u32, values: &[u32]) {
+        let mut operands = vec![id, member, decoration];
+        operands.extend_from_slice(values);
+        write_instruction(&mut self.decorations, op::MEMBER_DECORATE, &operands);
+    }
+
+    fn decorate_precision(&mut self, id: u32, precision: Precision) {
+        if matches!(precision, Precision::Low | Precision::Medium) {
+            self.decorate(id, DECORATION_RELAXED_PRECISION, &[]);
+        }
+    }
+
+    // Declares a type or constant and returns its id.
+    fn declare(&mut self, opcode: u32, operands_after_id: &[u32]) -> u32 {
+        let id = self.new_id();
+        let mut operands = vec![id];
+        operands.extend_from_slice(operands_after_id);
+        write_instruction(&mut self.types_and_constants, opcode, &operands);
+        id
+    }
+
+    // Declares a typed constant and returns its id.
+    fn declare_constant(&mut self, opcode: u32, type_id: u32, operands_after_id: &[u32]) -> u32 {
+        let id = self.new_id();
+        let mut operands = vec![type_id, id];
+        operands.extend_from_slice(operands_after_id);
+        write_instruction(&mut self.types_and_constants, opcode, &operands);
+        self.constant_ids.insert(id);
+        id
+    }
+
+    // Writes an instruction to the current function.
+    fn emit(&mut self, opcode: u32, operands: &[u32]) {
+        write_instruction(&mut self.body, opcode, operands);
+    }
+
+    // Writes an instruction that produces a result to the current function and returns its id.
+    fn emit_value(&mut self, opcode: u32, type_id: u32, operands: &[u32]) -> u32 {
+        let id = self.new_id();
+        self.body.push(((operands.len() as u32 + 3) << 16) | opcode);
+        self.body.push(type_id);
+        self.body.push(id);
+        self.body.extend_from_slice(operands);
+        id
+    }
+
+    fn emit_ext(&mut self, type_id: u32, instruction: u32, operands: &[u32]) -> u32 {
+        let mut ext_operands = vec![reserved::GLSL_STD_INSTRUCTION_SET, instruction];
+        ext_operands.extend_from_slice(operands);
+        self.emit_value(op::EXT_INST, type_id, &ext_operands)
+    }
+
+    fn emit_non_semantic(&mut self, instruction: u32) {
+        let id = self.new_id();
+        self.emit(
+            op::EXT_INST,
+            &[reserved::VOID, id, reserved::NON_SEMANTIC_INSTRUCTION_SET, instruction],
+        );
+    }
+
+    // The types, constants and pointer types the SPIR-V transformer expects at reserved ids.
+    fn declare_common_types(&mut self) {
+        let t = &mut self.types_and_constants;
+        write_instruction(t, op::TYPE_VOID, &[reserved::VOID]);
+        write_instruction(t, op::TYPE_FLOAT, &[reserved::FLOAT, 32]);
+        for size in 2..=4 {
+            let vec_id = reserved::VEC2 + size - 2;
+            let mat_id = reserved::MAT2 + size - 2;
+            write_instruction(t, op::TYPE_VECTOR, &[vec_id, reserved::FLOAT, size]);
+            write_instruction(t, op::TYPE_MATRIX, &[mat_id, vec_id, size]);
+            self.vector_types.insert((BasicType::Float, size), vec_id);
+            self.matrix_types.insert((size, size), mat_id);
+        }
+        write_instruction(t, op::TYPE_INT, &[reserved::UINT, 32, 0]);
+        write_instruction(t, op::TYPE_INT, &[reserved::INT, 32, 1]);
+        write_instruction(t, op::TYPE_VECTOR, &[reserved::IVEC2, reserved::INT, 2]);
+        write_instruction(t, op::TYPE_VECTOR, &[reserved::IVEC4, reserved::INT, 4]);
+        self.vector_types.insert((BasicType::Int, 2), reserved::IVEC2);
+        self.vector_types.insert((BasicType::Int, 4), reserved::IVEC4);
+
+        for value in 0..8 {
+            let id = reserved::INT_ZERO + value;
+            write_instruction(t, op::CONSTANT, &[reserved::INT, id, value]);
+            self.scalar_constants.insert((reserved::INT, value), id);
+            self.constant_ids.insert(id);
+        }
+        let two = 2.0f32.to_bits();
+        write_instruction(t, op::CONSTANT, &[reserved::FLOAT, reserved::FLOAT_TWO, two]);
+        self.scalar_constants.insert((reserved::FLOAT, two), reserved::FLOAT_TWO);
+        self.constant_ids.insert(reserved::FLOAT_TWO);
+
+        write_instruction(t, op::CONSTANT_NULL, &[reserved::VEC4, reserved::VEC4_ZERO]);
+        write_instruction(t, op::CONSTANT_NULL, &[reserved::IVEC4, reserved::IVEC4_ZERO]);
+        self.null_constants.insert(reserved::VEC4, reserved::VEC4_ZERO);
+        self.null_constants.insert(reserved::IVEC4, reserved::IVEC4_ZERO);
+        self.constant_ids.insert(reserved::VEC4_ZERO);
+        self.constant_ids.insert(reserved::IVEC4_ZERO);
+
+        for (type_id, storage, pointer_id) in [
+            (reserved::INT, STORAGE_CLASS_INPUT, reserved::INT_INPUT_TYPE_POINTER),
+            (reserved::VEC4, STORAGE_CLASS_INPUT, reserved::VEC4_INPUT_TYPE_POINTER),
+            (reserved::VEC4, STORAGE_CLASS_OUTPUT, reserved::VEC4_OUTPUT_TYPE_POINTER),
+            (reserved::VEC3, STORAGE_CLASS_OUTPUT, reserved::VEC3_OUTPUT_TYPE_POINTER),
+            (reserved::IVEC4, STORAGE_CLASS_FUNCTION, reserved::IVEC4_FUNCTION_TYPE_POINTER),
+        ] {
+            write_instruction(t, op::TYPE_POINTER, &[pointer_id, storage, type_id]);
+            self.pointer_types.insert((type_id, storage), pointer_id);
+        }
+    }
+
+    fn bool_type(&mut self) -> u32 {
+        if let Some(id) = self.bool_type {
+            return id;
+        }
+        let id = self.declare(op::TYPE_BOOL, &[]);
+        self.bool_type = Some(id);
+        id
+    }
+
+    fn basic_type(&mut self, basic: BasicType) -> Result<u32> {
+        match basic {
+            BasicType::Void => Ok(reserved::VOID),
+            BasicType::Float => Ok(reserved::FLOAT),
+            BasicType::Int => Ok(reserved::INT),
+            BasicType::Uint => Ok(reserved::UINT),
+            BasicType::Bool => Ok(self.bool_type()),
+            _ => Err(Unsupported),
+        }
+    }
+
+    fn vector_type(&mut self, basic: BasicType, size: u32) -> Result<u32> {
+        if size == 1 {
+            return self.basic_type(basic);
+        }
+        if let Some(&id) = self.vector_types.get(&(basic, size)) {
+            return Ok(id);
+        }
+        let component = self.basic_type(basic)?;
+        let id = self.declare(op::TYPE_VECTOR, &[component, size]);
+        self.vector_types.insert((basic, size), id);
+        Ok(id)
+    }
+
+    fn matrix_type(&mut self, rows: u32, columns: u32) -> Result<u32> {
+        if let Some(&id) = self.matrix_types.get(&(rows, columns)) {
+            return Ok(id);
+        }
+        let column = self.vector_type(BasicType::Float, rows)?;
+        let id = self.declare(op::TYPE_MATRIX, &[column, columns]);
+        self.matrix_types.insert((rows, columns), id);
+        Ok(id)
+    }
+
+    fn shape_type(&mut self, shape: Shape) -> Result<u32> {
+        if shape.columns > 0 {
+            self.matrix_type(shape.size, shape.columns)
+        } else {
+            self.vector_type(shape.basic, shape.size)
+        }
+    }
+
+    fn pointer_type(&mut self, pointee: u32, storage: u32) -> u32 {
+        if let Some(&id) = self.pointer_types.get(&(pointee, storage)) {
+            return id;
+        }
+        let id = self.declare(op::TYPE_POINTER, &[storage, pointee]);
+        self.pointer_types.insert((pointee, storage), id);
+        id
+    }
+
+    fn function_type(&mut self, return_type: u32, param_types: &[u32]) -> u32 {
+        let mut key = vec![return_type];
+        key.extend_from_slice(param_types);
+        if let Some(&id) = self.function_types.get(&key) {
+            return id;
+        }
+        let id = self.declare(op::TYPE_FUNCTION, &key);
+        self.function_types.insert(key, id);
+        id
+    }
+
+    fn sampled_image_type(&mut self, basic: ImageBasicType, image: &ImageType) -> Result<u32> {
+        let dim = match image.dimension {
+            ImageDimension::D2 => DIM_2D,
+            ImageDimension::D3 if !image.is_array => DIM_3D,
+            ImageDimension::Cube if !image.is_array => DIM_CUBE,
+            _ => return Err(Unsupported),
+        };
+        if !image.is_sampled || image.is_ms || image.is_shadow {
+            return Err(Unsupported);
+        }
+
+        let key = (basic, dim, image.is_array);
+        if let Some(&id) = self.image_types.get(&key) {
+            return Ok(id);
+        }
+        let sampled_type = match basic {
+            ImageBasicType::Float => reserved::FLOAT,
+            ImageBasicType::Int => reserved::INT,
+            ImageBasicType::Uint => reserved::UINT,
+        };
+        // Operands: sampled type, dim, depth, arrayed, multisampled, sampled, format.
+        let image_id =
+            self.declare(op::TYPE_IMAGE, &[sampled_type, dim, 0, image.is_array as u32, 0, 1, 0]);
+        let id = self.declare(op::TYPE_SAMPLED_IMAGE, &[image_id]);
+        self.image_types.insert(key, id);
+        self.sampled_image_to_image.insert(id, image_id);
+        Ok(id)
+    }
+
+    fn scalar_basic_type(&self, type_id: TypeId) -> Result<BasicType> {
+        match *self.ir.meta.get_type(type_id) {
+            Type::Scalar(basic) => Ok(basic),
+            _ => Err(Unsupported),
+        }
+    }
+
+    fn shape(&self, type_id: TypeId) -> Result<Shape> {
+        let ir = self.ir;
+        match *ir.meta.get_type(type_id) {
+            Type::Scalar(basic) => Ok(Shape { basic, size: 1, columns: 0 }),
+            Type::Vector(scalar, size) => {
+                Ok(Shape { basic: self.scalar_basic_type(scalar)?, size, columns: 0 })
+            }
+            Type::Matrix(column, columns) => {
+                let rows = ir.meta.get_type(column).get_vector_size().ok_or(Unsupported)?;
+                Ok(Shape { basic: BasicType::Float, size: rows, columns })
+            }
+            _ => Err(Unsupported),
+        }
+    }
+
+    // The SPIR-V type corresponding to an IR type.
+    fn type_id(&mut self, type_id: TypeId) -> Result<u32> {
+        if let Some(&id) = self.ir_types.get(&type_id) {
+            return Ok(id);
+        }
+
+        let ir = self.ir;
+        let id = match ir.meta.get_type(type_id) {
+            Type::Scalar(_) | Type::Vector(..) | Type::Matrix(..) => {
+                let shape = self.shape(type_id)?;
+                self.shape_type(shape)?
+            }
+            &Type::Array(element, size) => {
+                let element = self.type_id(element)?;
+                if let Some(&id) = self.array_types.get(&(element, size)) {
+                    id
+                } else {
+                    let length = self.uint_constant(size);
+                    let id = self.declare(op::TYPE_ARRAY, &[element, length]);
+                    self.array_types.insert((element, size), id);
+                    id
+                }
+            }
+            Type::Struct(_, fields, StructSpecialization::Struct) => {
+                let mut members = vec![];
+                for field in fields {
+                    members.push(self.type_id(field.type_id)?);
+                }
+                self.declare(op::TYPE_STRUCT, &members)
+            }
+            &Type::Image(basic, ref image) => self.sampled_image_type(basic, image)?,
+            _ => return Err(Unsupported),
+        };
+
+        self.ir_types.insert(type_id, id);
+        Ok(id)
+    }
+
+    fn scalar_constant(&mut self, type_id: u32, bits: u32) -> u32 {
+        if let Some(&id) = self.scalar_constants.get(&(type_id, bits)) {
+            return id;
+        }
+        let id = self.declare_constant(op::CONSTANT, type_id, &[bits]);
+        self.scalar_constants.insert((type_id, bits), id);
+        id
+    }
+
+    fn int_constant(&mut self, value: i32) -> u32 {
+        self.scalar_constant(reserved::INT, value as u32)
+    }
+
+    fn uint_constant(&mut self, value: u32) -> u32 {
+        self.scalar_constant(reserved::UINT, value)
+    }
+
+    fn float_constant(&mut self, value: f32) -> u32 {
+        self.scalar_constant(reserved::FLOAT, value.to_bits())
+    }
+
+    fn bool_constant(&mut self, value: bool) -> u32 {
+        let bool_type = self.bool_type();
+        let key = (bool_type, value as u32);
+        if let Some(&id) = self.scalar_constants.get(&key) {
+            return id;
+        }
+        let opcode = if value { op::CONSTANT_TRUE } else { op::CONSTANT_FALSE };
+        let id = self.declare_constant(opcode, bool_type, &[]);
+        self.scalar_constants.insert(key, id);
+        id
+    }
+
+    fn composite_constant(&mut self, type_id: u32, components: Vec<u32>) -> u32 {
+        let key = (type_id, components);
+        if let Some(&id) = self.composite_constants.get(&key) {
+            return id;
+        }
+        let id = self.declare_constant(op::CONSTANT_COMPOSITE, type_id, &key.1);
+        self.composite_constants.insert(key, id);
+        id
+    }
+
+    // A scalar or vector constant with all components set to 0 or 1.
+    fn splat_constant(&mut self, basic: BasicType, size: u32, value: i32) -> Result<u32> {
+        let scalar = match basic {
+            BasicType::Float => self.float_constant(value as f32),
+            BasicType::Int => self.int_constant(value),
+            BasicType::Uint => self.uint_constant(value as u32),
+            BasicType::Bool => self.bool_constant(value != 0),
+            _ => return Err(Unsupported),
+        };
+        if size == 1 {
+            return Ok(scalar);
+        }
+        let type_id = self.vector_type(basic, size)?;
+        Ok(self.composite_constant(type_id, vec![scalar; size as usize]))
+    }
+
+    fn ir_constant(&mut self, constant_id: ConstantId) -> Result<u32> {
+        if let Some(&id) = self.ir_constants.get(&constant_id) {
+            return Ok(id);
+        }
+
+        let ir = self.ir;
+        let constant = ir.meta.get_constant(constant_id);
+        let id = match &constant.value {
+            &ConstantValue::Float(value) => self.float_constant(value),
+            &ConstantValue::Int(value) => self.int_constant(value),
+            &ConstantValue::Uint(value) => self.uint_constant(value),
+            &ConstantValue::Bool(value) => self.bool_constant(value),
+            ConstantValue::YuvCsc(_) => return Err(Unsupported),
+            ConstantValue::Composite(elements) => {
+                let type_id = self.type_id(constant.type_id)?;
+                let mut components = vec![];
+                for &element in elements {
+                    components.push(self.ir_constant(element)?);
+                }
+                self.composite_constant(type_id, components)
+            }
+        };
+
+        self.ir_constants.insert(constant_id, id);
+        Ok(id)
+    }
+
+    fn reflected_index(variables: &[reflection::ShaderVariable], name: &str) -> Result<usize> {
+        variables.iter().position(|variable| variable.name == name).ok_or(Unsupported)
+    }
+
+    fn declare_global_variables(&mut self) -> Result<()> {
+        let ir = self.ir;
+        let is_vertex = self.shader_type == ShaderType::Vertex;
+
+        // Classify the variables first, so the shader interface variables can be given the first
+        // unreserved ids in declaration order.
+        let mut uniforms = vec![];
+        let mut samplers = vec![];
+        let mut inputs = vec![];
+        let mut outputs = vec![];
+        let mut built_ins = vec![];
+        let mut privates = vec![];
+        for &variable_id in ir.meta.all_global_variables() {
+            let variable = ir.meta.get_variable(variable_id);
+            if variable.is_dead_code_eliminated {
+                continue;
+            }
+
+            if let Some(built_in) = variable.built_in {
+                let supported = match built_in {
+                    BuiltIn::Position
+                    | BuiltIn::PointSize
+                    | BuiltIn::VertexIndex
+                    | BuiltIn::InstanceIndex => is_vertex,
+                    BuiltIn::FrontFacing | BuiltIn::FragColor => !is_vertex,
+                    _ => false,
+                };
+                if !supported
+                    || variable.decorations.decorations.iter().any(|decoration| {
+                        !matches!(decoration, Decoration::Input | Decoration::Output)
+                    })
+                {
+                    return Err(Unsupported);
+                }
+                if built_in == BuiltIn::FragColor {
+                    let index = Self::reflected_index(&self.reflection.outputs, "gl_FragColor")?;
+                    outputs.push((variable_id, index));
+                } else {
+                    built_ins.push(variable_id);
+                }
+                continue;
+            }
+
+            if !variable.is_interface_variable() {
+                privates.push(variable_id);
+                continue;
+            }
+
+            if variable.name.source != NameSource::ShaderInterface
+                || variable.decorations.decorations.iter().any(|decoration| {
+                    !matches!(
+                        decoration,
+                        Decoration::Smooth
+                            | Decoration::Flat
+                            | Decoration::NoPerspective
+                            | Decoration::Centroid
+                            | Decoration::Uniform
+                            | Decoration::Input
+                            | Decoration::Output
+                            | Decoration::Location(_)
+                            | Decoration::Binding(_)
+                    )
+                })
+            {
+                return Err(Unsupported);
+            }
+
+            let name = variable.name.name;
+            let type_id = ir.meta.get_pointee_type(variable.type_id);
+            let type_info = ir.meta.get_type(type_id);
+            let element_type_id = if type_info.is_array() {
+                type_info.get_element_type_id().unwrap()
+            } else {
+                type_id
+            };
+            let element_type_info = ir.meta.get_type(element_type_id);
+            if type_info.is_array_of_array(&ir.meta) {
+                return Err(Unsupported);
+            }
+
+            if variable.decorations.has(Decoration::Uniform) {
+                let index = Self::reflected_index(&self.reflection.uniforms, name)?;
+                if element_type_info.is_image() {
+                    samplers.push((variable_id, index));
+                } else if self.shape(element_type_id)?.basic == BasicType::Bool
+                    || !self.reflection.uniforms[index].active
+                {
+                    // The default uniform block layout calculated by the backend only includes
+                    // active uniforms, and bools are stored as uints.
+                    return Err(Unsupported);
+                } else {
+                    uniforms.push((variable_id, index));
+                }
+            } else {
+                // Varyings and attributes can only be numeric (except bool).
+                if self.shape(element_type_id)?.basic == BasicType::Bool {
+                    return Err(Unsupported);
+                }
+                if variable.decorations.has(Decoration::Input) {
+                    inputs
+                        .push((variable_id, Self::reflected_index(&self.reflection.inputs, name)?));
+                } else if variable.decorations.has(Decoration::Output) {
+                    outputs.push((
+                        variable_id,
+                        Self::reflected_index(&self.reflection.outputs, name)?,
+                    ));
+                } else {
+                    return Err(Unsupported);
+                }
+            }
+        }
+
+        // The backend lays out the default uniform block by the order of the uniforms in the
+        // reflection info.  That matches the declaration order, but verify it.
+        if !uniforms.windows(2).all(|pair| pair[0].1 < pair[1].1) {
+            return Err(Unsupported);
+        }
+        // The backend also gives arrays of samplers a layout in the default uniform block, which
+        // is not replicated here.
+        if !uniforms.is_empty()
+            && samplers.iter().any(|&(variable_id, _)| {
+                let variable = ir.meta.get_variable(variable_id);
+                ir.meta.get_type(ir.meta.get_pointee_type(variable.type_id)).is_array()
+            })
+        {
+            return Err(Unsupported);
+        }
+
+        // Assign ids to the shader interface variables in declaration order.
+        for &variable_id in ir.meta.all_global_variables() {
+            let reflected = [
+                (ReflectionList::Inputs, &inputs),
+                (ReflectionList::Outputs, &outputs),
+                (ReflectionList::Uniforms, &samplers),
+            ]
+            .into_iter()
+            .find_map(|(list, variables)| {
+                variables
+                    .iter()
+                    .find(|&&(id, _)| id == variable_id)
+                    .map(|&(_, index)| (list, index))
+            });
+            if let Some((list, index)) = reflected {
+                let id = self.new_id();
+                self.reflected_ids.push((variable_id, list, index, id));
+            }
+        }
+        let interface_ids: HashMap<VariableId, u32> =
+            self.reflected_ids.iter().map(|&(variable_id, _, _, id)| (variable_id, id)).collect();
+
+        self.declare_driver_uniforms();
+        if is_vertex {
+            self.declare_output_per_vertex();
+        }
+        self.declare_default_uniforms(&uniforms)?;
+
+        let mut next_binding = 1;
+        for &(variable_id, _) in &samplers {
+            let variable = ir.meta.get_variable(variable_id);
+            let id = interface_ids[&variable_id];
+            let pointee_type_id = ir.meta.get_pointee_type(variable.type_id);
+            let pointee = self.type_id(pointee_type_id)?;
+            let pointer_type = self.pointer_type(pointee, STORAGE_CLASS_UNIFORM_CONSTANT);
+            write_instruction(
+                &mut self.variables,
+                op::VARIABLE,
+                &[pointer_type, id, STORAGE_CLASS_UNIFORM_CONSTANT],
+            );
+            self.decorate(id, DECORATION_DESCRIPTOR_SET, &[0]);
+            self.decorate(id, DECORATION_BINDING, &[next_binding]);
+            next_binding += 1;
+
+            let mut pointer = Pointer::new(id, STORAGE_CLASS_UNIFORM_CONSTANT, pointee_type_id);
+            pointer.sampler = Some(variable_id);
+            self.variable_pointers.insert(variable_id, pointer);
+        }
+
+        for (variables, storage) in
+            [(&inputs, STORAGE_CLASS_INPUT), (&outputs, STORAGE_CLASS_OUTPUT)]
+        {
+            let mut next_location = 0;
+            for &(variable_id, _) in variables {
+                let variable = ir.meta.get_variable(variable_id);
+                let id = interface_ids[&variable_id];
+                let pointee_type_id = ir.meta.get_pointee_type(variable.type_id);
+                let pointee = self.type_id(pointee_type_id)?;
+                let pointer_type = self.pointer_type(pointee, storage);
+                write_instruction(&mut self.variables, op::VARIABLE, &[pointer_type, id, storage]);
+                self.entry_point_interface.push(id);
+                self.decorate_precision(id, variable.precision);
+
+                // gl_FragColor is the only fragment output.  The other variables are given the
+                // next location unless specified in the shader.
+                let explicit_location = variable.decorations.decorations.iter().find_map(
+                    |decoration| match decoration {
+                        &Decoration::Location(location) => Some(location),
+                        _ => None,
+                    },
+                );
+                let location = if variable.built_in == Some(BuiltIn::FragColor) {
+                    0
+                } else {
+                    let location = explicit_location.unwrap_or(next_location);
+                    next_location = location + self.location_count(pointee_type_id)?;
+                    location
+                };
+                self.decorate(id, DECORATION_LOCATION, &[location]);
+
+                let is_varying =
+                    (storage == STORAGE_CLASS_INPUT) != is_vertex && variable.built_in.is_none();
+                if is_varying {
+                    if variable.decorations.has(Decoration::Flat) {
+                        self.decorate(id, DECORATION_FLAT, &[]);
+                    }
+                    if variable.decorations.has(Decoration::NoPerspective) {
+                        self.decorate(id, DECORATION_NO_PERSPECTIVE, &[]);
+                    }
+                    if variable.decorations.has(Decoration::Centroid) {
+                        self.decorate(id, DECORATION_CENTROID, &[]);
+                    }
+                }
+
+                self.variable_pointers
+                    .insert(variable_id, Pointer::new(id, storage, pointee_type_id));
+            }
+        }
+
+        for &variable_id in &built_ins {
+            let variable = ir.meta.get_variable(variable_id);
+            let pointee_type_id = ir.meta.get_pointee_type(variable.type_id);
+            let pointer = match variable.built_in.unwrap() {
+                BuiltIn::Position | BuiltIn::PointSize => {
+                    let member = if variable.built_in == Some(BuiltIn::Position) { 0 } else { 1 };
+                    let mut pointer = Pointer::new(
+                        reserved::OUTPUT_PER_VERTEX_VAR,
+                        STORAGE_CLASS_OUTPUT,
+                        pointee_type_id,
+                    );
+                    pointer.indices.push(reserved::INT_ZERO + member);
+                    pointer
+                }
+                built_in => {
+                    let decoration = match built_in {
+                        BuiltIn::VertexIndex => BUILT_IN_VERTEX_INDEX,
+                        BuiltIn::InstanceIndex => BUILT_IN_INSTANCE_INDEX,
+                        _ => BUILT_IN_FRONT_FACING,
+                    };
+                    let pointee = self.type_id(pointee_type_id)?;
+                    let pointer_type = self.pointer_type(pointee, STORAGE_CLASS_INPUT);
+                    let id = self.new_id();
+                    write_instruction(
+                        &mut self.variables,
+                        op::VARIABLE,
+                        &[pointer_type, id, STORAGE_CLASS_INPUT],
+                    );
+                    self.decorate(id, DECORATION_BUILT_IN, &[decoration]);
+                    self.entry_point_interface.push(id);
+                    if built_in == BuiltIn::InstanceIndex {
+                        self.instance_index_variable = Some(id);
+                    }
+                    Pointer::new(id, STORAGE_CLASS_INPUT, pointee_type_id)
+                }
+            };
+            self.variable_pointers.insert(variable_id, pointer);
+        }
+
+        for &variable_id in &privates {
+            let variable = ir.meta.get_variable(variable_id);
+            let pointee_type_id = ir.meta.get_pointee_type(variable.type_id);
+            let pointee = self.type_id(pointee_type_id)?;
+            let pointer_type = self.pointer_type(pointee, STORAGE_CLASS_PRIVATE);
+            let id = self.new_id();
+            let mut operands = vec![pointer_type, id, STORAGE_CLASS_PRIVATE];
+            if let Some(initializer) = variable.initializer {
+                operands.push(self.ir_constant(initializer)?);
+            }
+            write_instruction(&mut self.variables, op::VARIABLE, &operands);
+            self.decorate_precision(id, variable.precision);
+            self.variable_pointers
+                .insert(variable_id, Pointer::new(id, STORAGE_CLASS_PRIVATE, pointee_type_id));
+        }
+
+        Ok(())
+    }
+
+    // The number of locations taken by an attribute or varying.
+    fn location_count(&self, type_id: TypeId) -> Result<u32> {
+        let ir = self.ir;
+        match *ir.meta.get_type(type_id) {
+            Type::Array(element, size) => Ok(self.location_count(element)? * size),
+            _ => {
+                let shape = self.shape(type_id)?;
+                Ok(shape.columns.max(1))
+            }
+        }
+    }
+
+    // The driver uniforms, see DriverUniform::createUniformFields:
+    //
+    //     layout(push_constant) uniform ANGLEUniformBlock
+    //     {
+    //         vec2 depthRange;
+    //         uint renderArea;
+    //         uint flipXY;
+    //         uint misc;
+    //         int baseInstance;
+    //         uvec2 acbBufferOffsets;
+    //     } ANGLEUniforms;
+    fn declare_driver_uniforms(&mut self) {
+        let uvec2 = self.vector_type(BasicType::Uint, 2).unwrap_or(reserved::UINT);
+        let members = [
+            (reserved::VEC2, 0),
+            (reserved::UINT, 8),
+            (reserved::UINT, 12),
+            (reserved::UINT, 16),
+            (reserved::INT, 20),
+            (uvec2, 24),
+        ];
+        let mut operands = vec![reserved::DRIVER_UNIFORMS_BLOCK];
+        operands.extend(members.iter().map(|&(type_id, _)| type_id));
+        write_instruction(&mut self.types_and_constants, op::TYPE_STRUCT, &operands);
+        self.decorate(reserved::DRIVER_UNIFORMS_BLOCK, DECORATION_BLOCK, &[]);
+        for (index, &(_, offset)) in members.iter().enumerate() {
+            self.member_decorate(
+                reserved::DRIVER_UNIFORMS_BLOCK,
+                index as u32,
+                DECORATION_OFFSET,
+                &[offset],
+            );
+        }
+
+        let pointer_type =
+            self.pointer_type(reserved::DRIVER_UNIFORMS_BLOCK, STORAGE_CLASS_PUSH_CONSTANT);
+        let id = self.new_id();
+        write_instruction(
+            &mut self.variables,
+            op::VARIABLE,
+            &[pointer_type, id, STORAGE_CLASS_PUSH_CONSTANT],
+        );
+        self.driver_uniforms_variable = id;
+    }
+
+    // Loads a scalar field of the driver uniforms.
+    fn load_driver_uniform(&mut self, field: u32, type_id: u32) -> u32 {
+        let pointer_type = self.pointer_type(type_id, STORAGE_CLASS_PUSH_CONSTANT);
+        let driver_uniforms = self.driver_uniforms_variable;
+        let pointer = self.emit_value(
+            op::ACCESS_CHAIN,
+            pointer_type,
+            &[driver_uniforms, reserved::INT_ZERO + field],
+        );
+        self.emit_value(op::LOAD, type_id, &[pointer])
+    }
+
+    // The implicitly declared gl_PerVertex output block:
+    //
+    //     out gl_PerVertex
+    //     {
+    //         vec4 gl_Position;
+    //         float gl_PointSize;
+    //     };
+    fn declare_output_per_vertex(&mut self) {
+        write_instruction(
+            &mut self.types_and_constants,
+            op::TYPE_STRUCT,
+            &[reserved::OUTPUT_PER_VERTEX_BLOCK, reserved::VEC4, reserved::FLOAT],
+        );
+        self.decorate(reserved::OUTPUT_PER_VERTEX_BLOCK, DECORATION_BLOCK, &[]);
+        self.member_decorate(
+            reserved::OUTPUT_PER_VERTEX_BLOCK,
+            0,
+            DECORATION_BUILT_IN,
+            &[BUILT_IN_POSITION],
+        );
+        self.member_decorate(
+            reserved::OUTPUT_PER_VERTEX_BLOCK,
+            1,
+            DECORATION_BUILT_IN,
+            &[BUILT_IN_POINT_SIZE],
+        );
+
+        write_instruction(
+            &mut self.types_and_constants,
+            op::TYPE_POINTER,
+            &[
+                reserved::OUTPUT_PER_VERTEX_TYPE_POINTER,
+                STORAGE_CLASS_OUTPUT,
+                reserved::OUTPUT_PER_VERTEX_BLOCK,
+            ],
+        );
+        self.pointer_types.insert(
+            (reserved::OUTPUT_PER_VERTEX_BLOCK, STORAGE_CLASS_OUTPUT),
+            reserved::OUTPUT_PER_VERTEX_TYPE_POINTER,
+        );
+
+        write_instruction(
+            &mut self.variables,
+            op::VARIABLE,
+            &[
+                reserved::OUTPUT_PER_VERTEX_TYPE_POINTER,
+                reserved::OUTPUT_PER_VERTEX_VAR,
+                STORAGE_CLASS_OUTPUT,
+            ],
+        );
+        self.entry_point_interface.push(reserved::OUTPUT_PER_VERTEX_VAR);
+    }
+
+    // The non-opaque uniforms are placed in a uniform block with the std140 layout, which is what
+    // the backend expects of the default uniform block.
+    fn declare_default_uniforms(&mut self, uniforms: &[(VariableId, usize)]) -> Result<()> {
+        if uniforms.is_empty() {
+            return Ok(());
+        }
+
+        let ir = self.ir;
+        let mut members = vec![];
+        let mut offset: u32 = 0;
+        for (index, &(variable_id, _)) in uniforms.iter().enumerate() {
+            let variable = ir.meta.get_variable(variable_id);
+            let type_id = ir.meta.get_pointee_type(variable.type_id);
+            let (member_type, alignment, size, is_matrix) = self.std140_layout(type_id)?;
+
+            offset = offset.next_multiple_of(alignment);
+            members.push(member_type);
+            let member = index as u32;
+            self.member_decorate(
+                reserved::DEFAULT_UNIFORMS_BLOCK,
+                member,
+                DECORATION_OFFSET,
+                &[offset],
+            );
+            if is_matrix {
+                self.member_decorate(
+                    reserved::DEFAULT_UNIFORMS_BLOCK,
+                    member,
+                    DECORATION_COL_MAJOR,
+                    &[],
+                );
+                self.member_decorate(
+                    reserved::DEFAULT_UNIFORMS_BLOCK,
+                    member,
+                    DECORATION_MATRIX_STRIDE,
+                    &[16],
+                );
+            }
+            if matches!(variable.precision, Precision::Low | Precision::Medium) {
+                self.member_decorate(
+                    reserved::DEFAULT_UNIFORMS_BLOCK,
+                    member,
+                    DECORATION_RELAXED_PRECISION,
+                    &[],
+                );
+            }
+            offset += size;
+        }
+
+        let mut operands = vec![reserved::DEFAULT_UNIFORMS_BLOCK];
+        operands.extend_from_slice(&members);
+        write_instruction(&mut self.types_and_constants, op::TYPE_STRUCT, &operands);
+        self.decorate(reserved::DEFAULT_UNIFORMS_BLOCK, DECORATION_BLOCK, &[]);
+
+        let pointer_type =
+            self.pointer_type(reserved::DEFAULT_UNIFORMS_BLOCK, STORAGE_CLASS_UNIFORM);
+        let id = self.new_id();
+        write_instruction(
+            &mut self.variables,
+            op::VARIABLE,
+            &[pointer_type, id, STORAGE_CLASS_UNIFORM],
+        );
+        self.decorate(id, DECORATION_DESCRIPTOR_SET, &[0]);
+        self.decorate(id, DECORATION_BINDING, &[0]);
+
+        for (index, &(variable_id, _)) in uniforms.iter().enumerate() {
+            let variable = ir.meta.get_variable(variable_id);
+            let mut pointer =
+                Pointer::new(id, STORAGE_CLASS_UNIFORM, ir.meta.get_pointee_type(variable.type_id));
+            pointer.indices.push(self.int_constant(index as i32));
+            self.variable_pointers.insert(variable_id, pointer);
+        }
+
+        Ok(())
+    }
+
+    // Returns the SPIR-V type, alignment and size of a default uniform with the std140 layout, and
+    // whether it is a matrix (or an array of matrices).
+    fn std140_layout(&mut self, type_id: TypeId) -> Result<(u32, u32, u32, bool)> {
+        let ir = self.ir;
+        if let &Type::Array(element, size) = ir.meta.get_type(type_id) {
+            let (element_type, _, element_size, is_matrix) = self.std140_layout(element)?;
+            let stride = element_size.next_multiple_of(16);
+            // The array type is decorated with a stride, so it's not shared with the arrays that
+            // are not in the uniform block.
+            let length = self.uint_constant(size);
+            let array_type = self.declare(op::TYPE_ARRAY, &[element_type, length]);
+            self.decorate(array_type, DECORATION_ARRAY_STRIDE, &[stride]);
+            return Ok((array_type, 16, stride * size, is_matrix));
+        }
+
+        let shape = self.shape(type_id)?;
+        let spirv_type = self.shape_type(shape)?;
+        if shape.columns > 0 {
+            Ok((spirv_type, 16, 16 * shape.columns, true))
+        } else {
+            let alignment = match shape.size {
+                1 => 4,
+                2 => 8,
+                _ => 16,
+            };
+            Ok((spirv_type, alignment, 4 * shape.size, false))
+        }
+    }
+
+    // Generates the function the SPIR-V transformer calls on gl_Position to apply pre-rotation and
+    // the depth correction, see AddVertexTransformationSupport:
+    //
+    //     vec4 ANGLETransformPosition(vec4 position)
+    //     {
+    //         return vec4((swapXY ? position.yx : position.xy) * flipXY,
+    //                     transformDepth ? (position.z + position.w) / 2 : position.z,
+    //                     position.w);
+    //     }
+    fn generate_transform_position(&mut self) {
+        let function_type = self.function_type(reserved::VEC4, &[reserved::VEC4]);
+        let bool_type = self.bool_type();
+        let bvec2 = self.vector_type(BasicType::Bool, 2).unwrap_or(bool_type);
+
+        self.body.clear();
+        let position = self.new_id();
+        let label = self.new_id();
+
+        // flipXY = unpackSnorm4x8(ANGLEUniforms.flipXY).zw
+        let flip_packed = self.load_driver_uniform(DRIVER_UNIFORMS_FLIP_XY, reserved::UINT);
+        let flip_unpacked = self.emit_ext(reserved::VEC4, glsl::UNPACK_SNORM_4X8, &[flip_packed]);
+        let flip = self.emit_value(
+            op::VECTOR_SHUFFLE,
+            reserved::VEC2,
+            &[flip_unpacked, flip_unpacked, 2, 3],
+        );
+
+        // swapXY = (ANGLEUniforms.misc & 1) != 0
+        let misc = self.load_driver_uniform(DRIVER_UNIFORMS_MISC, reserved::UINT);
+        let swap_mask = self.uint_constant(DRIVER_UNIFORMS_MISC_SWAP_XY_MASK);
+        let swap_bits = self.emit_value(op::BITWISE_AND, reserved::UINT, &[misc, swap_mask]);
+        let uint_zero = self.uint_constant(0);
+        let swap = self.emit_value(op::I_NOT_EQUAL, bool_type, &[swap_bits, uint_zero]);
+        let swap2 = self.emit_value(op::COMPOSITE_CONSTRUCT, bvec2, &[swap, swap]);
+
+        let xy = self.emit_value(op::VECTOR_SHUFFLE, reserved::VEC2, &[position, position, 0, 1]);
+        let yx = self.emit_value(op::VECTOR_SHUFFLE, reserved::VEC2, &[position, position, 1, 0]);
+        let rotated = self.emit_value(op::SELECT, reserved::VEC2, &[swap2, yx, xy]);
+        let transformed_xy = self.emit_value(op::F_MUL, reserved::VEC2, &[rotated, flip]);
+
+        let z = self.emit_value(op::COMPOSITE_EXTRACT, reserved::FLOAT, &[position, 2]);
+        let w = self.emit_value(op::COMPOSITE_EXTRACT, reserved::FLOAT, &[position, 3]);
+        let transformed_z = if self.options.add_vulkan_depth_correction {
+            let offset = self.uint_constant(DRIVER_UNIFORMS_MISC_TRANSFORM_DEPTH_OFFSET);
+            let mask = self.uint_constant(DRIVER_UNIFORMS_MISC_TRANSFORM_DEPTH_MASK);
+            let shifted = self.emit_value(op::SHIFT_RIGHT_LOGICAL, reserved::UINT, &[misc, offset]);
+            let bits = self.emit_value(op::BITWISE_AND, reserved::UINT, &[shifted, mask]);
+            let transform_depth = self.emit_value(op::I_NOT_EQUAL, bool_type, &[bits, uint_zero]);
+
+            let z_plus_w = self.emit_value(op::F_ADD, reserved::FLOAT, &[z, w]);
+            let half = self.float_constant(0.5);
+            let corrected = self.emit_value(op::F_MUL, reserved::FLOAT, &[z_plus_w, half]);
+            self.emit_value(op::SELECT, reserved::FLOAT, &[transform_depth, corrected, z])
+        } else {
+            z
+        };
+
+        let result = self.emit_value(
+            op::COMPOSITE_CONSTRUCT,
+            reserved::VEC4,
+            &[transformed_xy, transformed_z, w],
+        );
+        self.emit(op::RETURN_VALUE, &[result]);
+
+        let body = std::mem::take(&mut self.body);
+        let f = &mut self.functions;
+        write_instruction(
+            f,
+            op::FUNCTION,
+            &[reserved::VEC4, reserved::TRANSFORM_POSITION_FUNCTION, 0, function_type],
+        );
+        write_instruction(f, op::FUNCTION_PARAMETER, &[reserved::VEC4, position]);
+        write_instruction(f, op::LABEL, &[label]);
+        f.extend_from_slice(&body);
+        write_instruction(f, op::FUNCTION_END, &[]);
+    }
+
+    fn generate_functions(&mut self) -> Result<()> {
+        let ir = self.ir;
+        let main_id = ir.meta.get_main_function_id().ok_or(Unsupported)?;
+        let function_order = util::calculate_function_decl_order(&ir.meta, &ir.function_entries);
+
+        for &function_id in &function_order {
+            let id = if function_id == main_id { reserved::ENTRY_POINT } else { self.new_id() };
+            self.function_ids.insert(function_id, id);
+        }
+
+        for &function_id in &function_order {
+            let entry = ir.function_entries[function_id.id as usize].as_ref().ok_or(Unsupported)?;
+            self.generate_function(function_id, function_id == main_id, entry)?;
+        }
+
+        Ok(())
+    }
+
+    fn generate_function(
+        &mut self,
+        function_id: FunctionId,
+        is_main: bool,
+        entry: &Block,
+    ) -> Result<()> {
+        let ir = self.ir;
+        let function = ir.meta.get_function(function_id);
+
+        self.values.clear();
+        self.register_pointers.clear();
+        self.sampler_sources.clear();
+        self.locals.clear();
+        self.body.clear();
+        self.constructs.clear();
+        self.merge_edges.clear();
+        self.terminated = false;
+        self.is_main = is_main;
+
+        let return_type = self.type_id(function.return_type_id)?;
+        let mut param_types = vec![];
+        let mut params = vec![];
+        for param in &function.params {
+            let variable = ir.meta.get_variable(param.variable_id);
+            let pointee_type_id = ir.meta.get_pointee_type(variable.type_id);
+            if ir.meta.get_type(pointee_type_id).is_image() {
+                return Err(Unsupported);
+            }
+            let pointee = self.type_id(pointee_type_id)?;
+            let param_type = if param.direction == FunctionParamDirection::Input {
+                pointee
+            } else {
+                self.pointer_type(pointee, STORAGE_CLASS_FUNCTION)
+            };
+            param_types.push(param_type);
+            params.push((param.variable_id, param.direction, param_type, pointee, pointee_type_id));
+        }
+        let function_type = self.function_type(return_type, &param_types);
+
+        let id = self.function_ids[&function_id];
+        let mut header = vec![];
+        write_instruction(&mut header, op::FUNCTION, &[return_type, id, 0, function_type]);
+
+        // Parameters passed by value are copied to a local variable, as they can be modified by the
+        // function.
+        for (variable_id, direction, param_type, pointee, pointee_type_id) in params {
+            let param_id = self.new_id();
+            write_instruction(&mut header, op::FUNCTION_PARAMETER, &[param_type, param_id]);
+            let precision = ir.meta.get_variable(variable_id).precision;
+            let pointer_id = if direction == FunctionParamDirection::Input {
+                let local = self.local_variable(pointee);
+                self.emit(op::STORE, &[local, param_id]);
+                local
+            } else {
+                param_id
+            };
+            self.decorate_precision(pointer_id, precision);
+            self.variable_pointers.insert(
+                variable_id,
+                Pointer::new(pointer_id, STORAGE_CLASS_FUNCTION, pointee_type_id),
+            );
+        }
+
+        let label = self.new_id();
+        self.current_label = label;
+        if is_main {
+            self.emit_non_semantic(NON_SEMANTIC_ENTER);
+        }
+        self.generate_block(entry)?;
+
+        let f = &mut self.functions;
+        f.extend_from_slice(&header);
+        write_instruction(f, op::LABEL, &[label]);
+        f.extend_from_slice(&self.locals);
+        f.extend_from_slice(&self.body);
+        write_instruction(f, op::FUNCTION_END, &[]);
+
+        Ok(())
+    }
+
+    // Declares a variable in the function's entry block.
+    fn local_variable(&mut self, pointee: u32) -> u32 {
+        let pointer_type = self.pointer_type(pointee, STORAGE_CLASS_FUNCTION);
+        let id = self.new_id();
+        write_instruction(
+            &mut self.locals,
+            op::VARIABLE,
+            &[pointer_type, id, STORAGE_CLASS_FUNCTION],
+        );
+        id
+    }
+
+    fn generate_block(&mut self, block: &Block) -> Result<()> {
+        let ir = self.ir;
+
+        for &variable_id in &block.variables {
+            let variable = ir.meta.get_variable(variable_id);
+            let pointee_type_id = ir.meta.get_pointee_type(variable.type_id);
+            let pointee = self.type_id(pointee_type_id)?;
+            let id = self.local_variable(pointee);
+            self.decorate_precision(id, variable.precision);
+            if let Some(initializer) = variable.initializer {
+                let value = self.ir_constant(initializer)?;
+                self.emit(op::STORE, &[id, value]);
+            }
+            self.variable_pointers
+                .insert(variable_id, Pointer::new(id, STORAGE_CLASS_FUNCTION, pointee_type_id));
+        }
+
+        for instruction in &block.instructions {
+            let (opcode, result) = instruction.get_op_and_result(&ir.meta);
+            if opcode.is_branch() {
+                return self.generate_branch(opcode, block);
+            }
+            self.generate_instruction(opcode, result)?;
+        }
+
+        // Every block ends in a branch.
+        Err(Unsupported)
+    }
+
+    fn start_block(&mut self, label: u32) {
+        self.emit(op::LABEL, &[label]);
+        self.current_label = label;
+        self.terminated = false;
+    }
+
+    fn branch(&mut self, target: u32) {
+        self.emit(op::BRANCH, &[target]);
+        self.terminated = true;
+    }
+
+    fn branch_if_not_terminated(&mut self, target: u32) {
+        if !self.terminated {
+            self.branch(target);
+        }
+    }
+
+    fn add_merge_edge(&mut self, merge: u32, value: Option<u32>) {
+        let label = self.current_label;
+        let edges = self.merge_edges.entry(merge).or_default();
+        match value {
+            Some(value) => edges.values.push((value, label)),
+            None => edges.has_edge_without_value = true,
+        }
+    }
+
+    fn break_target(&self) -> Result<u32> {
+        self.constructs
+            .iter()
+            .rev()
+            .find_map(|construct| match *construct {
+                Construct::Switch { merge, .. } | Construct::Loop { merge, .. } => Some(merge),
+                _ => None,
+            })
+            .ok_or(Unsupported)
+    }
+
+    fn continue_target(&self) -> Result<u32> {
+        self.constructs
+            .iter()
+            .rev()
+            .find_map(|construct| match *construct {
+                Construct::Loop { continue_target, .. } => Some(continue_target),
+                Construct::LoopContinue { header } => Some(header),
+                _ => None,
+            })
+            .ok_or(Unsupported)
+    }
+
+    fn merge_target(&self) -> Result<u32> {
+        self.constructs
+            .iter()
+            .rev()
+            .find_map(|construct| match *construct {
+                Construct::If { merge } | Construct::Switch { merge, .. } => Some(merge),
+                _ => None,
+            })
+            .ok_or(Unsupported)
+    }
+
+    fn passthrough_target(&self) -> Result<u32> {
+        self.constructs
+            .iter()
+            .rev()
+            .find_map(|construct| match construct {
+                Construct::Switch { merge, case_labels, current_case } => {
+                    Some(case_labels.get(current_case + 1).copied().unwrap_or(*merge))
+                }
+                _ => None,
+            })
+            .ok_or(Unsupported)
+    }
+
+    fn loop_condition_targets(&self) -> Result<(u32, u32)> {
+        self.constructs
+            .iter()
+            .rev()
+            .find_map(|construct| match *construct {
+                Construct::LoopCondition { if_true, merge } => Some((if_true, merge)),
+                _ => None,
+            })
+            .ok_or(Unsupported)
+    }
+
+    fn generate_branch(&mut self, opcode: &OpCode, block: &Block) -> Result<()> {
+        match opcode {
+            OpCode::Discard => {
+                self.emit(op::KILL, &[]);
+                self.terminated = true;
+            }
+            OpCode::Return(value) => {
+                let value = value.as_ref().map(|value| self.value(value)).transpose()?;
+                if self.is_main {
+                    self.emit_non_semantic(NON_SEMANTIC_OUTPUT);
+                }
+                match value {
+                    Some(value) => self.emit(op::RETURN_VALUE, &[value]),
+                    None => self.emit(op::RETURN, &[]),
+                }
+                self.terminated = true;
+            }
+            OpCode::Break => {
+                let target = self.break_target()?;
+                self.branch(target);
+            }
+            OpCode::Continue => {
+                let target = self.continue_target()?;
+                self.branch(target);
+            }
+            OpCode::Passthrough => {
+                let target = self.passthrough_target()?;
+                self.branch(target);
+            }
+            OpCode::Merge(value) => {
+                let target = self.merge_target()?;
+                let value = value.as_ref().map(|value| self.value(value)).transpose()?;
+                self.add_merge_edge(target, value);
+                self.branch(target);
+            }
+            OpCode::NextBlock => {
+                let next = block.merge_block.as_deref().ok_or(Unsupported)?;
+                if next.input.is_some() {
+                    return Err(Unsupported);
+                }
+                return self.generate_block(next);
+            }
+            OpCode::If(condition) => return self.generate_if(condition, block),
+            OpCode::Loop => return self.generate_loop(block),
+            OpCode::DoLoop => return self.generate_do_loop(block),
+            OpCode::LoopIf(condition) => {
+                let condition = self.value(condition)?;
+                let (if_true, merge) = self.loop_condition_targets()?;
+                self.emit(op::BRANCH_CONDITIONAL, &[condition, if_true, merge]);
+                self.terminated = true;
+            }
+            OpCode::Switch(selector, cases) => return self.generate_switch(selector, cases, block),
+            _ => return Err(Unsupported),
+        }
+        Ok(())
+    }
+
+    // Starts the merge block of a construct, including its input if any.  If the merge block is
+    // unreachable, an empty block is generated in its place, as required by OpSelectionMerge and
+    // OpLoopMerge.
+    fn generate_merge_block(&mut self, label: u32, merge_block: Option<&Block>) -> Result<()> {
+        self.start_block(label);
+        let edges = self.merge_edges.remove(&label).unwrap_or_default();
+
+        let Some(merge_block) = merge_block else {
+            self.emit(op::UNREACHABLE, &[]);
+            self.terminated = true;
+            return Ok(());
+        };
+
+        if let Some(input) = merge_block.input {
+            if edges.has_edge_without_value {
+                return Err(Unsupported);
+            }
+            let type_id = self.type_id(input.type_id)?;
+            let id = if edges.values.is_empty() {
+                self.emit_value(op::UNDEF, type_id, &[])
+            } else {
+                let operands: Vec<u32> =
+                    edges.values.iter().flat_map(|&(value, label)| [value, label]).collect();
+                self.emit_value(op::PHI, type_id, &operands)
+            };
+            self.decorate_precision(id, input.precision);
+            self.values.insert(input.id, id);
+        }
+
+        self.generate_block(merge_block)
+    }
+
+    fn generate_if(&mut self, condition: &TypedId, block: &Block) -> Result<()> {
+        let condition = self.value(condition)?;
+        let merge = self.new_id();
+        let true_label = if block.block1.is_some() { self.new_id() } else { merge };
+        let false_label = if block.block2.is_some() { self.new_id() } else { merge };
+
+        self.emit(op::SELECTION_MERGE, &[merge, 0]);
+        self.emit(op::BRANCH_CONDITIONAL, &[condition, true_label, false_label]);
+        if true_label == merge || false_label == merge {
+            self.add_merge_edge(merge, None);
+        }
+        self.terminated = true;
+
+        self.constructs.push(Construct::If { merge });
+        for (label, sub_block) in [(true_label, &block.block1), (false_label, &block.block2)] {
+            if let Some(sub_block) = sub_block {
+                self.start_block(label);
+                self.generate_block(sub_block)?;
+                self.branch_if_not_terminated(merge);
+            }
+        }
+        self.constructs.pop();
+
+        self.generate_merge_block(merge, block.merge_block.as_deref())
+    }
+
+    // A while or for loop:
+    //
+    //     header:    OpLoopMerge %merge %continue; OpBranch %condition
+    //     condition: ...; OpBranchConditional %cond %body %merge
+    //     body:      ...; OpBranch %continue
+    //     continue:  ...; OpBranch %header
+    //     merge:
+    fn generate_loop(&mut self, block: &Block) -> Result<()> {
+        let header = self.new_id();
+        let condition = self.new_id();
+        let body = self.new_id();
+        let continue_target = self.new_id();
+        let merge = self.new_id();
+
+        self.branch(header);
+        self.start_block(header);
+        self.emit(op::LOOP_MERGE, &[merge, continue_target, 0]);
+        self.branch(condition);
+
+        self.start_block(condition);
+        match block.loop_condition.as_deref() {
+            Some(condition_block) => {
+                self.constructs.push(Construct::LoopCondition { if_true: body, merge });
+                self.generate_block(condition_block)?;
+                self.constructs.pop();
+                if !self.terminated {
+                    return Err(Unsupported);
+                }
+            }
+            None => self.branch(body),
+        }
+
+        self.start_block(body);
+        self.constructs.push(Construct::Loop { merge, continue_target });
+        if let Some(body_block) = block.block1.as_deref() {
+            self.generate_block(body_block)?;
+        }
+        self.constructs.pop();
+        self.branch_if_not_terminated(continue_target);
+
+        self.start_block(continue_target);
+        if let Some(continue_block) = block.block2.as_deref() {
+            self.constructs.push(Construct::LoopContinue { header });
+            self.generate_block(continue_block)?;
+            self.constructs.pop();
+        }
+        self.branch_if_not_terminated(header);
+
+        self.generate_merge_block(merge, block.merge_block.as_deref())
+    }
+
+    // A do-while loop, where the condition is the continue target:
+    //
+    //     header:    OpLoopMerge %merge %condition; OpBranch %body
+    //     body:      ...; OpBranch %condition
+    //     condition: ...; OpBranchConditional %cond %header %merge
+    //     merge:
+    fn generate_do_loop(&mut self, block: &Block) -> Result<()> {
+        if block.block2.is_some() {
+            return Err(Unsupported);
+        }
+        let condition_block = block.loop_condition.as_deref().ok_or(Unsupported)?;
+
+        let header = self.new_id();
+        let body = self.new_id();
+        let condition = self.new_id();
+        let merge = self.new_id();
+
+        self.branch(header);
+        self.start_block(header);
+        self.emit(op::LOOP_MERGE, &[merge, condition, 0]);
+        self.branch(body);
+
+        self.start_block(body);
+        self.constructs.push(Construct::Loop { merge, continue_target: condition });
+        if let Some(body_block) = block.block1.as_deref() {
+            self.generate_block(body_block)?;
+        }
+        self.constructs.pop();
+        self.branch_if_not_terminated(condition);
+
+        self.start_block(condition);
+        self.constructs.push(Construct::LoopCondition { if_true: header, merge });
+        self.generate_block(condition_block)?;
+        self.constructs.pop();
+        if !self.terminated {
+            return Err(Unsupported);
+        }
+
+        self.generate_merge_block(merge, block.merge_block.as_deref())
+    }
+
+    fn is_empty_passthrough(block: &Block) -> bool {
+        block.variables.is_empty()
+            && block.merge_block.is_none()
+            && matches!(
+                block.instructions.as_slice(),
+                [BlockInstruction::Void(OpCode::Passthrough)]
+            )
+    }
+
+    fn generate_switch(
+        &mut self,
+        selector: &TypedId,
+        cases: &[Option<ConstantId>],
+        block: &Block,
+    ) -> Result<()> {
+        let ir = self.ir;
+        let selector = self.value(selector)?;
+        let merge = self.new_id();
+
+        // Empty cases that fall through to the next one share its label.
+        let case_count = block.case_blocks.len();
+        let mut case_labels = vec![merge; case_count];
+        for index in (0..case_count).rev() {
+            case_labels[index] = if Self::is_empty_passthrough(&block.case_blocks[index]) {
+                case_labels.get(index + 1).copied().unwrap_or(merge)
+            } else {
+                self.new_id()
+            };
+        }
+
+        let default_label = cases
+            .iter()
+            .position(|case| case.is_none())
+            .map(|index| case_labels[index])
+            .unwrap_or(merge);
+        let mut operands = vec![selector, default_label];
+        for (index, case) in cases.iter().enumerate() {
+            if let &Some(value) = case {
+                operands.push(ir.meta.get_constant(value).value.get_index());
+                operands.push(case_labels[index]);
+            }
+        }
+        self.emit(op::SELECTION_MERGE, &[merge, 0]);
+        self.emit(op::SWITCH, &operands);
+        if operands[1..].iter().step_by(2).any(|&label| label == merge) {
+            self.add_merge_edge(merge, None);
+        }
+        self.terminated = true;
+
+        self.constructs.push(Construct::Switch {
+            merge,
+            case_labels: case_labels.clone(),
+            current_case: 0,
+        });
+        for (index, case_block) in block.case_blocks.iter().enumerate() {
+            if Self::is_empty_passthrough(case_block) {
+                continue;
+            }
+            if let Some(Construct::Switch { current_case, .. }) = self.constructs.last_mut() {
+                *current_case = index;
+            }
+            self.start_block(case_labels[index]);
+            self.generate_block(case_block)?;
+            let next = case_labels.get(index + 1).copied().unwrap_or(merge);
+            self.branch_if_not_terminated(next);
+        }
+        self.constructs.pop();
+
+        self.generate_merge_block(merge, block.merge_block.as_deref())
+    }
+
+    fn value(&mut self, id: &TypedId) -> Result<u32> {
+        match id.id {
+            Id::Register(register_id) => self.values.get(&register_id).copied().ok_or(Unsupported),
+            Id::Constant(constant_id) => self.ir_constant(constant_id),
+            Id::Variable(_) => Err(Unsupported),
+        }
+    }
+
+    fn pointer(&self, id: &TypedId) -> Result<Pointer> {
+        match id.id {
+            Id::Variable(variable_id) => {
+                self.variable_pointers.get(&variable_id).cloned().ok_or(Unsupported)
+            }
+            Id::Register(register_id) => {
+                self.register_pointers.get(&register_id).cloned().ok_or(Unsupported)
+            }
+            Id::Constant(_) => Err(Unsupported),
+        }
+    }
+
+    // Produces the pointer to load from or store to, applying the access chain if any.
+    fn materialize(&mut self, pointer: &Pointer) -> Result<u32> {
+        if pointer.indices.is_empty() {
+            return Ok(pointer.base);
+        }
+        // Arrays in the default uniform block have a stride, so they are of a different type than
+        // the IR array type.  Only their elements can be accessed.
+        if pointer.storage == STORAGE_CLASS_UNIFORM
+            && self.ir.meta.get_type(pointer.type_id).is_array()
+        {
+            return Err(Unsupported);
+        }
+        let pointee = self.type_id(pointer.type_id)?;
+        let pointer_type = self.pointer_type(pointee, pointer.storage);
+        let mut operands = vec![pointer.base];
+        operands.extend_from_slice(&pointer.indices);
+        Ok(self.emit_value(op::ACCESS_CHAIN, pointer_type, &operands))
+    }
+
+    fn load(&mut self, pointer: &Pointer) -> Result<u32> {
+        let pointer_id = self.materialize(pointer)?;
+        let pointee = self.type_id(pointer.type_id)?;
+        let loaded = self.emit_value(op::LOAD, pointee, &[pointer_id]);
+        match &pointer.swizzle {
+            None => Ok(loaded),
+            Some(swizzle) => {
+                let shape = self.shape(pointer.type_id)?;
+                let type_id = self.vector_type(shape.basic, swizzle.len() as u32)?;
+                let mut operands = vec![loaded, loaded];
+                operands.extend_from_slice(swizzle);
+                Ok(self.emit_value(op::VECTOR_SHUFFLE, type_id, &operands))
+            }
+        }
+    }
+
+    fn store(&mut self, pointer: &Pointer, value: u32) -> Result<()> {
+        let pointer_id = self.materialize(pointer)?;
+        let value = match &pointer.swizzle {
+            None => value,
+            Some(swizzle) => {
+                // Shuffle the written components into the current value.
+                let shape = self.shape(pointer.type_id)?;
+                let type_id = self.type_id(pointer.type_id)?;
+                let current = self.emit_value(op::LOAD, type_id, &[pointer_id]);
+                let mut components: Vec<u32> = (0..shape.size).collect();
+                for (index, &component) in swizzle.iter().enumerate() {
+                    components[component as usize] = shape.size + index as u32;
+                }
+                let mut operands = vec![current, value];
+                operands.extend_from_slice(&components);
+                self.emit_value(op::VECTOR_SHUFFLE, type_id, &operands)
+            }
+        };
+        self.emit(op::STORE, &[pointer_id, value]);
+        Ok(())
+    }
+
+    // Builds the pointer resulting from an access instruction.
+    fn access(&mut self, opcode: &OpCode, result: &TypedRegisterId) -> Result<Pointer> {
+        let result_type_id = self.ir.meta.get_pointee_type(result.type_id);
+        let mut pointer = match opcode {
+            OpCode::AccessVectorComponent(base, component) => {
+                let mut pointer = self.pointer(base)?;
+                let component = match pointer.swizzle.take() {
+                    Some(swizzle) => swizzle[*component as usize],
+                    None => *component,
+                };
+                pointer.indices.push(self.int_constant(component as i32));
+                pointer
+            }
+            OpCode::AccessVectorComponentMulti(base, components) => {
+                let mut pointer = self.pointer(base)?;
+                let swizzle = match &pointer.swizzle {
+                    Some(swizzle) => components.iter().map(|&c| swizzle[c as usize]).collect(),
+                    None => components.clone(),
+                };
+                pointer.swizzle = Some(swizzle);
+                // The pointer type remains that of the vector being swizzled.
+                return Ok(pointer);
+            }
+            OpCode::AccessVectorComponentDynamic(base, index)
+            | OpCode::AccessMatrixColumn(base, index)
+            | OpCode::AccessArrayElement(base, index) => {
+                let mut pointer = self.pointer(base)?;
+                if pointer.swizzle.is_some() {
+                    return Err(Unsupported);
+                }
+                pointer.indices.push(self.value(index)?);
+                pointer
+            }
+            OpCode::AccessStructField(base, field) => {
+                let mut pointer = self.pointer(base)?;
+                pointer.indices.push(self.int_constant(*field as i32));
+                pointer
+            }
+            OpCode::Alias(base) => return self.pointer(base),
+            _ => return Err(Unsupported),
+        };
+        pointer.type_id = result_type_id;
+        Ok(pointer)
+    }
+
+    fn generate_instruction(
+        &mut self,
+        opcode: &OpCode,
+        result: Option<TypedRegisterId>,
+    ) -> Result<()> {
+        let Some(result) = result else {
+            return match opcode {
+                OpCode::Store(pointer, value) => {
+                    let pointer = self.pointer(pointer)?;
+                    let value = self.value(value)?;
+                    self.store(&pointer, value)
+                }
+                OpCode::Call(function_id, args) => self.call(*function_id, args, None).map(|_| ()),
+                _ => Err(Unsupported),
+            };
+        };
+
+        if self.ir.meta.get_type(result.type_id).is_pointer() {
+            let pointer = self.access(opcode, &result)?;
+            self.register_pointers.insert(result.id, pointer);
+            return Ok(());
+        }
+
+        let id = self.generate_value_instruction(opcode, &result)?;
+        self.values.insert(result.id, id);
+
+        // The AST-based generator doesn't relax the precision of these instructions either, as
+        // their result is not a function of their operands' precision.
+        let keep_precision = matches!(
+            opcode,
+            OpCode::Unary(UnaryOpCode::FindLSB | UnaryOpCode::FindMSB | UnaryOpCode::BitCount, _)
+        );
+        if !keep_precision && !self.constant_ids.contains(&id) {
+            self.decorate_precision(id, result.precision);
+        }
+        Ok(())
+    }
+
+    fn generate_value_instruction(
+        &mut self,
+        opcode: &OpCode,
+        result: &TypedRegisterId,
+    ) -> Result<u32> {
+        let ir = self.ir;
+        let result_type = self.type_id(result.type_id)?;
+        match opcode {
+            OpCode::ExtractVectorComponent(value, component)
+            | OpCode::ExtractStructField(value, component) => {
+                let value = self.value(value)?;
+                Ok(self.emit_value(op::COMPOSITE_EXTRACT, result_type, &[value, *component]))
+            }
+            OpCode::ExtractVectorComponentMulti(value, components) => {
+                let value = self.value(value)?;
+                let mut operands = vec![value, value];
+                operands.extend_from_slice(components);
+                Ok(self.emit_value(op::VECTOR_SHUFFLE, result_type, &operands))
+            }
+            OpCode::ExtractVectorComponentDynamic(value, index) => {
+                let value = self.value(value)?;
+                let index = self.value(index)?;
+                Ok(self.emit_value(op::VECTOR_EXTRACT_DYNAMIC, result_type, &[value, index]))
+            }
+            OpCode::ExtractMatrixColumn(composite, index)
+            | OpCode::ExtractArrayElement(composite, index) => {
+                let composite_value = self.value(composite)?;
+                match index.id.get_if_constant() {
+                    Some(constant_id) => {
+                        let index = ir.meta.get_constant(constant_id).value.get_index();
+                        Ok(self.emit_value(
+                            op::COMPOSITE_EXTRACT,
+                            result_type,
+                            &[composite_value, index],
+                        ))
+                    }
+                    None => {
+                        // Dynamic indexing requires the composite to be in memory.
+                        let composite_type = self.type_id(composite.type_id)?;
+                        let temp = self.local_variable(composite_type);
+                        self.emit(op::STORE, &[temp, composite_value]);
+                        let index = self.value(index)?;
+                        let pointer_type = self.pointer_type(result_type, STORAGE_CLASS_FUNCTION);
+                        let pointer =
+                            self.emit_value(op::ACCESS_CHAIN, pointer_type, &[temp, index]);
+                        Ok(self.emit_value(op::LOAD, result_type, &[pointer]))
+                    }
+                }
+            }
+            OpCode::ConstructScalarFromScalar(value) => {
+                let shape = self.shape(value.type_id)?;
+                let target = self.shape(result.type_id)?;
+                let value = self.value(value)?;
+                self.convert(value, shape, target.basic)
+            }
+            OpCode::ConstructVectorFromScalar(value) => {
+                let shape = self.shape(value.type_id)?;
+                let target = self.shape(result.type_id)?;
+                let value = self.value(value)?;
+                let scalar = self.convert(value, shape, target.basic)?;
+                Ok(self.emit_value(
+                    op::COMPOSITE_CONSTRUCT,
+                    result_type,
+                    &vec![scalar; target.size as usize],
+                ))
+            }
+            OpCode::ConstructMatrixFromScalar(value) => {
+                let shape = self.shape(value.type_id)?;
+                let target = self.shape(result.type_id)?;
+                let value = self.value(value)?;
+                let scalar = self.convert(value, shape, BasicType::Float)?;
+                let zero = self.float_constant(0.0);
+                let column_type = self.vector_type(BasicType::Float, target.size)?;
+                let mut columns = vec![];
+                for column in 0..target.columns {
+                    let components: Vec<u32> = (0..target.size)
+                        .map(|row| if row == column { scalar } else { zero })
+                        .collect();
+                    columns.push(self.emit_value(
+                        op::COMPOSITE_CONSTRUCT,
+                        column_type,
+                        &components,
+                    ));
+                }
+                Ok(self.emit_value(op::COMPOSITE_CONSTRUCT, result_type, &columns))
+            }
+            OpCode::ConstructMatrixFromMatrix(value) => {
+                let shape = self.shape(value.type_id)?;
+                let target = self.shape(result.type_id)?;
+                let value = self.value(value)?;
+                self.resize_matrix(value, shape, target, result_type)
+            }
+            OpCode::ConstructVectorFromMultiple(args) => {
+                let target = self.shape(result.type_id)?;
+                let components = self.gather_components(args, target.basic, target.size)?;
+                if components.len() == 1 {
+                    return Ok(components[0]);
+                }
+                Ok(self.emit_value(op::COMPOSITE_CONSTRUCT, result_type, &components))
+            }
+            OpCode::ConstructMatrixFromMultiple(args) => {
+                let target = self.shape(result.type_id)?;
+                let column_type = self.vector_type(BasicType::Float, target.size)?;
+                let scalars =
+                    self.gather_scalars(args, BasicType::Float, target.size * target.columns)?;
+                let mut columns = vec![];
+                for column in scalars.chunks(target.size as usize) {
+                    columns.push(self.emit_value(op::COMPOSITE_CONSTRUCT, column_type, column));
+                }
+                Ok(self.emit_value(op::COMPOSITE_CONSTRUCT, result_type, &columns))
+            }
+            OpCode::ConstructStruct(args) | OpCode::ConstructArray(args) => {
+                let mut components = vec![];
+                for arg in args {
+                    components.push(self.value(arg)?);
+                }
+                Ok(self.emit_value(op::COMPOSITE_CONSTRUCT, result_type, &components))
+            }
+            OpCode::Load(pointer_id) => {
+                let pointer = self.pointer(pointer_id)?;
+                let mut value = self.load(&pointer)?;
+                if Some(pointer.base) == self.instance_index_variable {
+                    // gl_InstanceID = gl_InstanceIndex - ANGLEUniforms.baseInstance
+                    let base_instance =
+                        self.load_driver_uniform(DRIVER_UNIFORMS_BASE_INSTANCE, reserved::INT);
+                    value = self.emit_value(op::I_SUB, result_type, &[value, base_instance]);
+                }
+                if let Some(sampler) = pointer.sampler {
+                    self.sampler_sources.insert(result.id, sampler);
+                }
+                Ok(value)
+            }
+            OpCode::Alias(value) => self.value(value),
+            OpCode::Call(function_id, args) => {
+                self.call(*function_id, args, Some(result_type))?.ok_or(Unsupported)
+            }
+            OpCode::Unary(unary_op, operand) => {
+                self.generate_unary(*unary_op, operand, result, result_type)
+            }
+            OpCode::Binary(binary_op, lhs, rhs) => {
+                self.generate_binary(*binary_op, lhs, rhs, result, result_type)
+            }
+            OpCode::BuiltIn(built_in_op, args) => {
+                self.generate_built_in(*built_in_op, args, result, result_type)
+            }
+            OpCode::Texture(texture_op, sampler, coord) => {
+                self.generate_texture(texture_op, sampler, coord, result_type)
+            }
+            _ => Err(Unsupported),
+        }
+    }
+
+    // Converts a scalar or vector to another basic type, the same way the AST-based generator does.
+    fn convert(&mut self, value: u32, from: Shape, to: BasicType) -> Result<u32> {
+        if from.basic == to {
+            return Ok(value);
+        }
+        if from.columns > 0 {
+            return Err(Unsupported);
+        }
+        let target = self.vector_type(to, from.size)?;
+        match (from.basic, to) {
+            (BasicType::Bool, _) => {
+                let one = self.splat_constant(to, from.size, 1)?;
+                let zero = self.splat_constant(to, from.size, 0)?;
+                Ok(self.emit_value(op::SELECT, target, &[value, one, zero]))
+            }
+            (_, BasicType::Bool) => {
+                let zero = self.splat_constant(from.basic, from.size, 0)?;
+                let opcode = if from.basic == BasicType::Float {
+                    op::F_UNORD_NOT_EQUAL
+                } else {
+                    op::I_NOT_EQUAL
+                };
+                Ok(self.emit_value(opcode, target, &[value, zero]))
+            }
+            (BasicType::Float, BasicType::Int) => {
+                Ok(self.emit_value(op::CONVERT_F_TO_S, target, &[value]))
+            }
+            (BasicType::Float, BasicType::Uint) => {
+                Ok(self.emit_value(op::CONVERT_F_TO_U, target, &[value]))
+            }
+            (BasicType::Int, BasicType::Float) => {
+                Ok(self.emit_value(op::CONVERT_S_TO_F, target, &[value]))
+            }
+            (BasicType::Uint, BasicType::Float) => {
+                Ok(self.emit_value(op::CONVERT_U_TO_F, target, &[value]))
+            }
+            (BasicType::Int, BasicType::Uint) | (BasicType::Uint, BasicType::Int) => {
+                Ok(self.emit_value(op::BITCAST, target, &[value]))
+            }
+            _ => Err(Unsupported),
+        }
+    }
+
+    // Extracts the scalar components of the constructor arguments, converted to the target basic
+    // type, up to the given count.
+    fn gather_scalars(
+        &mut self,
+        args: &[TypedId],
+        basic: BasicType,
+        count: u32,
+    ) -> Result<Vec<u32>> {
+        let mut scalars = vec![];
+        for arg in args {
+            let shape = self.shape(arg.type_id)?;
+            let value = self.value(arg)?;
+            let scalar_shape = Shape { basic: shape.basic, size: 1, columns: 0 };
+            let scalar_type = self.basic_type(shape.basic)?;
+            if shape.columns == 0 && shape.size == 1 {
+                scalars.push(self.convert(value, scalar_shape, basic)?);
+                continue;
+            }
+            for column in 0..shape.columns.max(1) {
+                for row in 0..shape.size {
+                    if scalars.len() as u32 == count {
+                        return Ok(scalars);
+                    }
+                    let indices: &[u32] = if shape.columns > 0 { &[column, row] } else { &[row] };
+                    let mut operands = vec![value];
+                    operands.extend_from_slice(indices);
+                    let component = self.emit_value(op::COMPOSITE_EXTRACT, scalar_type, &operands);
+                    scalars.push(self.convert(component, scalar_shape, basic)?);
+                }
+            }
+        }
+        if scalars.len() as u32 == count { Ok(scalars) } else { Err(Unsupported) }
+    }
+
+    // Like gather_scalars, but keeps vector arguments whole where possible.
+    fn gather_components(
+        &mut self,
+        args: &[TypedId],
+        basic: BasicType,
+        count: u32,
+    ) -> Result<Vec<u32>> {
+        let mut whole = true;
+        let mut total = 0;
+        for arg in args {
+            let shape = self.shape(arg.type_id)?;
+            whole = whole && shape.columns == 0;
+            total += shape.size * shape.columns.max(1);
+        }
+        if !whole || total != count {
+            return self.gather_scalars(args, basic, count);
+        }
+
+        let mut components = vec![];
+        for arg in args {
+            let shape = self.shape(arg.type_id)?;
+            let value = self.value(arg)?;
+            components.push(self.convert(value, shape, basic)?);
+        }
+        Ok(components)
+    }
+
+    // Constructs a matrix from a matrix of a different size, taking components from the identity
+    // matrix where the source matrix is smaller.
+    fn resize_matrix(
+        &mut self,
+        value: u32,
+        from: Shape,
+        to: Shape,
+        result_type: u32,
+    ) -> Result<u32> {
+        if from == to {
+            return Ok(value);
+        }
+        let column_type = self.vector_type(BasicType::Float, to.size)?;
+        let source_column_type = self.vector_type(BasicType::Float, from.size)?;
+        let zero = self.float_constant(0.0);
+        let one = self.float_constant(1.0);
+        let mut columns = vec![];
+        for column in 0..to.columns {
+            if column < from.columns && from.size == to.size {
+                columns.push(self.emit_value(op::COMPOSITE_EXTRACT, column_type, &[value, column]));
+                continue;
+            }
+            let source = if column < from.columns {
+                Some(self.emit_value(op::COMPOSITE_EXTRACT, source_column_type, &[value, column]))
+            } else {
+                None
+            };
+            let mut components = vec![];
+            for row in 0..to.size {
+                components.push(match source {
+                    Some(source) if row < from.size => {
+                        self.emit_value(op::COMPOSITE_EXTRACT, reserved::FLOAT, &[source, row])
+                    }
+                    _ => {
+                        if row == column {
+                            one
+                        } else {
+                            zero
+                        }
+                    }
+                });
+            }
+            columns.push(self.emit_value(op::COMPOSITE_CONSTRUCT, column_type, &components));
+        }
+        Ok(self.emit_value(op::COMPOSITE_CONSTRUCT, result_type, &columns))
+    }
+
+    // Broadcasts a scalar to a vector of the given size.
+    fn splat(&mut self, value: u32, basic: BasicType, size: u32) -> Result<u32> {
+        if size == 1 {
+            return Ok(value);
+        }
+        let type_id = self.vector_type(basic, size)?;
+        Ok(self.emit_value(op::COMPOSITE_CONSTRUCT, type_id, &vec![value; size as usize]))
+    }
+
+    // Gets the value of an operand, broadcast to the given size if it's a scalar.
+    fn value_with_size(&mut self, id: &TypedId, size: u32) -> Result<u32> {
+        let shape = self.shape(id.type_id)?;
+        let value = self.value(id)?;
+        if shape.columns == 0 && shape.size == 1 {
+            self.splat(value, shape.basic, size)
+        } else {
+            Ok(value)
+        }
+    }
+
+    fn pick_opcode(basic: BasicType, float_op: u32, int_op: u32, uint_op: u32) -> Result<u32> {
+        let opcode = match basic {
+            BasicType::Float => float_op,
+            BasicType::Int => int_op,
+            BasicType::Uint => uint_op,
+            _ => 0,
+        };
+        if opcode == 0 { Err(Unsupported) } else { Ok(opcode) }
+    }
+
+    // Component-wise arithmetic, where either operand may be a scalar.  Matrices are handled one
+    // column at a time.
+    fn arithmetic(
+        &mut self,
+        opcodes: [u32; 3],
+        lhs: &TypedId,
+        rhs: &TypedId,
+        result: &TypedRegisterId,
+        result_type: u32,
+    ) -> Result<u32> {
+        let shape = self.shape(result.type_id)?;
+        let opcode = Self::pick_opcode(shape.basic, opcodes[0], opcodes[1], opcodes[2])?;
+        if shape.columns == 0 {
+            let lhs = self.value_with_size(lhs, shape.size)?;
+            let rhs = self.value_with_size(rhs, shape.size)?;
+            return Ok(self.emit_value(opcode, result_type, &[lhs, rhs]));
+        }
+
+        let column_type = self.vector_type(BasicType::Float, shape.size)?;
+        let mut operands = vec![];
+        for operand in [lhs, rhs] {
+            let is_matrix = self.shape(operand.type_id)?.columns > 0;
+            let value = self.value_with_size(operand, shape.size)?;
+            operands.push((value, is_matrix));
+        }
+        let mut columns = vec![];
+        for column in 0..shape.columns {
+            let mut column_operands = vec![];
+            for &(value, is_matrix) in &operands {
+                column_operands.push(if is_matrix {
+                    self.emit_value(op::COMPOSITE_EXTRACT, column_type, &[value, column])
+                } else {
+                    value
+                });
+            }
+            columns.push(self.emit_value(opcode, column_type, &column_operands));
+        }
+        Ok(self.emit_value(op::COMPOSITE_CONSTRUCT, result_type, &columns))
+    }
+
+    // Comparison of scalars or vectors, producing a boolean of the same size.
+    fn compare(
+        &mut self,
+        opcodes: [u32; 4],
+        lhs: &TypedId,
+        rhs: &TypedId,
+        result_type: u32,
+    ) -> Result<u32> {
+        let shape = self.shape(lhs.type_id)?;
+        if shape.columns > 0 {
+            return Err(Unsupported);
+        }
+        let opcode = match shape.basic {
+            BasicType::Bool => opcodes[3],
+            basic => Self::pick_opcode(basic, opcodes[0], opcodes[1], opcodes[2])?,
+        };
+        if opcode == 0 {
+            return Err(Unsupported);
+        }
+        let lhs = self.value(lhs)?;
+        let rhs = self.value(rhs)?;
+        Ok(self.emit_value(opcode, result_type, &[lhs, rhs]))
+    }
+
+    // Comparison of whole scalars or vectors, producing a single boolean.
+    fn compare_all(
+        &mut self,
+        opcodes: [u32; 4],
+        reduce: u32,
+        lhs: &TypedId,
+        rhs: &TypedId,
+        result_type: u32,
+    ) -> Result<u32> {
+        let shape = self.shape(lhs.type_id)?;
+        if shape.size == 1 {
+            return self.compare(opcodes, lhs, rhs, result_type);
+        }
+        let bool_vector = self.vector_type(BasicType::Bool, shape.size)?;
+        let components = self.compare(opcodes, lhs, rhs, bool_vector)?;
+        Ok(self.emit_value(reduce, result_type, &[components]))
+    }
+
+    // A GLSL.std.450 instruction with the scalar operands broadcast to the result size.
+    fn ext_with_size(
+        &mut self,
+        instruction: u32,
+        args: &[&TypedId],
+        result: &TypedRegisterId,
+        result_type: u32,
+    ) -> Result<u32> {
+        let size = self.shape(result.type_id)?.size;
+        let mut operands = vec![];
+        for arg in args {
+            operands.push(self.value_with_size(arg, size)?);
+        }
+        Ok(self.emit_ext(result_type, instruction, &operands))
+    }
+
+    fn ext_by_type(
+        &mut self,
+        instructions: [u32; 3],
+        args: &[&TypedId],
+        result: &TypedRegisterId,
+        result_type: u32,
+    ) -> Result<u32> {
+        let basic = self.shape(result.type_id)?.basic;
+        let instruction =
+            Self::pick_opcode(basic, instructions[0], instructions[1], instructions[2])?;
+        self.ext_with_size(instruction, args, result, result_type)
+    }
+
+    fn generate_unary(
+        &mut self,
+        unary_op: UnaryOpCode,
+        operand: &TypedId,
+        result: &TypedRegisterId,
+        result_type: u32,
+    ) -> Result<u32> {
+        use UnaryOpCode as U;
+
+        if matches!(
+            unary_op,
+            U::PrefixIncrement | U::PrefixDecrement | U::PostfixIncrement | U::PostfixDecrement
+        ) {
+            let shape = self.shape(result.type_id)?;
+            if shape.columns > 0 {
+                return Err(Unsupported);
+            }
+            let pointer = self.pointer(operand)?;
+            let current = self.load(&pointer)?;
+            let one = self.splat_constant(shape.basic, shape.size, 1)?;
+            let opcode = if matches!(unary_op, U::PrefixIncrement | U::PostfixIncrement) {
+                Self::pick_opcode(shape.basic, op::F_ADD, op::I_ADD, op::I_ADD)?
+            } else {
+                Self::pick_opcode(shape.basic, op::F_SUB, op::I_SUB, op::I_SUB)?
+            };
+            let updated = self.emit_value(opcode, result_type, &[current, one]);
+            self.store(&pointer, updated)?;
+            return Ok(if matches!(unary_op, U::PrefixIncrement | U::PrefixDecrement) {
+                updated
+            } else {
+                current
+            });
+        }
+
+        let shape = self.shape(operand.type_id)?;
+        let value = self.value(operand)?;
+        let glsl_instruction = match unary_op {
+            U::Radians => Some(glsl::RADIANS),
+            U::Degrees => Some(glsl::DEGREES),
+            U::Sin => Some(glsl::SIN),
+            U::Cos => Some(glsl::COS),
+            U::Tan => Some(glsl::TAN),
+            U::Asin => Some(glsl::ASIN),
+            U::Acos => Some(glsl::ACOS),
+            U::Atan => Some(glsl::ATAN),
+            U::Sinh => Some(glsl::SINH),
+            U::Cosh => Some(glsl::COSH),
+            U::Tanh => Some(glsl::TANH),
+            U::Asinh => Some(glsl::ASINH),
+            U::Acosh => Some(glsl::ACOSH),
+            U::Atanh => Some(glsl::ATANH),
+            U::Exp => Some(glsl::EXP),
+            U::Log => Some(glsl::LOG),
+            U::Exp2 => Some(glsl::EXP2),
+            U::Log2 => Some(glsl::LOG2),
+            U::Sqrt => Some(glsl::SQRT),
+            U::Inversesqrt => Some(glsl::INVERSE_SQRT),
+            U::Abs => Some(Self::pick_opcode(shape.basic, glsl::F_ABS, glsl::S_ABS, 0)?),
+            U::Sign => Some(Self::pick_opcode(shape.basic, glsl::F_SIGN, glsl::S_SIGN, 0)?),
+            U::Floor => Some(glsl::FLOOR),
+            U::Trunc => Some(glsl::TRUNC),
+            U::Round => Some(glsl::ROUND),
+            U::RoundEven => Some(glsl::ROUND_EVEN),
+            U::Ceil => Some(glsl::CEIL),
+            U::Fract => Some(glsl::FRACT),
+            U::PackSnorm2x16 => Some(glsl::PACK_SNORM_2X16),
+            U::PackHalf2x16 => Some(glsl::PACK_HALF_2X16),
+            U::UnpackSnorm2x16 => Some(glsl::UNPACK_SNORM_2X16),
+            U::UnpackHalf2x16 => Some(glsl::UNPACK_HALF_2X16),
+            U::PackUnorm2x16 => Some(glsl::PACK_UNORM_2X16),
+            U::UnpackUnorm2x16 => Some(glsl::UNPACK_UNORM_2X16),
+            U::PackUnorm4x8 => Some(glsl::PACK_UNORM_4X8),
+            U::PackSnorm4x8 => Some(glsl::PACK_SNORM_4X8),
+            U::UnpackUnorm4x8 => Some(glsl::UNPACK_UNORM_4X8),
+            U::UnpackSnorm4x8 => Some(glsl::UNPACK_SNORM_4X8),
+            U::Length => Some(glsl::LENGTH),
+            U::Normalize => Some(glsl::NORMALIZE),
+            U::Determinant => Some(glsl::DETERMINANT),
+            U::Inverse => Some(glsl::MATRIX_INVERSE),
+            U::FindLSB => Some(glsl::FIND_I_LSB),
+            U::FindMSB => {
+                Some(Self::pick_opcode(shape.basic, 0, glsl::FIND_S_MSB, glsl::FIND_U_MSB)?)
+            }
+            _ => None,
+        };
+        if let Some(instruction) = glsl_instruction {
+            return Ok(self.emit_ext(result_type, instruction, &[value]));
+        }
+
+        let opcode = match unary_op {
+            U::Negate => {
+                if shape.columns > 0 {
+                    let column_type = self.vector_type(BasicType::Float, shape.size)?;
+                    let mut columns = vec![];
+                    for column in 0..shape.columns {
+                        let column_value =
+                            self.emit_value(op::COMPOSITE_EXTRACT, column_type, &[value, column]);
+                        columns.push(self.emit_value(op::F_NEGATE, column_type, &[column_value]));
+                    }
+                    return Ok(self.emit_value(op::COMPOSITE_CONSTRUCT, result_type, &columns));
+                }
+                Self::pick_opcode(shape.basic, op::F_NEGATE, op::S_NEGATE, op::S_NEGATE)?
+            }
+            U::LogicalNot | U::Not => op::LOGICAL_NOT,
+            U::BitwiseNot => op::NOT,
+            U::Isnan => op::IS_NAN,
+            U::Isinf => op::IS_INF,
+            U::FloatBitsToInt | U::FloatBitsToUint | U::IntBitsToFloat | U::UintBitsToFloat => {
+                op::BITCAST
+            }
+            U::Transpose => op::TRANSPOSE,
+            U::Any => op::ANY,
+            U::All => op::ALL,
+            U::BitfieldReverse => op::BIT_REVERSE,
+            U::BitCount => op::BIT_COUNT,
+            _ => return Err(Unsupported),
+        };
+        Ok(self.emit_value(opcode, result_type, &[value]))
+    }
+
+    fn generate_binary(
+        &mut self,
+        binary_op: BinaryOpCode,
+        lhs: &TypedId,
+        rhs: &TypedId,
+        result: &TypedRegisterId,
+        result_type: u32,
+    ) -> Result<u32> {
+        use BinaryOpCode as B;
+
+        // [float, int, uint, bool]
+        const EQUAL: [u32; 4] = [op::F_ORD_EQUAL, op::I_EQUAL, op::I_EQUAL, op::LOGICAL_EQUAL];
+        const NOT_EQUAL: [u32; 4] =
+            [op::F_UNORD_NOT_EQUAL, op::I_NOT_EQUAL, op::I_NOT_EQUAL, op::LOGICAL_NOT_EQUAL];
+        const LESS_THAN: [u32; 4] = [op::F_ORD_LESS_THAN, op::S_LESS_THAN, op::U_LESS_THAN, 0];
+        const GREATER_THAN: [u32; 4] =
+            [op::F_ORD_GREATER_THAN, op::S_GREATER_THAN, op::U_GREATER_THAN, 0];
+        const LESS_THAN_EQUAL: [u32; 4] =
+            [op::F_ORD_LESS_THAN_EQUAL, op::S_LESS_THAN_EQUAL, op::U_LESS_THAN_EQUAL, 0];
+        const GREATER_THAN_EQUAL: [u32; 4] =
+            [op::F_ORD_GREATER_THAN_EQUAL, op::S_GREATER_THAN_EQUAL, op::U_GREATER_THAN_EQUAL, 0];
+
+        match binary_op {
+            B::Add => {
+                self.arithmetic([op::F_ADD, op::I_ADD, op::I_ADD], lhs, rhs, result, result_type)
+            }
+            B::Sub => {
+                self.arithmetic([op::F_SUB, op::I_SUB, op::I_SUB], lhs, rhs, result, result_type)
+            }
+            B::Mul | B::MatrixCompMult => {
+                self.arithmetic([op::F_MUL, op::I_MUL, op::I_MUL], lhs, rhs, result, result_type)
+            }
+            B::Div => {
+                self.arithmetic([op::F_DIV, op::S_DIV, op::U_DIV], lhs, rhs, result, result_type)
+            }
+            B::IMod => self.arithmetic([0, op::S_MOD, op::U_MOD], lhs, rhs, result, result_type),
+            B::Mod => self.arithmetic([op::F_MOD, 0, 0], lhs, rhs, result, result_type),
+            B::BitwiseOr => {
+                self.arithmetic([0, op::BITWISE_OR, op::BITWISE_OR], lhs, rhs, result, result_type)
+            }
+            B::BitwiseXor => self.arithmetic(
+                [0, op::BITWISE_XOR, op::BITWISE_XOR],
+                lhs,
+                rhs,
+                result,
+                result_type,
+            ),
+            B::BitwiseAnd => self.arithmetic(
+                [0, op::BITWISE_AND, op::BITWISE_AND],
+                lhs,
+                rhs,
+                result,
+                result_type,
+            ),
+            B::BitShiftLeft | B::BitShiftRight => {
+                let shape = self.shape(lhs.type_id)?;
+                let opcode = match binary_op {
+                    B::BitShiftLeft => op::SHIFT_LEFT_LOGICAL,
+                    _ => Self::pick_opcode(
+                        shape.basic,
+                        0,
+                        op::SHIFT_RIGHT_ARITHMETIC,
+                        op::SHIFT_RIGHT_LOGICAL,
+                    )?,
+                };
+                let lhs = self.value(lhs)?;
+                let rhs = self.value_with_size(rhs, shape.size)?;
+                Ok(self.emit_value(opcode, result_type, &[lhs, rhs]))
+            }
+            B::VectorTimesScalar | B::MatrixTimesScalar => {
+                let (composite, scalar) = if self.shape(lhs.type_id)?.size == 1
+                    && self.shape(lhs.type_id)?.columns == 0
+                {
+                    (rhs, lhs)
+                } else {
+                    (lhs, rhs)
+                };
+                if self.shape(result.type_id)?.basic != BasicType::Float {
+                    return self.arithmetic(
+                        [0, op::I_MUL, op::I_MUL],
+                        composite,
+                        scalar,
+                        result,
+                        result_type,
+                    );
+                }
+                let opcode = if binary_op == B::VectorTimesScalar {
+                    op::VECTOR_TIMES_SCALAR
+                } else {
+                    op::MATRIX_TIMES_SCALAR
+                };
+                let composite = self.value(composite)?;
+                let scalar = self.value(scalar)?;
+                Ok(self.emit_value(opcode, result_type, &[composite, scalar]))
+            }
+            B::VectorTimesMatrix
+            | B::MatrixTimesVector
+            | B::MatrixTimesMatrix
+            | B::OuterProduct => {
+                let opcode = match binary_op {
+                    B::VectorTimesMatrix => op::VECTOR_TIMES_MATRIX,
+                    B::MatrixTimesVector => op::MATRIX_TIMES_VECTOR,
+                    B::MatrixTimesMatrix => op::MATRIX_TIMES_MATRIX,
+                    _ => op::OUTER_PRODUCT,
+                };
+                let lhs = self.value(lhs)?;
+                let rhs = self.value(rhs)?;
+                Ok(self.emit_value(opcode, result_type, &[lhs, rhs]))
+            }
+            B::Dot => {
+                if self.shape(lhs.type_id)?.size == 1 {
+                    return self.arithmetic([op::F_MUL, 0, 0], lhs, rhs, result, result_type);
+                }
+                let lhs = self.value(lhs)?;
+                let rhs = self.value(rhs)?;
+                Ok(self.emit_value(op::DOT, result_type, &[lhs, rhs]))
+            }
+            B::LogicalXor => self.compare(NOT_EQUAL, lhs, rhs, result_type),
+            B::Equal => self.compare_all(EQUAL, op::ALL, lhs, rhs, result_type),
+            B::NotEqual => self.compare_all(NOT_EQUAL, op::ANY, lhs, rhs, result_type),
+            B::LessThan | B::LessThanVec => self.compare(LESS_THAN, lhs, rhs, result_type),
+            B::GreaterThan | B::GreaterThanVec => self.compare(GREATER_THAN, lhs, rhs, result_type),
+            B::LessThanEqual | B::LessThanEqualVec => {
+                self.compare(LESS_THAN_EQUAL, lhs, rhs, result_type)
+            }
+            B::GreaterThanEqual | B::GreaterThanEqualVec => {
+                self.compare(GREATER_THAN_EQUAL, lhs, rhs, result_type)
+            }
+            B::EqualVec => self.compare(EQUAL, lhs, rhs, result_type),
+            B::NotEqualVec => self.compare(NOT_EQUAL, lhs, rhs, result_type),
+            B::Atan => self.ext_with_size(glsl::ATAN2, &[lhs, rhs], result, result_type),
+            B::Pow => self.ext_with_size(glsl::POW, &[lhs, rhs], result, result_type),
+            B::Min => self.ext_by_type(
+                [glsl::F_MIN, glsl::S_MIN, glsl::U_MIN],
+                &[lhs, rhs],
+                result,
+                result_type,
+            ),
+            B::Max => self.ext_by_type(
+                [glsl::F_MAX, glsl::S_MAX, glsl::U_MAX],
+                &[lhs, rhs],
+                result,
+                result_type,
+            ),
+            B::Step => self.ext_with_size(glsl::STEP, &[lhs, rhs], result, result_type),
+            B::Ldexp => {
+                let lhs = self.value(lhs)?;
+                let rhs = self.value(rhs)?;
+                Ok(self.emit_ext(result_type, glsl::LDEXP, &[lhs, rhs]))
+            }
+            B::Distance | B::Cross | B::Reflect => {
+                let instruction = match binary_op {
+                    B::Distance => glsl::DISTANCE,
+                    B::Cross => glsl::CROSS,
+                    _ => glsl::REFLECT,
+                };
+                let lhs = self.value(lhs)?;
+                let rhs = self.value(rhs)?;
+                Ok(self.emit_ext(result_type, instruction, &[lhs, rhs]))
+            }
+            _ => Err(Unsupported),
+        }
+    }
+
+    fn generate_built_in(
+        &mut self,
+        built_in_op: BuiltInOpCode,
+        args: &[TypedId],
+        result: &TypedRegisterId,
+        result_type: u32,
+    ) -> Result<u32> {
+        use BuiltInOpCode as BI;
+
+        let arg = |index: usize| args.get(index).ok_or(Unsupported);
+        match built_in_op {
+            BI::Clamp => self.ext_by_type(
+                [glsl::F_CLAMP, glsl::S_CLAMP, glsl::U_CLAMP],
+                &[arg(0)?, arg(1)?, arg(2)?],
+                result,
+                result_type,
+            ),
+            BI::Mix => {
+                if self.shape(arg(2)?.type_id)?.basic == BasicType::Bool {
+                    let x = self.value(arg(0)?)?;
+                    let y = self.value(arg(1)?)?;
+                    let a = self.value(arg(2)?)?;
+                    return Ok(self.emit_value(op::SELECT, result_type, &[a, y, x]));
+                }
+                self.ext_with_size(glsl::F_MIX, &[arg(0)?, arg(1)?, arg(2)?], result, result_type)
+            }
+            BI::Smoothstep => self.ext_with_size(
+                glsl::SMOOTH_STEP,
+                &[arg(0)?, arg(1)?, arg(2)?],
+                result,
+                result_type,
+            ),
+            BI::Fma | BI::Faceforward | BI::Refract => {
+                let instruction = match built_in_op {
+                    BI::Fma => glsl::FMA,
+                    BI::Faceforward => glsl::FACE_FORWARD,
+                    _ => glsl::REFRACT,
+                };
+                let mut operands = vec![];
+                for arg in args {
+                    operands.push(self.value(arg)?);
+                }
+                Ok(self.emit_ext(result_type, instruction, &operands))
+            }
+            BI::BitfieldExtract | BI::BitfieldInsert => {
+                let basic = self.shape(result.type_id)?.basic;
+                let opcode = if built_in_op == BI::BitfieldInsert {
+                    op::BIT_FIELD_INSERT
+                } else {
+                    Self::pick_opcode(basic, 0, op::BIT_FIELD_S_EXTRACT, op::BIT_FIELD_U_EXTRACT)?
+                };
+                let mut operands = vec![];
+                for arg in args {
+                    operands.push(self.value(arg)?);
+                }
+                Ok(self.emit_value(opcode, result_type, &operands))
+            }
+            BI::TextureSize => {
+                let image = self.image_of(arg(0)?)?;
+                let lod = match args.get(1) {
+                    Some(lod) => self.value(lod)?,
+                    None => self.int_constant(0),
+                };
+                self.uses_image_query = true;
+                Ok(self.emit_value(op::IMAGE_QUERY_SIZE_LOD, result_type, &[image, lod]))
+            }
+            BI::TexelFetch | BI::TexelFetchOffset => {
+                let image = self.image_of(arg(0)?)?;
+                if let Id::Register(register_id) = arg(0)?.id {
+                    if let Some(&sampler) = self.sampler_sources.get(&register_id) {
+                        self.texel_fetch_samplers.insert(sampler);
+                    }
+                }
+                let coord = self.value(arg(1)?)?;
+                let lod = self.value(arg(2)?)?;
+                let mut operands = vec![image, coord, IMAGE_OPERANDS_LOD, lod];
+                if built_in_op == BI::TexelFetchOffset {
+                    let offset = arg(3)?.id.get_if_constant().ok_or(Unsupported)?;
+                    operands[2] |= IMAGE_OPERANDS_CONST_OFFSET;
+                    operands.push(self.ir_constant(offset)?);
+                }
+                Ok(self.emit_value(op::IMAGE_FETCH, result_type, &operands))
+            }
+            _ => Err(Unsupported),
+        }
+    }
+
+    // Extracts the image from a sampled image.
+    fn image_of(&mut self, sampler: &TypedId) -> Result<u32> {
+        let sampled_image_type = self.type_id(sampler.type_id)?;
+        let image_type =
+            *self.sampled_image_to_image.get(&sampled_image_type).ok_or(Unsupported)?;
+        let sampled_image = self.value(sampler)?;
+        Ok(self.emit_value(op::IMAGE, image_type, &[sampled_image]))
+    }
+
+    fn generate_texture(
+        &mut self,
+        texture_op: &TextureOpCode,
+        sampler: &TypedId,
+        coord: &TypedId,
+        result_type: u32,
+    ) -> Result<u32> {
+        let ir = self.ir;
+        let (is_proj, bias, lod, grad, offset) = match texture_op {
+            TextureOpCode::Implicit { is_proj, offset } => (*is_proj, None, None, None, offset),
+            TextureOpCode::Bias { is_proj, bias, offset } => {
+                (*is_proj, Some(bias), None, None, offset)
+            }
+            TextureOpCode::Lod { is_proj, lod, offset } => {
+                (*is_proj, None, Some(lod), None, offset)
+            }
+            TextureOpCode::Grad { is_proj, dx, dy, offset } => {
+                (*is_proj, None, None, Some((dx, dy)), offset)
+            }
+            _ => return Err(Unsupported),
+        };
+
+        let sampled_image = self.value(sampler)?;
+        let mut coord_value = self.value(coord)?;
+
+        // textureProj(sampler2D, vec4) divides by the w component; z is ignored.
+        let (_, image_type) = ir.meta.get_type(sampler.type_id).get_image_type();
+        if is_proj
+            && image_type.dimension == ImageDimension::D2
+            && !image_type.is_array
+            && self.shape(coord.type_id)?.size == 4
+        {
+            coord_value = self.emit_value(
+                op::VECTOR_SHUFFLE,
+                reserved::VEC3,
+                &[coord_value, coord_value, 0, 1, 3],
+            );
+        }
+
+        // Implicit derivatives are only available in fragment shaders.
+        let is_fragment = self.shader_type == ShaderType::Fragment;
+        let mut lod = lod.map(|lod| self.value(lod)).transpose()?;
+        if !is_fragment && grad.is_none() && lod.is_none() {
+            if bias.is_some() {
+                return Err(Unsupported);
+            }
+            lod = Some(self.float_constant(0.0));
+        }
+        let is_explicit = lod.is_some() || grad.is_some();
+
+        // The image operands are ordered by their bit in the mask.
+        let mut mask = 0;
+        let mut image_operands = vec![];
+        if let Some(bias) = bias {
+            mask |= IMAGE_OPERANDS_BIAS;
+            image_operands.push(self.value(bias)?);
+        }
+        if let Some(lod) = lod {
+            mask |= IMAGE_OPERANDS_LOD;
+            image_operands.push(lod);
+        }
+        if let Some((dx, dy)) = grad {
+            mask |= IMAGE_OPERANDS_GRAD;
+            image_operands.push(self.value(dx)?);
+            image_operands.push(self.value(dy)?);
+        }
+        if let Some(offset) = offset {
+            let offset = offset.id.get_if_constant().ok_or(Unsupported)?;
+            mask |= IMAGE_OPERANDS_CONST_OFFSET;
+            image_operands.push(self.ir_constant(offset)?);
+        }
+
+        let opcode = match (is_proj, is_explicit) {
+            (false, false) => op::IMAGE_SAMPLE_IMPLICIT_LOD,
+            (false, true) => op::IMAGE_SAMPLE_EXPLICIT_LOD,
+            (true, false) => op::IMAGE_SAMPLE_PROJ_IMPLICIT_LOD,
+            (true, true) => op::IMAGE_SAMPLE_PROJ_EXPLICIT_LOD,
+        };
+        let mut operands = vec![sampled_image, coord_value];
+        if mask != 0 {
+            operands.push(mask);
+            operands.extend_from_slice(&image_operands);
+        }
+        Ok(self.emit_value(opcode, result_type, &operands))
+    }
+
+    // Calls a function.  `in` arguments are passed by value, while `out` and `inout` arguments are
+    // passed through temporary variables that are copied back after the call, as the argument
+    // may not be something an OpFunctionCall can take a pointer to (such as a swizzle or a
+    // uniform).
+    fn call(
+        &mut self,
+        function_id: FunctionId,
+        args: &[TypedId],
+        result_type: Option<u32>,
+    ) -> Result<Option<u32>> {
+        let ir = self.ir;
+        let function = *self.function_ids.get(&function_id).ok_or(Unsupported)?;
+        let params = &ir.meta.get_function(function_id).params;
+        if params.len() != args.len() {
+            return Err(Unsupported);
+        }
+
+        let mut operands = vec![function];
+        let mut copy_back = vec![];
+        for (param, arg) in params.iter().zip(args) {
+            if param.direction == FunctionParamDirection::Input {
+                let value = if ir.meta.get_type(arg.type_id).is_pointer() {
+                    let pointer = self.pointer(arg)?;
+                    self.load(&pointer)?
+                } else {
+                    self.value(arg)?
+                };
+                operands.push(value);
+                continue;
+            }
+
+            let variable = ir.meta.get_variable(param.variable_id);
+            let pointee = self.type_id(ir.meta.get_pointee_type(variable.type_id))?;
+            let temp = self.local_variable(pointee);
+            let pointer = self.pointer(arg)?;
+            if param.direction == FunctionParamDirection::InputOutput {
+                let value = self.load(&pointer)?;
+                self.emit(op::STORE, &[temp, value]);
+            }
+            operands.push(temp);
+            copy_back.push((pointer, temp, pointee));
+        }
+
+        let result_type = result_type.unwrap_or(reserved::VOID);
+        let id = self.emit_value(op::FUNCTION_CALL, result_type, &operands);
+
+        for (pointer, temp, pointee) in copy_back {
+            let value = self.emit_value(op::LOAD, pointee, &[temp]);
+            self.store(&pointer, value)?;
+        }
+
+        Ok(if result_type == reserved::VOID { None } else { Some(id) })
+    }
+}
@@ -6698,9 +6698,6 @@ spirv::Blob OutputSPIRVTraverser::getSpirv()
 {
     spirv::Blob result = mBuilder.getSpirv();
 
-    // Validate that correct SPIR-V was generated
-    ASSERT(spirv::Validate(result));
-
 #if ANGLE_DEBUG_SPIRV_GENERATION
     // Disassemble and log the generated SPIR-V for debugging.
     spvtools::SpirvTools spirvTools(mCompileOptions.emitSPIRV14 ? SPV_ENV_VULKAN_1_1_SPIRV_1_4
@@ -6722,6 +6719,8 @@ bool OutputSPIRV(TCompiler *compiler,
                  const angle::HashMap<int, uint32_t> &uniqueToSpirvIdMap,
                  uint32_t firstUnusedSpirvId)
 {
+    const uint64_t outputStartTimeNs = angle::GetCurrentSystemTimeNs();
+
     // Find the list of nodes that require NoContraction (as a result of |precise|).
     if (compiler->hasAnyPreciseType())
     {
@@ -6733,8 +6732,20 @@ bool OutputSPIRV(TCompiler *compiler,
                                    firstUnusedSpirvId);
     root->traverse(&traverser);
 
-    // Generate the final SPIR-V and store in the sink
+    // Generate the final SPIR-V
     spirv::Blob spirvBlob = traverser.getSpirv();
+    compiler->recordCompileStage("OutputSPIRV",
+                                 angle::GetCurrentSystemTimeNs() - outputStartTimeNs);
+
+#if defined(ANGLE_ENABLE_ASSERTS)
+    // Validate that correct SPIR-V was generated
+    const uint64_t validateStartTimeNs = angle::GetCurrentSystemTimeNs();
+    ASSERT(spirv::Validate(spirvBlob));
+    compiler->recordCompileStage("ValidateSPIRV",
+                                 angle::GetCurrentSystemTimeNs() - validateStartTimeNs);
+#endif
+
+    // Store the SPIR-V in the sink
     compiler->getInfoSink().obj.setBinary(std::move(spirvBlob));
 
     return true;
@@ -13,6 +13,8 @@
 #include "common/unsafe_buffers.h"
 
 #include "common/PackedEnums.h"
+#include "common/spirv/spirv_types.h"
+#include "common/system_utils.h"
 #include "common/utilities.h"
 #include "compiler/translator/ImmutableStringBuilder.h"
 #include "compiler/translator/IntermNode.h"
@@ -656,7 +658,9 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                                            UnsupportedFunctionArgs::ArrayOfArrayOfSamplerOrImage,
                                            UnsupportedFunctionArgs::AtomicCounter,
                                            UnsupportedFunctionArgs::Image};
-        if (!MonomorphizeUnsupportedFunctions(this, root, &getSymbolTable(), args))
+        if (!runASTPass("MonomorphizeUnsupportedFunctions", [&] {
+                return MonomorphizeUnsupportedFunctions(this, root, &getSymbolTable(), args);
+            }))
         {
             return false;
         }
@@ -664,12 +668,16 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
     if (aggregateTypesUsedForUniforms > 0)
     {
-        if (!SeparateStructFromUniformDeclarations(this, root, &getSymbolTable()))
+        if (!runASTPass("SeparateStructFromUniformDeclarations", [&] {
+                return SeparateStructFromUniformDeclarations(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
 
-        if (!RewriteStructSamplers(this, root, &getSymbolTable()))
+        if (!runASTPass("RewriteStructSamplers", [&] {
+                return RewriteStructSamplers(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -678,12 +686,16 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
     // Replace array of array of opaque uniforms with a flattened array.  This is run after
     // MonomorphizeUnsupportedFunctions and RewriteStructSamplers so that it's not possible for an
     // array of array of opaque type to be partially subscripted and passed to a function.
-    if (!RewriteArrayOfArrayOfOpaqueUniforms(this, root, &getSymbolTable()))
+    if (!runASTPass("RewriteArrayOfArrayOfOpaqueUniforms", [&] {
+            return RewriteArrayOfArrayOfOpaqueUniforms(this, root, &getSymbolTable());
+        }))
     {
         return false;
     }
 
-    if (!FlagSamplersForTexelFetch(this, root, &getSymbolTable(), &mUniforms))
+    if (!runASTPass("FlagSamplersForTexelFetch", [&] {
+            return FlagSamplersForTexelFetch(this, root, &getSymbolTable(), &mUniforms);
+        }))
     {
         return false;
     }
@@ -693,8 +705,11 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
     if (defaultUniformCount > 0)
     {
         const TVariable *uniformBlock;
-        if (!GatherDefaultUniforms(this, root, &getSymbolTable(), packedShaderType,
-                                   kDefaultUniformsBlockName, ImmutableString(""), &uniformBlock))
+        if (!runASTPass("GatherDefaultUniforms", [&] {
+                return GatherDefaultUniforms(this, root, &getSymbolTable(), packedShaderType,
+                                             kDefaultUniformsBlockName, ImmutableString(""),
+                                             &uniformBlock);
+            }))
         {
             return false;
         }
@@ -719,8 +734,10 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
     if (getShaderType() == GL_VERTEX_SHADER)
     {
-        if (!ShaderBuiltinsWorkaround(this, root, driverUniforms, &getSymbolTable(),
-                                      compileOptions))
+        if (!runASTPass("ShaderBuiltinsWorkaround", [&] {
+                return ShaderBuiltinsWorkaround(this, root, driverUniforms, &getSymbolTable(),
+                                                compileOptions);
+            }))
         {
             return false;
         }
@@ -728,7 +745,9 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
     if (r32fImageCount > 0 && compileOptions.emulateR32fImageAtomicExchange)
     {
-        if (!RewriteR32fImages(this, root, &getSymbolTable()))
+        if (!runASTPass("RewriteR32fImages", [&] {
+                return RewriteR32fImages(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -739,8 +758,10 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         // ANGLEUniforms.acbBufferOffsets
         const TIntermTyped *acbBufferOffsets = driverUniforms->getAcbBufferOffsets();
         const TVariable *atomicCounters      = nullptr;
-        if (!RewriteAtomicCounters(this, root, &getSymbolTable(), acbBufferOffsets,
-                                   &atomicCounters))
+        if (!runASTPass("RewriteAtomicCounters", [&] {
+                return RewriteAtomicCounters(this, root, &getSymbolTable(), acbBufferOffsets,
+                                             &atomicCounters);
+            }))
         {
             return false;
         }
@@ -752,7 +773,9 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         // Vulkan doesn't support Atomic Storage as a Storage Class, but we've seen
         // cases where builtins are using it even with no active atomic counters.
         // This pass simply removes those builtins in that scenario.
-        if (!RemoveAtomicCounterBuiltins(this, root))
+        if (!runASTPass("RemoveAtomicCounterBuiltins", [&] {
+                return RemoveAtomicCounterBuiltins(this, root);
+            }))
         {
             return false;
         }
@@ -760,7 +783,10 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
     if (packedShaderType != gl::ShaderType::Compute)
     {
-        if (!ReplaceGLDepthRangeWithDriverUniform(this, root, driverUniforms, &getSymbolTable()))
+        if (!runASTPass("ReplaceGLDepthRangeWithDriverUniform", [&] {
+                return ReplaceGLDepthRangeWithDriverUniform(this, root, driverUniforms,
+                                                            &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -792,14 +818,18 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             }
         }
 
-        if (useClipDistance &&
-            !ReplaceClipDistanceAssignments(this, root, &getSymbolTable(), getShaderType(),
-                                            driverUniforms->getClipDistancesEnabled()))
+        if (useClipDistance && !runASTPass("ReplaceClipDistanceAssignments", [&] {
+                return ReplaceClipDistanceAssignments(this, root, &getSymbolTable(),
+                                                      getShaderType(),
+                                                      driverUniforms->getClipDistancesEnabled());
+            }))
         {
             return false;
         }
-        if (useCullDistance &&
-            !ReplaceCullDistanceAssignments(this, root, &getSymbolTable(), getShaderType()))
+        if (useCullDistance && !runASTPass("ReplaceCullDistanceAssignments", [&] {
+                return ReplaceCullDistanceAssignments(this, root, &getSymbolTable(),
+                                                      getShaderType());
+            }))
         {
             return false;
         }
@@ -810,15 +840,19 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         if (compileOptions.addVulkanXfbExtensionSupportCode)
         {
             // Add support code for transform feedback extension.
-            if (!AddXfbExtensionSupport(this, root, &getSymbolTable(), driverUniforms))
+            if (!runASTPass("AddXfbExtensionSupport", [&] {
+                    return AddXfbExtensionSupport(this, root, &getSymbolTable(), driverUniforms);
+                }))
             {
                 return false;
             }
         }
 
         // Add support code for pre-rotation and depth correction in the vertex processing stages.
-        if (!AddVertexTransformationSupport(this, compileOptions, root, &getSymbolTable(),
-                                            driverUniforms))
+        if (!runASTPass("AddVertexTransformationSupport", [&] {
+                return AddVertexTransformationSupport(this, compileOptions, root, &getSymbolTable(),
+                                                      driverUniforms);
+            }))
         {
             return false;
         }
@@ -826,12 +860,16 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
     if (IsExtensionEnabled(getExtensionBehavior(), TExtension::EXT_YUV_target))
     {
-        if (!EmulateYUVBuiltIns(this, root, &getSymbolTable()))
+        if (!runASTPass("EmulateYUVBuiltIns", [&] {
+                return EmulateYUVBuiltIns(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
 
-        if (!ReswizzleYUVTextureAccess(this, root, &getSymbolTable()))
+        if (!runASTPass("ReswizzleYUVTextureAccess", [&] {
+                return ReswizzleYUVTextureAccess(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -841,7 +879,9 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         IsExtensionEnabled(getExtensionBehavior(), TExtension::OES_EGL_image_external) ||
         IsExtensionEnabled(getExtensionBehavior(), TExtension::OES_EGL_image_external_essl3))
     {
-        if (!RewriteSamplerExternalTexelFetch(this, root, &getSymbolTable()))
+        if (!runASTPass("RewriteSamplerExternalTexelFetch", [&] {
+                return RewriteSamplerExternalTexelFetch(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -929,7 +969,9 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 }
             }
 
-            if (!RemoveInvariantDeclaration(this, root))
+            if (!runASTPass("RemoveInvariantDeclaration", [&] {
+                    return RemoveInvariantDeclaration(this, root);
+                }))
             {
                 return false;
             }
@@ -941,9 +983,12 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 TIntermConstantUnion *pivot = CreateFloatNode(0.5f, EbpMedium);
                 TIntermTyped *swapXY        = driverUniforms->getSwapXY();
 
-                if (!RotateAndFlipBuiltinVariable(
-                        this, root, GetMainSequence(root), swapXY, flipNegXY, &getSymbolTable(),
-                        BuiltInVariable::gl_PointCoord(), kFlippedPointCoordName, pivot))
+                if (!runASTPass("RotateAndFlipBuiltinVariable", [&] {
+                        return RotateAndFlipBuiltinVariable(this, root, GetMainSequence(root),
+                                                            swapXY, flipNegXY, &getSymbolTable(),
+                                                            BuiltInVariable::gl_PointCoord(),
+                                                            kFlippedPointCoordName, pivot);
+                    }))
                 {
                     return false;
                 }
@@ -959,9 +1004,12 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 const TVariable *samplePositionBuiltin =
                     static_cast<const TVariable *>(getSymbolTable().findBuiltIn(
                         ImmutableString("gl_SamplePosition"), getShaderVersion()));
-                if (!RotateAndFlipBuiltinVariable(this, root, GetMainSequence(root), swapXY, flipXY,
-                                                  &getSymbolTable(), samplePositionBuiltin,
-                                                  kFlippedSamplePositionName, pivot))
+                if (!runASTPass("RotateAndFlipBuiltinVariable", [&] {
+                        return RotateAndFlipBuiltinVariable(this, root, GetMainSequence(root),
+                                                            swapXY, flipXY, &getSymbolTable(),
+                                                            samplePositionBuiltin,
+                                                            kFlippedSamplePositionName, pivot);
+                    }))
                 {
                     return false;
                 }
@@ -969,8 +1017,11 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
             if (usesFragCoord)
             {
-                if (!InsertFragCoordCorrection(this, compileOptions, root, GetMainSequence(root),
-                                               &getSymbolTable(), driverUniforms))
+                if (!runASTPass("InsertFragCoordCorrection", [&] {
+                        return InsertFragCoordCorrection(this, compileOptions, root,
+                                                         GetMainSequence(root), &getSymbolTable(),
+                                                         driverUniforms);
+                    }))
                 {
                     return false;
                 }
@@ -978,7 +1029,10 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             }
 
             // Emulate gl_FragColor and gl_FragData with normal output variables.
-            if (!EmulateFragColorData(this, root, &getSymbolTable(), hasGLSecondaryFragData))
+            if (!runASTPass("EmulateFragColorData", [&] {
+                    return EmulateFragColorData(this, root, &getSymbolTable(),
+                                                hasGLSecondaryFragData);
+                }))
             {
                 return false;
             }
@@ -988,7 +1042,9 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             // Emulate framebuffer fetch if used.
             if (HasFramebufferFetch(getExtensionBehavior(), compileOptions))
             {
-                if (!EmulateFramebufferFetch(this, root, &inputAttachmentMap))
+                if (!runASTPass("EmulateFramebufferFetch", [&] {
+                        return EmulateFramebufferFetch(this, root, &inputAttachmentMap);
+                    }))
                 {
                     return false;
                 }
@@ -1000,9 +1056,11 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             // attachment variable then create a new one.
             if (getAdvancedBlendEquations().any() &&
                 compileOptions.addAdvancedBlendEquationsEmulation &&
-                !EmulateAdvancedBlendEquations(this, root, &getSymbolTable(),
-                                               getAdvancedBlendEquations(), driverUniforms,
-                                               &inputAttachmentMap))
+                !runASTPass("EmulateAdvancedBlendEquations", [&] {
+                    return EmulateAdvancedBlendEquations(this, root, &getSymbolTable(),
+                                                         getAdvancedBlendEquations(),
+                                                         driverUniforms, &inputAttachmentMap);
+                }))
             {
                 return false;
             }
@@ -1011,18 +1069,25 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             // emulation.  Declare their SPIR-V ids.
             assignInputAttachmentIds(inputAttachmentMap);
 
-            if (!RewriteDfdy(this, root, &getSymbolTable(), getShaderVersion(), driverUniforms))
+            if (!runASTPass("RewriteDfdy", [&] {
+                    return RewriteDfdy(this, root, &getSymbolTable(), getShaderVersion(),
+                                       driverUniforms);
+                }))
             {
                 return false;
             }
 
-            if (!RewriteInterpolateAtOffset(this, root, &getSymbolTable(), getShaderVersion(),
-                                            driverUniforms))
+            if (!runASTPass("RewriteInterpolateAtOffset", [&] {
+                    return RewriteInterpolateAtOffset(this, root, &getSymbolTable(),
+                                                      getShaderVersion(), driverUniforms);
+                }))
             {
                 return false;
             }
 
-            if (usesSampleMaskIn && !RewriteSampleMaskIn(this, root, &getSymbolTable()))
+            if (usesSampleMaskIn && !runASTPass("RewriteSampleMaskIn", [&] {
+                    return RewriteSampleMaskIn(this, root, &getSymbolTable());
+                }))
             {
                 return false;
             }
@@ -1030,7 +1095,9 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             if (hasGLSampleMask)
             {
                 TIntermTyped *numSamples = driverUniforms->getNumSamples();
-                if (!RewriteSampleMask(this, root, &getSymbolTable(), numSamples))
+                if (!runASTPass("RewriteSampleMask", [&] {
+                        return RewriteSampleMask(this, root, &getSymbolTable(), numSamples);
+                    }))
                 {
                     return false;
                 }
@@ -1041,8 +1108,9 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                     static_cast<const TVariable *>(getSymbolTable().findBuiltIn(
                         ImmutableString("gl_NumSamples"), getShaderVersion()));
                 TIntermTyped *numSamples = driverUniforms->getNumSamples();
-                if (numSamplesVar &&
-                    !ReplaceVariableWithTyped(this, root, numSamplesVar, numSamples))
+                if (numSamplesVar && !runASTPass("ReplaceVariableWithTyped", [&] {
+                        return ReplaceVariableWithTyped(this, root, numSamplesVar, numSamples);
+                    }))
                 {
                     return false;
                 }
@@ -1050,8 +1118,9 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
             if (IsExtensionEnabled(getExtensionBehavior(), TExtension::EXT_YUV_target))
             {
-                if (yuvOutput != nullptr &&
-                    !AdjustYUVOutput(this, root, &getSymbolTable(), *yuvOutput))
+                if (yuvOutput != nullptr && !runASTPass("AdjustYUVOutput", [&] {
+                        return AdjustYUVOutput(this, root, &getSymbolTable(), *yuvOutput);
+                    }))
                 {
                     return false;
                 }
@@ -1067,7 +1136,10 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 // Add support code for transform feedback emulation.  Only applies to vertex shader
                 // as tessellation and geometry shader transform feedback capture require
                 // VK_EXT_transform_feedback.
-                if (!AddXfbEmulationSupport(this, root, &getSymbolTable(), driverUniforms))
+                if (!runASTPass("AddXfbEmulationSupport", [&] {
+                        return AddXfbEmulationSupport(this, root, &getSymbolTable(),
+                                                      driverUniforms);
+                    }))
                 {
                     return false;
                 }
@@ -1077,7 +1149,9 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         }
 
         case gl::ShaderType::Geometry:
-            if (!ClampGLLayer(this, root, &getSymbolTable(), driverUniforms))
+            if (!runASTPass("ClampGLLayer", [&] {
+                    return ClampGLLayer(this, root, &getSymbolTable(), driverUniforms);
+                }))
             {
                 return false;
             }
@@ -1085,7 +1159,10 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
         case gl::ShaderType::TessControl:
         {
-            if (!ReplaceGLBoundingBoxWithGlobal(this, root, &getSymbolTable(), getShaderVersion()))
+            if (!runASTPass("ReplaceGLBoundingBoxWithGlobal", [&] {
+                    return ReplaceGLBoundingBoxWithGlobal(this, root, &getSymbolTable(),
+                                                          getShaderVersion());
+                }))
             {
                 return false;
             }
@@ -1116,7 +1193,10 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
     // generation treat them mostly like usual I/O blocks.
     const TVariable *inputPerVertex  = nullptr;
     const TVariable *outputPerVertex = nullptr;
-    if (!DeclarePerVertexBlocks(this, root, &getSymbolTable(), &inputPerVertex, &outputPerVertex))
+    if (!runASTPass("DeclarePerVertexBlocks", [&] {
+            return DeclarePerVertexBlocks(this, root, &getSymbolTable(), &inputPerVertex,
+                                          &outputPerVertex);
+        }))
     {
         return false;
     }
@@ -1144,6 +1224,20 @@ bool TranslatorSPIRV::translate(TIntermBlock *root,
                                 const ShCompileOptions &compileOptions,
                                 PerformanceDiagnostics *perfDiagnostics)
 {
+    // If the SPIR-V was already generated from the IR, there is nothing left to translate.
+    if (!mSpirvFromIR.empty())
+    {
+#if defined(ANGLE_ENABLE_ASSERTS)
+        const uint64_t validateStartTimeNs = angle::GetCurrentSystemTimeNs();
+        ASSERT(angle::spirv::Validate(mSpirvFromIR));
+        recordCompileStage("ValidateSPIRV", angle::GetCurrentSystemTimeNs() - validateStartTimeNs);
+#endif
+
+        getInfoSink().obj.setBinary(std::move(mSpirvFromIR));
+        mSpirvFromIR.clear();
+        return true;
+    }
+
     mUniqueToSpirvIdMap.clear();
     mFirstUnusedSpirvId = 0;
 
@@ -3,11 +3,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 //
-// EmulateGLDrawID is an AST traverser to convert the gl_DrawID builtin
-// to a uniform int
-//
-// EmulateGLBaseVertex is an AST traverser to convert the gl_BaseVertex builtin
-// to a uniform int
+// EmulateMultiDrawShaderBuiltins is an AST traverser to convert the gl_DrawID, gl_BaseVertex and
+// gl_BaseInstance builtins to uniform ints
 //
 
 #include "compiler/translator/tree_ops/EmulateMultiDrawShaderBuiltins.h"
@@ -17,6 +14,7 @@
 #include "compiler/translator/Symbol.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/tree_util/BuiltIn.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
 #include "compiler/translator/tree_util/ReplaceVariable.h"
 #include "compiler/translator/util.h"
@@ -104,47 +102,34 @@ class FindGLBaseVertexBaseInstanceTraverser : public TIntermTraverser
     const TVariable *mBaseInstanceVariable;
 };
 
-bool EmulateBuiltIn(TCompiler *compiler,
-                    TIntermBlock *root,
-                    TSymbolTable *symbolTable,
-                    const TVariable *builtInVariable,
-                    const TType *type,
-                    const ImmutableString &name)
+void DeclareEmulatedBuiltIn(TIntermBlock *root,
+                            TSymbolTable *symbolTable,
+                            const TVariable *builtInVariable,
+                            const ImmutableString &name,
+                            VariableReplacementMap *replacements)
 {
+    if (builtInVariable == nullptr)
+    {
+        return;
+    }
+
+    const TType *type = StaticType::Get<EbtInt, EbpHigh, EvqUniform, 1, 1>();
     const TVariable *emulatedVar =
         new TVariable(symbolTable, name, type, SymbolType::AngleInternal);
-    const TIntermSymbol *emulatedSymbol = new TIntermSymbol(emulatedVar);
-
     DeclareGlobalVariable(root, emulatedVar);
-    return ReplaceVariableWithTyped(compiler, root, builtInVariable, emulatedSymbol);
+    (*replacements)[builtInVariable->uniqueId()] = new TIntermSymbol(emulatedVar);
 }
 
 }  // namespace
 
-bool EmulateGLDrawID(TCompiler *compiler, TIntermBlock *root, TSymbolTable *symbolTable)
+bool EmulateMultiDrawShaderBuiltins(TCompiler *compiler,
+                                    TIntermBlock *root,
+                                    TSymbolTable *symbolTable,
+                                    bool emulateGLDrawID,
+                                    bool emulateGLBaseVertexBaseInstance,
+                                    bool addBaseVertexToVertexID)
 {
-    FindGLDrawIDTraverser traverser;
-    root->traverse(&traverser);
-    const TVariable *builtInVariable = traverser.getGLDrawIDBuiltinVariable();
-    if (builtInVariable)
-    {
-        const TType *type = StaticType::Get<EbtInt, EbpHigh, EvqUniform, 1, 1>();
-        if (!EmulateBuiltIn(compiler, root, symbolTable, builtInVariable, type,
-                            kEmulatedGLDrawIDName))
-        {
-            return false;
-        }
-    }
-
-    return true;
-}
-
-bool EmulateGLBaseVertexBaseInstance(TCompiler *compiler,
-                                     TIntermBlock *root,
-                                     TSymbolTable *symbolTable,
-                                     bool addBaseVertexToVertexID)
-{
-    if (addBaseVertexToVertexID)
+    if (emulateGLBaseVertexBaseInstance && addBaseVertexToVertexID)
     {
         // This is a workaround for Mac AMD GPU
         // Replace gl_VertexID with (gl_VertexID + gl_BaseVertex)
@@ -156,32 +141,38 @@ bool EmulateGLBaseVertexBaseInstance(TCompiler *compiler,
         }
     }
 
-    FindGLBaseVertexBaseInstanceTraverser traverser;
-    root->traverse(&traverser);
-    const TVariable *builtInVariableBaseVertex   = traverser.getGLBaseVertexBuiltinVariable();
-    const TVariable *builtInVariableBaseInstance = traverser.getGLBaseInstanceBuiltinVariable();
+    FindGLDrawIDTraverser drawIDTraverser;
+    FindGLBaseVertexBaseInstanceTraverser baseVertexBaseInstanceTraverser;
 
-    if (builtInVariableBaseVertex)
+    std::vector<TIntermTraverser *> traversers;
+    if (emulateGLDrawID)
     {
-        const TType *type = StaticType::Get<EbtInt, EbpHigh, EvqUniform, 1, 1>();
-        if (!EmulateBuiltIn(compiler, root, symbolTable, builtInVariableBaseVertex, type,
-                            kEmulatedGLBaseVertexName))
-        {
-            return false;
-        }
+        traversers.push_back(&drawIDTraverser);
     }
-
-    if (builtInVariableBaseInstance)
+    if (emulateGLBaseVertexBaseInstance)
     {
-        const TType *type = StaticType::Get<EbtInt, EbpHigh, EvqUniform, 1, 1>();
-        if (!EmulateBuiltIn(compiler, root, symbolTable, builtInVariableBaseInstance, type,
-                            kEmulatedGLBaseInstanceName))
-        {
-            return false;
-        }
+        traversers.push_back(&baseVertexBaseInstanceTraverser);
+    }
+    if (!TraverseFused(compiler, root, traversers))
+    {
+        return false;
     }
 
-    return true;
+    VariableReplacementMap replacements;
+    DeclareEmulatedBuiltIn(root, symbolTable, drawIDTraverser.getGLDrawIDBuiltinVariable(),
+                           kEmulatedGLDrawIDName, &replacements);
+    DeclareEmulatedBuiltIn(root, symbolTable,
+                           baseVertexBaseInstanceTraverser.getGLBaseVertexBuiltinVariable(),
+                           kEmulatedGLBaseVertexName, &replacements);
+    DeclareEmulatedBuiltIn(root, symbolTable,
+                           baseVertexBaseInstanceTraverser.getGLBaseInstanceBuiltinVariable(),
+                           kEmulatedGLBaseInstanceName, &replacements);
+
+    if (replacements.empty())
+    {
+        return true;
+    }
+    return ReplaceVariables(compiler, root, replacements);
 }
 
 }  // namespace sh
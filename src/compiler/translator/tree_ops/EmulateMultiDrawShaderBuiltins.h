@@ -3,11 +3,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 //
-// EmulateGLDrawID is an AST traverser to convert the gl_DrawID builtin
-// to a uniform int
-//
-// EmulateGLBaseVertexBaseInstance is an AST traverser to convert the gl_BaseVertex and
-// gl_BaseInstance builtin to uniform ints
+// EmulateMultiDrawShaderBuiltins is an AST traverser to convert the gl_DrawID, gl_BaseVertex and
+// gl_BaseInstance builtins to uniform ints
 //
 
 #ifndef COMPILER_TRANSLATOR_TREEOPS_EMULATEMULTIDRAWSHADERBUILTINS_H_
@@ -26,14 +23,14 @@ class TCompiler;
 class TIntermBlock;
 class TSymbolTable;
 
-[[nodiscard]] bool EmulateGLDrawID(TCompiler *compiler,
-                                   TIntermBlock *root,
-                                   TSymbolTable *symbolTable);
-
-[[nodiscard]] bool EmulateGLBaseVertexBaseInstance(TCompiler *compiler,
-                                                   TIntermBlock *root,
-                                                   TSymbolTable *symbolTable,
-                                                   bool addBaseVertexToVertexID);
+// Each of the emulations can be enabled separately.  The builtins are looked for and replaced in a
+// single pass over the tree each.
+[[nodiscard]] bool EmulateMultiDrawShaderBuiltins(TCompiler *compiler,
+                                                  TIntermBlock *root,
+                                                  TSymbolTable *symbolTable,
+                                                  bool emulateGLDrawID,
+                                                  bool emulateGLBaseVertexBaseInstance,
+                                                  bool addBaseVertexToVertexID);
 
 }  // namespace sh
 
@@ -105,6 +105,7 @@ bool PruneEmptyCasesTraverser::visitBlock(Visit visit, TIntermBlock *node)
         {
             // If switch's init condition has a side effect (like |switch(a++)|), preserve that.
             TIntermTyped *init = asSwitch->getInit();
+            markTreeChangedInPlace();
             if (!init->hasSideEffects())
             {
                 continue;
@@ -122,6 +123,7 @@ bool PruneEmptyCasesTraverser::visitBlock(Visit visit, TIntermBlock *node)
         !EndsInBranch(statements))
     {
         statements.push_back(new TIntermBranch(EOpBreak, nullptr));
+        markTreeChangedInPlace();
     }
 
     return false;
@@ -178,6 +180,7 @@ bool PruneEmptyCasesTraverser::visitSwitch(Visit visit, TIntermSwitch *node)
         if (!hasDefault)
         {
             statements->erase(statements->begin() + lastNoOpInStatementList, statements->end());
+            markTreeChangedInPlace();
         }
     }
 
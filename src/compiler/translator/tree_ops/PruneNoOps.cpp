@@ -311,13 +311,21 @@ bool PruneNoOpsTraverser::visitBlock(Visit visit, TIntermBlock *node)
             {
                 continue;
             }
+            if (statement != statements[statementIndex])
+            {
+                markTreeChangedInPlace();
+            }
         }
 
         // Visit the statement if not pruned.
         statements[writeIndex++] = statement;
         statement->traverse(this);
     }
-    statements.resize(writeIndex);
+    if (writeIndex < statements.size())
+    {
+        statements.resize(writeIndex);
+        markTreeChangedInPlace();
+    }
 
     // If the parent is a block and mIsBranchVisited is set, this is a nested block without any
     // condition (like if, loop or switch), so the rest of the parent block should also be pruned.
@@ -452,11 +460,13 @@ bool PruneNoOpsTraverser::visitLoop(Visit visit, TIntermLoop *loop)
     if (expr != nullptr && IsNoOp(expr))
     {
         loop->setExpression(nullptr);
+        markTreeChangedInPlace();
     }
     TIntermNode *init = loop->getInit();
     if (init != nullptr && IsNoOp(init))
     {
         loop->setInit(nullptr);
+        markTreeChangedInPlace();
     }
 
     return true;
@@ -241,6 +241,7 @@ void EnsureLoopForwardProgressTraverser::traverseLoop(TIntermLoop *node)
                                                           kESSLInternalBackendBuiltIns));
         sequence->push_back(node->getBody());
         node->setBody(newBody);
+        markTreeChangedInPlace();
     }
     mLoopInfoStack = mLoopInfoStack->getParent();
 }
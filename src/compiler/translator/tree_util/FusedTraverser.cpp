@@ -0,0 +1,207 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.cpp: Runs several traversers in a single walk of the tree.
+//
+
+#include "compiler/translator/tree_util/FusedTraverser.h"
+
+#include <utility>
+#include <vector>
+
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+// Walks the tree and forwards each visit to the traversers that would have visited the node.  The
+// traversal state (the path to the node, the parent blocks, etc.) and the queue of changes are
+// swapped into a traverser while its visit function runs, so that it can query the state and
+// queue changes as if it traversed the tree itself.  Every change ends up in this traverser's
+// queue, in the order the traversers made them, and so does the note of any change made in place.
+class TFusedTraverser : public TIntermTraverser
+{
+  public:
+    TFusedTraverser(angle::Span<TIntermTraverser *const> traversers);
+
+    void visitSymbol(TIntermSymbol *node) override { visitLeaf(node); }
+    void visitConstantUnion(TIntermConstantUnion *node) override { visitLeaf(node); }
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override { return visitAll(visit, node); }
+    bool visitBinary(Visit visit, TIntermBinary *node) override { return visitAll(visit, node); }
+    bool visitUnary(Visit visit, TIntermUnary *node) override { return visitAll(visit, node); }
+    bool visitTernary(Visit visit, TIntermTernary *node) override { return visitAll(visit, node); }
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override { return visitAll(visit, node); }
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override { return visitAll(visit, node); }
+    bool visitCase(Visit visit, TIntermCase *node) override { return visitAll(visit, node); }
+    void visitFunctionPrototype(TIntermFunctionPrototype *node) override { visitLeaf(node); }
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override
+    {
+        return visitAll(visit, node);
+    }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        return visitAll(visit, node);
+    }
+    bool visitBlock(Visit visit, TIntermBlock *node) override { return visitAll(visit, node); }
+    bool visitGlobalQualifierDeclaration(Visit visit,
+                                         TIntermGlobalQualifierDeclaration *node) override
+    {
+        return visitAll(visit, node);
+    }
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        return visitAll(visit, node);
+    }
+    bool visitLoop(Visit visit, TIntermLoop *node) override { return visitAll(visit, node); }
+    bool visitBranch(Visit visit, TIntermBranch *node) override { return visitAll(visit, node); }
+    void visitPreprocessorDirective(TIntermPreprocessorDirective *node) override
+    {
+        visitLeaf(node);
+    }
+
+  private:
+    struct FusedTraverser
+    {
+        TIntermTraverser *traverser;
+        // The depth of the node whose subtree the traverser skips, or 0 if it visits the current
+        // node.
+        size_t skippedDepth;
+    };
+
+    static bool AnyVisitsInOrder(angle::Span<TIntermTraverser *const> traversers);
+    static bool WantsVisit(const TIntermTraverser &traverser, Visit visit);
+
+    void visitLeaf(TIntermNode *node);
+    bool visitAll(Visit visit, TIntermNode *node);
+    bool visitWith(TIntermTraverser *traverser, Visit visit, TIntermNode *node);
+
+    std::vector<FusedTraverser> mTraversers;
+};
+
+TFusedTraverser::TFusedTraverser(angle::Span<TIntermTraverser *const> traversers)
+    // Pre- and post-visits are always needed to track which traversers skip a subtree.
+    : TIntermTraverser(true, AnyVisitsInOrder(traversers), true)
+{
+    mTraversers.reserve(traversers.size());
+    for (TIntermTraverser *traverser : traversers)
+    {
+        mTraversers.push_back({traverser, 0});
+    }
+}
+
+// static
+bool TFusedTraverser::AnyVisitsInOrder(angle::Span<TIntermTraverser *const> traversers)
+{
+    for (const TIntermTraverser *traverser : traversers)
+    {
+        if (traverser->inVisit)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// static
+bool TFusedTraverser::WantsVisit(const TIntermTraverser &traverser, Visit visit)
+{
+    switch (visit)
+    {
+        case PreVisit:
+            return traverser.preVisit;
+        case InVisit:
+            return traverser.inVisit;
+        case PostVisit:
+            return traverser.postVisit;
+        default:
+            UNREACHABLE();
+            return false;
+    }
+}
+
+void TFusedTraverser::visitLeaf(TIntermNode *node)
+{
+    // Leaves are visited regardless of the visit flags.
+    for (FusedTraverser &fused : mTraversers)
+    {
+        if (fused.skippedDepth == 0)
+        {
+            visitWith(fused.traverser, PreVisit, node);
+        }
+    }
+}
+
+bool TFusedTraverser::visitAll(Visit visit, TIntermNode *node)
+{
+    const size_t depth = static_cast<size_t>(getCurrentTraversalDepth()) + 1;
+
+    bool anyVisiting = false;
+    for (FusedTraverser &fused : mTraversers)
+    {
+        if (fused.skippedDepth == 0 && WantsVisit(*fused.traverser, visit) &&
+            !visitWith(fused.traverser, visit, node))
+        {
+            fused.skippedDepth = depth;
+        }
+        anyVisiting = anyVisiting || fused.skippedDepth == 0;
+    }
+
+    // Once the node is done with, or nothing visits its subtree so that it is skipped altogether,
+    // the traversers that skipped only this subtree visit the rest of the tree.
+    if (visit == PostVisit || !anyVisiting)
+    {
+        for (FusedTraverser &fused : mTraversers)
+        {
+            if (fused.skippedDepth == depth)
+            {
+                fused.skippedDepth = 0;
+            }
+        }
+    }
+
+    return anyVisiting;
+}
+
+bool TFusedTraverser::visitWith(TIntermTraverser *traverser, Visit visit, TIntermNode *node)
+{
+    std::swap(mPath, traverser->mPath);
+    std::swap(mCurrentChildIndex, traverser->mCurrentChildIndex);
+    std::swap(mParentBlockStack, traverser->mParentBlockStack);
+    std::swap(mInGlobalScope, traverser->mInGlobalScope);
+    std::swap(mTreeChangedInPlace, traverser->mTreeChangedInPlace);
+    std::swap(mInsertions, traverser->mInsertions);
+    std::swap(mReplacements, traverser->mReplacements);
+    std::swap(mMultiReplacements, traverser->mMultiReplacements);
+
+    const bool visitChildren = node->visit(visit, traverser);
+
+    std::swap(mPath, traverser->mPath);
+    std::swap(mCurrentChildIndex, traverser->mCurrentChildIndex);
+    std::swap(mParentBlockStack, traverser->mParentBlockStack);
+    std::swap(mInGlobalScope, traverser->mInGlobalScope);
+    std::swap(mTreeChangedInPlace, traverser->mTreeChangedInPlace);
+    std::swap(mInsertions, traverser->mInsertions);
+    std::swap(mReplacements, traverser->mReplacements);
+    std::swap(mMultiReplacements, traverser->mMultiReplacements);
+
+    return visitChildren;
+}
+
+bool TraverseFused(TCompiler *compiler,
+                   TIntermNode *root,
+                   angle::Span<TIntermTraverser *const> traversers)
+{
+    if (traversers.size() == 1)
+    {
+        root->traverse(traversers[0]);
+        return traversers[0]->updateTree(compiler, root);
+    }
+
+    TFusedTraverser fusedTraverser(traversers);
+    root->traverse(&fusedTraverser);
+    return fusedTraverser.updateTree(compiler, root);
+}
+
+}  // namespace sh
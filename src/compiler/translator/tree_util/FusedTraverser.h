@@ -0,0 +1,40 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.h: Runs several traversers in a single walk of the tree.
+//
+
+#ifndef COMPILER_TRANSLATOR_TREEUTIL_FUSEDTRAVERSER_H_
+#define COMPILER_TRANSLATOR_TREEUTIL_FUSEDTRAVERSER_H_
+
+#include "common/angleutils.h"
+#include "common/span.h"
+
+namespace sh
+{
+
+class TCompiler;
+class TIntermNode;
+class TIntermTraverser;
+
+// Traverses the tree once, calling the visit functions of each of the traversers where they would
+// be called if it traversed the tree on its own, and then applies the changes they queued like
+// updateTree does.  A traverser whose visit function returns false skips that subtree while the
+// others keep visiting it.
+//
+// The traversers are only compatible if none of them:
+//
+// - Overrides the traverse*() functions or limits the traversal depth, such as
+//   TLValueTrackingTraverser,
+// - Depends on the changes another one makes, since none is applied until after the traversal,
+// - Changes nodes that another one also changes or that are inside a subtree another one
+//   replaces.
+[[nodiscard]] bool TraverseFused(TCompiler *compiler,
+                                 TIntermNode *root,
+                                 angle::Span<TIntermTraverser *const> traversers);
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEUTIL_FUSEDTRAVERSER_H_
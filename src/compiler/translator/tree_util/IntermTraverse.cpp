@@ -221,6 +221,7 @@ TIntermTraverser::TIntermTraverser(bool preVisit,
       mMaxDepth(0),
       mMaxAllowedDepth(std::numeric_limits<int>::max()),
       mInGlobalScope(true),
+      mTreeChangedInPlace(false),
       mSymbolTable(symbolTable),
       mCurrentChildIndex(0)
 {
@@ -511,6 +512,15 @@ bool TIntermTraverser::CompareInsertion(const NodeInsertMultipleEntry &a,
 
 bool TIntermTraverser::updateTree(TCompiler *compiler, TIntermNode *node)
 {
+    // If nothing was changed, the tree is as valid as it was before the traversal.
+    if (mInsertions.empty() && mReplacements.empty() && mMultiReplacements.empty() &&
+        !mTreeChangedInPlace)
+    {
+        return true;
+    }
+    mTreeChangedInPlace = false;
+    compiler->onASTChanged();
+
     // Sort the insertions so that insertion position is increasing and same position insertions are
     // not reordered. The insertions are processed in reverse order so that multiple insertions to
     // the same parent node are handled correctly.
@@ -92,8 +92,8 @@ class TIntermTraverser : angle::NonCopyable
     // mReplacements/mMultiReplacements during traversal and the user of the traverser should call
     // this function after traversal to perform them.
     //
-    // Compiler is used to validate the tree.  Node is the same given to traverse().  Returns false
-    // if the tree is invalid after update.
+    // Compiler is used to validate the tree if any change was queued or made in place.  Node is the
+    // same given to traverse().  Returns false if the tree is invalid after update.
     [[nodiscard]] bool updateTree(TCompiler *compiler, TIntermNode *node);
 
   protected:
@@ -255,6 +255,10 @@ class TIntermTraverser : angle::NonCopyable
     //
     void queueAccessChainReplacement(TIntermTyped *replacement);
 
+    // Traversers that change the tree in place instead of queueing the changes call this, so that
+    // updateTree validates the tree even if nothing was queued.
+    void markTreeChangedInPlace() { mTreeChangedInPlace = true; }
+
     const bool preVisit;
     const bool inVisit;
     const bool postVisit;
@@ -263,6 +267,7 @@ class TIntermTraverser : angle::NonCopyable
     int mMaxAllowedDepth;
 
     bool mInGlobalScope;
+    bool mTreeChangedInPlace;
 
     // During traversing, save all the changes that need to happen into
     // mReplacements/mMultiReplacements, then do them by calling updateTree().
@@ -272,6 +277,9 @@ class TIntermTraverser : angle::NonCopyable
     TSymbolTable *mSymbolTable;
 
   private:
+    // Runs the visit functions of other traversers with its own traversal state.
+    friend class TFusedTraverser;
+
     // To insert multiple nodes into the parent block.
     struct NodeInsertMultipleEntry
     {
@@ -6,9 +6,11 @@
 
 // AstcDecompressorImpl.cpp: Decodes ASTC-encoded textures.
 
+#include <algorithm>
 #include <array>
 #include <future>
 #include <unordered_map>
+#include <vector>
 
 #include "astcenc.h"
 #include "common/SimpleMutex.h"
@@ -33,7 +35,8 @@ using AstcencContextUniquePtr = std::unique_ptr<astcenc_context, AstcencContextD
 // Returns the max number of threads to use when using multithreaded decompression
 uint32_t MaxThreads()
 {
-    static const uint32_t numThreads = std::min(16u, std::thread::hardware_concurrency());
+    static const uint32_t numThreads =
+        std::max(1u, std::min(16u, std::thread::hardware_concurrency()));
     return numThreads;
 }
 
@@ -57,8 +60,10 @@ AstcencContextUniquePtr MakeDecoderContext(uint32_t blockWidth,
         return nullptr;
     }
 
+    // Each context is only used by one thread at a time, which decompresses a band of block rows
+    // on its own.
     astcenc_context *context;
-    *error = astcenc_context_alloc(&config, MaxThreads(), &context);
+    *error = astcenc_context_alloc(&config, 1, &context);
     if (*error != ASTCENC_SUCCESS)
     {
         return nullptr;
@@ -79,31 +84,52 @@ bool IsAstcDecompressorAvailable()
 
 // Caches and manages astcenc_context objects.
 //
-// Each context is fairly large (around 30 MB) and takes a while to construct, so it's important to
-// reuse them as much as possible.
+// Each context is fairly large and takes a while to construct, so it's important to reuse them as
+// much as possible.
 //
-// While context objects can be reused across multiple threads, they must be used sequentially. To
-// avoid having to lock and manage access between threads, we keep one cache per thread. This avoids
-// any concurrency issues, at the cost of extra memory.
+// Context objects can only decompress one image at a time. Each thread decompressing a band of
+// block rows borrows a context for a given block size with acquire(), and hands it back with
+// release() once done, so that the next band or the next call can reuse it. Up to MaxThreads()
+// contexts are kept for each block size, which is as many as a single call can use at once.
 //
-// Currently, there is no eviction strategy. Each cache could grow to a maximum of ~400 MB in size
-// since they are 13 possible ASTC block sizes.
+// Currently, there is no eviction strategy beyond that limit.
 //
-// Thread-safety: not thread safe.
+// Thread-safety: thread safe.
 class AstcDecompressorContextCache
 {
   public:
     // Returns a context object for a given ASTC block size, along with the error code if the
     // context initialization failed.
     // In this case, the context will be null, and the status code will be non-zero.
-    std::pair<astcenc_context *, astcenc_error> get(uint32_t blockWidth, uint32_t blockHeight)
+    std::pair<AstcencContextUniquePtr, astcenc_error> acquire(uint32_t blockWidth,
+                                                              uint32_t blockHeight)
     {
-        Value &value = mContexts[{blockWidth, blockHeight}];
-        if (value.context == nullptr)
         {
-            value.context = MakeDecoderContext(blockWidth, blockHeight, &value.error);
+            std::lock_guard<angle::SimpleMutex> lock(mMutex);
+            std::vector<AstcencContextUniquePtr> &contexts = mContexts[{blockWidth, blockHeight}];
+            if (!contexts.empty())
+            {
+                AstcencContextUniquePtr context = std::move(contexts.back());
+                contexts.pop_back();
+                return {std::move(context), ASTCENC_SUCCESS};
+            }
+        }
+
+        // Create the context without holding the lock, as this is slow.
+        astcenc_error error             = ASTCENC_SUCCESS;
+        AstcencContextUniquePtr context = MakeDecoderContext(blockWidth, blockHeight, &error);
+        return {std::move(context), error};
+    }
+
+    // Returns a context obtained from acquire() to the cache. The context must be reset.
+    void release(uint32_t blockWidth, uint32_t blockHeight, AstcencContextUniquePtr context)
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mMutex);
+        std::vector<AstcencContextUniquePtr> &contexts = mContexts[{blockWidth, blockHeight}];
+        if (contexts.size() < MaxThreads())
+        {
+            contexts.push_back(std::move(context));
         }
-        return {value.context.get(), value.error};
     }
 
   private:
@@ -119,12 +145,6 @@ class AstcDecompressorContextCache
         }
     };
 
-    struct Value
-    {
-        AstcencContextUniquePtr context = nullptr;
-        astcenc_error error             = ASTCENC_SUCCESS;
-    };
-
     // Computes the hash of a Key
     struct KeyHash
     {
@@ -135,33 +155,67 @@ class AstcDecompressorContextCache
         }
     };
 
-    std::unordered_map<Key, Value, KeyHash> mContexts;
+    angle::SimpleMutex mMutex;
+    // The idle contexts for each block size.
+    std::unordered_map<Key, std::vector<AstcencContextUniquePtr>, KeyHash> mContexts;
+};
+
+// A horizontal band of block rows of an image, decompressed as an image of its own.
+struct DecompressBand
+{
+    const uint8_t *input;
+    size_t inputLength;
+    uint32_t width;
+    uint32_t height;
+    uint8_t *output;
 };
 
 struct DecompressTask : public Closure
 {
-    DecompressTask(astcenc_context *context,
-                   uint32_t threadIndex,
-                   const uint8_t *data,
-                   size_t dataLength,
-                   astcenc_image *image)
-        : context(context),
-          threadIndex(threadIndex),
-          data(data),
-          dataLength(dataLength),
-          image(image)
+    DecompressTask(AstcDecompressorContextCache *contextCache,
+                   uint32_t blockWidth,
+                   uint32_t blockHeight)
+        : contextCache(contextCache),
+          blockWidth(blockWidth),
+          blockHeight(blockHeight),
+          result(ASTCENC_SUCCESS)
     {}
 
     void operator()() override
     {
-        result = astcenc_decompress_image(context, data, dataLength, image, &kSwizzle, threadIndex);
+        auto [context, contextStatus] = contextCache->acquire(blockWidth, blockHeight);
+        if (contextStatus != ASTCENC_SUCCESS)
+        {
+            result = contextStatus;
+            return;
+        }
+
+        for (const DecompressBand &band : bands)
+        {
+            astcenc_image image;
+            uint8_t *output = band.output;
+            image.dim_x     = band.width;
+            image.dim_y     = band.height;
+            image.dim_z     = 1;
+            image.data_type = ASTCENC_TYPE_U8;
+            image.data      = reinterpret_cast<void **>(&output);
+
+            result = astcenc_decompress_image(context.get(), band.input, band.inputLength, &image,
+                                              &kSwizzle, 0);
+            astcenc_decompress_reset(context.get());
+            if (result != ASTCENC_SUCCESS)
+            {
+                break;
+            }
+        }
+
+        contextCache->release(blockWidth, blockHeight, std::move(context));
     }
 
-    astcenc_context *context;
-    uint32_t threadIndex;
-    const uint8_t *data;
-    size_t dataLength;
-    astcenc_image *image;
+    AstcDecompressorContextCache *contextCache;
+    uint32_t blockWidth;
+    uint32_t blockHeight;
+    std::vector<DecompressBand> bands;
     astcenc_error result;
 };
 
@@ -171,10 +225,7 @@ class AstcDecompressorImpl : public AstcDecompressor
   public:
     AstcDecompressorImpl()
         : AstcDecompressor(), mContextCache(std::make_unique<AstcDecompressorContextCache>())
-    {
-        mTasks.reserve(MaxThreads());
-        mWaitEvents.reserve(MaxThreads());
-    }
+    {}
 
     ~AstcDecompressorImpl() override = default;
 
@@ -192,43 +243,115 @@ class AstcDecompressorImpl : public AstcDecompressor
                        const uint32_t blockHeight,
                        const uint8_t *input,
                        size_t inputLength,
-                       uint8_t *output) override
+                       uint8_t *output,
+                       uint32_t threadCount) override
     {
-        // A given astcenc context can only decompress one image at a time, which we why we keep
-        // this mutex locked the whole time.
-        std::lock_guard global_lock(mMutex);
+        const Image image = {imgWidth, imgHeight, input, inputLength, output};
+        return decompressImages(singleThreadPool, multiThreadPool, blockWidth, blockHeight, &image,
+                                1, threadCount);
+    }
 
-        auto [context, context_status] = mContextCache->get(blockWidth, blockHeight);
-        if (context_status != ASTCENC_SUCCESS)
-            return context_status;
+    int32_t decompressImages(std::shared_ptr<WorkerThreadPool> singleThreadPool,
+                             std::shared_ptr<WorkerThreadPool> multiThreadPool,
+                             uint32_t blockWidth,
+                             uint32_t blockHeight,
+                             const Image *images,
+                             size_t imageCount,
+                             uint32_t threadCount) override
+    {
+        if (blockWidth == 0 || blockHeight == 0)
+        {
+            return ASTCENC_ERR_BAD_BLOCK_SIZE;
+        }
 
-        astcenc_image image;
-        image.dim_x     = imgWidth;
-        image.dim_y     = imgHeight;
-        image.dim_z     = 1;
-        image.data_type = ASTCENC_TYPE_U8;
-        image.data      = reinterpret_cast<void **>(&output);
+        uint64_t totalTexels = 0;
+        uint64_t totalBlocks = 0;
+        for (size_t imageIndex = 0; imageIndex < imageCount; ++imageIndex)
+        {
+            const Image &image = images[imageIndex];
+            totalTexels += static_cast<uint64_t>(image.width) * image.height;
+            totalBlocks += static_cast<uint64_t>(BlockCount(image.width, blockWidth)) *
+                           BlockCount(image.height, blockHeight);
+        }
+        if (totalBlocks == 0)
+        {
+            return ASTCENC_SUCCESS;
+        }
 
         // For smaller images the overhead of multithreading exceeds the benefits.
-        const bool singleThreaded = (imgHeight <= 32 && imgWidth <= 32) || !multiThreadPool;
+        if (!multiThreadPool || (threadCount == kAutomaticThreadCount && totalTexels <= 32 * 32))
+        {
+            threadCount = 1;
+        }
+        else if (threadCount == kAutomaticThreadCount)
+        {
+            threadCount = MaxThreads();
+        }
+        threadCount = std::max(1u, std::min(threadCount, MaxThreads()));
 
-        std::shared_ptr<WorkerThreadPool> &threadPool =
-            singleThreaded ? singleThreadPool : multiThreadPool;
-        const uint32_t threadCount = singleThreaded ? 1 : MaxThreads();
+        // Split the block rows of all the images in contiguous ranges with about the same number
+        // of blocks, one per thread. A range can span several images, and holds one band for
+        // each of them.
+        const uint64_t blocksPerTask = (totalBlocks + threadCount - 1) / threadCount;
 
-        mTasks.clear();
-        mWaitEvents.clear();
+        std::vector<std::shared_ptr<DecompressTask>> tasks;
+        tasks.push_back(std::make_shared<DecompressTask>(mContextCache.get(), blockWidth,
+                                                         blockHeight));
+        uint64_t taskBlocks = 0;
 
-        for (uint32_t i = 0; i < threadCount; ++i)
+        for (size_t imageIndex = 0; imageIndex < imageCount; ++imageIndex)
         {
-            mTasks.push_back(
-                std::make_shared<DecompressTask>(context, i, input, inputLength, &image));
-            mWaitEvents.push_back(threadPool->postWorkerTask(mTasks[i]));
+            const Image &image          = images[imageIndex];
+            const uint32_t blockCountX  = BlockCount(image.width, blockWidth);
+            const uint32_t blockCountY  = BlockCount(image.height, blockHeight);
+            const size_t blockRowBytes  = static_cast<size_t>(blockCountX) * kBlockBytes;
+            const size_t outputRowPitch = static_cast<size_t>(image.width) * 4;
+            uint32_t blockRow           = 0;
+
+            while (blockRow < blockCountY && blockCountX > 0)
+            {
+                if (taskBlocks >= blocksPerTask)
+                {
+                    tasks.push_back(std::make_shared<DecompressTask>(mContextCache.get(),
+                                                                     blockWidth, blockHeight));
+                    taskBlocks = 0;
+                }
+
+                // Take as many rows as the current task has room for, at least one.
+                const uint64_t rowsLeftInTask =
+                    std::max<uint64_t>(1, (blocksPerTask - taskBlocks) / blockCountX);
+                const uint32_t bandRows = static_cast<uint32_t>(
+                    std::min<uint64_t>(rowsLeftInTask, blockCountY - blockRow));
+
+                // Let astcenc check the input is large enough, by passing it what's left of it.
+                const size_t inputOffset = blockRow * blockRowBytes;
+                const uint32_t firstRow  = blockRow * blockHeight;
+
+                DecompressBand band;
+                band.input       = image.input + std::min(inputOffset, image.inputLength);
+                band.inputLength = image.inputLength - std::min(inputOffset, image.inputLength);
+                band.width       = image.width;
+                band.height      = std::min(bandRows * blockHeight, image.height - firstRow);
+                band.output      = image.output + firstRow * outputRowPitch;
+                tasks.back()->bands.push_back(band);
+
+                blockRow += bandRows;
+                taskBlocks += static_cast<uint64_t>(bandRows) * blockCountX;
+            }
         }
-        WaitableEvent::WaitMany(&mWaitEvents);
-        astcenc_decompress_reset(context);
 
-        for (auto &task : mTasks)
+        std::shared_ptr<WorkerThreadPool> &threadPool =
+            tasks.size() == 1 ? singleThreadPool : multiThreadPool;
+
+        std::vector<std::shared_ptr<WaitableEvent>> waitEvents;
+        waitEvents.reserve(tasks.size());
+        for (std::shared_ptr<DecompressTask> &task : tasks)
+        {
+            waitEvents.push_back(threadPool->postWorkerTask(task));
+        }
+        WaitableEvent::WaitMany(&waitEvents);
+
+        for (auto &task : tasks)
         {
             if (task->result != ASTCENC_SUCCESS)
                 return task->result;
@@ -236,6 +359,60 @@ class AstcDecompressorImpl : public AstcDecompressor
         return ASTCENC_SUCCESS;
     }
 
+    int32_t decompressStreaming(std::shared_ptr<WorkerThreadPool> singleThreadPool,
+                                std::shared_ptr<WorkerThreadPool> multiThreadPool,
+                                uint32_t imgWidth,
+                                uint32_t imgHeight,
+                                uint32_t blockWidth,
+                                uint32_t blockHeight,
+                                const uint8_t *input,
+                                size_t inputLength,
+                                uint8_t *staging,
+                                size_t stagingSize,
+                                uint32_t threadCount,
+                                const SliceCallback &onSlice) override
+    {
+        if (blockWidth == 0 || blockHeight == 0)
+        {
+            return ASTCENC_ERR_BAD_BLOCK_SIZE;
+        }
+
+        const size_t blockRowOutputBytes = static_cast<size_t>(imgWidth) * blockHeight * 4;
+        if (imgWidth == 0 || imgHeight == 0)
+        {
+            return ASTCENC_SUCCESS;
+        }
+        if (stagingSize < blockRowOutputBytes)
+        {
+            return ASTCENC_ERR_BAD_PARAM;
+        }
+
+        const uint32_t blockCountX      = BlockCount(imgWidth, blockWidth);
+        const uint32_t blockCountY      = BlockCount(imgHeight, blockHeight);
+        const size_t blockRowInputBytes = static_cast<size_t>(blockCountX) * kBlockBytes;
+        const uint32_t sliceBlockRows   = static_cast<uint32_t>(
+            std::min<size_t>(stagingSize / blockRowOutputBytes, blockCountY));
+
+        for (uint32_t blockRow = 0; blockRow < blockCountY; blockRow += sliceBlockRows)
+        {
+            const size_t inputOffset = std::min(blockRow * blockRowInputBytes, inputLength);
+            const uint32_t firstRow  = blockRow * blockHeight;
+            const uint32_t rowCount  = std::min(sliceBlockRows * blockHeight, imgHeight - firstRow);
+
+            const Image slice = {imgWidth, rowCount, input + inputOffset,
+                                 inputLength - inputOffset, staging};
+            int32_t result    = decompressImages(singleThreadPool, multiThreadPool, blockWidth,
+                                                 blockHeight, &slice, 1, threadCount);
+            if (result != ASTCENC_SUCCESS)
+            {
+                return result;
+            }
+
+            onSlice(firstRow, rowCount);
+        }
+        return ASTCENC_SUCCESS;
+    }
+
     const char *getStatusString(int32_t statusCode) const override
     {
         const char *msg = astcenc_get_error_string((astcenc_error)statusCode);
@@ -243,10 +420,15 @@ class AstcDecompressorImpl : public AstcDecompressor
     }
 
   private:
+    // Every ASTC block is 128 bits, regardless of its size in texels.
+    static constexpr size_t kBlockBytes = 16;
+
+    static uint32_t BlockCount(uint32_t texels, uint32_t blockSize)
+    {
+        return (texels + blockSize - 1) / blockSize;
+    }
+
     std::unique_ptr<AstcDecompressorContextCache> mContextCache;
-    angle::SimpleMutex mMutex;  // Locked while calling `decode()`
-    std::vector<std::shared_ptr<DecompressTask>> mTasks;
-    std::vector<std::shared_ptr<WaitableEvent>> mWaitEvents;
 };
 
 }  // namespace
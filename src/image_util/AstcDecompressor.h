@@ -11,6 +11,7 @@
 
 #include <stdint.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -34,6 +35,23 @@ class AstcDecompressor
     // If this returns false, decompress() will fail.
     virtual bool available() const = 0;
 
+    // Passed as the thread count to let the decompressor choose how many threads to use.
+    static constexpr uint32_t kAutomaticThreadCount = 0;
+
+    // One image to decompress, for example a mip level or a layer of an array texture.
+    struct Image
+    {
+        // Width and height of the image, in texels.
+        uint32_t width;
+        uint32_t height;
+        // Pointer to the ASTC data to decompress, and its size.
+        const uint8_t *input;
+        size_t inputLength;
+        // Where to write the decompressed output. This buffer must be able to hold at least
+        // width * height * 4 bytes.
+        uint8_t *output;
+    };
+
     // Decompress an ASTC texture.
     //
     // singleThreadPool: a thread pool that runs tasks on the current thread. Must not be null.
@@ -45,6 +63,8 @@ class AstcDecompressor
     // inputLength: size of astData
     // output: where to white the decompressed output. This buffer must be able to hold at least
     //         imgWidth * imgHeight * 4 bytes.
+    // threadCount: the maximum number of threads to split the image across, or
+    //              kAutomaticThreadCount. Ignored if multiThreadPool is null.
     //
     // Returns 0 on success, or a non-zero status code on error. Use getStatusString() to convert
     // this status code to an error string.
@@ -56,7 +76,49 @@ class AstcDecompressor
                                uint32_t blockHeight,
                                const uint8_t *input,
                                size_t inputLength,
-                               uint8_t *output) = 0;
+                               uint8_t *output,
+                               uint32_t threadCount) = 0;
+
+    // Decompress several images with the same block size, such as the mip levels of a texture.
+    // The block rows of all the images are split together across the threads, so that small
+    // images don't each pay for a separate round trip to the thread pool.
+    //
+    // Parameters and return value are the same as decompress().
+    virtual int32_t decompressImages(std::shared_ptr<WorkerThreadPool> singleThreadPool,
+                                     std::shared_ptr<WorkerThreadPool> multiThreadPool,
+                                     uint32_t blockWidth,
+                                     uint32_t blockHeight,
+                                     const Image *images,
+                                     size_t imageCount,
+                                     uint32_t threadCount) = 0;
+
+    // Called by decompressStreaming() when texel rows [firstRow, firstRow + rowCount) of the image
+    // have been decompressed to the start of the staging buffer.
+    using SliceCallback = std::function<void(uint32_t firstRow, uint32_t rowCount)>;
+
+    // Decompress an ASTC texture in slices of block rows, for when the whole decompressed image
+    // doesn't need to exist at once, for example when it is uploaded to a staging buffer that is
+    // smaller than the image. Each slice holds as many block rows as fit in the staging buffer,
+    // and onSlice is called once the slice is decompressed. The next slice overwrites the staging
+    // buffer after onSlice returns.
+    //
+    // staging: where to write the decompressed slices, with rows of imgWidth * 4 bytes.
+    // stagingSize: size of the staging buffer. It must hold at least one row of blocks, that is
+    //              imgWidth * blockHeight * 4 bytes.
+    //
+    // Other parameters and return value are the same as decompress().
+    virtual int32_t decompressStreaming(std::shared_ptr<WorkerThreadPool> singleThreadPool,
+                                        std::shared_ptr<WorkerThreadPool> multiThreadPool,
+                                        uint32_t imgWidth,
+                                        uint32_t imgHeight,
+                                        uint32_t blockWidth,
+                                        uint32_t blockHeight,
+                                        const uint8_t *input,
+                                        size_t inputLength,
+                                        uint8_t *staging,
+                                        size_t stagingSize,
+                                        uint32_t threadCount,
+                                        const SliceCallback &onSlice) = 0;
 
     // Returns an error string for a given status code. Will always return non-null.
     virtual const char *getStatusString(int32_t statusCode) const = 0;
@@ -27,7 +27,35 @@ class AstcDecompressorNoOp : public AstcDecompressor
                        uint32_t blockHeight,
                        const uint8_t *astcData,
                        size_t astcDataLength,
-                       uint8_t *output) override
+                       uint8_t *output,
+                       uint32_t threadCount) override
+    {
+        return -1;
+    }
+
+    int32_t decompressImages(std::shared_ptr<WorkerThreadPool> singleThreadPool,
+                             std::shared_ptr<WorkerThreadPool> multiThreadPool,
+                             uint32_t blockWidth,
+                             uint32_t blockHeight,
+                             const Image *images,
+                             size_t imageCount,
+                             uint32_t threadCount) override
+    {
+        return -1;
+    }
+
+    int32_t decompressStreaming(std::shared_ptr<WorkerThreadPool> singleThreadPool,
+                                std::shared_ptr<WorkerThreadPool> multiThreadPool,
+                                uint32_t imgWidth,
+                                uint32_t imgHeight,
+                                uint32_t blockWidth,
+                                uint32_t blockHeight,
+                                const uint8_t *astcData,
+                                size_t astcDataLength,
+                                uint8_t *staging,
+                                size_t stagingSize,
+                                uint32_t threadCount,
+                                const SliceCallback &onSlice) override
     {
         return -1;
     }
@@ -6,6 +6,7 @@
 // AstcDecompressor_unittest.cpp: Unit tests for AstcDecompressor
 
 #include <gmock/gmock.h>
+#include <algorithm>
 #include <vector>
 
 #include "common/WorkerThread.h"
@@ -35,9 +36,9 @@ TEST(AstcDecompressor, Decompress)
 
     std::vector<Rgba> output(width * height);
     std::vector<uint8_t> astcData = makeAstcCheckerboard(width, height);
-    int32_t status =
-        decompressor.decompress(singleThreadedPool, multiThreadedPool, width, height, 8, 8,
-                                astcData.data(), astcData.size(), (uint8_t *)output.data());
+    int32_t status = decompressor.decompress(
+        singleThreadedPool, multiThreadedPool, width, height, 8, 8, astcData.data(),
+        astcData.size(), (uint8_t *)output.data(), AstcDecompressor::kAutomaticThreadCount);
     EXPECT_EQ(status, 0);
 
     std::vector<Rgba> expected = makeCheckerboard(width, height);
@@ -45,6 +46,121 @@ TEST(AstcDecompressor, Decompress)
     ASSERT_THAT(output, ElementsAreArray(expected));
 }
 
+// Test that the image is correctly split across any number of threads
+TEST(AstcDecompressor, DecompressWithThreadCounts)
+{
+    const int width  = 256;
+    const int height = 136;
+
+    auto singleThreadedPool =
+        WorkerThreadPool::Create(ThreadPoolType::Synchronous, 0, ANGLEPlatformCurrent());
+    auto multiThreadedPool =
+        WorkerThreadPool::Create(ThreadPoolType::Asynchronous, 0, ANGLEPlatformCurrent());
+
+    auto &decompressor = AstcDecompressor::get();
+    if (!decompressor.available())
+        GTEST_SKIP() << "ASTC decompressor not available";
+
+    std::vector<uint8_t> astcData = makeAstcCheckerboard(width, height);
+    std::vector<Rgba> expected    = makeCheckerboard(width, height);
+
+    for (uint32_t threadCount : {1u, 2u, 3u, 7u, 16u, 100u})
+    {
+        std::vector<Rgba> output(width * height);
+        int32_t status = decompressor.decompress(singleThreadedPool, multiThreadedPool, width,
+                                                 height, 8, 8, astcData.data(), astcData.size(),
+                                                 (uint8_t *)output.data(), threadCount);
+        EXPECT_EQ(status, 0);
+        ASSERT_THAT(output, ElementsAreArray(expected)) << "threadCount: " << threadCount;
+    }
+}
+
+// Test that several images, such as mip levels, can be decompressed together
+TEST(AstcDecompressor, DecompressImages)
+{
+    auto singleThreadedPool =
+        WorkerThreadPool::Create(ThreadPoolType::Synchronous, 0, ANGLEPlatformCurrent());
+    auto multiThreadedPool =
+        WorkerThreadPool::Create(ThreadPoolType::Asynchronous, 0, ANGLEPlatformCurrent());
+
+    auto &decompressor = AstcDecompressor::get();
+    if (!decompressor.available())
+        GTEST_SKIP() << "ASTC decompressor not available";
+
+    const std::vector<int> sizes = {128, 64, 32, 16, 8};
+
+    std::vector<std::vector<uint8_t>> astcData;
+    std::vector<std::vector<Rgba>> outputs;
+    std::vector<AstcDecompressor::Image> images;
+    for (int size : sizes)
+    {
+        astcData.push_back(makeAstcCheckerboard(size, size));
+        outputs.emplace_back(size * size);
+    }
+    for (size_t level = 0; level < sizes.size(); ++level)
+    {
+        images.push_back({static_cast<uint32_t>(sizes[level]), static_cast<uint32_t>(sizes[level]),
+                          astcData[level].data(), astcData[level].size(),
+                          (uint8_t *)outputs[level].data()});
+    }
+
+    int32_t status =
+        decompressor.decompressImages(singleThreadedPool, multiThreadedPool, 8, 8, images.data(),
+                                      images.size(), 4);
+    EXPECT_EQ(status, 0);
+
+    for (size_t level = 0; level < sizes.size(); ++level)
+    {
+        ASSERT_THAT(outputs[level], ElementsAreArray(makeCheckerboard(sizes[level], sizes[level])))
+            << "level: " << level;
+    }
+}
+
+// Test that streaming decompression produces the whole image slice by slice
+TEST(AstcDecompressor, DecompressStreaming)
+{
+    const int width  = 64;
+    const int height = 72;
+
+    auto singleThreadedPool =
+        WorkerThreadPool::Create(ThreadPoolType::Synchronous, 0, ANGLEPlatformCurrent());
+    auto multiThreadedPool =
+        WorkerThreadPool::Create(ThreadPoolType::Asynchronous, 0, ANGLEPlatformCurrent());
+
+    auto &decompressor = AstcDecompressor::get();
+    if (!decompressor.available())
+        GTEST_SKIP() << "ASTC decompressor not available";
+
+    std::vector<uint8_t> astcData = makeAstcCheckerboard(width, height);
+
+    // Room for two and a half block rows, so slices are two block rows each.
+    std::vector<Rgba> staging(width * 20);
+    std::vector<Rgba> output(width * height);
+
+    uint32_t nextRow = 0;
+    int32_t status   = decompressor.decompressStreaming(
+        singleThreadedPool, multiThreadedPool, width, height, 8, 8, astcData.data(),
+        astcData.size(), (uint8_t *)staging.data(), staging.size() * sizeof(Rgba), 2,
+        [&](uint32_t firstRow, uint32_t rowCount) {
+            EXPECT_EQ(firstRow, nextRow);
+            EXPECT_EQ(rowCount, std::min(16u, height - firstRow));
+            std::copy(staging.begin(), staging.begin() + rowCount * width,
+                      output.begin() + firstRow * width);
+            nextRow = firstRow + rowCount;
+        });
+    EXPECT_EQ(status, 0);
+    EXPECT_EQ(nextRow, static_cast<uint32_t>(height));
+
+    ASSERT_THAT(output, ElementsAreArray(makeCheckerboard(width, height)));
+
+    // A staging buffer that can't hold a row of blocks is an error.
+    status = decompressor.decompressStreaming(
+        singleThreadedPool, multiThreadedPool, width, height, 8, 8, astcData.data(),
+        astcData.size(), (uint8_t *)staging.data(), width * 7 * sizeof(Rgba), 2,
+        [](uint32_t, uint32_t) { FAIL() << "Unexpected slice"; });
+    EXPECT_NE(status, 0);
+}
+
 // Test that getStatusString returns non-null even for unknown statuses
 TEST(AstcDecompressor, getStatusStringAlwaysNonNull)
 {
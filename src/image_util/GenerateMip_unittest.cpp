@@ -0,0 +1,199 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GenerateMip_unittest.cpp: Unit tests for mip generation functions.
+
+#include <gmock/gmock.h>
+#include <random>
+#include <vector>
+#include "common/WorkerThread.h"
+#include "common/mathutil.h"
+#include "common/unsafe_buffers.h"
+#include "image_util/generatemip.h"
+#include "image_util/loadimage.h"
+
+using namespace angle;
+using namespace testing;
+
+namespace
+{
+
+// Generates the next mip level of a 2D image with T::average only, as GenerateMip did before it had
+// vectorized rows.
+template <typename T>
+std::vector<uint8_t> GenerateReferenceMip(const std::vector<uint8_t> &source,
+                                          size_t sourceWidth,
+                                          size_t sourceHeight)
+{
+    const size_t destWidth  = std::max<size_t>(1, sourceWidth >> 1);
+    const size_t destHeight = std::max<size_t>(1, sourceHeight >> 1);
+    const T *sourcePixels   = reinterpret_cast<const T *>(source.data());
+
+    std::vector<uint8_t> dest(destWidth * destHeight * sizeof(T));
+    T *destPixels = reinterpret_cast<T *>(dest.data());
+
+    for (size_t y = 0; y < destHeight; ++y)
+    {
+        for (size_t x = 0; x < destWidth; ++x)
+        {
+            ANGLE_UNSAFE_TODO({
+                T *dst = &destPixels[y * destWidth + x];
+                if (sourceHeight == 1)
+                {
+                    T::average(dst, &sourcePixels[x * 2], &sourcePixels[x * 2 + 1]);
+                    continue;
+                }
+
+                const T *src0 = &sourcePixels[(y * 2) * sourceWidth + x * 2];
+                const T *src1 = &sourcePixels[(y * 2 + 1) * sourceWidth + x * 2];
+                T tmp0, tmp1;
+                T::average(&tmp0, src0, src1);
+                T::average(&tmp1, src0 + 1, src1 + 1);
+                T::average(dst, &tmp0, &tmp1);
+            })
+        }
+    }
+    return dest;
+}
+
+std::vector<uint8_t> MakeRandomBytes(size_t size, uint32_t seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    std::vector<uint8_t> bytes(size);
+    for (uint8_t &byte : bytes)
+    {
+        byte = static_cast<uint8_t>(distribution(generator));
+    }
+    return bytes;
+}
+
+// Half floats covering every exponent, including denormals, infinities and NaNs, and values whose
+// average is a denormal.
+std::vector<uint8_t> MakeHalfFloatBytes(size_t size, uint32_t seed)
+{
+    std::vector<uint8_t> bytes = MakeRandomBytes(size, seed);
+    uint16_t *halves           = reinterpret_cast<uint16_t *>(bytes.data());
+    for (size_t index = 0; index < size / 2; index += 7)
+    {
+        ANGLE_UNSAFE_TODO(halves[index] &= 0x83FF);
+    }
+    return bytes;
+}
+
+// Random floats that are finite, like the colors in a texture.
+std::vector<uint8_t> MakeFloatBytes(size_t size, uint32_t seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> distribution(-1000.0f, 1000.0f);
+
+    std::vector<uint8_t> bytes(size);
+    float *floats = reinterpret_cast<float *>(bytes.data());
+    for (size_t index = 0; index < size / 4; ++index)
+    {
+        ANGLE_UNSAFE_TODO(floats[index] = distribution(generator));
+    }
+    return bytes;
+}
+
+// Tests that GenerateMip gives the same results as T::average for 2D and 1D images whose widths
+// exercise both the vectorized rows and the pixels left after them.
+template <typename T>
+void TestGenerateMipMatchesReference(std::vector<uint8_t> (*makeSource)(size_t, uint32_t))
+{
+    const std::pair<size_t, size_t> sizes[] = {{64, 64}, {67, 33}, {2, 2},  {35, 1},
+                                               {128, 1}, {31, 5},  {96, 3}, {5, 64}};
+    for (const std::pair<size_t, size_t> &size : sizes)
+    {
+        const size_t sourceWidth  = size.first;
+        const size_t sourceHeight = size.second;
+        const size_t destWidth    = std::max<size_t>(1, sourceWidth >> 1);
+        const size_t destHeight   = std::max<size_t>(1, sourceHeight >> 1);
+
+        const uint32_t seed               = static_cast<uint32_t>(sourceWidth * 131 + sourceHeight);
+        const std::vector<uint8_t> source =
+            makeSource(sourceWidth * sourceHeight * sizeof(T), seed);
+        std::vector<uint8_t> dest(destWidth * destHeight * sizeof(T));
+
+        GenerateMip<T>(sourceWidth, sourceHeight, 1, source.data(), sourceWidth * sizeof(T),
+                       source.size(), dest.data(), destWidth * sizeof(T), dest.size());
+
+        EXPECT_EQ(dest, GenerateReferenceMip<T>(source, sourceWidth, sourceHeight))
+            << sourceWidth << "x" << sourceHeight;
+    }
+}
+
+// Tests mip generation of the byte-wise formats.
+TEST(GenerateMip, Bytewise)
+{
+    TestGenerateMipMatchesReference<R8>(MakeRandomBytes);
+    TestGenerateMipMatchesReference<R8G8>(MakeRandomBytes);
+    TestGenerateMipMatchesReference<R8G8B8A8>(MakeRandomBytes);
+    TestGenerateMipMatchesReference<B8G8R8A8>(MakeRandomBytes);
+}
+
+// Tests mip generation of RGBA16F, including the rounding of denormals, infinities and NaNs.
+TEST(GenerateMip, RGBA16F)
+{
+    TestGenerateMipMatchesReference<R16G16B16A16F>(MakeHalfFloatBytes);
+}
+
+// Tests mip generation of RGBA32F.
+TEST(GenerateMip, RGBA32F)
+{
+    TestGenerateMipMatchesReference<R32G32B32A32F>(MakeFloatBytes);
+}
+
+// Tests that splitting the generation of a mip level across threads gives the same results as
+// generating it on the calling thread.
+void TestGenerateMipInParallel(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth)
+{
+    const size_t destWidth  = std::max<size_t>(1, sourceWidth >> 1);
+    const size_t destHeight = std::max<size_t>(1, sourceHeight >> 1);
+    const size_t destDepth  = std::max<size_t>(1, sourceDepth >> 1);
+
+    const size_t sourceRowPitch   = sourceWidth * sizeof(R8G8B8A8);
+    const size_t sourceDepthPitch = sourceRowPitch * sourceHeight;
+    const size_t destRowPitch     = destWidth * sizeof(R8G8B8A8);
+    const size_t destDepthPitch   = destRowPitch * destHeight;
+
+    const std::vector<uint8_t> source = MakeRandomBytes(sourceDepthPitch * sourceDepth, 1);
+    std::vector<uint8_t> expected(destDepthPitch * destDepth);
+    std::vector<uint8_t> actual(destDepthPitch * destDepth);
+
+    GenerateMip<R8G8B8A8>(sourceWidth, sourceHeight, sourceDepth, source.data(), sourceRowPitch,
+                          sourceDepthPitch, expected.data(), destRowPitch, destDepthPitch);
+
+    ImageLoadContext context;
+    context.multiThreadPool =
+        WorkerThreadPool::Create(ThreadPoolType::Asynchronous, 4, ANGLEPlatformCurrent());
+    GenerateMipInParallel(GenerateMip<R8G8B8A8>, context, sourceWidth, sourceHeight, sourceDepth,
+                          source.data(), sourceRowPitch, sourceDepthPitch, actual.data(),
+                          destRowPitch, destDepthPitch);
+
+    EXPECT_EQ(actual, expected);
+}
+
+// Tests splitting a 2D mip level by rows, with an odd source height.
+TEST(GenerateMipInParallel, Rows)
+{
+    TestGenerateMipInParallel(2048, 1025, 1);
+}
+
+// Tests splitting a 3D mip level with few rows by slices, with an odd source depth.
+TEST(GenerateMipInParallel, Slices)
+{
+    TestGenerateMipInParallel(2048, 2, 67);
+}
+
+// Tests that 1D and small mip levels are generated correctly without being split.
+TEST(GenerateMipInParallel, Unsplit)
+{
+    TestGenerateMipInParallel(1 << 20, 1, 1);
+    TestGenerateMipInParallel(64, 64, 1);
+}
+
+}  // anonymous namespace
@@ -6,7 +6,9 @@
 // LoadToNative_unittest.cpp: Unit tests for pixel loading functions.
 
 #include <gmock/gmock.h>
+#include <random>
 #include <vector>
+#include "common/WorkerThread.h"
 #include "common/debug.h"
 #include "common/mathutil.h"
 #include "common/unsafe_buffers.h"
@@ -503,4 +505,233 @@ TEST(LoadToNative3To4, LoadByteRGBToRGBAWithUnalignedWidthAndAlignment4)
         TestLoadByteRGBToRGBAForAllCases(context, alignment, 5, 5, 1, 0, 0, alignment);
     }
 }
+
+using LoadFunction = void (*)(const ImageLoadContext &context,
+                              size_t width,
+                              size_t height,
+                              size_t depth,
+                              const uint8_t *input,
+                              size_t inputRowPitch,
+                              size_t inputDepthPitch,
+                              uint8_t *output,
+                              size_t outputRowPitch,
+                              size_t outputDepthPitch);
+
+// Expects a load function to produce the same output with and without its vectorized
+// implementation.  Widths up to 70 pixels exercise the vector loops as well as the remainders
+// converted by the scalar code, and the rows are padded and offset from the vector alignment.
+void TestSIMDMatchesScalar(const char *strCase,
+                           LoadFunction loadFunction,
+                           size_t inputPixelBytes,
+                           size_t outputPixelBytes)
+{
+    constexpr size_t kHeight     = 3;
+    constexpr size_t kDepth      = 2;
+    constexpr size_t kRowPadding = 8;
+
+    ImageLoadContext simdContext;
+    ImageLoadContext scalarContext;
+    scalarContext.useSIMD = false;
+
+    std::mt19937 generator(1);
+
+    for (size_t width = 1; width <= 70; width++)
+    {
+        for (size_t byteOffset : {0, 4})
+        {
+            size_t inputRowPitch    = width * inputPixelBytes + kRowPadding;
+            size_t inputDepthPitch  = kHeight * inputRowPitch;
+            size_t outputRowPitch   = width * outputPixelBytes + kRowPadding;
+            size_t outputDepthPitch = kHeight * outputRowPitch;
+
+            std::vector<uint8_t> input(byteOffset + kDepth * inputDepthPitch);
+            for (uint8_t &byte : input)
+            {
+                byte = static_cast<uint8_t>(generator());
+            }
+
+            std::vector<uint8_t> simdOutput(byteOffset + kDepth * outputDepthPitch, 0xAA);
+            std::vector<uint8_t> scalarOutput(simdOutput);
+
+            loadFunction(simdContext, width, kHeight, kDepth, input.data() + byteOffset,
+                         inputRowPitch, inputDepthPitch, simdOutput.data() + byteOffset,
+                         outputRowPitch, outputDepthPitch);
+            loadFunction(scalarContext, width, kHeight, kDepth, input.data() + byteOffset,
+                         inputRowPitch, inputDepthPitch, scalarOutput.data() + byteOffset,
+                         outputRowPitch, outputDepthPitch);
+
+            EXPECT_EQ(simdOutput, scalarOutput)
+                << "Case " << strCase << ": Mismatch with width " << width << " and offset "
+                << byteOffset;
+        }
+    }
+}
+
+// Tests that the vectorized luminance and alpha loading functions match the scalar ones.
+TEST(LoadToNativeSIMD, LuminanceAlpha)
+{
+    TestSIMDMatchesScalar("A8ToRGBA8", LoadA8ToRGBA8, 1, 4);
+    TestSIMDMatchesScalar("L8ToRGBA8", LoadL8ToRGBA8, 1, 4);
+    TestSIMDMatchesScalar("LA8ToRGBA8", LoadLA8ToRGBA8, 2, 4);
+    TestSIMDMatchesScalar("L16FToRGBA16F", LoadL16FToRGBA16F, 2, 8);
+    TestSIMDMatchesScalar("LA16FToRGBA16F", LoadLA16FToRGBA16F, 4, 8);
+}
+
+// Tests that the vectorized RGB and RGBA loading functions match the scalar ones.
+TEST(LoadToNativeSIMD, RGBAndRGBA)
+{
+    TestSIMDMatchesScalar("RGB8ToBGRX8", LoadRGB8ToBGRX8, 3, 4);
+    TestSIMDMatchesScalar("UbyteRGBToRGBA_FF", LoadToNative3To4<uint8_t, 0xFF>, 3, 4);
+    TestSIMDMatchesScalar("UbyteRGBToRGBA_01", LoadToNative3To4<uint8_t, 0x01>, 3, 4);
+    TestSIMDMatchesScalar("SbyteRGBToRGBA_7F", LoadToNative3To4<int8_t, 0x7F>, 3, 4);
+    TestSIMDMatchesScalar("SbyteRGBToRGBA_01", LoadToNative3To4<int8_t, 0x01>, 3, 4);
+    TestSIMDMatchesScalar("RGBA8ToBGRA8", LoadRGBA8ToBGRA8, 4, 4);
+    TestSIMDMatchesScalar("RGB565ToBGR565", LoadRGB565ToBGR565, 2, 2);
+}
+
+// Tests that the vectorized depth-stencil loading function matches the scalar one.
+TEST(LoadToNativeSIMD, DepthStencil)
+{
+    TestSIMDMatchesScalar("D24S8ToS8D24", LoadD24S8ToS8D24, 4, 4);
+}
+
+// Expects an ETC or EAC load function to produce the same output with and without its fast paths.
+// Random blocks use all the modes, and sizes that aren't multiples of the block size leave partial
+// blocks at the edges.
+void TestETCFastPathMatchesReference(const char *strCase,
+                                     LoadFunction loadFunction,
+                                     size_t blockBytes,
+                                     size_t outputPixelBytes)
+{
+    constexpr size_t kDepth      = 2;
+    constexpr size_t kRowPadding = 8;
+
+    ImageLoadContext fastContext;
+    ImageLoadContext referenceContext;
+    referenceContext.useSIMD = false;
+
+    std::mt19937 generator(1);
+
+    for (size_t width = 1; width <= 14; width++)
+    {
+        for (size_t height : {4, 7, 16})
+        {
+            size_t inputRowPitch    = ((width + 3) / 4) * blockBytes;
+            size_t inputDepthPitch  = ((height + 3) / 4) * inputRowPitch;
+            size_t outputRowPitch   = width * outputPixelBytes + kRowPadding;
+            size_t outputDepthPitch = height * outputRowPitch;
+
+            std::vector<uint8_t> input(kDepth * inputDepthPitch);
+            for (uint8_t &byte : input)
+            {
+                byte = static_cast<uint8_t>(generator());
+            }
+
+            std::vector<uint8_t> fastOutput(kDepth * outputDepthPitch, 0xAA);
+            std::vector<uint8_t> referenceOutput(fastOutput);
+
+            loadFunction(fastContext, width, height, kDepth, input.data(), inputRowPitch,
+                         inputDepthPitch, fastOutput.data(), outputRowPitch, outputDepthPitch);
+            loadFunction(referenceContext, width, height, kDepth, input.data(), inputRowPitch,
+                         inputDepthPitch, referenceOutput.data(), outputRowPitch,
+                         outputDepthPitch);
+
+            EXPECT_EQ(fastOutput, referenceOutput)
+                << "Case " << strCase << ": Mismatch with size " << width << "x" << height;
+        }
+    }
+}
+
+// Tests that the fast ETC color decoding matches the per-pixel decoding.
+TEST(LoadToNativeSIMD, ETCColor)
+{
+    TestETCFastPathMatchesReference("ETC1RGB8ToRGBA8", LoadETC1RGB8ToRGBA8, 8, 4);
+    TestETCFastPathMatchesReference("ETC2RGB8ToRGBA8", LoadETC2RGB8ToRGBA8, 8, 4);
+    TestETCFastPathMatchesReference("ETC2RGB8A1ToRGBA8", LoadETC2RGB8A1ToRGBA8, 8, 4);
+    TestETCFastPathMatchesReference("ETC2RGBA8ToRGBA8", LoadETC2RGBA8ToRGBA8, 16, 4);
+}
+
+// Tests that the fast EAC decoding matches the per-pixel decoding.
+TEST(LoadToNativeSIMD, EAC)
+{
+    TestETCFastPathMatchesReference("EACR11ToR8", LoadEACR11ToR8, 8, 1);
+    TestETCFastPathMatchesReference("EACR11SToR8", LoadEACR11SToR8, 8, 1);
+    TestETCFastPathMatchesReference("EACRG11ToRG8", LoadEACRG11ToRG8, 16, 2);
+    TestETCFastPathMatchesReference("EACRG11SToRG8", LoadEACRG11SToRG8, 16, 2);
+    TestETCFastPathMatchesReference("EACR11ToR16", LoadEACR11ToR16, 8, 2);
+    TestETCFastPathMatchesReference("EACR11SToR16", LoadEACR11SToR16, 8, 2);
+    TestETCFastPathMatchesReference("EACRG11ToRG16", LoadEACRG11ToRG16, 16, 4);
+    TestETCFastPathMatchesReference("EACRG11SToRG16F", LoadEACRG11SToRG16F, 16, 8);
+    TestETCFastPathMatchesReference("EACR11ToR16F", LoadEACR11ToR16F, 8, 4);
+}
+
+// Expects loading an image in bands on a thread pool to produce the same output as loading it at
+// once.
+void TestParallelMatchesSerial(const char *strCase,
+                               LoadFunction loadFunction,
+                               size_t width,
+                               size_t height,
+                               size_t depth,
+                               size_t inputRowPitch,
+                               size_t inputBlockHeight,
+                               size_t outputRowPitch,
+                               size_t outputBlockHeight)
+{
+    ImageLoadContext serialContext;
+    ImageLoadContext parallelContext;
+    parallelContext.multiThreadPool =
+        WorkerThreadPool::Create(ThreadPoolType::Asynchronous, 4, ANGLEPlatformCurrent());
+
+    const size_t inputBlockRows   = rx::UnsignedCeilDivide64(height, inputBlockHeight);
+    const size_t outputBlockRows  = rx::UnsignedCeilDivide64(height, outputBlockHeight);
+    const size_t inputDepthPitch  = inputRowPitch * inputBlockRows;
+    const size_t outputDepthPitch = outputRowPitch * outputBlockRows;
+
+    std::mt19937 generator(2);
+    std::vector<uint8_t> input(inputDepthPitch * depth);
+    for (uint8_t &byte : input)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+
+    std::vector<uint8_t> serialOutput(outputDepthPitch * depth, 0xAA);
+    std::vector<uint8_t> parallelOutput(serialOutput);
+
+    loadFunction(serialContext, width, height, depth, input.data(), inputRowPitch, inputDepthPitch,
+                 serialOutput.data(), outputRowPitch, outputDepthPitch);
+    LoadImageInParallel(loadFunction, parallelContext, width, height, depth, input.data(),
+                        inputRowPitch, inputDepthPitch, parallelOutput.data(), outputRowPitch,
+                        outputDepthPitch, inputBlockHeight, outputBlockHeight);
+
+    EXPECT_EQ(serialOutput, parallelOutput) << "Case " << strCase;
+}
+
+// Tests that large 2D images loaded in bands of rows match images loaded at once.
+TEST(LoadImageInParallel, Rows)
+{
+    TestParallelMatchesSerial("UbyteRGBToRGBA", LoadToNative3To4<uint8_t, 0xFF>, 1500, 1001, 1,
+                              1500 * 3 + 4, 1, 1500 * 4, 1);
+}
+
+// Tests that bands of compressed images start at a row of blocks, including when the height isn't
+// a multiple of the block height.
+TEST(LoadImageInParallel, CompressedRows)
+{
+    TestParallelMatchesSerial("ETC2RGB8ToRGBA8", LoadETC2RGB8ToRGBA8, 1024, 1026, 1,
+                              1024 / 4 * 8, 4, 1024 * 4, 1);
+}
+
+// Tests that 3D images with few rows are split in bands of slices.
+TEST(LoadImageInParallel, Slices)
+{
+    TestParallelMatchesSerial("RGBA8ToBGRA8", LoadRGBA8ToBGRA8, 256, 3, 2000, 256 * 4, 1, 256 * 4,
+                              1);
+}
+
+// Tests that small images, which are loaded on the calling thread, are loaded correctly.
+TEST(LoadImageInParallel, Small)
+{
+    TestParallelMatchesSerial("UbyteRGBToRGBA", LoadToNative3To4<uint8_t, 0xFF>, 64, 64, 1, 64 * 3,
+                              1, 64 * 4, 1);
+}
 }  // namespace
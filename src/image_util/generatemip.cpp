@@ -0,0 +1,663 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+// generatemip.cpp: Defines the vectorized mip generation rows and the splitting of mip generation
+// across threads.
+
+#include "image_util/generatemip.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "common/WorkerThread.h"
+#include "image_util/image_simd.h"
+#include "image_util/loadimage.h"
+
+namespace angle
+{
+namespace priv
+{
+namespace
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+// Averages each byte, rounding down like gl::average.  _mm_avg_epu8 rounds up, which the low bit of
+// the sum corrects.
+ANGLE_LOADIMAGE_TARGET("sse2")
+inline __m128i AverageBytesSSE2(__m128i a, __m128i b)
+{
+    const __m128i roundedUp = _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1));
+    return _mm_sub_epi8(_mm_avg_epu8(a, b), roundedUp);
+}
+
+// Splits the pixels of |a| followed by |b| into the even ones and the odd ones.
+template <size_t PixelBytes>
+ANGLE_LOADIMAGE_TARGET("sse2")
+inline void DeinterleavePixelsSSE2(__m128i a, __m128i b, __m128i *even, __m128i *odd)
+{
+    if (PixelBytes == 4)
+    {
+        const __m128 aFloat = _mm_castsi128_ps(a);
+        const __m128 bFloat = _mm_castsi128_ps(b);
+
+        *even = _mm_castps_si128(_mm_shuffle_ps(aFloat, bFloat, _MM_SHUFFLE(2, 0, 2, 0)));
+        *odd  = _mm_castps_si128(_mm_shuffle_ps(aFloat, bFloat, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+    else if (PixelBytes == 2)
+    {
+        // Sign extend the 16-bit pixels so the saturating pack keeps them intact.
+        *even = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16),
+                                _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+        *odd  = _mm_packs_epi32(_mm_srai_epi32(a, 16), _mm_srai_epi32(b, 16));
+    }
+    else
+    {
+        const __m128i lowByteMask = _mm_set1_epi16(0x00FF);
+
+        *even = _mm_packus_epi16(_mm_and_si128(a, lowByteMask), _mm_and_si128(b, lowByteMask));
+        *odd  = _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+    }
+}
+
+// Each iteration generates 16 bytes of the destination from 32 bytes of each source row.
+template <size_t PixelBytes>
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t GenerateMipRowX_BytewiseSSE2(const uint8_t *source, uint8_t *dest, size_t destWidth)
+{
+    constexpr size_t kPixelsPerIteration = 16 / PixelBytes;
+
+    size_t x = 0;
+    for (; x + kPixelsPerIteration <= destWidth; x += kPixelsPerIteration)
+    {
+        const uint8_t *sourcePixels = source + x * 2 * PixelBytes;
+
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(sourcePixels));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(sourcePixels + 16));
+
+        __m128i even, odd;
+        DeinterleavePixelsSSE2<PixelBytes>(a, b, &even, &odd);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x * PixelBytes),
+                         AverageBytesSSE2(even, odd));
+    }
+    return x;
+}
+
+template <size_t PixelBytes>
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t GenerateMipRowXY_BytewiseSSE2(const uint8_t *source0,
+                                     const uint8_t *source1,
+                                     uint8_t *dest,
+                                     size_t destWidth)
+{
+    constexpr size_t kPixelsPerIteration = 16 / PixelBytes;
+
+    size_t x = 0;
+    for (; x + kPixelsPerIteration <= destWidth; x += kPixelsPerIteration)
+    {
+        const __m128i *top    = reinterpret_cast<const __m128i *>(source0 + x * 2 * PixelBytes);
+        const __m128i *bottom = reinterpret_cast<const __m128i *>(source1 + x * 2 * PixelBytes);
+        const __m128i a0      = _mm_loadu_si128(top);
+        const __m128i b0      = _mm_loadu_si128(top + 1);
+        const __m128i a1      = _mm_loadu_si128(bottom);
+        const __m128i b1      = _mm_loadu_si128(bottom + 1);
+
+        // Like GenerateMip_XY, average vertically first, then horizontally.
+        __m128i even, odd;
+        DeinterleavePixelsSSE2<PixelBytes>(AverageBytesSSE2(a0, a1), AverageBytesSSE2(b0, b1),
+                                           &even, &odd);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x * PixelBytes),
+                         AverageBytesSSE2(even, odd));
+    }
+    return x;
+}
+
+ANGLE_LOADIMAGE_TARGET("sse2")
+inline __m128 AverageFloatsSSE2(__m128 a, __m128 b)
+{
+    return _mm_mul_ps(_mm_add_ps(a, b), _mm_set1_ps(0.5f));
+}
+
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t GenerateMipRowX_RGBA32FSSE2(const uint8_t *source, uint8_t *dest, size_t destWidth)
+{
+    const float *sourceFloats = reinterpret_cast<const float *>(source);
+    float *destFloats         = reinterpret_cast<float *>(dest);
+
+    for (size_t x = 0; x < destWidth; ++x)
+    {
+        const __m128 a = _mm_loadu_ps(sourceFloats + x * 8);
+        const __m128 b = _mm_loadu_ps(sourceFloats + x * 8 + 4);
+        _mm_storeu_ps(destFloats + x * 4, AverageFloatsSSE2(a, b));
+    }
+    return destWidth;
+}
+
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t GenerateMipRowXY_RGBA32FSSE2(const uint8_t *source0,
+                                    const uint8_t *source1,
+                                    uint8_t *dest,
+                                    size_t destWidth)
+{
+    const float *source0Floats = reinterpret_cast<const float *>(source0);
+    const float *source1Floats = reinterpret_cast<const float *>(source1);
+    float *destFloats          = reinterpret_cast<float *>(dest);
+
+    for (size_t x = 0; x < destWidth; ++x)
+    {
+        const __m128 even = AverageFloatsSSE2(_mm_loadu_ps(source0Floats + x * 8),
+                                              _mm_loadu_ps(source1Floats + x * 8));
+        const __m128 odd  = AverageFloatsSSE2(_mm_loadu_ps(source0Floats + x * 8 + 4),
+                                              _mm_loadu_ps(source1Floats + x * 8 + 4));
+        _mm_storeu_ps(destFloats + x * 4, AverageFloatsSSE2(even, odd));
+    }
+    return destWidth;
+}
+
+// Converts the half floats in the low 16 bits of each lane to floats, exactly like
+// gl::float16ToFloat32.  Shifting the exponent and mantissa in place and scaling by 2^112 rebiases
+// the exponent, and normalizes denormals exactly.  Infinities and NaNs keep their mantissa.
+ANGLE_LOADIMAGE_TARGET("sse2")
+inline __m128 HalfToFloatSSE2(__m128i half)
+{
+    const __m128i sign      = _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x8000)), 16);
+    const __m128i magnitude = _mm_and_si128(half, _mm_set1_epi32(0x7FFF));
+    const __m128i shifted   = _mm_slli_epi32(magnitude, 13);
+
+    const __m128i scaled     = _mm_castps_si128(
+        _mm_mul_ps(_mm_castsi128_ps(shifted), _mm_castsi128_ps(_mm_set1_epi32(0x77800000))));
+    const __m128i infOrNaN   = _mm_or_si128(shifted, _mm_set1_epi32(0x7F800000));
+    const __m128i isInfOrNaN = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x7BFF));
+
+    const __m128i result = _mm_or_si128(_mm_and_si128(isInfOrNaN, infOrNaN),
+                                        _mm_andnot_si128(isInfOrNaN, scaled));
+    return _mm_castsi128_ps(_mm_or_si128(sign, result));
+}
+
+// Converts floats to half floats in the low 16 bits of each lane, exactly like
+// gl::float32ToFloat16.  Values that become half float denormals are rare, and are converted by
+// gl::float32ToFloat16 itself.
+ANGLE_LOADIMAGE_TARGET("sse2")
+inline __m128i FloatToHalfSSE2(__m128 value)
+{
+    const __m128i bits = _mm_castps_si128(value);
+    const __m128i abs  = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+    const __m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+
+    // Rebias the exponent and round the mantissa to nearest even.
+    const __m128i roundBit = _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(1));
+    const __m128i normal   = _mm_srli_epi32(
+        _mm_add_epi32(_mm_add_epi32(abs, _mm_set1_epi32(0xC8000FFF)), roundBit), 13);
+
+    // Values smaller than the smallest half float denormal round to zero.
+    const __m128i isNaN      = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F800000));
+    const __m128i isInfinity = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x47FFEFFF));
+    const __m128i isDenormal = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000));
+    const __m128i isZero     = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x2D000000));
+
+    const __m128i infinity  = _mm_and_si128(isInfinity, _mm_set1_epi32(0x7C00));
+    const __m128i magnitude =
+        _mm_or_si128(_mm_andnot_si128(_mm_or_si128(isInfinity, isDenormal), normal), infinity);
+
+    // NaNs lose their sign.
+    __m128i half = _mm_or_si128(sign, magnitude);
+    half         = _mm_or_si128(_mm_andnot_si128(isNaN, half),
+                                _mm_and_si128(isNaN, _mm_set1_epi32(0x7FFF)));
+
+    const int denormalLanes =
+        _mm_movemask_ps(_mm_castsi128_ps(_mm_andnot_si128(isZero, isDenormal)));
+    if (ANGLE_UNLIKELY(denormalLanes != 0))
+    {
+        alignas(16) float values[4];
+        alignas(16) uint32_t halves[4];
+        _mm_store_ps(values, value);
+        _mm_store_si128(reinterpret_cast<__m128i *>(halves), half);
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            if ((denormalLanes >> lane) & 1)
+            {
+                halves[lane] = gl::float32ToFloat16(values[lane]);
+            }
+        }
+        half = _mm_load_si128(reinterpret_cast<const __m128i *>(halves));
+    }
+    return half;
+}
+
+// Like gl::averageHalfFloat, the average is rounded to a half float, and returned as a float.
+ANGLE_LOADIMAGE_TARGET("sse2")
+inline __m128 AverageHalfFloatsSSE2(__m128 a, __m128 b)
+{
+    return HalfToFloatSSE2(FloatToHalfSSE2(AverageFloatsSSE2(a, b)));
+}
+
+// Loads two RGBA16F pixels as floats.
+ANGLE_LOADIMAGE_TARGET("sse2")
+inline void LoadHalfFloatPixelsSSE2(const uint8_t *source, __m128 *pixel0, __m128 *pixel1)
+{
+    const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+    *pixel0              = HalfToFloatSSE2(_mm_unpacklo_epi16(halves, _mm_setzero_si128()));
+    *pixel1              = HalfToFloatSSE2(_mm_unpackhi_epi16(halves, _mm_setzero_si128()));
+}
+
+// Stores two RGBA16F pixels given as floats that are exact half floats.
+ANGLE_LOADIMAGE_TARGET("sse2")
+inline void StoreHalfFloatPixelsSSE2(uint8_t *dest, __m128 pixel0, __m128 pixel1)
+{
+    // Sign extend the half floats so the saturating pack keeps them intact.
+    const __m128i halves0 = _mm_srai_epi32(_mm_slli_epi32(FloatToHalfSSE2(pixel0), 16), 16);
+    const __m128i halves1 = _mm_srai_epi32(_mm_slli_epi32(FloatToHalfSSE2(pixel1), 16), 16);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_packs_epi32(halves0, halves1));
+}
+
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t GenerateMipRowX_RGBA16FSSE2(const uint8_t *source, uint8_t *dest, size_t destWidth)
+{
+    size_t x = 0;
+    for (; x + 2 <= destWidth; x += 2)
+    {
+        __m128 s0, s1, s2, s3;
+        LoadHalfFloatPixelsSSE2(source + x * 16, &s0, &s1);
+        LoadHalfFloatPixelsSSE2(source + x * 16 + 16, &s2, &s3);
+        StoreHalfFloatPixelsSSE2(dest + x * 8, AverageFloatsSSE2(s0, s1),
+                                 AverageFloatsSSE2(s2, s3));
+    }
+    return x;
+}
+
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t GenerateMipRowXY_RGBA16FSSE2(const uint8_t *source0,
+                                    const uint8_t *source1,
+                                    uint8_t *dest,
+                                    size_t destWidth)
+{
+    size_t x = 0;
+    for (; x + 2 <= destWidth; x += 2)
+    {
+        __m128 top[4];
+        __m128 bottom[4];
+        LoadHalfFloatPixelsSSE2(source0 + x * 16, &top[0], &top[1]);
+        LoadHalfFloatPixelsSSE2(source0 + x * 16 + 16, &top[2], &top[3]);
+        LoadHalfFloatPixelsSSE2(source1 + x * 16, &bottom[0], &bottom[1]);
+        LoadHalfFloatPixelsSSE2(source1 + x * 16 + 16, &bottom[2], &bottom[3]);
+
+        // Like GenerateMip_XY, average vertically first, then horizontally.
+        __m128 vertical[4];
+        for (size_t pixel = 0; pixel < 4; ++pixel)
+        {
+            vertical[pixel] = AverageHalfFloatsSSE2(top[pixel], bottom[pixel]);
+        }
+        StoreHalfFloatPixelsSSE2(dest + x * 8, AverageFloatsSSE2(vertical[0], vertical[1]),
+                                 AverageFloatsSSE2(vertical[2], vertical[3]));
+    }
+    return x;
+}
+#endif  // defined(ANGLE_LOADIMAGE_USE_SSE)
+
+#if defined(ANGLE_LOADIMAGE_USE_NEON)
+// vhaddq_u8 rounds down like gl::average.  The structure loads split the even and odd pixels.
+template <size_t PixelBytes>
+uint8x16x2_t LoadPixelPairsNEON(const uint8_t *source);
+
+template <>
+inline uint8x16x2_t LoadPixelPairsNEON<4>(const uint8_t *source)
+{
+    const uint32x4x2_t pixels = vld2q_u32(reinterpret_cast<const uint32_t *>(source));
+    return {{vreinterpretq_u8_u32(pixels.val[0]), vreinterpretq_u8_u32(pixels.val[1])}};
+}
+
+template <>
+inline uint8x16x2_t LoadPixelPairsNEON<2>(const uint8_t *source)
+{
+    const uint16x8x2_t pixels = vld2q_u16(reinterpret_cast<const uint16_t *>(source));
+    return {{vreinterpretq_u8_u16(pixels.val[0]), vreinterpretq_u8_u16(pixels.val[1])}};
+}
+
+template <>
+inline uint8x16x2_t LoadPixelPairsNEON<1>(const uint8_t *source)
+{
+    return vld2q_u8(source);
+}
+
+template <size_t PixelBytes>
+size_t GenerateMipRowX_BytewiseNEON(const uint8_t *source, uint8_t *dest, size_t destWidth)
+{
+    constexpr size_t kPixelsPerIteration = 16 / PixelBytes;
+
+    size_t x = 0;
+    for (; x + kPixelsPerIteration <= destWidth; x += kPixelsPerIteration)
+    {
+        const uint8x16x2_t pixels = LoadPixelPairsNEON<PixelBytes>(source + x * 2 * PixelBytes);
+        vst1q_u8(dest + x * PixelBytes, vhaddq_u8(pixels.val[0], pixels.val[1]));
+    }
+    return x;
+}
+
+template <size_t PixelBytes>
+size_t GenerateMipRowXY_BytewiseNEON(const uint8_t *source0,
+                                     const uint8_t *source1,
+                                     uint8_t *dest,
+                                     size_t destWidth)
+{
+    constexpr size_t kPixelsPerIteration = 16 / PixelBytes;
+
+    size_t x = 0;
+    for (; x + kPixelsPerIteration <= destWidth; x += kPixelsPerIteration)
+    {
+        const uint8x16x2_t top    = LoadPixelPairsNEON<PixelBytes>(source0 + x * 2 * PixelBytes);
+        const uint8x16x2_t bottom = LoadPixelPairsNEON<PixelBytes>(source1 + x * 2 * PixelBytes);
+
+        // Like GenerateMip_XY, average vertically first, then horizontally.
+        const uint8x16_t even = vhaddq_u8(top.val[0], bottom.val[0]);
+        const uint8x16_t odd  = vhaddq_u8(top.val[1], bottom.val[1]);
+        vst1q_u8(dest + x * PixelBytes, vhaddq_u8(even, odd));
+    }
+    return x;
+}
+
+inline float32x4_t AverageFloatsNEON(float32x4_t a, float32x4_t b)
+{
+    return vmulq_n_f32(vaddq_f32(a, b), 0.5f);
+}
+
+size_t GenerateMipRowX_RGBA32FNEON(const uint8_t *source, uint8_t *dest, size_t destWidth)
+{
+    const float *sourceFloats = reinterpret_cast<const float *>(source);
+    float *destFloats         = reinterpret_cast<float *>(dest);
+
+    for (size_t x = 0; x < destWidth; ++x)
+    {
+        vst1q_f32(destFloats + x * 4, AverageFloatsNEON(vld1q_f32(sourceFloats + x * 8),
+                                                        vld1q_f32(sourceFloats + x * 8 + 4)));
+    }
+    return destWidth;
+}
+
+size_t GenerateMipRowXY_RGBA32FNEON(const uint8_t *source0,
+                                    const uint8_t *source1,
+                                    uint8_t *dest,
+                                    size_t destWidth)
+{
+    const float *source0Floats = reinterpret_cast<const float *>(source0);
+    const float *source1Floats = reinterpret_cast<const float *>(source1);
+    float *destFloats          = reinterpret_cast<float *>(dest);
+
+    for (size_t x = 0; x < destWidth; ++x)
+    {
+        const float32x4_t even = AverageFloatsNEON(vld1q_f32(source0Floats + x * 8),
+                                                   vld1q_f32(source1Floats + x * 8));
+        const float32x4_t odd  = AverageFloatsNEON(vld1q_f32(source0Floats + x * 8 + 4),
+                                                   vld1q_f32(source1Floats + x * 8 + 4));
+        vst1q_f32(destFloats + x * 4, AverageFloatsNEON(even, odd));
+    }
+    return destWidth;
+}
+#endif  // defined(ANGLE_LOADIMAGE_USE_NEON)
+}  // anonymous namespace
+
+size_t GenerateMipRowX_Bytewise(const uint8_t *source,
+                                uint8_t *dest,
+                                size_t destWidth,
+                                size_t pixelBytes)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (GetSupportedSIMDLevel() >= SIMDLevel::SSE2)
+    {
+        switch (pixelBytes)
+        {
+            case 1:
+                return GenerateMipRowX_BytewiseSSE2<1>(source, dest, destWidth);
+            case 2:
+                return GenerateMipRowX_BytewiseSSE2<2>(source, dest, destWidth);
+            case 4:
+                return GenerateMipRowX_BytewiseSSE2<4>(source, dest, destWidth);
+        }
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    switch (pixelBytes)
+    {
+        case 1:
+            return GenerateMipRowX_BytewiseNEON<1>(source, dest, destWidth);
+        case 2:
+            return GenerateMipRowX_BytewiseNEON<2>(source, dest, destWidth);
+        case 4:
+            return GenerateMipRowX_BytewiseNEON<4>(source, dest, destWidth);
+    }
+#endif
+    return 0;
+}
+
+size_t GenerateMipRowXY_Bytewise(const uint8_t *source0,
+                                 const uint8_t *source1,
+                                 uint8_t *dest,
+                                 size_t destWidth,
+                                 size_t pixelBytes)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (GetSupportedSIMDLevel() >= SIMDLevel::SSE2)
+    {
+        switch (pixelBytes)
+        {
+            case 1:
+                return GenerateMipRowXY_BytewiseSSE2<1>(source0, source1, dest, destWidth);
+            case 2:
+                return GenerateMipRowXY_BytewiseSSE2<2>(source0, source1, dest, destWidth);
+            case 4:
+                return GenerateMipRowXY_BytewiseSSE2<4>(source0, source1, dest, destWidth);
+        }
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    switch (pixelBytes)
+    {
+        case 1:
+            return GenerateMipRowXY_BytewiseNEON<1>(source0, source1, dest, destWidth);
+        case 2:
+            return GenerateMipRowXY_BytewiseNEON<2>(source0, source1, dest, destWidth);
+        case 4:
+            return GenerateMipRowXY_BytewiseNEON<4>(source0, source1, dest, destWidth);
+    }
+#endif
+    return 0;
+}
+
+// The NEON conversions to half floats don't round denormals and NaNs like gl::float32ToFloat16, so
+// RGBA16F is only vectorized with SSE.
+size_t GenerateMipRowX_RGBA16F(const uint8_t *source, uint8_t *dest, size_t destWidth)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (GetSupportedSIMDLevel() >= SIMDLevel::SSE2)
+    {
+        return GenerateMipRowX_RGBA16FSSE2(source, dest, destWidth);
+    }
+#endif
+    return 0;
+}
+
+size_t GenerateMipRowXY_RGBA16F(const uint8_t *source0,
+                                const uint8_t *source1,
+                                uint8_t *dest,
+                                size_t destWidth)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (GetSupportedSIMDLevel() >= SIMDLevel::SSE2)
+    {
+        return GenerateMipRowXY_RGBA16FSSE2(source0, source1, dest, destWidth);
+    }
+#endif
+    return 0;
+}
+
+size_t GenerateMipRowX_RGBA32F(const uint8_t *source, uint8_t *dest, size_t destWidth)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (GetSupportedSIMDLevel() >= SIMDLevel::SSE2)
+    {
+        return GenerateMipRowX_RGBA32FSSE2(source, dest, destWidth);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    return GenerateMipRowX_RGBA32FNEON(source, dest, destWidth);
+#endif
+    return 0;
+}
+
+size_t GenerateMipRowXY_RGBA32F(const uint8_t *source0,
+                                const uint8_t *source1,
+                                uint8_t *dest,
+                                size_t destWidth)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (GetSupportedSIMDLevel() >= SIMDLevel::SSE2)
+    {
+        return GenerateMipRowXY_RGBA32FSSE2(source0, source1, dest, destWidth);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    return GenerateMipRowXY_RGBA32FNEON(source0, source1, dest, destWidth);
+#endif
+    return 0;
+}
+}  // namespace priv
+
+namespace
+{
+// Mip levels with less output than this are generated on the calling thread, as splitting them
+// would cost more than it saves.  Each source byte is only read once, so this is lower than for
+// image loads.
+constexpr size_t kMinParallelMipBytes = 1024 * 1024;
+// Each band of a split level generates at least this much output.
+constexpr size_t kMinParallelMipBandBytes = 256 * 1024;
+constexpr size_t kMaxParallelMipBands     = 16;
+
+class GenerateMipBandTask final : public Closure
+{
+  public:
+    GenerateMipBandTask(GenerateMipFunction generateMip,
+                        size_t sourceWidth,
+                        size_t sourceHeight,
+                        size_t sourceDepth,
+                        const uint8_t *sourceData,
+                        size_t sourceRowPitch,
+                        size_t sourceDepthPitch,
+                        uint8_t *destData,
+                        size_t destRowPitch,
+                        size_t destDepthPitch)
+        : mGenerateMip(generateMip),
+          mSourceWidth(sourceWidth),
+          mSourceHeight(sourceHeight),
+          mSourceDepth(sourceDepth),
+          mSourceData(sourceData),
+          mSourceRowPitch(sourceRowPitch),
+          mSourceDepthPitch(sourceDepthPitch),
+          mDestData(destData),
+          mDestRowPitch(destRowPitch),
+          mDestDepthPitch(destDepthPitch)
+    {}
+
+    void operator()() override
+    {
+        mGenerateMip(mSourceWidth, mSourceHeight, mSourceDepth, mSourceData, mSourceRowPitch,
+                     mSourceDepthPitch, mDestData, mDestRowPitch, mDestDepthPitch);
+    }
+
+  private:
+    GenerateMipFunction mGenerateMip;
+    size_t mSourceWidth;
+    size_t mSourceHeight;
+    size_t mSourceDepth;
+    const uint8_t *mSourceData;
+    size_t mSourceRowPitch;
+    size_t mSourceDepthPitch;
+    uint8_t *mDestData;
+    size_t mDestRowPitch;
+    size_t mDestDepthPitch;
+};
+}  // anonymous namespace
+
+void GenerateMipInParallel(GenerateMipFunction generateMip,
+                           const ImageLoadContext &context,
+                           size_t sourceWidth,
+                           size_t sourceHeight,
+                           size_t sourceDepth,
+                           const uint8_t *sourceData,
+                           size_t sourceRowPitch,
+                           size_t sourceDepthPitch,
+                           uint8_t *destData,
+                           size_t destRowPitch,
+                           size_t destDepthPitch)
+{
+    const size_t destHeight = std::max<size_t>(1, sourceHeight >> 1);
+    const size_t destDepth  = std::max<size_t>(1, sourceDepth >> 1);
+    const size_t destSize   = destRowPitch * destHeight * destDepth;
+
+    WorkerThreadPool *pool = context.multiThreadPool.get();
+    size_t bandCount       = 1;
+    if (pool != nullptr && pool->isAsync() && destSize >= kMinParallelMipBytes)
+    {
+        bandCount = std::min(destSize / kMinParallelMipBandBytes, kMaxParallelMipBands);
+    }
+
+    // Each band reads twice as many source rows or slices as it generates.  3D images with too few
+    // rows to give each band some are split by slices instead, and rows of 1D images can't be
+    // split.
+    const bool splitSlices = sourceDepth > 1 && destHeight < bandCount && destDepth > destHeight;
+    const size_t unitCount = splitSlices ? destDepth : (sourceHeight > 1 ? destHeight : 1);
+    bandCount              = std::min(bandCount, unitCount);
+
+    if (bandCount <= 1)
+    {
+        generateMip(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                    sourceDepthPitch, destData, destRowPitch, destDepthPitch);
+        return;
+    }
+
+    const size_t unitsPerBand = (unitCount + bandCount - 1) / bandCount;
+    std::vector<std::shared_ptr<GenerateMipBandTask>> tasks;
+    for (size_t firstUnit = 0; firstUnit < unitCount; firstUnit += unitsPerBand)
+    {
+        // The last band also takes the odd source row or slice, which GenerateMip ignores.
+        const bool lastBand = firstUnit + unitsPerBand >= unitCount;
+        if (splitSlices)
+        {
+            const size_t bandSourceDepth =
+                lastBand ? sourceDepth - firstUnit * 2 : unitsPerBand * 2;
+            tasks.push_back(std::make_shared<GenerateMipBandTask>(
+                generateMip, sourceWidth, sourceHeight, bandSourceDepth,
+                sourceData + firstUnit * 2 * sourceDepthPitch, sourceRowPitch, sourceDepthPitch,
+                destData + firstUnit * destDepthPitch, destRowPitch, destDepthPitch));
+        }
+        else
+        {
+            const size_t bandSourceHeight =
+                lastBand ? sourceHeight - firstUnit * 2 : unitsPerBand * 2;
+            tasks.push_back(std::make_shared<GenerateMipBandTask>(
+                generateMip, sourceWidth, bandSourceHeight, sourceDepth,
+                sourceData + firstUnit * 2 * sourceRowPitch, sourceRowPitch, sourceDepthPitch,
+                destData + firstUnit * destRowPitch, destRowPitch, destDepthPitch));
+        }
+    }
+
+    // As in LoadImageInParallel, the calling thread generates the last band instead of waiting
+    // idle, and the other bands are given high priority.
+    std::vector<std::shared_ptr<WaitableEvent>> waitEvents;
+    for (size_t taskIndex = 0; taskIndex + 1 < tasks.size(); ++taskIndex)
+    {
+        std::shared_ptr<WaitableEvent> waitEvent =
+            pool->postWorkerTaskWithPriority(tasks[taskIndex], WorkerTaskPriority::High);
+        if (waitEvent)
+        {
+            waitEvents.push_back(std::move(waitEvent));
+        }
+        else
+        {
+            (*tasks[taskIndex])();
+        }
+    }
+    (*tasks.back())();
+
+    WaitableEvent::WaitMany(&waitEvents);
+}
+}  // namespace angle
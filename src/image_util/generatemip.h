@@ -15,6 +15,7 @@
 
 namespace angle
 {
+struct ImageLoadContext;
 
 template <typename T>
 inline void GenerateMip(size_t sourceWidth,
@@ -27,6 +28,31 @@ inline void GenerateMip(size_t sourceWidth,
                         size_t destRowPitch,
                         size_t destDepthPitch);
 
+using GenerateMipFunction = void (*)(size_t sourceWidth,
+                                     size_t sourceHeight,
+                                     size_t sourceDepth,
+                                     const uint8_t *sourceData,
+                                     size_t sourceRowPitch,
+                                     size_t sourceDepthPitch,
+                                     uint8_t *destData,
+                                     size_t destRowPitch,
+                                     size_t destDepthPitch);
+
+// Calls |generateMip|, an instantiation of GenerateMip, on the image.  Large images are split into
+// bands of destination rows, or of slices for 3D images with few rows, which are generated
+// concurrently on |context.multiThreadPool|.
+void GenerateMipInParallel(GenerateMipFunction generateMip,
+                           const ImageLoadContext &context,
+                           size_t sourceWidth,
+                           size_t sourceHeight,
+                           size_t sourceDepth,
+                           const uint8_t *sourceData,
+                           size_t sourceRowPitch,
+                           size_t sourceDepthPitch,
+                           uint8_t *destData,
+                           size_t destRowPitch,
+                           size_t destDepthPitch);
+
 }  // namespace angle
 
 #include "generatemip.inc"
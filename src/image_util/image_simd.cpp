@@ -0,0 +1,99 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// image_simd.cpp: Detects the vector instruction sets that the image utilities can use.
+
+#include "image_util/image_simd.h"
+
+#if defined(ANGLE_LOADIMAGE_USE_SSE) && !(defined(_MSC_VER) && !defined(__clang__))
+#    include <cpuid.h>
+#endif
+
+namespace angle
+{
+namespace
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+void GetCPUID(uint32_t leaf, uint32_t subleaf, uint32_t *regs)
+{
+#    if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (size_t index = 0; index < 4; ++index)
+    {
+        regs[index] = static_cast<uint32_t>(info[index]);
+    }
+#    else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#    endif
+}
+
+uint64_t GetXCR0()
+{
+#    if defined(_MSC_VER) && !defined(__clang__)
+    return _xgetbv(0);
+#    else
+    uint32_t eax = 0;
+    uint32_t edx = 0;
+    __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return static_cast<uint64_t>(edx) << 32 | eax;
+#    endif
+}
+
+SIMDLevel DetectSIMDLevel()
+{
+    uint32_t regs[4];
+    GetCPUID(0, 0, regs);
+    const uint32_t maxLeaf = regs[0];
+    if (maxLeaf < 1)
+    {
+        return SIMDLevel::None;
+    }
+
+    GetCPUID(1, 0, regs);
+    const bool hasSSE2    = (regs[3] >> 26) & 1;
+    const bool hasSSSE3   = (regs[2] >> 9) & 1;
+    const bool hasOSXSAVE = (regs[2] >> 27) & 1;
+    const bool hasAVX     = (regs[2] >> 28) & 1;
+
+    // AVX2 also needs the OS to preserve the YMM registers across context switches.
+    bool hasAVX2 = false;
+    if (maxLeaf >= 7 && hasOSXSAVE && hasAVX && (GetXCR0() & 0x6) == 0x6)
+    {
+        GetCPUID(7, 0, regs);
+        hasAVX2 = (regs[1] >> 5) & 1;
+    }
+
+    if (!hasSSE2)
+    {
+        return SIMDLevel::None;
+    }
+    if (!hasSSSE3)
+    {
+        return SIMDLevel::SSE2;
+    }
+    return hasAVX2 ? SIMDLevel::AVX2 : SIMDLevel::SSSE3;
+}
+#endif
+}  // anonymous namespace
+
+SIMDLevel GetSupportedSIMDLevel()
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    static const SIMDLevel kSupportedLevel = DetectSIMDLevel();
+    return kSupportedLevel;
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    return SIMDLevel::NEON;
+#else
+    return SIMDLevel::None;
+#endif
+}
+
+SIMDLevel GetSIMDLevel(const ImageLoadContext &context)
+{
+    return context.useSIMD ? GetSupportedSIMDLevel() : SIMDLevel::None;
+}
+}  // namespace angle
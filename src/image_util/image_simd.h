@@ -0,0 +1,50 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// image_simd.h: Selects the vector instruction sets that the image utilities can use.
+
+#ifndef IMAGEUTIL_IMAGE_SIMD_H_
+#define IMAGEUTIL_IMAGE_SIMD_H_
+
+#include "image_util/loadimage.h"
+
+// Functions using instructions beyond the baseline of the target are marked with
+// ANGLE_LOADIMAGE_TARGET, and only called once GetSIMDLevel() has found the CPU supports them.
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#    define ANGLE_LOADIMAGE_USE_SSE
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <intrin.h>
+#        define ANGLE_LOADIMAGE_TARGET(isa)
+#    else
+#        include <immintrin.h>
+#        define ANGLE_LOADIMAGE_TARGET(isa) __attribute__((target(isa)))
+#    endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_LOADIMAGE_USE_NEON
+#endif
+
+namespace angle
+{
+// The vector instruction sets that the image functions can use.  The x86 ones are ordered, each
+// implying support for the previous ones.
+enum class SIMDLevel
+{
+    None,
+    SSE2,
+    SSSE3,
+    AVX2,
+    NEON,
+};
+
+// Returns the best instruction set supported by the CPU.
+SIMDLevel GetSupportedSIMDLevel();
+
+// Returns the best instruction set supported by the CPU, or None if |context| disables them.
+SIMDLevel GetSIMDLevel(const ImageLoadContext &context);
+}  // namespace angle
+
+#endif  // IMAGEUTIL_IMAGE_SIMD_H_
@@ -12,54 +12,742 @@
 
 #include "image_util/loadimage.h"
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "common/WorkerThread.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
+#include "image_util/image_simd.h"
 #include "image_util/imageformats.h"
 
-#if defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM) && !defined(_M_ARM64)
-#    if defined(_MSC_VER)
-#        include <intrin.h>
-#        define ANGLE_LOADIMAGE_USE_SSE
-#    elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
-#        include <x86intrin.h>
-#        if __SSE__
-#            define ANGLE_LOADIMAGE_USE_SSE
-#        endif
-#    endif
-#endif
+namespace angle
+{
+ImageLoadContext::ImageLoadContext()                                         = default;
+ImageLoadContext::~ImageLoadContext()                                        = default;
+ImageLoadContext::ImageLoadContext(const ImageLoadContext &other)            = default;
+ImageLoadContext &ImageLoadContext::operator=(const ImageLoadContext &other) = default;
+
+namespace
+{
+// Images with less output than this are loaded on the calling thread, as splitting them would cost
+// more than it saves.
+constexpr size_t kMinParallelLoadBytes = 4 * 1024 * 1024;
+// Each band of a split image loads at least this much output.  There may be more bands than
+// worker threads, which balances the load when some threads are busy with other work.
+constexpr size_t kMinParallelLoadBandBytes = 1024 * 1024;
+constexpr size_t kMaxParallelLoadBands     = 16;
+
+size_t CeilDivide(size_t value, size_t divisor)
+{
+    return (value + divisor - 1) / divisor;
+}
+
+// What all the bands of an image share.
+struct LoadImageParams
+{
+    LoadImageFunction loadFunction;
+    ImageLoadContext context;
+    size_t width;
+    size_t inputRowPitch;
+    size_t inputDepthPitch;
+    size_t outputRowPitch;
+    size_t outputDepthPitch;
+};
+
+class LoadImageBandTask final : public Closure
+{
+  public:
+    LoadImageBandTask(const LoadImageParams *params,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      uint8_t *output)
+        : mParams(params), mHeight(height), mDepth(depth), mInput(input), mOutput(output)
+    {}
+
+    void operator()() override
+    {
+        mParams->loadFunction(mParams->context, mParams->width, mHeight, mDepth, mInput,
+                              mParams->inputRowPitch, mParams->inputDepthPitch, mOutput,
+                              mParams->outputRowPitch, mParams->outputDepthPitch);
+    }
+
+  private:
+    const LoadImageParams *mParams;
+    size_t mHeight;
+    size_t mDepth;
+    const uint8_t *mInput;
+    uint8_t *mOutput;
+};
+}  // anonymous namespace
+
+void LoadImageInParallel(LoadImageFunction loadFunction,
+                         const ImageLoadContext &context,
+                         size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch,
+                         size_t inputBlockHeight,
+                         size_t outputBlockHeight)
+{
+    ASSERT(inputBlockHeight > 0 && outputBlockHeight > 0);
+
+    // Bands start at a row of blocks of both the input and the output.
+    const size_t bandRowAlignment = std::lcm(inputBlockHeight, outputBlockHeight);
+    const size_t rowGroupCount    = CeilDivide(height, bandRowAlignment);
+    const size_t outputSize       = outputRowPitch * CeilDivide(height, outputBlockHeight) * depth;
+
+    WorkerThreadPool *pool = context.multiThreadPool.get();
+    size_t bandCount       = 1;
+    if (pool != nullptr && pool->isAsync() && outputSize >= kMinParallelLoadBytes)
+    {
+        bandCount = std::min(outputSize / kMinParallelLoadBandBytes, kMaxParallelLoadBands);
+    }
+
+    // 3D images with too few rows to give each band some are split by slices instead.
+    const bool splitSlices = rowGroupCount < bandCount && depth > rowGroupCount;
+    const size_t unitCount = splitSlices ? depth : rowGroupCount;
+    bandCount              = std::min(bandCount, unitCount);
+
+    if (bandCount <= 1)
+    {
+        loadFunction(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch);
+        return;
+    }
+
+    // Some load functions use the thread pool themselves, which the bands must not do as they
+    // would wait on tasks queued behind them.
+    LoadImageParams params;
+    params.loadFunction            = loadFunction;
+    params.context                 = context;
+    params.context.multiThreadPool = nullptr;
+    params.width                   = width;
+    params.inputRowPitch           = inputRowPitch;
+    params.inputDepthPitch         = inputDepthPitch;
+    params.outputRowPitch          = outputRowPitch;
+    params.outputDepthPitch        = outputDepthPitch;
+
+    const size_t unitsPerBand = CeilDivide(unitCount, bandCount);
+    std::vector<std::shared_ptr<LoadImageBandTask>> tasks;
+    for (size_t firstUnit = 0; firstUnit < unitCount; firstUnit += unitsPerBand)
+    {
+        const size_t bandUnitCount = std::min(unitsPerBand, unitCount - firstUnit);
+        if (splitSlices)
+        {
+            tasks.push_back(std::make_shared<LoadImageBandTask>(
+                &params, height, bandUnitCount, input + firstUnit * inputDepthPitch,
+                output + firstUnit * outputDepthPitch));
+        }
+        else
+        {
+            const size_t firstRow = firstUnit * bandRowAlignment;
+            const size_t rowCount = std::min(bandUnitCount * bandRowAlignment, height - firstRow);
+            tasks.push_back(std::make_shared<LoadImageBandTask>(
+                &params, rowCount, depth, input + firstRow / inputBlockHeight * inputRowPitch,
+                output + firstRow / outputBlockHeight * outputRowPitch));
+        }
+    }
+
+    // The calling thread loads the last band instead of waiting idle.  The application is waiting
+    // for the upload, so the other bands are given high priority.
+    std::vector<std::shared_ptr<WaitableEvent>> waitEvents;
+    for (size_t taskIndex = 0; taskIndex + 1 < tasks.size(); ++taskIndex)
+    {
+        std::shared_ptr<WaitableEvent> waitEvent =
+            pool->postWorkerTaskWithPriority(tasks[taskIndex], WorkerTaskPriority::High);
+        if (waitEvent)
+        {
+            waitEvents.push_back(std::move(waitEvent));
+        }
+        else
+        {
+            (*tasks[taskIndex])();
+        }
+    }
+    (*tasks.back())();
+
+    WaitableEvent::WaitMany(&waitEvents);
+}
+
+namespace
+{
+// The row functions below convert as many pixels at the start of a row as the vector code can
+// handle, and return how many they converted.  The scalar loops of the Load* functions convert the
+// rest, and are the reference implementation that the vector code matches.
+
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t LoadA8ToRGBA8RowSSE2(const uint8_t *source, uint32_t *dest, size_t width)
+{
+    const __m128i zeroWide = _mm_setzero_si128();
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i sourceData = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&source[x]));
+        // Interleave each byte to 16bit, make the lower byte to zero
+        sourceData = _mm_unpacklo_epi8(zeroWide, sourceData);
+        // Interleave each 16bit to 32bit, make the lower 16bit to zero
+        __m128i lo = _mm_unpacklo_epi16(zeroWide, sourceData);
+        __m128i hi = _mm_unpackhi_epi16(zeroWide, sourceData);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x + 4]), hi);
+    }
+    return x;
+}
+
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t LoadL8ToRGBA8RowSSE2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m128i opaque = _mm_set1_epi8(-1);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+
+        // Pair each luminance with itself and with an opaque alpha, then interleave the pairs.
+        __m128i ll = _mm_unpacklo_epi8(l, l);
+        __m128i la = _mm_unpacklo_epi8(l, opaque);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x]), _mm_unpacklo_epi16(ll, la));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x + 16]),
+                         _mm_unpackhi_epi16(ll, la));
+
+        ll = _mm_unpackhi_epi8(l, l);
+        la = _mm_unpackhi_epi8(l, opaque);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x + 32]),
+                         _mm_unpacklo_epi16(ll, la));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x + 48]),
+                         _mm_unpackhi_epi16(ll, la));
+    }
+    return x;
+}
+
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t LoadLA8ToRGBA8RowSSE2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m128i lowByteMask = _mm_set1_epi16(0x00FF);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        const __m128i la = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[2 * x]));
+        const __m128i l  = _mm_and_si128(la, lowByteMask);
+        const __m128i ll = _mm_or_si128(l, _mm_slli_epi16(l, 8));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x]), _mm_unpacklo_epi16(ll, la));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x + 16]),
+                         _mm_unpackhi_epi16(ll, la));
+    }
+    return x;
+}
+
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t LoadL16FToRGBA16FRowSSE2(const uint16_t *source, uint16_t *dest, size_t width)
+{
+    const __m128i one = _mm_set1_epi16(static_cast<short>(gl::Float16One));
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+
+        __m128i ll   = _mm_unpacklo_epi16(l, l);
+        __m128i lOne = _mm_unpacklo_epi16(l, one);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x]), _mm_unpacklo_epi32(ll, lOne));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x + 8]),
+                         _mm_unpackhi_epi32(ll, lOne));
+
+        ll   = _mm_unpackhi_epi16(l, l);
+        lOne = _mm_unpackhi_epi16(l, one);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x + 16]),
+                         _mm_unpacklo_epi32(ll, lOne));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x + 24]),
+                         _mm_unpackhi_epi32(ll, lOne));
+    }
+    return x;
+}
+
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t LoadLA16FToRGBA16FRowSSE2(const uint16_t *source, uint16_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        const __m128i la = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[2 * x]));
+        // Duplicate the luminance of each pixel.
+        const __m128i ll = _mm_shufflehi_epi16(_mm_shufflelo_epi16(la, _MM_SHUFFLE(2, 2, 0, 0)),
+                                               _MM_SHUFFLE(2, 2, 0, 0));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x]), _mm_unpacklo_epi32(ll, la));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x + 8]),
+                         _mm_unpackhi_epi32(ll, la));
+    }
+    return x;
+}
+
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t LoadRGB565ToBGR565RowSSE2(const uint16_t *source, uint16_t *dest, size_t width)
+{
+    const __m128i greenMask = _mm_set1_epi16(0x07E0);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        const __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+        const __m128i r   = _mm_srli_epi16(rgb, 11);
+        const __m128i g   = _mm_and_si128(rgb, greenMask);
+        const __m128i b   = _mm_slli_epi16(rgb, 11);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]),
+                         _mm_or_si128(_mm_or_si128(r, g), b));
+    }
+    return x;
+}
+
+ANGLE_LOADIMAGE_TARGET("avx2")
+size_t LoadRGB565ToBGR565RowAVX2(const uint16_t *source, uint16_t *dest, size_t width)
+{
+    const __m256i greenMask = _mm256_set1_epi16(0x07E0);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const __m256i rgb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&source[x]));
+        const __m256i r   = _mm256_srli_epi16(rgb, 11);
+        const __m256i g   = _mm256_and_si256(rgb, greenMask);
+        const __m256i b   = _mm256_slli_epi16(rgb, 11);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[x]),
+                            _mm256_or_si256(_mm256_or_si256(r, g), b));
+    }
+    return x;
+}
+
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t LoadRGBA8ToBGRA8RowSSE2(const uint32_t *source, uint32_t *dest, size_t width)
+{
+    const __m128i brMask = _mm_set1_epi32(0x00ff00ff);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i sourceData = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+        // Mask out g and a, which don't change
+        __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
+        // Mask out b and r
+        __m128i brComponents = _mm_and_si128(sourceData, brMask);
+        // Swap b and r
+        __m128i brSwapped =
+            _mm_shufflehi_epi16(_mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)),
+                                _MM_SHUFFLE(2, 3, 0, 1));
+        __m128i result = _mm_or_si128(gaComponents, brSwapped);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]), result);
+    }
+    return x;
+}
+
+ANGLE_LOADIMAGE_TARGET("avx2")
+size_t LoadRGBA8ToBGRA8RowAVX2(const uint32_t *source, uint32_t *dest, size_t width)
+{
+    const __m256i swapRB = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15));
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        const __m256i rgba = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&source[x]));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[x]),
+                            _mm256_shuffle_epi8(rgba, swapRB));
+    }
+    return x;
+}
+
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t LoadD24S8ToS8D24RowSSE2(const uint32_t *source, uint32_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        const __m128i d24s8 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]),
+                         _mm_or_si128(_mm_slli_epi32(d24s8, 24), _mm_srli_epi32(d24s8, 8)));
+    }
+    return x;
+}
+
+ANGLE_LOADIMAGE_TARGET("avx2")
+size_t LoadD24S8ToS8D24RowAVX2(const uint32_t *source, uint32_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        const __m256i d24s8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&source[x]));
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i *>(&dest[x]),
+            _mm256_or_si256(_mm256_slli_epi32(d24s8, 24), _mm256_srli_epi32(d24s8, 8)));
+    }
+    return x;
+}
+
+// Shuffles that expand 4 packed 3-byte pixels to 4-byte pixels, leaving the fourth byte zero.
+ANGLE_LOADIMAGE_TARGET("ssse3")
+__m128i GetRGB8ExpandMask(bool swapRB)
+{
+    return swapRB ? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1)
+                  : _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+}
+
+ANGLE_LOADIMAGE_TARGET("ssse3")
+size_t LoadRGB8ToRGBX8RowSSSE3(const uint8_t *source,
+                               uint8_t *dest,
+                               size_t width,
+                               bool swapRB,
+                               uint8_t fourthValue)
+{
+    const __m128i expandMask = GetRGB8ExpandMask(swapRB);
+    const __m128i fourth     = _mm_set1_epi32(static_cast<int>(uint32_t{fourthValue} << 24));
+
+    // Each iteration converts 4 pixels, but loads 16 bytes, which is more than 5 pixels.
+    size_t x = 0;
+    for (; x + 6 <= width; x += 4)
+    {
+        const __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[3 * x]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[4 * x]),
+                         _mm_or_si128(_mm_shuffle_epi8(rgb, expandMask), fourth));
+    }
+    return x;
+}
+
+ANGLE_LOADIMAGE_TARGET("avx2")
+size_t LoadRGB8ToRGBX8RowAVX2(const uint8_t *source,
+                              uint8_t *dest,
+                              size_t width,
+                              bool swapRB,
+                              uint8_t fourthValue)
+{
+    const __m256i expandMask = _mm256_broadcastsi128_si256(GetRGB8ExpandMask(swapRB));
+    const __m256i fourth     = _mm256_set1_epi32(static_cast<int>(uint32_t{fourthValue} << 24));
+
+    // Each iteration converts 8 pixels, but its second load ends past the 9th pixel.
+    size_t x = 0;
+    for (; x + 10 <= width; x += 8)
+    {
+        const __m128i rgbLo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[3 * x]));
+        const __m128i rgbHi =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[3 * x + 12]));
+        const __m256i rgb = _mm256_inserti128_si256(_mm256_castsi128_si256(rgbLo), rgbHi, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[4 * x]),
+                            _mm256_or_si256(_mm256_shuffle_epi8(rgb, expandMask), fourth));
+    }
+    return x;
+}
+#endif  // defined(ANGLE_LOADIMAGE_USE_SSE)
+
+#if defined(ANGLE_LOADIMAGE_USE_NEON)
+size_t LoadA8ToRGBA8RowNEON(const uint8_t *source, uint32_t *dest, size_t width)
+{
+    const uint8x16_t zero = vdupq_n_u8(0);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const uint8x16x4_t rgba = {{zero, zero, zero, vld1q_u8(&source[x])}};
+        vst4q_u8(reinterpret_cast<uint8_t *>(&dest[x]), rgba);
+    }
+    return x;
+}
+
+size_t LoadL8ToRGBA8RowNEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const uint8x16_t opaque = vdupq_n_u8(0xFF);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const uint8x16_t l      = vld1q_u8(&source[x]);
+        const uint8x16x4_t rgba = {{l, l, l, opaque}};
+        vst4q_u8(&dest[4 * x], rgba);
+    }
+    return x;
+}
+
+size_t LoadLA8ToRGBA8RowNEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const uint8x16x2_t la   = vld2q_u8(&source[2 * x]);
+        const uint8x16x4_t rgba = {{la.val[0], la.val[0], la.val[0], la.val[1]}};
+        vst4q_u8(&dest[4 * x], rgba);
+    }
+    return x;
+}
+
+size_t LoadL16FToRGBA16FRowNEON(const uint16_t *source, uint16_t *dest, size_t width)
+{
+    const uint16x8_t one = vdupq_n_u16(gl::Float16One);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        const uint16x8_t l      = vld1q_u16(&source[x]);
+        const uint16x8x4_t rgba = {{l, l, l, one}};
+        vst4q_u16(&dest[4 * x], rgba);
+    }
+    return x;
+}
+
+size_t LoadLA16FToRGBA16FRowNEON(const uint16_t *source, uint16_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        const uint16x8x2_t la   = vld2q_u16(&source[2 * x]);
+        const uint16x8x4_t rgba = {{la.val[0], la.val[0], la.val[0], la.val[1]}};
+        vst4q_u16(&dest[4 * x], rgba);
+    }
+    return x;
+}
+
+size_t LoadRGB565ToBGR565RowNEON(const uint16_t *source, uint16_t *dest, size_t width)
+{
+    const uint16x8_t greenMask = vdupq_n_u16(0x07E0);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        const uint16x8_t rgb = vld1q_u16(&source[x]);
+        const uint16x8_t r   = vshrq_n_u16(rgb, 11);
+        const uint16x8_t g   = vandq_u16(rgb, greenMask);
+        const uint16x8_t b   = vshlq_n_u16(rgb, 11);
+        vst1q_u16(&dest[x], vorrq_u16(vorrq_u16(r, g), b));
+    }
+    return x;
+}
+
+size_t LoadRGBA8ToBGRA8RowNEON(const uint32_t *source, uint32_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const uint8x16x4_t rgba = vld4q_u8(reinterpret_cast<const uint8_t *>(&source[x]));
+        const uint8x16x4_t bgra = {{rgba.val[2], rgba.val[1], rgba.val[0], rgba.val[3]}};
+        vst4q_u8(reinterpret_cast<uint8_t *>(&dest[x]), bgra);
+    }
+    return x;
+}
+
+size_t LoadD24S8ToS8D24RowNEON(const uint32_t *source, uint32_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        const uint32x4_t d24s8 = vld1q_u32(&source[x]);
+        vst1q_u32(&dest[x], vorrq_u32(vshlq_n_u32(d24s8, 24), vshrq_n_u32(d24s8, 8)));
+    }
+    return x;
+}
+
+size_t LoadRGB8ToRGBX8RowNEON(const uint8_t *source,
+                              uint8_t *dest,
+                              size_t width,
+                              bool swapRB,
+                              uint8_t fourthValue)
+{
+    const uint8x16_t fourth = vdupq_n_u8(fourthValue);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const uint8x16x3_t rgb = vld3q_u8(&source[3 * x]);
+        const uint8x16x4_t rgbx =
+            swapRB ? uint8x16x4_t{{rgb.val[2], rgb.val[1], rgb.val[0], fourth}}
+                   : uint8x16x4_t{{rgb.val[0], rgb.val[1], rgb.val[2], fourth}};
+        vst4q_u8(&dest[4 * x], rgbx);
+    }
+    return x;
+}
+#endif  // defined(ANGLE_LOADIMAGE_USE_NEON)
 
+size_t LoadA8ToRGBA8Row(SIMDLevel level, const uint8_t *source, uint32_t *dest, size_t width)
+{
 #if defined(ANGLE_LOADIMAGE_USE_SSE)
-inline bool supportsSSE2()
+    if (level >= SIMDLevel::SSE2)
+    {
+        return LoadA8ToRGBA8RowSSE2(source, dest, width);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (level == SIMDLevel::NEON)
+    {
+        return LoadA8ToRGBA8RowNEON(source, dest, width);
+    }
+#endif
+    return 0;
+}
+
+size_t LoadL8ToRGBA8Row(SIMDLevel level, const uint8_t *source, uint8_t *dest, size_t width)
 {
-    static bool checked  = false;
-    static bool supports = false;
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (level >= SIMDLevel::SSE2)
+    {
+        return LoadL8ToRGBA8RowSSE2(source, dest, width);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (level == SIMDLevel::NEON)
+    {
+        return LoadL8ToRGBA8RowNEON(source, dest, width);
+    }
+#endif
+    return 0;
+}
 
-    if (checked)
+size_t LoadLA8ToRGBA8Row(SIMDLevel level, const uint8_t *source, uint8_t *dest, size_t width)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (level >= SIMDLevel::SSE2)
+    {
+        return LoadLA8ToRGBA8RowSSE2(source, dest, width);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (level == SIMDLevel::NEON)
     {
-        return supports;
+        return LoadLA8ToRGBA8RowNEON(source, dest, width);
     }
+#endif
+    return 0;
+}
 
-    int info[4];
-    __cpuid(info, 0);
+size_t LoadL16FToRGBA16FRow(SIMDLevel level, const uint16_t *source, uint16_t *dest, size_t width)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (level >= SIMDLevel::SSE2)
+    {
+        return LoadL16FToRGBA16FRowSSE2(source, dest, width);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (level == SIMDLevel::NEON)
+    {
+        return LoadL16FToRGBA16FRowNEON(source, dest, width);
+    }
+#endif
+    return 0;
+}
 
-    if (info[0] >= 1)
+size_t LoadLA16FToRGBA16FRow(SIMDLevel level, const uint16_t *source, uint16_t *dest, size_t width)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (level >= SIMDLevel::SSE2)
     {
-        __cpuid(info, 1);
+        return LoadLA16FToRGBA16FRowSSE2(source, dest, width);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (level == SIMDLevel::NEON)
+    {
+        return LoadLA16FToRGBA16FRowNEON(source, dest, width);
+    }
+#endif
+    return 0;
+}
 
-        supports = (info[3] >> 26) & 1;
+size_t LoadRGB565ToBGR565Row(SIMDLevel level, const uint16_t *source, uint16_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (level >= SIMDLevel::AVX2)
+    {
+        x = LoadRGB565ToBGR565RowAVX2(source, dest, width);
     }
+    if (level >= SIMDLevel::SSE2)
+    {
+        x += LoadRGB565ToBGR565RowSSE2(source + x, dest + x, width - x);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (level == SIMDLevel::NEON)
+    {
+        x = LoadRGB565ToBGR565RowNEON(source, dest, width);
+    }
+#endif
+    return x;
+}
 
-    checked = true;
-    return supports;
+size_t LoadRGBA8ToBGRA8Row(SIMDLevel level, const uint32_t *source, uint32_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (level >= SIMDLevel::AVX2)
+    {
+        x = LoadRGBA8ToBGRA8RowAVX2(source, dest, width);
+    }
+    if (level >= SIMDLevel::SSE2)
+    {
+        x += LoadRGBA8ToBGRA8RowSSE2(source + x, dest + x, width - x);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (level == SIMDLevel::NEON)
+    {
+        x = LoadRGBA8ToBGRA8RowNEON(source, dest, width);
+    }
+#endif
+    return x;
 }
+
+size_t LoadD24S8ToS8D24Row(SIMDLevel level, const uint32_t *source, uint32_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (level >= SIMDLevel::AVX2)
+    {
+        x = LoadD24S8ToS8D24RowAVX2(source, dest, width);
+    }
+    if (level >= SIMDLevel::SSE2)
+    {
+        x += LoadD24S8ToS8D24RowSSE2(source + x, dest + x, width - x);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (level == SIMDLevel::NEON)
+    {
+        x = LoadD24S8ToS8D24RowNEON(source, dest, width);
+    }
 #endif
+    return x;
+}
 
-namespace angle
+// Expands 3-byte pixels to 4 bytes, optionally swapping the first and third bytes.
+size_t LoadRGB8ToRGBX8Row(SIMDLevel level,
+                          const uint8_t *source,
+                          uint8_t *dest,
+                          size_t width,
+                          bool swapRB,
+                          uint8_t fourthValue)
 {
-ImageLoadContext::ImageLoadContext()                                         = default;
-ImageLoadContext::~ImageLoadContext()                                        = default;
-ImageLoadContext::ImageLoadContext(const ImageLoadContext &other)            = default;
-ImageLoadContext &ImageLoadContext::operator=(const ImageLoadContext &other) = default;
+    size_t x = 0;
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (level >= SIMDLevel::AVX2)
+    {
+        x = LoadRGB8ToRGBX8RowAVX2(source, dest, width, swapRB, fourthValue);
+    }
+    if (level >= SIMDLevel::SSSE3)
+    {
+        x += LoadRGB8ToRGBX8RowSSSE3(source + 3 * x, dest + 4 * x, width - x, swapRB,
+                                     fourthValue);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (level == SIMDLevel::NEON)
+    {
+        x = LoadRGB8ToRGBX8RowNEON(source, dest, width, swapRB, fourthValue);
+    }
+#endif
+    return x;
+}
+}  // anonymous namespace
 
 void LoadA8ToRGBA8(const ImageLoadContext &context,
                    size_t width,
@@ -72,53 +760,7 @@ void LoadA8ToRGBA8(const ImageLoadContext &context,
                    size_t outputRowPitch,
                    size_t outputDepthPitch)
 {
-#if defined(ANGLE_LOADIMAGE_USE_SSE)
-    if (supportsSSE2())
-    {
-        __m128i zeroWide = _mm_setzero_si128();
-
-        for (size_t z = 0; z < depth; z++)
-        {
-            for (size_t y = 0; y < height; y++)
-            {
-                const uint8_t *source =
-                    priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
-                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
-                                                                   outputDepthPitch);
-
-                size_t x = 0;
-
-                // Make output writes aligned
-                for (; x < width && (reinterpret_cast<intptr_t>(&dest[x]) & 0xF) != 0; x++)
-                {
-                    dest[x] = static_cast<uint32_t>(source[x]) << 24;
-                }
-
-                for (; x + 7 < width; x += 8)
-                {
-                    __m128i sourceData =
-                        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&source[x]));
-                    // Interleave each byte to 16bit, make the lower byte to zero
-                    sourceData = _mm_unpacklo_epi8(zeroWide, sourceData);
-                    // Interleave each 16bit to 32bit, make the lower 16bit to zero
-                    __m128i lo = _mm_unpacklo_epi16(zeroWide, sourceData);
-                    __m128i hi = _mm_unpackhi_epi16(zeroWide, sourceData);
-
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), lo);
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x + 4]), hi);
-                }
-
-                // Handle the remainder
-                for (; x < width; x++)
-                {
-                    dest[x] = static_cast<uint32_t>(source[x]) << 24;
-                }
-            }
-        }
-
-        return;
-    }
-#endif
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
 
     for (size_t z = 0; z < depth; z++)
     {
@@ -128,7 +770,7 @@ void LoadA8ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadA8ToRGBA8Row(simdLevel, source, dest, width); x < width; x++)
             {
                 dest[x] = static_cast<uint32_t>(source[x]) << 24;
             }
@@ -223,6 +865,8 @@ void LoadL8ToRGBA8(const ImageLoadContext &context,
                    size_t outputRowPitch,
                    size_t outputDepthPitch)
 {
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -231,7 +875,7 @@ void LoadL8ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadL8ToRGBA8Row(simdLevel, source, dest, width); x < width; x++)
             {
                 uint8_t sourceVal = source[x];
                 dest[4 * x + 0]   = sourceVal;
@@ -300,6 +944,8 @@ void LoadL16FToRGBA16F(const ImageLoadContext &context,
                        size_t outputRowPitch,
                        size_t outputDepthPitch)
 {
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -308,7 +954,7 @@ void LoadL16FToRGBA16F(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadL16FToRGBA16FRow(simdLevel, source, dest, width); x < width; x++)
             {
                 dest[4 * x + 0] = source[x];
                 dest[4 * x + 1] = source[x];
@@ -360,6 +1006,8 @@ void LoadLA8ToRGBA8(const ImageLoadContext &context,
                     size_t outputRowPitch,
                     size_t outputDepthPitch)
 {
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -368,7 +1016,7 @@ void LoadLA8ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadLA8ToRGBA8Row(simdLevel, source, dest, width); x < width; x++)
             {
                 dest[4 * x + 0] = source[2 * x + 0];
                 dest[4 * x + 1] = source[2 * x + 0];
@@ -436,6 +1084,8 @@ void LoadLA16FToRGBA16F(const ImageLoadContext &context,
                         size_t outputRowPitch,
                         size_t outputDepthPitch)
 {
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -444,7 +1094,7 @@ void LoadLA16FToRGBA16F(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadLA16FToRGBA16FRow(simdLevel, source, dest, width); x < width; x++)
             {
                 dest[4 * x + 0] = source[2 * x + 0];
                 dest[4 * x + 1] = source[2 * x + 0];
@@ -532,6 +1182,8 @@ void LoadRGB565ToBGR565(const ImageLoadContext &context,
                         size_t outputRowPitch,
                         size_t outputDepthPitch)
 {
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -540,7 +1192,7 @@ void LoadRGB565ToBGR565(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRGB565ToBGR565Row(simdLevel, source, dest, width); x < width; x++)
             {
                 auto rgb    = source[x];
                 uint16_t r5 = gl::getShiftedData<5, 11>(rgb);
@@ -563,6 +1215,8 @@ void LoadRGB8ToBGRX8(const ImageLoadContext &context,
                      size_t outputRowPitch,
                      size_t outputDepthPitch)
 {
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -571,7 +1225,7 @@ void LoadRGB8ToBGRX8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRGB8ToRGBX8Row(simdLevel, source, dest, width, true, 0xFF); x < width; x++)
             {
                 dest[4 * x + 0] = source[x * 3 + 2];
                 dest[4 * x + 1] = source[x * 3 + 1];
@@ -582,6 +1236,121 @@ void LoadRGB8ToBGRX8(const ImageLoadContext &context,
     }
 }
 
+void LoadToNativeByte3To4Impl(const ImageLoadContext &context,
+                              const uint8_t fourthValue,
+                              size_t width,
+                              size_t height,
+                              size_t depth,
+                              const uint8_t *input,
+                              size_t inputRowPitch,
+                              size_t inputDepthPitch,
+                              uint8_t *output,
+                              size_t outputRowPitch,
+                              size_t outputDepthPitch)
+{
+    // This function is used for both signed and unsigned byte copies.
+    ASSERT(IsLittleEndian());
+    uint32_t fourthValue32 = static_cast<uint32_t>(fourthValue) << 24;
+
+    // To prevent undefined behavior, if the output address is not aligned by 4, the copy would be
+    // done using the default function instead.
+    if (reinterpret_cast<uintptr_t>(output) % 4 != 0)
+    {
+        LoadToNative3To4Impl<uint8_t>(context, fourthValue, width, height, depth, input,
+                                      inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                                      outputDepthPitch);
+        return;
+    }
+
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
+
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y++)
+        {
+            const uint8_t *source8 =
+                priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
+            uint8_t *dest8 =
+                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+
+            size_t pixelIndex =
+                LoadRGB8ToRGBX8Row(simdLevel, source8, dest8, width, false, fourthValue);
+            source8 += 3 * pixelIndex;
+            dest8 += 4 * pixelIndex;
+
+            // If the uint8_t addresses are not aligned to 4 bytes, there may be undefined behavior
+            // if they are used to copy 32-bit data. In that case, pixels are copied to the output
+            // one at a time until 4-byte alignment has been achieved for the source.
+
+            uint32_t source4Mod = reinterpret_cast<uintptr_t>(source8) % 4;
+            while (source4Mod != 0 && pixelIndex < width)
+            {
+                dest8[0] = source8[0];
+                dest8[1] = source8[1];
+                dest8[2] = source8[2];
+                dest8[3] = fourthValue;
+
+                source8 += 3;
+                source4Mod = (source4Mod + 3) % 4;
+                dest8 += 4;
+                pixelIndex++;
+            }
+
+            if (pixelIndex == width)
+            {
+                continue;
+            }
+
+            // In the following loop, 4 RGB pixels will be read in each iteration. If the remaining
+            // pixels are not a multiple of 4, the rest at the end of the row will be copied one at
+            // a time.
+            const uint32_t *source32 = reinterpret_cast<const uint32_t *>(source8);
+            uint32_t *dest32         = reinterpret_cast<uint32_t *>(dest8);
+
+            size_t remainingWidth = width - pixelIndex;
+            if (remainingWidth >= 4)
+            {
+                size_t fourByteCopyThreshold = remainingWidth - 4;
+                for (; pixelIndex <= fourByteCopyThreshold; pixelIndex += 4)
+                {
+                    // Three 32-bit values from the input contain 4 RGB pixels in total. This
+                    // translates to four 32-bits on the output.
+                    // (RGBR GBRG BRGB -> RGBA RGBA RGBA RGBA)
+                    uint32_t newPixelData[3];
+                    uint32_t rgbaPixelData[4];
+                    memcpy(&newPixelData[0], &source32[0], sizeof(uint32_t) * 3);
+
+                    rgbaPixelData[0] = (newPixelData[0] & 0x00FFFFFF) | fourthValue32;
+                    rgbaPixelData[1] = (newPixelData[0] >> 24) |
+                                       ((newPixelData[1] & 0x0000FFFF) << 8) | fourthValue32;
+                    rgbaPixelData[2] = (newPixelData[1] >> 16) |
+                                       ((newPixelData[2] & 0x000000FF) << 16) | fourthValue32;
+                    rgbaPixelData[3] = (newPixelData[2] >> 8) | fourthValue32;
+
+                    memcpy(&dest32[0], &rgbaPixelData[0], sizeof(uint32_t) * 4);
+
+                    source32 += 3;
+                    dest32 += 4;
+                }
+            }
+
+            // We should copy the remaining pixels at the end one by one.
+            source8 = reinterpret_cast<const uint8_t *>(source32);
+            dest8   = reinterpret_cast<uint8_t *>(dest32);
+            for (; pixelIndex < width; pixelIndex++)
+            {
+                dest8[0] = source8[0];
+                dest8[1] = source8[1];
+                dest8[2] = source8[2];
+                dest8[3] = fourthValue;
+
+                source8 += 3;
+                dest8 += 4;
+            }
+        }
+    }
+}
+
 void LoadRG8ToBGRX8(const ImageLoadContext &context,
                     size_t width,
                     size_t height,
@@ -721,57 +1490,7 @@ void LoadRGBA8ToBGRA8(const ImageLoadContext &context,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-#if defined(ANGLE_LOADIMAGE_USE_SSE)
-    if (supportsSSE2())
-    {
-        __m128i brMask = _mm_set1_epi32(0x00ff00ff);
-
-        for (size_t z = 0; z < depth; z++)
-        {
-            for (size_t y = 0; y < height; y++)
-            {
-                const uint32_t *source =
-                    priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
-                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
-                                                                   outputDepthPitch);
-
-                size_t x = 0;
-
-                // Make output writes aligned
-                for (; x < width && (reinterpret_cast<intptr_t>(&dest[x]) & 15) != 0; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-
-                for (; x + 3 < width; x += 4)
-                {
-                    __m128i sourceData =
-                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
-                    // Mask out g and a, which don't change
-                    __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
-                    // Mask out b and r
-                    __m128i brComponents = _mm_and_si128(sourceData, brMask);
-                    // Swap b and r
-                    __m128i brSwapped = _mm_shufflehi_epi16(
-                        _mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)),
-                        _MM_SHUFFLE(2, 3, 0, 1));
-                    __m128i result = _mm_or_si128(gaComponents, brSwapped);
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), result);
-                }
-
-                // Perform leftover writes
-                for (; x < width; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-            }
-        }
-
-        return;
-    }
-#endif
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
 
     for (size_t z = 0; z < depth; z++)
     {
@@ -781,7 +1500,7 @@ void LoadRGBA8ToBGRA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRGBA8ToBGRA8Row(simdLevel, source, dest, width); x < width; x++)
             {
                 uint32_t rgba = source[x];
                 dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
@@ -1593,6 +2312,8 @@ void LoadD24S8ToS8D24(const ImageLoadContext &context,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -1601,7 +2322,7 @@ void LoadD24S8ToS8D24(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadD24S8ToS8D24Row(simdLevel, source, dest, width); x < width; x++)
             {
                 dest[x] = ANGLE_ROTL(source[x], 24);
             }
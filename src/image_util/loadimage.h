@@ -27,8 +27,44 @@ struct ImageLoadContext
     // Passed to Load* functions as the context
     std::shared_ptr<WorkerThreadPool> singleThreadPool;
     std::shared_ptr<WorkerThreadPool> multiThreadPool;
+
+    // Whether Load* functions may use the CPU's vector instructions, and the fast paths of the
+    // ETC and EAC decoders.  Disabled to compare against the scalar implementations.
+    bool useSIMD = true;
 };
 
+using LoadImageFunction = void (*)(const ImageLoadContext &context,
+                                   size_t width,
+                                   size_t height,
+                                   size_t depth,
+                                   const uint8_t *input,
+                                   size_t inputRowPitch,
+                                   size_t inputDepthPitch,
+                                   uint8_t *output,
+                                   size_t outputRowPitch,
+                                   size_t outputDepthPitch);
+
+// Calls |loadFunction| on the image.  Large images are split into bands of rows, or of slices for
+// 3D images with few rows, which are loaded concurrently on |context.multiThreadPool|.  The input
+// and output row pitches apply to rows of blocks |inputBlockHeight| and |outputBlockHeight| pixels
+// high, which are 1 for uncompressed formats.
+//
+// Only load functions that convert each row of blocks independently of the others can be split.
+// Those that need the whole image, such as the ASTC and paletted ones, must be called directly.
+void LoadImageInParallel(LoadImageFunction loadFunction,
+                         const ImageLoadContext &context,
+                         size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch,
+                         size_t inputBlockHeight,
+                         size_t outputBlockHeight);
+
 void LoadA8ToRGBA8(const ImageLoadContext &context,
                    size_t width,
                    size_t height,
@@ -1208,6 +1244,19 @@ inline void LoadPalettedToRGBA8(const ImageLoadContext &context,
                                 size_t outputRowPitch,
                                 size_t outputDepthPitch);
 
+// Used by the byte specializations of LoadToNative3To4.
+void LoadToNativeByte3To4Impl(const ImageLoadContext &context,
+                              const uint8_t fourthValue,
+                              size_t width,
+                              size_t height,
+                              size_t depth,
+                              const uint8_t *input,
+                              size_t inputRowPitch,
+                              size_t inputDepthPitch,
+                              uint8_t *output,
+                              size_t outputRowPitch,
+                              size_t outputDepthPitch);
+
 }  // namespace angle
 
 #include "loadimage.inc"
@@ -6,6 +6,8 @@
 
 // loadimage_astc.cpp: Decodes ASTC encoded textures.
 
+#include <vector>
+
 #include "common/unsafe_buffers.h"
 #include "image_util/AstcDecompressor.h"
 #include "image_util/loadimage.h"
@@ -43,20 +45,25 @@ void LoadASTCToRGBA8Inner(const ImageLoadContext &context,
     // Space needed for 16 bytes of output per compressed block
     size_t blockSize = blockCountX * blockCountY * 16;
 
+    // Decompress all the slices at once, so that their block rows are split together across the
+    // threads.
+    std::vector<AstcDecompressor::Image> images(depth);
     for (size_t slice = 0; slice < depth; ++slice)
     {
-        int32_t result =
-            decompressor.decompress(context.singleThreadPool, context.multiThreadPool, imgWidth,
-                                    imgHeight, blockWidth, blockHeight, input, blockSize, output);
-        if (result != 0)
-        {
-            WARN() << "ASTC decompression failed: " << decompressor.getStatusString(result);
-        }
+        images[slice] = {imgWidth, imgHeight, input, blockSize, output};
 
         ANGLE_UNSAFE_TODO({
             input += inputDepthPitch;
             output += outputDepthPitch;
         })
     }
+
+    int32_t result = decompressor.decompressImages(
+        context.singleThreadPool, context.multiThreadPool, blockWidth, blockHeight, images.data(),
+        images.size(), AstcDecompressor::kAutomaticThreadCount);
+    if (result != 0)
+    {
+        WARN() << "ASTC decompression failed: " << decompressor.getStatusString(result);
+    }
 }
 }  // namespace angle
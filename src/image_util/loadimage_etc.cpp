@@ -12,11 +12,18 @@
 
 #include "image_util/loadimage.h"
 
+#include <string.h>
 #include <type_traits>
 #include "common/mathutil.h"
 
+#include "image_util/image_simd.h"
 #include "image_util/imageformats.h"
 
+// The NEON table lookups of more than 8 bytes are only available on 64-bit ARM.
+#if defined(ANGLE_LOADIMAGE_USE_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#    define ANGLE_LOADIMAGE_ETC_USE_NEON
+#endif
+
 namespace angle
 {
 namespace
@@ -54,8 +61,449 @@ static IntensityModifier intensityModifierNonOpaque[] =
 };
 // clang-format on
 
+// Table C.10, intensity modifiers of single channel blocks
+// clang-format off
+static const int kSingleChannelModifierTable[16][8] =
+{
+    { -3, -6,  -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5,  -8, -13, 1, 4, 7, 12 },
+    { -2, -4,  -6, -13, 1, 3, 5, 12 },
+    { -3, -6,  -8, -12, 2, 5, 7, 11 },
+    { -3, -7,  -9, -11, 2, 6, 8, 10 },
+    { -4, -7,  -8, -11, 3, 6, 7, 10 },
+    { -3, -5,  -8, -11, 2, 4, 7, 10 },
+    { -2, -6,  -8, -10, 1, 5, 7,  9 },
+    { -2, -5,  -8, -10, 1, 4, 7,  9 },
+    { -2, -4,  -8, -10, 1, 3, 7,  9 },
+    { -2, -5,  -7, -10, 1, 4, 6,  9 },
+    { -3, -4,  -7, -10, 2, 3, 6,  9 },
+    { -1, -2,  -3, -10, 0, 1, 2,  9 },
+    { -4, -6,  -8,  -9, 3, 5, 7,  8 },
+    { -3, -5,  -7,  -9, 2, 4, 6,  8 }
+};
+// clang-format on
+
 static const int kNumPixelsInBlock = 16;
 
+// The fast paths decode whole blocks read as big-endian 64-bit words, in which the fields of each
+// mode are at fixed bit positions.  The colors a block can hold are computed once into a palette,
+// from which each pixel then picks its color by index.
+//
+// In individual and differential mode blocks, the palette holds the four colors of each subblock,
+// and the index of a pixel is made of bit k of the low 16 bits of the word and bit k of the next
+// 16, with k = x * 4 + y.
+struct ETCSubblocks
+{
+    uint64_t bits;
+    bool flipbit;
+    bool nonOpaquePunchThroughAlpha;
+    // The base color and the row of the intensity modifier table of each subblock.
+    int baseColors[2][3];
+    size_t codewords[2];
+};
+
+// The tables below are in the order of the decoded pixels, row by row.
+// clang-format off
+// The byte of the word holding each pixel's index LSB.  Its MSB is two bytes further.
+alignas(16) static const uint8_t kETCIndexByte[16] =
+{
+    0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1,
+};
+
+// The bit within that byte.
+alignas(16) static const uint8_t kETCIndexBit[16] =
+{
+    1, 16, 1, 16, 2, 32, 2, 32, 4, 64, 4, 64, 8, 128, 8, 128,
+};
+
+// The subblock of each pixel, as an offset in the palette, when the flip bit is clear or set.
+alignas(16) static const uint8_t kETCSubblockOffset[2][16] =
+{
+    { 0, 0, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4 },
+};
+
+// Spreads the palette indices of a row of pixels to the four bytes of each pixel.
+alignas(16) static const uint8_t kETCExpandRow[4][16] =
+{
+    {  0,  0,  0,  0,  1,  1,  1,  1,  2,  2,  2,  2,  3,  3,  3,  3 },
+    {  4,  4,  4,  4,  5,  5,  5,  5,  6,  6,  6,  6,  7,  7,  7,  7 },
+    {  8,  8,  8,  8,  9,  9,  9,  9, 10, 10, 10, 10, 11, 11, 11, 11 },
+    { 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15 },
+};
+
+alignas(16) static const uint8_t kETCByteInPixel[16] =
+{
+    0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+};
+
+// Moves the alpha values of a row of pixels to the last byte of each pixel, zeroing the others.
+alignas(16) static const uint8_t kETCExpandAlpha[16] =
+{
+    0x80, 0x80, 0x80, 0, 0x80, 0x80, 0x80, 1, 0x80, 0x80, 0x80, 2, 0x80, 0x80, 0x80, 3,
+};
+
+// Spreads the four 16-bit intensity modifiers of a subblock to the red, green and blue channels
+// of its first two colors and last two colors, zeroing the alpha channels.
+alignas(16) static const uint8_t kETCSpreadModifiers[2][16] =
+{
+    { 0, 1, 0, 1, 0, 1, 0x80, 0x80, 2, 3, 2, 3, 2, 3, 0x80, 0x80 },
+    { 4, 5, 4, 5, 4, 5, 0x80, 0x80, 6, 7, 6, 7, 6, 7, 0x80, 0x80 },
+};
+
+// Clears the colors of a subblock that non opaque punchthrough alpha blocks make transparent.
+alignas(16) static const uint8_t kETCNonOpaqueMask[16] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+// clang-format on
+
+const IntensityModifier *GetETCIntensityModifiers(const ETCSubblocks &block)
+{
+    return block.nonOpaquePunchThroughAlpha ? intensityModifierNonOpaque
+                                            : intensityModifierDefault;
+}
+
+// Decodes an individual or differential mode block to rgba8.  The alpha of the pixels is taken
+// from |alphaValues|, except in non opaque punchthrough alpha blocks where the pixels with index 2
+// are transparent black.  The alpha values are all opaque for these formats.
+void DecodeETCSubblocks(const ETCSubblocks &block,
+                        uint8_t *dest,
+                        size_t destRowPitch,
+                        const uint8_t alphaValues[4][4])
+{
+    const IntensityModifier *intensityModifier = GetETCIntensityModifiers(block);
+
+    uint8_t palette[8][4];
+    for (size_t subblock = 0; subblock < 2; subblock++)
+    {
+        for (size_t modifierIdx = 0; modifierIdx < 4; modifierIdx++)
+        {
+            const int modifier = intensityModifier[block.codewords[subblock]][modifierIdx];
+            uint8_t *color     = palette[subblock * 4 + modifierIdx];
+            for (size_t channel = 0; channel < 3; channel++)
+            {
+                color[channel] = static_cast<uint8_t>(
+                    gl::clamp(block.baseColors[subblock][channel] + modifier, 0, 255));
+            }
+            color[3] = 255;
+        }
+    }
+    if (block.nonOpaquePunchThroughAlpha)
+    {
+        memset(palette[2], 0, 4);
+        memset(palette[6], 0, 4);
+    }
+
+    const uint8_t *subblockOffset = kETCSubblockOffset[block.flipbit];
+    for (size_t j = 0; j < 4; j++)
+    {
+        uint8_t *row = dest + j * destRowPitch;
+        for (size_t i = 0; i < 4; i++)
+        {
+            const size_t k     = i * 4 + j;
+            const size_t index = ((block.bits >> (16 + k)) & 1) << 1 | ((block.bits >> k) & 1);
+            memcpy(row + i * 4, palette[subblockOffset[j * 4 + i] + index], 4);
+            if (!block.nonOpaquePunchThroughAlpha)
+            {
+                row[i * 4 + 3] = alphaValues[j][i];
+            }
+        }
+    }
+}
+
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+ANGLE_LOADIMAGE_TARGET("ssse3")
+void DecodeETCSubblocksSSSE3(const ETCSubblocks &block,
+                             uint8_t *dest,
+                             size_t destRowPitch,
+                             const uint8_t alphaValues[4][4])
+{
+    auto load = [](const uint8_t *data) {
+        return _mm_load_si128(reinterpret_cast<const __m128i *>(data));
+    };
+
+    // Add the modifiers to the base colors in 16-bit lanes, two colors per vector, and clamp them
+    // when packing them to bytes.  Each half of the 32-byte palette holds a subblock.
+    const IntensityModifier *intensityModifier = GetETCIntensityModifiers(block);
+    __m128i palette[2];
+    for (size_t subblock = 0; subblock < 2; subblock++)
+    {
+        const int *baseColor = block.baseColors[subblock];
+        const __m128i base   = _mm_setr_epi16(
+            static_cast<int16_t>(baseColor[0]), static_cast<int16_t>(baseColor[1]),
+            static_cast<int16_t>(baseColor[2]), 255, static_cast<int16_t>(baseColor[0]),
+            static_cast<int16_t>(baseColor[1]), static_cast<int16_t>(baseColor[2]), 255);
+        const __m128i modifiers = _mm_packs_epi32(
+            _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(intensityModifier[block.codewords[subblock]])),
+            _mm_setzero_si128());
+        palette[subblock] = _mm_packus_epi16(
+            _mm_add_epi16(base, _mm_shuffle_epi8(modifiers, load(kETCSpreadModifiers[0]))),
+            _mm_add_epi16(base, _mm_shuffle_epi8(modifiers, load(kETCSpreadModifiers[1]))));
+        if (block.nonOpaquePunchThroughAlpha)
+        {
+            palette[subblock] = _mm_and_si128(palette[subblock], load(kETCNonOpaqueMask));
+        }
+    }
+
+    // Gather the bytes holding the index bits of each pixel, and test the bits.
+    const __m128i word     = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&block.bits));
+    const __m128i lsbByte  = load(kETCIndexByte);
+    const __m128i msbByte  = _mm_add_epi8(lsbByte, _mm_set1_epi8(2));
+    const __m128i indexBit = load(kETCIndexBit);
+    const __m128i lsb =
+        _mm_cmpeq_epi8(_mm_and_si128(_mm_shuffle_epi8(word, lsbByte), indexBit), indexBit);
+    const __m128i msb =
+        _mm_cmpeq_epi8(_mm_and_si128(_mm_shuffle_epi8(word, msbByte), indexBit), indexBit);
+    const __m128i paletteIndices =
+        _mm_or_si128(_mm_or_si128(_mm_and_si128(lsb, _mm_set1_epi8(1)),
+                                  _mm_and_si128(msb, _mm_set1_epi8(2))),
+                     load(kETCSubblockOffset[block.flipbit]));
+
+    // Look each pixel up in both halves of the palette and select the right one.
+    const __m128i byteInPixel = load(kETCByteInPixel);
+    const __m128i highHalf    = _mm_set1_epi8(16);
+    const __m128i colorMask   = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i expandAlpha = load(kETCExpandAlpha);
+
+    for (size_t j = 0; j < 4; j++)
+    {
+        const __m128i pixelIndices = _mm_shuffle_epi8(paletteIndices, load(kETCExpandRow[j]));
+        const __m128i control      = _mm_or_si128(_mm_slli_epi16(pixelIndices, 2), byteInPixel);
+        const __m128i inHigh       = _mm_cmpeq_epi8(_mm_and_si128(control, highHalf), highHalf);
+        const __m128i colorLow     = _mm_shuffle_epi8(palette[0], control);
+        const __m128i colorHigh    = _mm_shuffle_epi8(palette[1], control);
+        __m128i color = _mm_or_si128(_mm_andnot_si128(inHigh, colorLow),
+                                     _mm_and_si128(inHigh, colorHigh));
+        if (!block.nonOpaquePunchThroughAlpha)
+        {
+            int alphaRow;
+            memcpy(&alphaRow, alphaValues[j], 4);
+            const __m128i alpha = _mm_shuffle_epi8(_mm_cvtsi32_si128(alphaRow), expandAlpha);
+            color               = _mm_or_si128(_mm_and_si128(color, colorMask), alpha);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + j * destRowPitch), color);
+    }
+}
+#elif defined(ANGLE_LOADIMAGE_ETC_USE_NEON)
+void DecodeETCSubblocksNEON(const ETCSubblocks &block,
+                            uint8_t *dest,
+                            size_t destRowPitch,
+                            const uint8_t alphaValues[4][4])
+{
+    // Add the modifiers to the base colors in 16-bit lanes, two colors per vector, and clamp them
+    // when narrowing them to bytes.  Each half of the 32-byte palette holds a subblock.
+    const IntensityModifier *intensityModifier = GetETCIntensityModifiers(block);
+    uint8x16x2_t palette;
+    for (size_t subblock = 0; subblock < 2; subblock++)
+    {
+        const int *baseColor      = block.baseColors[subblock];
+        const int16_t baseLanes[] = {
+            static_cast<int16_t>(baseColor[0]), static_cast<int16_t>(baseColor[1]),
+            static_cast<int16_t>(baseColor[2]), 255, static_cast<int16_t>(baseColor[0]),
+            static_cast<int16_t>(baseColor[1]), static_cast<int16_t>(baseColor[2]), 255};
+        const int16x8_t base = vld1q_s16(baseLanes);
+        const uint8x16_t modifiers = vreinterpretq_u8_s16(vcombine_s16(
+            vmovn_s32(vld1q_s32(intensityModifier[block.codewords[subblock]])), vdup_n_s16(0)));
+        const int16x8_t low =
+            vreinterpretq_s16_u8(vqtbl1q_u8(modifiers, vld1q_u8(kETCSpreadModifiers[0])));
+        const int16x8_t high =
+            vreinterpretq_s16_u8(vqtbl1q_u8(modifiers, vld1q_u8(kETCSpreadModifiers[1])));
+        palette.val[subblock] =
+            vcombine_u8(vqmovun_s16(vaddq_s16(base, low)), vqmovun_s16(vaddq_s16(base, high)));
+        if (block.nonOpaquePunchThroughAlpha)
+        {
+            palette.val[subblock] = vandq_u8(palette.val[subblock], vld1q_u8(kETCNonOpaqueMask));
+        }
+    }
+
+    // Gather the bytes holding the index bits of each pixel, and test the bits.
+    const uint8x16_t word     = vreinterpretq_u8_u64(vdupq_n_u64(block.bits));
+    const uint8x16_t lsbByte  = vld1q_u8(kETCIndexByte);
+    const uint8x16_t msbByte  = vaddq_u8(lsbByte, vdupq_n_u8(2));
+    const uint8x16_t indexBit = vld1q_u8(kETCIndexBit);
+    const uint8x16_t lsb      = vtstq_u8(vqtbl1q_u8(word, lsbByte), indexBit);
+    const uint8x16_t msb      = vtstq_u8(vqtbl1q_u8(word, msbByte), indexBit);
+    const uint8x16_t paletteIndices =
+        vorrq_u8(vorrq_u8(vandq_u8(lsb, vdupq_n_u8(1)), vandq_u8(msb, vdupq_n_u8(2))),
+                 vld1q_u8(kETCSubblockOffset[block.flipbit]));
+
+    const uint8x16_t byteInPixel = vld1q_u8(kETCByteInPixel);
+    const uint8x16_t alphaMask   = vreinterpretq_u8_u32(vdupq_n_u32(0xFF000000));
+    const uint8x16_t expandAlpha = vld1q_u8(kETCExpandAlpha);
+
+    for (size_t j = 0; j < 4; j++)
+    {
+        const uint8x16_t pixelIndices = vqtbl1q_u8(paletteIndices, vld1q_u8(kETCExpandRow[j]));
+        const uint8x16_t control      = vorrq_u8(vshlq_n_u8(pixelIndices, 2), byteInPixel);
+        uint8x16_t color              = vqtbl2q_u8(palette, control);
+        if (!block.nonOpaquePunchThroughAlpha)
+        {
+            uint32_t alphaRow;
+            memcpy(&alphaRow, alphaValues[j], 4);
+            const uint8x16_t alpha =
+                vqtbl1q_u8(vreinterpretq_u8_u32(vdupq_n_u32(alphaRow)), expandAlpha);
+            color = vbslq_u8(alphaMask, alpha, color);
+        }
+        vst1q_u8(dest + j * destRowPitch, color);
+    }
+}
+#endif
+
+void DecodeETCSubblocks(SIMDLevel level,
+                        const ETCSubblocks &block,
+                        uint8_t *dest,
+                        size_t destRowPitch,
+                        const uint8_t alphaValues[4][4])
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (level >= SIMDLevel::SSSE3)
+    {
+        DecodeETCSubblocksSSSE3(block, dest, destRowPitch, alphaValues);
+        return;
+    }
+#elif defined(ANGLE_LOADIMAGE_ETC_USE_NEON)
+    if (level == SIMDLevel::NEON)
+    {
+        DecodeETCSubblocksNEON(block, dest, destRowPitch, alphaValues);
+        return;
+    }
+#endif
+    DecodeETCSubblocks(block, dest, destRowPitch, alphaValues);
+}
+
+// Single channel blocks hold 3-bit indices in the low 48 bits of the word, in column-major order.
+// The vector code gathers the two bytes holding the index of each pixel in a 16-bit lane, in
+// row-major order, and multiplies them to move the index to the top 3 bits.
+// clang-format off
+alignas(16) static const uint8_t kEACIndexBytes[2][16] =
+{
+    { 5, 6, 4, 5, 2, 3, 1, 2, 5, 6, 3, 4, 2, 3, 0, 1 },
+    { 4, 5, 3, 4, 1, 2, 0, 1, 4, 5, 3, 4, 1, 2, 0, 1 },
+};
+
+alignas(16) static const uint16_t kEACIndexMultiplier[16] =
+{
+    256, 4096, 256, 4096, 2048, 128, 2048, 128, 64, 1024, 64, 1024, 512, 8192, 512, 8192,
+};
+// clang-format on
+
+// Decodes a single channel block to 8-bit values, row by row.
+void DecodeSingleChannelBlock(uint64_t bits,
+                              int codeword,
+                              int multiplier,
+                              const int *modifiers,
+                              bool isSigned,
+                              uint8_t *values)
+{
+    uint8_t palette[8];
+    for (size_t index = 0; index < 8; index++)
+    {
+        const int value = codeword + modifiers[index] * multiplier;
+        palette[index]  = static_cast<uint8_t>(isSigned ? gl::clamp(value, -128, 127)
+                                                        : gl::clamp(value, 0, 255));
+    }
+
+    for (size_t j = 0; j < 4; j++)
+    {
+        for (size_t i = 0; i < 4; i++)
+        {
+            values[j * 4 + i] = palette[(bits >> (45 - 3 * (i * 4 + j))) & 7];
+        }
+    }
+}
+
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+ANGLE_LOADIMAGE_TARGET("ssse3")
+void DecodeSingleChannelBlockSSSE3(uint64_t bits,
+                                   int codeword,
+                                   int multiplier,
+                                   const int *modifiers,
+                                   bool isSigned,
+                                   uint8_t *values)
+{
+    // The values fit in 16 bits, and are clamped when packing them to bytes.
+    const __m128i modifiers16 =
+        _mm_packs_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(modifiers)),
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(modifiers + 4)));
+    const __m128i scaledModifiers =
+        _mm_mullo_epi16(modifiers16, _mm_set1_epi16(static_cast<int16_t>(multiplier)));
+    const __m128i paletteWide =
+        _mm_add_epi16(_mm_set1_epi16(static_cast<int16_t>(codeword)), scaledModifiers);
+    const __m128i palette = isSigned ? _mm_packs_epi16(paletteWide, paletteWide)
+                                     : _mm_packus_epi16(paletteWide, paletteWide);
+
+    const __m128i word = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&bits));
+    __m128i indices[2];
+    for (size_t half = 0; half < 2; half++)
+    {
+        const __m128i window = _mm_shuffle_epi8(
+            word, _mm_load_si128(reinterpret_cast<const __m128i *>(kEACIndexBytes[half])));
+        const __m128i multipliers =
+            _mm_load_si128(reinterpret_cast<const __m128i *>(kEACIndexMultiplier + half * 8));
+        indices[half] = _mm_srli_epi16(_mm_mullo_epi16(window, multipliers), 13);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(values),
+                     _mm_shuffle_epi8(palette, _mm_packus_epi16(indices[0], indices[1])));
+}
+#elif defined(ANGLE_LOADIMAGE_ETC_USE_NEON)
+void DecodeSingleChannelBlockNEON(uint64_t bits,
+                                  int codeword,
+                                  int multiplier,
+                                  const int *modifiers,
+                                  bool isSigned,
+                                  uint8_t *values)
+{
+    // The values fit in 16 bits, and are clamped when narrowing them to bytes.
+    const int16x8_t modifiers16 =
+        vcombine_s16(vmovn_s32(vld1q_s32(modifiers)), vmovn_s32(vld1q_s32(modifiers + 4)));
+    const int16x8_t paletteWide = vmlaq_n_s16(vdupq_n_s16(static_cast<int16_t>(codeword)),
+                                              modifiers16, static_cast<int16_t>(multiplier));
+    const uint8x8_t palette =
+        isSigned ? vreinterpret_u8_s8(vqmovn_s16(paletteWide)) : vqmovun_s16(paletteWide);
+
+    const uint8x16_t word = vreinterpretq_u8_u64(vdupq_n_u64(bits));
+    uint16x8_t indices[2];
+    for (size_t half = 0; half < 2; half++)
+    {
+        const uint16x8_t window =
+            vreinterpretq_u16_u8(vqtbl1q_u8(word, vld1q_u8(kEACIndexBytes[half])));
+        const uint16x8_t multipliers = vld1q_u16(kEACIndexMultiplier + half * 8);
+        indices[half]                = vshrq_n_u16(vmulq_u16(window, multipliers), 13);
+    }
+
+    vst1q_u8(values, vqtbl1q_u8(vcombine_u8(palette, palette),
+                                vcombine_u8(vmovn_u16(indices[0]), vmovn_u16(indices[1]))));
+}
+#endif
+
+void DecodeSingleChannelBlock(SIMDLevel level,
+                              uint64_t bits,
+                              int codeword,
+                              int multiplier,
+                              const int *modifiers,
+                              bool isSigned,
+                              uint8_t *values)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (level >= SIMDLevel::SSSE3)
+    {
+        DecodeSingleChannelBlockSSSE3(bits, codeword, multiplier, modifiers, isSigned, values);
+        return;
+    }
+#elif defined(ANGLE_LOADIMAGE_ETC_USE_NEON)
+    if (level == SIMDLevel::NEON)
+    {
+        DecodeSingleChannelBlockNEON(bits, codeword, multiplier, modifiers, isSigned, values);
+        return;
+    }
+#endif
+    DecodeSingleChannelBlock(bits, codeword, multiplier, modifiers, isSigned, values);
+}
+
 struct ETC2Block
 {
     // Decodes unsigned single or dual channel ETC2 block to 8-bit color
@@ -161,20 +609,65 @@ struct ETC2Block
             for (size_t i = 0; i < 4 && (x + i) < w; i++)
             {
                 uint16_t *pixel = row + (i * destPixelStride);
-                if (isSigned)
-                {
-                    int16_t tempPixel =
-                        renormalizeEAC<int16_t>(getSingleEACChannel(i, j, isSigned));
-                    *pixel =
-                        isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
-                }
-                else
-                {
-                    uint16_t tempPixel =
-                        renormalizeEAC<uint16_t>(getSingleEACChannel(i, j, isSigned));
-                    *pixel =
-                        isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
-                }
+                *pixel          = encodeEAC(getSingleEACChannel(i, j, isSigned), isSigned, isFloat);
+            }
+        }
+    }
+
+    // Decodes a whole single or dual channel ETC2 block to 8-bit color.  The eight values the block
+    // can hold are computed once, then each pixel picks its value by index.
+    void decodeAsSingleETC2ChannelFast(uint8_t *dest,
+                                       size_t destPixelStride,
+                                       size_t destRowPitch,
+                                       bool isSigned,
+                                       SIMDLevel simdLevel) const
+    {
+        const int codeword = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
+
+        uint8_t values[kNumPixelsInBlock];
+        DecodeSingleChannelBlock(simdLevel, getBits(), codeword, u.scblk.multiplier,
+                                 kSingleChannelModifierTable[u.scblk.table_index], isSigned,
+                                 values);
+
+        for (size_t j = 0; j < 4; j++)
+        {
+            uint8_t *row = dest + (j * destRowPitch);
+            for (size_t i = 0; i < 4; i++)
+            {
+                row[i * destPixelStride] = values[j * 4 + i];
+            }
+        }
+    }
+
+    // Decodes a whole single or dual channel EAC block to 16-bit color, like
+    // decodeAsSingleETC2ChannelFast.  The conversion of the values dominates, so the indices are
+    // extracted without vector code.
+    void decodeAsSingleEACChannelFast(uint16_t *dest,
+                                      size_t destPixelStride,
+                                      size_t destRowPitch,
+                                      bool isSigned,
+                                      bool isFloat) const
+    {
+        const int codeword   = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
+        const int multiplier = (u.scblk.multiplier == 0) ? 1 : u.scblk.multiplier * 8;
+        const int *modifiers = kSingleChannelModifierTable[u.scblk.table_index];
+
+        uint16_t palette[8];
+        for (size_t index = 0; index < 8; index++)
+        {
+            palette[index] =
+                encodeEAC(codeword * 8 + 4 + modifiers[index] * multiplier, isSigned, isFloat);
+        }
+
+        uint8_t indices[kNumPixelsInBlock];
+        getSingleChannelIndices(indices);
+        for (size_t j = 0; j < 4; j++)
+        {
+            uint16_t *row = reinterpret_cast<uint16_t *>(reinterpret_cast<uint8_t *>(dest) +
+                                                         (j * destRowPitch));
+            for (size_t i = 0; i < 4; i++)
+            {
+                row[i * destPixelStride] = palette[indices[j * 4 + i]];
             }
         }
     }
@@ -225,6 +718,56 @@ struct ETC2Block
         }
     }
 
+    // Decodes a whole RGB block to rgba8 if it's in individual or differential mode, the most
+    // common ones, and returns false otherwise.
+    bool decodeAsRGBFast(uint8_t *dest,
+                         size_t destRowPitch,
+                         const uint8_t alphaValues[4][4],
+                         bool punchThroughAlpha,
+                         SIMDLevel simdLevel) const
+    {
+        ETCSubblocks block;
+        block.bits         = getBits();
+        block.flipbit      = (block.bits >> 32) & 1;
+        const bool diffbit = (block.bits >> 33) & 1;
+
+        // The red, green and blue fields start at the same bits in both modes.
+        if (diffbit || punchThroughAlpha)
+        {
+            for (size_t channel = 0; channel < 3; channel++)
+            {
+                const size_t shift = 59 - channel * 8;
+                const int base     = static_cast<int>((block.bits >> shift) & 31);
+                const int delta    = static_cast<int>(((block.bits >> (shift - 3)) & 7) ^ 4) - 4;
+                // Overflows select the T, H and planar modes.
+                if (base + delta < 0 || base + delta > 31)
+                {
+                    return false;
+                }
+                block.baseColors[0][channel] = extend_5to8bits(base);
+                block.baseColors[1][channel] = extend_5to8bits(base + delta);
+            }
+        }
+        else
+        {
+            for (size_t channel = 0; channel < 3; channel++)
+            {
+                const size_t shift = 60 - channel * 8;
+                block.baseColors[0][channel] =
+                    extend_4to8bits(static_cast<int>((block.bits >> shift) & 15));
+                block.baseColors[1][channel] =
+                    extend_4to8bits(static_cast<int>((block.bits >> (shift - 4)) & 15));
+            }
+        }
+
+        block.nonOpaquePunchThroughAlpha = punchThroughAlpha && !diffbit;
+        block.codewords[0]               = static_cast<size_t>((block.bits >> 37) & 7);
+        block.codewords[1]               = static_cast<size_t>((block.bits >> 34) & 7);
+
+        DecodeETCSubblocks(simdLevel, block, dest, destRowPitch, alphaValues);
+        return true;
+    }
+
     // Transcodes RGB block to BC1
     void transcodeAsBC1(uint8_t *dest,
                         size_t x,
@@ -459,6 +1002,41 @@ struct ETC2Block
         return static_cast<T>(gl::clamp(value, lower, upper)) << shift;
     }
 
+    static uint16_t encodeEAC(int value, bool isSigned, bool isFloat)
+    {
+        if (isSigned)
+        {
+            int16_t tempPixel = renormalizeEAC<int16_t>(value);
+            return isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
+        }
+        uint16_t tempPixel = renormalizeEAC<uint16_t>(value);
+        return isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
+    }
+
+    // Reads the block as a big-endian 64-bit word.
+    uint64_t getBits() const
+    {
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(this);
+        return static_cast<uint64_t>(bytes[0]) << 56 | static_cast<uint64_t>(bytes[1]) << 48 |
+               static_cast<uint64_t>(bytes[2]) << 40 | static_cast<uint64_t>(bytes[3]) << 32 |
+               static_cast<uint64_t>(bytes[4]) << 24 | static_cast<uint64_t>(bytes[5]) << 16 |
+               static_cast<uint64_t>(bytes[6]) << 8 | static_cast<uint64_t>(bytes[7]);
+    }
+
+    // Stores the modifier index of each pixel of a single channel block, row by row.  The 3-bit
+    // indices follow the 16-bit header, in column-major order.
+    void getSingleChannelIndices(uint8_t *indices) const
+    {
+        const uint64_t bits = getBits();
+        for (size_t j = 0; j < 4; j++)
+        {
+            for (size_t i = 0; i < 4; i++)
+            {
+                indices[j * 4 + i] = static_cast<uint8_t>((bits >> (45 - 3 * (i * 4 + j))) & 7);
+            }
+        }
+    }
+
     static R8G8B8A8 createRGBA(int red, int green, int blue, int alpha)
     {
         R8G8B8A8 rgba;
@@ -1438,29 +2016,7 @@ struct ETC2Block
 
     int getSingleChannelModifier(size_t x, size_t y) const
     {
-        // clang-format off
-        static const int modifierTable[16][8] =
-        {
-            { -3, -6,  -9, -15, 2, 5, 8, 14 },
-            { -3, -7, -10, -13, 2, 6, 9, 12 },
-            { -2, -5,  -8, -13, 1, 4, 7, 12 },
-            { -2, -4,  -6, -13, 1, 3, 5, 12 },
-            { -3, -6,  -8, -12, 2, 5, 7, 11 },
-            { -3, -7,  -9, -11, 2, 6, 8, 10 },
-            { -4, -7,  -8, -11, 3, 6, 7, 10 },
-            { -3, -5,  -8, -11, 2, 4, 7, 10 },
-            { -2, -6,  -8, -10, 1, 5, 7,  9 },
-            { -2, -5,  -8, -10, 1, 4, 7,  9 },
-            { -2, -4,  -8, -10, 1, 3, 7,  9 },
-            { -2, -5,  -7, -10, 1, 4, 6,  9 },
-            { -3, -4,  -7, -10, 2, 3, 6,  9 },
-            { -1, -2,  -3, -10, 0, 1, 2,  9 },
-            { -4, -6,  -8,  -9, 3, 5, 7,  8 },
-            { -3, -5,  -7,  -9, 2, 4, 6,  8 }
-        };
-        // clang-format on
-
-        return modifierTable[u.scblk.table_index][getSingleChannelIndex(x, y)];
+        return kSingleChannelModifierTable[u.scblk.table_index][getSingleChannelIndex(x, y)];
     }
 };
 
@@ -1474,6 +2030,14 @@ static const uint8_t DefaultETCAlphaValues[4][4] =
 };
 
 // clang-format on
+
+// Whether the block at (x, y) is entirely within the image, so the fast paths can decode it.  They
+// are disabled along with the vector paths, to compare against the per-pixel decoding.
+bool IsWholeBlock(const ImageLoadContext &context, size_t x, size_t y, size_t w, size_t h)
+{
+    return context.useSIMD && x + 4 <= w && y + 4 <= h;
+}
+
 void LoadR11EACToR8(const ImageLoadContext &context,
                     size_t width,
                     size_t height,
@@ -1486,6 +2050,8 @@ void LoadR11EACToR8(const ImageLoadContext &context,
                     size_t outputDepthPitch,
                     bool isSigned)
 {
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y += 4)
@@ -1500,6 +2066,12 @@ void LoadR11EACToR8(const ImageLoadContext &context,
                 const ETC2Block *sourceBlock = sourceRow + (x / 4);
                 uint8_t *destPixels          = destRow + x;
 
+                if (IsWholeBlock(context, x, y, width, height))
+                {
+                    sourceBlock->decodeAsSingleETC2ChannelFast(destPixels, 1, outputRowPitch,
+                                                               isSigned, simdLevel);
+                    continue;
+                }
                 sourceBlock->decodeAsSingleETC2Channel(destPixels, x, y, width, height, 1,
                                                        outputRowPitch, isSigned);
             }
@@ -1519,6 +2091,8 @@ void LoadRG11EACToRG8(const ImageLoadContext &context,
                       size_t outputDepthPitch,
                       bool isSigned)
 {
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y += 4)
@@ -1530,13 +2104,21 @@ void LoadRG11EACToRG8(const ImageLoadContext &context,
 
             for (size_t x = 0; x < width; x += 4)
             {
-                uint8_t *destPixelsRed          = destRow + (x * 2);
-                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
-                sourceBlockRed->decodeAsSingleETC2Channel(destPixelsRed, x, y, width, height, 2,
-                                                          outputRowPitch, isSigned);
-
+                uint8_t *destPixelsRed            = destRow + (x * 2);
+                const ETC2Block *sourceBlockRed   = sourceRow + (x / 2);
                 uint8_t *destPixelsGreen          = destPixelsRed + 1;
                 const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+
+                if (IsWholeBlock(context, x, y, width, height))
+                {
+                    sourceBlockRed->decodeAsSingleETC2ChannelFast(destPixelsRed, 2, outputRowPitch,
+                                                                  isSigned, simdLevel);
+                    sourceBlockGreen->decodeAsSingleETC2ChannelFast(
+                        destPixelsGreen, 2, outputRowPitch, isSigned, simdLevel);
+                    continue;
+                }
+                sourceBlockRed->decodeAsSingleETC2Channel(destPixelsRed, x, y, width, height, 2,
+                                                          outputRowPitch, isSigned);
                 sourceBlockGreen->decodeAsSingleETC2Channel(destPixelsGreen, x, y, width, height, 2,
                                                             outputRowPitch, isSigned);
             }
@@ -1571,6 +2153,12 @@ void LoadR11EACToR16(const ImageLoadContext &context,
                 const ETC2Block *sourceBlock = sourceRow + (x / 4);
                 uint16_t *destPixels         = destRow + x;
 
+                if (IsWholeBlock(context, x, y, width, height))
+                {
+                    sourceBlock->decodeAsSingleEACChannelFast(destPixels, 1, outputRowPitch,
+                                                              isSigned, isFloat);
+                    continue;
+                }
                 sourceBlock->decodeAsSingleEACChannel(destPixels, x, y, width, height, 1,
                                                       outputRowPitch, isSigned, isFloat);
             }
@@ -1602,13 +2190,22 @@ void LoadRG11EACToRG16(const ImageLoadContext &context,
 
             for (size_t x = 0; x < width; x += 4)
             {
-                uint16_t *destPixelsRed         = destRow + (x * 2);
-                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
-                sourceBlockRed->decodeAsSingleEACChannel(destPixelsRed, x, y, width, height, 2,
-                                                         outputRowPitch, isSigned, isFloat);
-
+                uint16_t *destPixelsRed           = destRow + (x * 2);
+                const ETC2Block *sourceBlockRed   = sourceRow + (x / 2);
                 uint16_t *destPixelsGreen         = destPixelsRed + 1;
                 const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+
+                if (IsWholeBlock(context, x, y, width, height))
+                {
+                    sourceBlockRed->decodeAsSingleEACChannelFast(destPixelsRed, 2, outputRowPitch,
+                                                                 isSigned, isFloat);
+                    sourceBlockGreen->decodeAsSingleEACChannelFast(destPixelsGreen, 2,
+                                                                   outputRowPitch, isSigned,
+                                                                   isFloat);
+                    continue;
+                }
+                sourceBlockRed->decodeAsSingleEACChannel(destPixelsRed, x, y, width, height, 2,
+                                                         outputRowPitch, isSigned, isFloat);
                 sourceBlockGreen->decodeAsSingleEACChannel(destPixelsGreen, x, y, width, height, 2,
                                                            outputRowPitch, isSigned, isFloat);
             }
@@ -1628,6 +2225,8 @@ void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
                          size_t outputDepthPitch,
                          bool punchthroughAlpha)
 {
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y += 4)
@@ -1642,6 +2241,12 @@ void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
                 const ETC2Block *sourceBlock = sourceRow + (x / 4);
                 uint8_t *destPixels          = destRow + (x * 4);
 
+                if (IsWholeBlock(context, x, y, width, height) &&
+                    sourceBlock->decodeAsRGBFast(destPixels, outputRowPitch, DefaultETCAlphaValues,
+                                                 punchthroughAlpha, simdLevel))
+                {
+                    continue;
+                }
                 sourceBlock->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
                                          DefaultETCAlphaValues, punchthroughAlpha);
             }
@@ -1733,6 +2338,7 @@ void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
                           size_t outputDepthPitch,
                           bool srgb)
 {
+    const SIMDLevel simdLevel = GetSIMDLevel(context);
     uint8_t decodedAlphaValues[4][4];
 
     for (size_t z = 0; z < depth; z++)
@@ -1747,12 +2353,28 @@ void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
             for (size_t x = 0; x < width; x += 4)
             {
                 const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
-                sourceBlockAlpha->decodeAsSingleETC2Channel(
-                    reinterpret_cast<uint8_t *>(decodedAlphaValues), x, y, width, height, 1, 4,
-                    false);
+                uint8_t *destPixels               = destRow + (x * 4);
+                const ETC2Block *sourceBlockRGB   = sourceBlockAlpha + 1;
+
+                const bool wholeBlock = IsWholeBlock(context, x, y, width, height);
+                if (wholeBlock)
+                {
+                    sourceBlockAlpha->decodeAsSingleETC2ChannelFast(
+                        reinterpret_cast<uint8_t *>(decodedAlphaValues), 1, 4, false, simdLevel);
+                }
+                else
+                {
+                    sourceBlockAlpha->decodeAsSingleETC2Channel(
+                        reinterpret_cast<uint8_t *>(decodedAlphaValues), x, y, width, height, 1,
+                        4, false);
+                }
 
-                uint8_t *destPixels             = destRow + (x * 4);
-                const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
+                if (wholeBlock && sourceBlockRGB->decodeAsRGBFast(destPixels, outputRowPitch,
+                                                                  decodedAlphaValues, false,
+                                                                  simdLevel))
+                {
+                    continue;
+                }
                 sourceBlockRGB->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
                                             decodedAlphaValues, false);
             }
@@ -0,0 +1,287 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+// BitmapHandleAllocator.cpp: Implements the gl::BitmapHandleAllocator class, which allocates GL
+// handles by tracking the free handles in a hierarchical bitmap.
+
+#include "libANGLE/BitmapHandleAllocator.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace gl
+{
+
+BitmapHandleAllocator::BitmapHandleAllocator(GLuint maximumHandleValue)
+    : mMaxValue(maximumHandleValue),
+      mLevels(1),
+      mFreeCount(0),
+      mNextUnused(1),
+      mLoggingEnabled(false)
+{
+    mLevels[0].resize(1, 0);
+}
+
+BitmapHandleAllocator::~BitmapHandleAllocator() = default;
+
+bool BitmapHandleAllocator::allocate(GLuint *outId)
+{
+    GLuint handle = 0;
+    if (mFreeCount > 0)
+    {
+        handle = static_cast<GLuint>(findLowestSetBit(0));
+        clearBit(0, handle);
+        --mFreeCount;
+    }
+    else if (mNextUnused <= mMaxValue)
+    {
+        handle = static_cast<GLuint>(mNextUnused);
+        takeNextUnused();
+    }
+    else
+    {
+        return false;
+    }
+
+    if (mLoggingEnabled)
+    {
+        WARN() << "BitmapHandleAllocator::allocate allocating " << handle << std::endl;
+    }
+
+    if (outId)
+    {
+        *outId = handle;
+    }
+    return true;
+}
+
+bool BitmapHandleAllocator::allocate(size_t count, GLuint *outIds)
+{
+    // Reserved handles are all above |mNextUnused| and not above |mMaxValue|.
+    const uint64_t unusedCount = static_cast<uint64_t>(mMaxValue) + 1 - mNextUnused;
+    if (count > mFreeCount + unusedCount - mReservedUnused.size())
+    {
+        return false;
+    }
+
+    size_t allocatedCount = 0;
+    while (allocatedCount < count && mFreeCount > 0)
+    {
+        // Take the free handles of a word at once.
+        const uint64_t wordIndex = findLowestSetBit(1);
+        uint64_t &word           = mLevels[0][wordIndex];
+        while (word != 0 && allocatedCount < count)
+        {
+            outIds[allocatedCount++] =
+                static_cast<GLuint>(wordIndex * kWordBits + ScanForward(word));
+            word &= word - 1;
+            --mFreeCount;
+        }
+        if (word == 0)
+        {
+            clearBit(1, wordIndex);
+        }
+    }
+
+    for (; allocatedCount < count; ++allocatedCount)
+    {
+        outIds[allocatedCount] = static_cast<GLuint>(mNextUnused);
+        takeNextUnused();
+    }
+
+    if (mLoggingEnabled)
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            WARN() << "BitmapHandleAllocator::allocate allocating " << outIds[index] << std::endl;
+        }
+    }
+    return true;
+}
+
+void BitmapHandleAllocator::release(GLuint handle)
+{
+    if (mLoggingEnabled)
+    {
+        WARN() << "BitmapHandleAllocator::release releasing " << handle << std::endl;
+    }
+
+    if (handle == 0 || handle > mMaxValue)
+    {
+        // Handle is outside the range of allocated handles, do not reclaim it.
+        return;
+    }
+
+    if (handle >= mNextUnused)
+    {
+        mReservedUnused.erase(handle);
+        return;
+    }
+
+    if (!isFree(handle))
+    {
+        setBit(0, handle);
+        ++mFreeCount;
+    }
+}
+
+void BitmapHandleAllocator::reserve(GLuint handle)
+{
+    if (mLoggingEnabled)
+    {
+        WARN() << "BitmapHandleAllocator::reserve reserving " << handle << std::endl;
+    }
+
+    if (handle == 0 || handle > mMaxValue)
+    {
+        // Handle being reserved is outside the range of allocated handles. Allow this and don't
+        // update the tracking.
+        return;
+    }
+
+    if (handle == mNextUnused)
+    {
+        takeNextUnused();
+    }
+    else if (handle > mNextUnused)
+    {
+        mReservedUnused.insert(handle);
+    }
+    else if (isFree(handle))
+    {
+        clearBit(0, handle);
+        --mFreeCount;
+    }
+}
+
+void BitmapHandleAllocator::reset()
+{
+    mLevels.resize(1);
+    mLevels[0].assign(1, 0);
+    mFreeCount  = 0;
+    mNextUnused = 1;
+    mReservedUnused.clear();
+}
+
+bool BitmapHandleAllocator::anyHandleAvailableForAllocation() const
+{
+    return mFreeCount > 0 || mNextUnused <= mMaxValue;
+}
+
+void BitmapHandleAllocator::enableLogging(bool enabled)
+{
+    mLoggingEnabled = enabled;
+}
+
+bool BitmapHandleAllocator::isFree(uint64_t handle) const
+{
+    return (mLevels[0][handle / kWordBits] >> (handle % kWordBits) & 1) != 0;
+}
+
+void BitmapHandleAllocator::setBit(size_t level, uint64_t index)
+{
+    // Only the first bit set in a word needs to be recorded in the level above.
+    for (; level < mLevels.size(); ++level)
+    {
+        uint64_t &word      = mLevels[level][index / kWordBits];
+        const bool wasEmpty = word == 0;
+        word |= uint64_t(1) << (index % kWordBits);
+        if (!wasEmpty)
+        {
+            return;
+        }
+        index /= kWordBits;
+    }
+}
+
+void BitmapHandleAllocator::clearBit(size_t level, uint64_t index)
+{
+    // Only the last bit cleared in a word needs to be recorded in the level above.
+    for (; level < mLevels.size(); ++level)
+    {
+        uint64_t &word = mLevels[level][index / kWordBits];
+        word &= ~(uint64_t(1) << (index % kWordBits));
+        if (word != 0)
+        {
+            return;
+        }
+        index /= kWordBits;
+    }
+}
+
+uint64_t BitmapHandleAllocator::findLowestSetBit(size_t level) const
+{
+    ASSERT(mFreeCount > 0);
+
+    // Each level gives the word of the level below to look into.
+    uint64_t index = 0;
+    for (size_t current = mLevels.size(); current-- > level;)
+    {
+        index = index * kWordBits + ScanForward(mLevels[current][index]);
+    }
+    return index;
+}
+
+void BitmapHandleAllocator::takeNextUnused()
+{
+    while (true)
+    {
+        // The bits of the handles below |mNextUnused| must be in the bitmap.
+        if (mNextUnused / kWordBits >= mLevels[0].size())
+        {
+            growLevels();
+        }
+        ++mNextUnused;
+
+        // A reserved handle is used, which its clear bit records once it is below |mNextUnused|.
+        if (mReservedUnused.empty() || *mReservedUnused.begin() != mNextUnused)
+        {
+            return;
+        }
+        mReservedUnused.erase(mReservedUnused.begin());
+    }
+}
+
+void BitmapHandleAllocator::growLevels()
+{
+    // Double the size of the bitmap so that growing it takes constant time on average.
+    size_t wordCount =
+        std::max(mLevels[0].size() * 2, static_cast<size_t>(mNextUnused / kWordBits + 1));
+    wordCount = std::min(wordCount, static_cast<size_t>(mMaxValue / kWordBits + 1));
+    mLevels[0].resize(wordCount, 0);
+
+    // The words added to a level are empty, so the bits already set in the level above are still
+    // right.  A new level is filled from the level below it.
+    for (size_t level = 1; mLevels[level - 1].size() > 1; ++level)
+    {
+        const std::vector<uint64_t> &below = mLevels[level - 1];
+        wordCount                          = (below.size() + kWordBits - 1) / kWordBits;
+        if (level < mLevels.size())
+        {
+            mLevels[level].resize(wordCount, 0);
+            continue;
+        }
+
+        std::vector<uint64_t> summary(wordCount, 0);
+        for (size_t index = 0; index < below.size(); ++index)
+        {
+            if (below[index] != 0)
+            {
+                summary[index / kWordBits] |= uint64_t(1) << (index % kWordBits);
+            }
+        }
+        mLevels.push_back(std::move(summary));
+    }
+}
+
+}  // namespace gl
@@ -0,0 +1,74 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// BitmapHandleAllocator.h: Defines the gl::BitmapHandleAllocator class, which allocates GL handles
+// by tracking the free handles in a hierarchical bitmap.
+
+#ifndef LIBANGLE_BITMAPHANDLEALLOCATOR_H_
+#define LIBANGLE_BITMAPHANDLEALLOCATOR_H_
+
+#include <set>
+#include <vector>
+
+#include "common/angleutils.h"
+
+#include "angle_gl.h"
+
+namespace gl
+{
+
+// Unlike HandleAllocator, which reuses released handles in the order they were released, this
+// allocator always returns the lowest free handle.  Allocation and release take a constant number
+// of steps (one per level of the bitmap), and reserving a handle is at worst logarithmic in the
+// number of reserved handles that were never allocated.
+class BitmapHandleAllocator final : angle::NonCopyable
+{
+  public:
+    explicit BitmapHandleAllocator(GLuint maximumHandleValue);
+
+    ~BitmapHandleAllocator();
+
+    bool allocate(GLuint *outId);
+    // Allocates |count| handles, or none if there are not that many handles available.
+    bool allocate(size_t count, GLuint *outIds);
+    void release(GLuint handle);
+    void reserve(GLuint handle);
+    void reset();
+    bool anyHandleAvailableForAllocation() const;
+
+    void enableLogging(bool enabled);
+
+  private:
+    static constexpr uint64_t kWordBits = 64;
+
+    bool isFree(uint64_t handle) const;
+    void setBit(size_t level, uint64_t index);
+    void clearBit(size_t level, uint64_t index);
+    uint64_t findLowestSetBit(size_t level) const;
+
+    // Takes |mNextUnused|, and moves it to the next handle that is neither used nor reserved.
+    void takeNextUnused();
+    void growLevels();
+
+    const GLuint mMaxValue;
+
+    // Level 0 has a bit per handle below |mNextUnused|, which is set if the handle is free.  Every
+    // other level has a bit per word of the level below, which is set if the word has a bit set.
+    // Levels are added as the bitmap grows, so that the last one is always a single word.
+    std::vector<std::vector<uint64_t>> mLevels;
+    size_t mFreeCount;
+
+    // Handles from |mNextUnused| on were never allocated, and are free unless they are reserved.
+    // |mNextUnused| itself is never reserved.
+    uint64_t mNextUnused;
+    std::set<GLuint> mReservedUnused;
+
+    bool mLoggingEnabled;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_BITMAPHANDLEALLOCATOR_H_
@@ -0,0 +1,223 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Unit tests for BitmapHandleAllocator.
+//
+
+#include <limits>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/BitmapHandleAllocator.h"
+
+namespace
+{
+
+constexpr GLuint kMaxHandleForTesting = std::numeric_limits<GLuint>::max();
+
+// Tests that handles are allocated in increasing order, and that the lowest free one is reused.
+TEST(BitmapHandleAllocatorTest, AllocatesLowestFreeHandle)
+{
+    gl::BitmapHandleAllocator allocator(kMaxHandleForTesting);
+
+    for (GLuint expected = 1; expected <= 1000; ++expected)
+    {
+        GLuint handle = 0;
+        EXPECT_TRUE(allocator.allocate(&handle));
+        EXPECT_EQ(expected, handle);
+    }
+
+    allocator.release(700);
+    allocator.release(3);
+    allocator.release(130);
+
+    GLuint handle = 0;
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(3u, handle);
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(130u, handle);
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(700u, handle);
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(1001u, handle);
+}
+
+// Tests that reserved handles are never allocated, whether they were released before or not.
+TEST(BitmapHandleAllocatorTest, ReservationsWithGaps)
+{
+    gl::BitmapHandleAllocator allocator(kMaxHandleForTesting);
+
+    std::set<GLuint> reservedList;
+    for (GLuint id = 2; id < 50; id += 2)
+    {
+        reservedList.insert(id);
+    }
+    for (GLuint id = 100; id < 5000; id += 97)
+    {
+        reservedList.insert(id);
+    }
+
+    // Reserve in decreasing order, so that every handle is reserved ahead of the allocated ones.
+    for (auto it = reservedList.rbegin(); it != reservedList.rend(); ++it)
+    {
+        allocator.reserve(*it);
+    }
+
+    std::set<GLuint> allocatedList;
+    for (size_t allocationNum = 0; allocationNum < 6000; ++allocationNum)
+    {
+        GLuint handle = 0;
+        EXPECT_TRUE(allocator.allocate(&handle));
+        EXPECT_EQ(0u, reservedList.count(handle));
+        EXPECT_EQ(0u, allocatedList.count(handle));
+        allocatedList.insert(handle);
+    }
+}
+
+// Tests a random mix of allocations, releases and reservations against a reference allocator.
+TEST(BitmapHandleAllocatorTest, Random)
+{
+    constexpr GLuint kMaxHandle = 20000;
+    gl::BitmapHandleAllocator allocator(kMaxHandle);
+
+    // The reference keeps the free handles in order.
+    std::set<GLuint> freeList;
+    for (GLuint handle = 1; handle <= kMaxHandle; ++handle)
+    {
+        freeList.insert(handle);
+    }
+
+    std::mt19937 generator(1);
+    for (size_t iteration = 0; iteration < 100000; ++iteration)
+    {
+        const GLuint randomHandle = generator() % kMaxHandle + 1;
+        // Release more often than allocating or reserving, as releases often miss.
+        const uint32_t operation = generator() % 10;
+        if (operation < 3)
+        {
+            GLuint handle = 0;
+            ASSERT_TRUE(allocator.allocate(&handle));
+            ASSERT_EQ(*freeList.begin(), handle);
+            freeList.erase(freeList.begin());
+        }
+        else if (operation < 4)
+        {
+            allocator.reserve(randomHandle);
+            freeList.erase(randomHandle);
+        }
+        else
+        {
+            allocator.release(randomHandle);
+            freeList.insert(randomHandle);
+        }
+    }
+}
+
+// Tests that batch allocation returns the same handles as allocating one at a time.
+TEST(BitmapHandleAllocatorTest, BatchAllocation)
+{
+    gl::BitmapHandleAllocator batchAllocator(kMaxHandleForTesting);
+    gl::BitmapHandleAllocator singleAllocator(kMaxHandleForTesting);
+
+    std::vector<GLuint> handles(300);
+    ASSERT_TRUE(batchAllocator.allocate(handles.size(), handles.data()));
+    for (GLuint handle : handles)
+    {
+        GLuint expected = 0;
+        ASSERT_TRUE(singleAllocator.allocate(&expected));
+        EXPECT_EQ(expected, handle);
+    }
+
+    // Free a few handles spread over several words, and reserve a few unused ones.
+    for (GLuint handle : {5u, 6u, 64u, 65u, 200u, 299u})
+    {
+        batchAllocator.release(handle);
+        singleAllocator.release(handle);
+    }
+    for (GLuint handle : {302u, 303u, 310u})
+    {
+        batchAllocator.reserve(handle);
+        singleAllocator.reserve(handle);
+    }
+
+    ASSERT_TRUE(batchAllocator.allocate(handles.size(), handles.data()));
+    for (GLuint handle : handles)
+    {
+        GLuint expected = 0;
+        ASSERT_TRUE(singleAllocator.allocate(&expected));
+        EXPECT_EQ(expected, handle);
+    }
+}
+
+// Tests that a batch is allocated whole or not at all.
+TEST(BitmapHandleAllocatorTest, BatchExhaustion)
+{
+    constexpr GLuint kMaxHandle = 100;
+    gl::BitmapHandleAllocator allocator(kMaxHandle);
+
+    std::vector<GLuint> handles(kMaxHandle + 1);
+    allocator.reserve(50);
+    EXPECT_FALSE(allocator.allocate(kMaxHandle, handles.data()));
+
+    ASSERT_TRUE(allocator.allocate(kMaxHandle - 1, handles.data()));
+    EXPECT_FALSE(allocator.anyHandleAvailableForAllocation());
+    EXPECT_FALSE(allocator.allocate(1, handles.data()));
+
+    allocator.release(10);
+    allocator.release(kMaxHandle);
+    EXPECT_FALSE(allocator.allocate(3, handles.data()));
+    ASSERT_TRUE(allocator.allocate(2, handles.data()));
+    EXPECT_EQ(10u, handles[0]);
+    EXPECT_EQ(kMaxHandle, handles[1]);
+}
+
+// Tests that reserving the largest handles doesn't affect the allocation of the others.
+TEST(BitmapHandleAllocatorTest, ReserveMaxHandle)
+{
+    gl::BitmapHandleAllocator allocator(kMaxHandleForTesting);
+
+    allocator.reserve(kMaxHandleForTesting);
+    allocator.reserve(kMaxHandleForTesting - 1);
+
+    GLuint handle = 0;
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(1u, handle);
+
+    allocator.release(kMaxHandleForTesting);
+    allocator.release(kMaxHandleForTesting - 1);
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(2u, handle);
+}
+
+// Tests that all handles are allocated before the allocator is exhausted, and that reset frees
+// them all.
+TEST(BitmapHandleAllocatorTest, ExhaustionAndReset)
+{
+    constexpr GLuint kMaxHandle = 4200;
+    gl::BitmapHandleAllocator allocator(kMaxHandle);
+
+    GLuint handle = 0;
+    for (GLuint expected = 1; expected <= kMaxHandle; ++expected)
+    {
+        EXPECT_TRUE(allocator.allocate(&handle));
+        EXPECT_EQ(expected, handle);
+    }
+    EXPECT_FALSE(allocator.anyHandleAvailableForAllocation());
+    EXPECT_FALSE(allocator.allocate(&handle));
+
+    allocator.release(4100);
+    EXPECT_TRUE(allocator.anyHandleAvailableForAllocation());
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(4100u, handle);
+
+    allocator.reset();
+    EXPECT_TRUE(allocator.allocate(&handle));
+    EXPECT_EQ(1u, handle);
+}
+
+}  // anonymous namespace
@@ -8,6 +8,11 @@
 // disk.  MemoryProgramCache uses this to handle caching of compiled programs.
 
 #include "libANGLE/BlobCache.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "common/mathutil.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
@@ -17,10 +22,61 @@
 namespace egl
 {
 BlobCache::BlobCache(size_t maxCacheSizeBytes)
-    : mBlobCache(maxCacheSizeBytes), mSetBlobFunc(nullptr), mGetBlobFunc(nullptr)
-{}
+    : mTotalSize(0),
+      mMaxSize(maxCacheSizeBytes),
+      mUseSerial(0),
+      mCompressionCodec(angle::BlobCompressionCodec::ZlibDefault),
+      mSetBlobFunc(nullptr),
+      mGetBlobFunc(nullptr)
+{
+    for (Shard &shard : mShards)
+    {
+        // Each shard may take up the whole cache; the total is limited by evictToSize().
+        shard.cache.resize(maxCacheSizeBytes);
+    }
+}
+
+BlobCache::~BlobCache()
+{
+    waitForPendingCompressions();
+}
+
+void BlobCache::setCompressionOptions(angle::BlobCompressionCodec codec,
+                                      std::shared_ptr<angle::WorkerThreadPool> compressionPool)
+{
+    waitForPendingCompressions();
+
+    mCompressionCodec = codec;
+
+    std::scoped_lock<angle::SimpleMutex> lock(mCompressionMutex);
+    mCompressionPool = compressionPool && compressionPool->isAsync() ? std::move(compressionPool)
+                                                                     : nullptr;
+}
+
+void BlobCache::setDiskCache(std::unique_ptr<DiskBlobCache> &&diskCache)
+{
+    waitForPendingCompressions();
+    mDiskCache = std::move(diskCache);
+}
+
+void BlobCache::waitForPendingCompressions()
+{
+    std::vector<std::shared_ptr<angle::WaitableEvent>> pendingCompressions;
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mCompressionMutex);
+        pendingCompressions = std::move(mPendingCompressions);
+        mPendingCompressions.clear();
+    }
+    angle::WaitableEvent::WaitMany(&pendingCompressions);
+}
 
-BlobCache::~BlobCache() {}
+BlobCache::Shard &BlobCache::getShard(const BlobCache::Key &key)
+{
+    static_assert(gl::isPow2(kShardCount), "Shard count must be a power of two");
+
+    // The key is a hash, so any of its bytes is well distributed.
+    return mShards[key[0] & (kShardCount - 1)];
+}
 
 void BlobCache::put(const gl::Context *context,
                     const BlobCache::Key &key,
@@ -32,22 +88,90 @@ void BlobCache::put(const gl::Context *context,
     }
     else
     {
-        populate(key, std::move(value), CacheSource::Memory);
+        std::shared_ptr<const angle::MemoryBuffer> blob =
+            std::make_shared<angle::MemoryBuffer>(std::move(value));
+        if (mDiskCache)
+        {
+            mDiskCache->put(key, *blob);
+        }
+        populateShared(key, std::move(blob), CacheSource::Memory);
     }
 }
 
 bool BlobCache::compressAndPut(const gl::Context *context,
                                const BlobCache::Key &key,
                                angle::MemoryBuffer &&uncompressedValue,
-                               size_t *compressedSize)
+                               const CompressedBlobCallback &onCompressed)
+{
+    // The context's callbacks can't be used once the context is destroyed, which may happen before
+    // an asynchronous compression finishes.  |onCompressed| is promised to run on this thread, so
+    // blobs that come with one are compressed synchronously as well.
+    const bool canCompressAsync =
+        (context == nullptr || !context->areBlobCacheFuncsSet()) && !onCompressed;
+
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mCompressionMutex);
+        if (mCompressionPool && canCompressAsync)
+        {
+            class CompressTask : public angle::Closure
+            {
+              public:
+                CompressTask(BlobCache *blobCache,
+                             const BlobCache::Key &key,
+                             angle::MemoryBuffer &&uncompressedValue)
+                    : mBlobCache(blobCache),
+                      mKey(key),
+                      mUncompressedValue(std::move(uncompressedValue))
+                {}
+
+                void operator()() override
+                {
+                    if (!mBlobCache->compressAndPutImpl(nullptr, mKey, mUncompressedValue,
+                                                        nullptr))
+                    {
+                        WARN() << "Error compressing blob for insertion into cache.";
+                    }
+                }
+
+              private:
+                BlobCache *mBlobCache;
+                BlobCache::Key mKey;
+                angle::MemoryBuffer mUncompressedValue;
+            };
+
+            // Forget about compressions that are already done.
+            mPendingCompressions.erase(
+                std::remove_if(mPendingCompressions.begin(), mPendingCompressions.end(),
+                               [](const std::shared_ptr<angle::WaitableEvent> &event) {
+                                   return event->isReady();
+                               }),
+                mPendingCompressions.end());
+
+            mPendingCompressions.push_back(mCompressionPool->postWorkerTaskWithPriority(
+                std::make_shared<CompressTask>(this, key, std::move(uncompressedValue)),
+                angle::WorkerTaskPriority::Low));
+            return true;
+        }
+    }
+
+    return compressAndPutImpl(context, key, uncompressedValue, onCompressed);
+}
+
+bool BlobCache::compressAndPutImpl(const gl::Context *context,
+                                   const BlobCache::Key &key,
+                                   const angle::MemoryBuffer &uncompressedValue,
+                                   const CompressedBlobCallback &onCompressed)
 {
     angle::MemoryBuffer compressedValue;
-    if (!angle::CompressBlob(uncompressedValue.size(), uncompressedValue.data(), &compressedValue))
+    if (!angle::CompressBlob(uncompressedValue.size(), uncompressedValue.data(),
+                             getCompressionCodec(), &compressedValue))
     {
         return false;
     }
-    if (compressedSize != nullptr)
-        *compressedSize = compressedValue.size();
+    if (onCompressed)
+    {
+        onCompressed(key, compressedValue);
+    }
     put(context, key, std::move(compressedValue));
     return true;
 }
@@ -58,7 +182,7 @@ void BlobCache::putApplication(const gl::Context *context,
 {
     if (context && context->areBlobCacheFuncsSet())
     {
-        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        std::scoped_lock<angle::SimpleMutex> lock(mApplicationCallbackMutex);
         const gl::BlobCacheCallbacks &contextCallbacks =
             context->getState().getBlobCacheCallbacks();
         contextCallbacks.setFunction(key.data(), key.size(), value.data(), value.size(),
@@ -66,20 +190,147 @@ void BlobCache::putApplication(const gl::Context *context,
     }
     else if (areBlobCacheFuncsSet())
     {
-        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
-        mSetBlobFunc(key.data(), key.size(), value.data(), value.size());
+        std::scoped_lock<angle::SimpleMutex> lock(mApplicationCallbackMutex);
+        mSetBlobFunc.load()(key.data(), key.size(), value.data(), value.size());
     }
 }
 
 void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source)
 {
-    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    populateShared(key, std::make_shared<angle::MemoryBuffer>(std::move(value)), source);
+}
+
+void BlobCache::populateShared(const BlobCache::Key &key,
+                               std::shared_ptr<const angle::MemoryBuffer> &&blob,
+                               CacheSource source)
+{
+    const size_t valueSize = blob->size();
+    if (valueSize > maxSize())
+    {
+        return;
+    }
+
     CacheEntry newEntry;
-    newEntry.first  = std::move(value);
-    newEntry.second = source;
+    newEntry.blob          = std::move(blob);
+    newEntry.source        = source;
+    newEntry.lastUseSerial = mUseSerial.fetch_add(1, std::memory_order_relaxed);
 
     // Cache it inside blob cache only if caching inside the application is not possible.
-    mBlobCache.put(key, std::move(newEntry), newEntry.first.size());
+    Shard &shard = getShard(key);
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        const size_t sizeBefore = shard.cache.size();
+        shard.cache.put(key, std::move(newEntry), valueSize);
+        const size_t sizeAfter = shard.cache.size();
+
+        // Note: the shard size may shrink if a larger entry is replaced.
+        mTotalSize.fetch_add(sizeAfter - sizeBefore, std::memory_order_relaxed);
+    }
+
+    evictToSize(maxSize());
+}
+
+std::shared_ptr<const angle::MemoryBuffer> BlobCache::getInternal(const BlobCache::Key &key)
+{
+    {
+        Shard &shard = getShard(key);
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+
+        CacheEntry *entry;
+        if (shard.cache.getMutable(key, &entry))
+        {
+            entry->lastUseSerial = mUseSerial.fetch_add(1, std::memory_order_relaxed);
+            return entry->blob;
+        }
+    }
+
+    if (!mDiskCache)
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<angle::MemoryBuffer> blob = std::make_shared<angle::MemoryBuffer>();
+    if (!mDiskCache->get(key, blob.get()))
+    {
+        return nullptr;
+    }
+
+    // Keep the blob in memory for the following lookups.
+    populateShared(key, blob, CacheSource::Disk);
+    return blob;
+}
+
+size_t BlobCache::evictToSize(size_t limit)
+{
+    std::scoped_lock<angle::SimpleMutex> evictionLock(mEvictionMutex);
+
+    size_t bytesFreed = 0;
+    while (mTotalSize.load(std::memory_order_relaxed) > limit)
+    {
+        // Find the shard whose least recently used entry is the oldest.  Other threads may use
+        // that entry before it's evicted below, in which case a slightly more recently used entry
+        // is evicted instead.
+        Shard *oldestShard    = nullptr;
+        uint64_t oldestSerial = std::numeric_limits<uint64_t>::max();
+        for (Shard &shard : mShards)
+        {
+            std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+            const CacheEntry *entry;
+            if (shard.cache.peekLeastRecentlyUsed(&entry) && entry->lastUseSerial < oldestSerial)
+            {
+                oldestShard  = &shard;
+                oldestSerial = entry->lastUseSerial;
+            }
+        }
+
+        if (oldestShard == nullptr)
+        {
+            break;
+        }
+
+        std::scoped_lock<angle::SimpleMutex> lock(oldestShard->mutex);
+        const size_t entrySize = oldestShard->cache.evictLeastRecentlyUsed();
+        mTotalSize.fetch_sub(entrySize, std::memory_order_relaxed);
+        bytesFreed += entrySize;
+    }
+
+    return bytesFreed;
+}
+
+void BlobCache::clear()
+{
+    waitForPendingCompressions();
+
+    for (Shard &shard : mShards)
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        mTotalSize.fetch_sub(shard.cache.size(), std::memory_order_relaxed);
+        shard.cache.clear();
+    }
+}
+
+void BlobCache::resize(size_t maxCacheSizeBytes)
+{
+    waitForPendingCompressions();
+
+    mMaxSize = maxCacheSizeBytes;
+    for (Shard &shard : mShards)
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        mTotalSize.fetch_sub(shard.cache.size(), std::memory_order_relaxed);
+        shard.cache.resize(maxCacheSizeBytes);
+    }
+}
+
+size_t BlobCache::entryCount() const
+{
+    size_t count = 0;
+    for (const Shard &shard : mShards)
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        count += shard.cache.entryCount();
+    }
+    return count;
 }
 
 bool BlobCache::get(const gl::Context *context,
@@ -90,7 +341,7 @@ bool BlobCache::get(const gl::Context *context,
     // Look into the application's cache, if there is such a cache
     if (areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()))
     {
-        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        std::scoped_lock<angle::SimpleMutex> lock(mApplicationCallbackMutex);
         EGLsizeiANDROID valueSize =
             callBlobGetCallback(context, key.data(), key.size(), nullptr, 0);
         if (valueSize <= 0)
@@ -125,29 +376,36 @@ bool BlobCache::get(const gl::Context *context,
         return true;
     }
 
-    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
     // Otherwise we are doing caching internally, so try to find it there
-    const CacheEntry *entry;
-    bool result = mBlobCache.get(key, &entry);
-
-    if (result)
+    std::shared_ptr<const angle::MemoryBuffer> blob = getInternal(key);
+    if (!blob)
     {
-        *valueOut = BlobCache::Value(entry->first.data(), entry->first.size());
+        return false;
     }
 
-    return result;
+    *valueOut = BlobCache::Value(blob->data(), blob->size());
+    return true;
 }
 
 bool BlobCache::getAt(size_t index, const BlobCache::Key **keyOut, BlobCache::Value *valueOut)
 {
-    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
-    const CacheEntry *valueBuf;
-    bool result = mBlobCache.getAt(index, keyOut, &valueBuf);
-    if (result)
+    for (Shard &shard : mShards)
     {
-        *valueOut = BlobCache::Value(valueBuf->first.data(), valueBuf->first.size());
+        std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+        const size_t shardEntryCount = shard.cache.entryCount();
+        if (index >= shardEntryCount)
+        {
+            index -= shardEntryCount;
+            continue;
+        }
+
+        const CacheEntry *entry;
+        bool result = shard.cache.getAt(index, keyOut, &entry);
+        ASSERT(result);
+        *valueOut = BlobCache::Value(entry->blob->data(), entry->blob->size());
+        return true;
     }
-    return result;
+    return false;
 }
 
 BlobCache::GetAndDecompressResult BlobCache::getAndDecompress(
@@ -159,21 +417,32 @@ BlobCache::GetAndDecompressResult BlobCache::getAndDecompress(
 {
     ASSERT(uncompressedValueOut);
 
+    // Blobs from the application's cache are copied into |scratchBuffer|, which is owned by the
+    // caller.  Blobs from the internal cache are kept alive by |internalBlob|.  Either way, no
+    // lock needs to be held during decompression.
     Value compressedValue;
-    if (!get(context, scratchBuffer, key, &compressedValue))
+    std::shared_ptr<const angle::MemoryBuffer> internalBlob;
+    if (areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()))
     {
-        return GetAndDecompressResult::NotFound;
+        if (!get(context, scratchBuffer, key, &compressedValue))
+        {
+            return GetAndDecompressResult::NotFound;
+        }
     }
-
+    else
     {
-        // This needs to be locked because `DecompressBlob` is reading shared memory from
-        // `compressedValue.data()`.
-        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
-        if (!angle::DecompressBlob(compressedValue.data(), compressedValue.size(),
-                                   maxUncompressedDataSize, uncompressedValueOut))
+        internalBlob = getInternal(key);
+        if (!internalBlob)
         {
-            return GetAndDecompressResult::DecompressFailure;
+            return GetAndDecompressResult::NotFound;
         }
+        compressedValue = Value(internalBlob->data(), internalBlob->size());
+    }
+
+    if (!angle::DecompressBlob(compressedValue.data(), compressedValue.size(),
+                               maxUncompressedDataSize, uncompressedValueOut))
+    {
+        return GetAndDecompressResult::DecompressFailure;
     }
 
     return GetAndDecompressResult::Success;
@@ -181,29 +450,47 @@ BlobCache::GetAndDecompressResult BlobCache::getAndDecompress(
 
 void BlobCache::remove(const BlobCache::Key &key)
 {
-    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
-    mBlobCache.eraseByKey(key);
+    // The blob is removed from the disk cache too, as it's typically removed because it was
+    // rejected by the program or shader cache.
+    if (mDiskCache)
+    {
+        mDiskCache->remove(key);
+    }
+
+    Shard &shard = getShard(key);
+    std::scoped_lock<angle::SimpleMutex> lock(shard.mutex);
+    const size_t sizeBefore = shard.cache.size();
+    shard.cache.eraseByKey(key);
+    mTotalSize.fetch_sub(sizeBefore - shard.cache.size(), std::memory_order_relaxed);
 }
 
 void BlobCache::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
 {
-    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    // Blobs compressed before the callbacks change go where they would have gone synchronously.
+    waitForPendingCompressions();
+
+    std::scoped_lock<angle::SimpleMutex> lock(mApplicationCallbackMutex);
     mSetBlobFunc = set;
     mGetBlobFunc = get;
 }
 
 bool BlobCache::areBlobCacheFuncsSet() const
 {
-    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    // The callbacks are set during initialization, so they are read without locking to keep the
+    // mutex off the lookup path.
+    const bool isSetFuncSet = mSetBlobFunc.load(std::memory_order_acquire) != nullptr;
+    const bool isGetFuncSet = mGetBlobFunc.load(std::memory_order_acquire) != nullptr;
+
     // Either none or both of the callbacks should be set.
-    ASSERT((mSetBlobFunc != nullptr) == (mGetBlobFunc != nullptr));
+    ASSERT(isSetFuncSet == isGetFuncSet);
 
-    return mSetBlobFunc != nullptr && mGetBlobFunc != nullptr;
+    return isSetFuncSet && isGetFuncSet;
 }
 
 bool BlobCache::isCachingEnabled(const gl::Context *context) const
 {
-    return areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()) || maxSize() > 0;
+    return areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()) ||
+           maxSize() > 0 || mDiskCache != nullptr;
 }
 
 size_t BlobCache::callBlobGetCallback(const gl::Context *context,
@@ -221,8 +508,9 @@ size_t BlobCache::callBlobGetCallback(const gl::Context *context,
     }
     else
     {
-        ASSERT(mGetBlobFunc);
-        return mGetBlobFunc(key, keySize, value, valueSize);
+        EGLGetBlobFuncANDROID getBlobFunc = mGetBlobFunc.load(std::memory_order_acquire);
+        ASSERT(getBlobFunc);
+        return getBlobFunc(key, keySize, value, valueSize);
     }
 }
 
@@ -6,14 +6,24 @@
 // BlobCache: Stores compiled and linked programs in memory so they don't
 //   always have to be re-compiled. Can be used in conjunction with the platform
 //   layer to warm up the cache from disk.
+//
+//   The internal cache is split into independently locked shards selected by the key, so that
+//   lookups from different threads don't serialize on a single mutex.  Size is accounted for
+//   globally, and entries are evicted in least recently used order across all shards.
 
 #ifndef LIBANGLE_BLOB_CACHE_H_
 #define LIBANGLE_BLOB_CACHE_H_
 
 #include <array>
+#include <atomic>
 #include <cstring>
+#include <functional>
+#include <memory>
+#include <vector>
 
 #include "common/SimpleMutex.h"
+#include "common/WorkerThread.h"
+#include "libANGLE/DiskBlobCache.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/angletypes.h"
@@ -50,19 +60,44 @@ class BlobCache final : angle::NonCopyable
         Disk,
     };
 
+    // Called with the compressed blob once compressAndPut() has compressed it, before it's put in
+    // the cache.  Always called on the thread that called compressAndPut().
+    using CompressedBlobCallback =
+        std::function<void(const BlobCache::Key &key, const angle::MemoryBuffer &compressedValue)>;
+
     explicit BlobCache(size_t maxCacheSizeBytes);
     ~BlobCache();
 
+    // Selects the codec used by compressAndPut().  If |compressionPool| is an asynchronous pool,
+    // compressAndPut() compresses on it and returns before the blob is put in the cache.  Waits
+    // for compressions in flight with the previous options.
+    void setCompressionOptions(angle::BlobCompressionCodec codec,
+                               std::shared_ptr<angle::WorkerThreadPool> compressionPool);
+    angle::BlobCompressionCodec getCompressionCodec() const
+    {
+        return mCompressionCodec.load(std::memory_order_relaxed);
+    }
+
+    // Waits until all blobs being compressed asynchronously are put in the cache.
+    void waitForPendingCompressions();
+
+    // Backs the internal cache with a persistent cache.  Blobs put in the internal cache are
+    // written through to |diskCache|, and lookups that miss the internal cache are looked up there.
+    void setDiskCache(std::unique_ptr<DiskBlobCache> &&diskCache);
+    bool hasDiskCache() const { return mDiskCache != nullptr; }
+
     // Store a key-blob pair in the cache.  If application callbacks are set, the application cache
     // will be used.  Otherwise the value is cached in this object.
     void put(const gl::Context *context, const BlobCache::Key &key, angle::MemoryBuffer &&value);
 
     // Store a key-blob pair in the cache, but compress the blob before insertion. Returns false if
-    // compression fails, returns true otherwise.
+    // compression fails, returns true otherwise.  If compression is done asynchronously, true is
+    // returned right away and failures are only logged.  |onCompressed| is optional; blobs given
+    // one are always compressed synchronously so that it runs on the calling thread.
     bool compressAndPut(const gl::Context *context,
                         const BlobCache::Key &key,
                         angle::MemoryBuffer &&uncompressedValue,
-                        size_t *compressedSize);
+                        const CompressedBlobCallback &onCompressed = nullptr);
 
     // Store a key-blob pair in the application cache, only if application callbacks are set.
     void putApplication(const gl::Context *context,
@@ -104,25 +139,25 @@ class BlobCache final : angle::NonCopyable
     void remove(const BlobCache::Key &key);
 
     // Empty the cache.
-    void clear() { mBlobCache.clear(); }
+    void clear();
 
     // Resize the cache. Discards current contents.
-    void resize(size_t maxCacheSizeBytes) { mBlobCache.resize(maxCacheSizeBytes); }
+    void resize(size_t maxCacheSizeBytes);
 
     // Returns the number of entries in the cache.
-    size_t entryCount() const { return mBlobCache.entryCount(); }
+    size_t entryCount() const;
 
     // Reduces the current cache size and returns the number of bytes freed.
-    size_t trim(size_t limit) { return mBlobCache.shrinkToSize(limit); }
+    size_t trim(size_t limit) { return evictToSize(limit); }
 
     // Returns the current cache size in bytes.
-    size_t size() const { return mBlobCache.size(); }
+    size_t size() const { return mTotalSize.load(std::memory_order_relaxed); }
 
     // Returns whether the cache is empty
-    bool empty() const { return mBlobCache.empty(); }
+    bool empty() const { return entryCount() == 0; }
 
     // Returns the maximum cache size in bytes.
-    size_t maxSize() const { return mBlobCache.maxSize(); }
+    size_t maxSize() const { return mMaxSize.load(std::memory_order_relaxed); }
 
     void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
 
@@ -130,23 +165,79 @@ class BlobCache final : angle::NonCopyable
 
     bool isCachingEnabled(const gl::Context *context) const;
 
-    angle::SimpleMutex &getMutex() { return mBlobCacheMutex; }
+    // Serializes calls into the application's callbacks.  The internal cache doesn't use this
+    // mutex.
+    angle::SimpleMutex &getMutex() { return mApplicationCallbackMutex; }
 
   private:
+    // This internal cache is used only if the application is not providing caching callbacks.  The
+    // blob is reference counted so that it can be read (e.g. decompressed) without holding the
+    // shard's lock, even if the entry is concurrently evicted.
+    struct CacheEntry
+    {
+        std::shared_ptr<const angle::MemoryBuffer> blob;
+        CacheSource source;
+        // Value of |mUseSerial| when the entry was last put or looked up; used to find the least
+        // recently used entry across shards.
+        uint64_t lastUseSerial;
+    };
+
+    // Must be a power of two.
+    static constexpr size_t kShardCount = 16;
+
+    struct Shard
+    {
+        mutable angle::SimpleMutex mutex;
+        angle::SizedMRUCache<BlobCache::Key, CacheEntry> cache{0};
+    };
+
+    Shard &getShard(const BlobCache::Key &key);
+
+    // Looks the key up in the internal cache, then the disk cache, and returns a reference to its
+    // blob, or nullptr.
+    std::shared_ptr<const angle::MemoryBuffer> getInternal(const BlobCache::Key &key);
+
+    void populateShared(const BlobCache::Key &key,
+                        std::shared_ptr<const angle::MemoryBuffer> &&blob,
+                        CacheSource source);
+
+    // Evicts least recently used entries until the total size is at most |limit|.  Returns the
+    // number of bytes freed.
+    size_t evictToSize(size_t limit);
+
+    // Compresses the blob and puts it in the cache.  Returns false if compression fails.
+    bool compressAndPutImpl(const gl::Context *context,
+                            const BlobCache::Key &key,
+                            const angle::MemoryBuffer &uncompressedValue,
+                            const CompressedBlobCallback &onCompressed);
+
     size_t callBlobGetCallback(const gl::Context *context,
                                const void *key,
                                size_t keySize,
                                void *value,
                                size_t valueSize);
 
-    // This internal cache is used only if the application is not providing caching callbacks
-    using CacheEntry = std::pair<angle::MemoryBuffer, CacheSource>;
+    std::array<Shard, kShardCount> mShards;
+    std::atomic<size_t> mTotalSize;
+    std::atomic<size_t> mMaxSize;
+    std::atomic<uint64_t> mUseSerial;
+
+    // Only one thread evicts at a time so that concurrent puts don't evict more than necessary.
+    angle::SimpleMutex mEvictionMutex;
+
+    std::atomic<angle::BlobCompressionCodec> mCompressionCodec;
+    // Set if compressAndPut() compresses asynchronously.  Protected by |mCompressionMutex|, as are
+    // the events of the compressions in flight.
+    angle::SimpleMutex mCompressionMutex;
+    std::shared_ptr<angle::WorkerThreadPool> mCompressionPool;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mPendingCompressions;
 
-    mutable angle::SimpleMutex mBlobCacheMutex;
-    angle::SizedMRUCache<BlobCache::Key, CacheEntry> mBlobCache;
+    // Set before any use of the cache, so it's not protected.
+    std::unique_ptr<DiskBlobCache> mDiskCache;
 
-    EGLSetBlobFuncANDROID mSetBlobFunc;
-    EGLGetBlobFuncANDROID mGetBlobFunc;
+    mutable angle::SimpleMutex mApplicationCallbackMutex;
+    std::atomic<EGLSetBlobFuncANDROID> mSetBlobFunc;
+    std::atomic<EGLGetBlobFuncANDROID> mGetBlobFunc;
 };
 
 }  // namespace egl
@@ -7,6 +7,8 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 #include "libANGLE/BlobCache.h"
 
 namespace egl
@@ -127,4 +129,156 @@ TEST(BlobCacheTest, OversizeValue)
     EXPECT_FALSE(blobCache.get(nullptr, nullptr, MakeKey(5), &qvalue));
 }
 
+// Tests that looking up a value makes it most recently used, even if it's in a different shard
+// than the values that are evicted instead.
+TEST(BlobCacheTest, LookupUpdatesRecency)
+{
+    constexpr size_t kSize = 4;
+    BlobCache blobCache(kSize);
+
+    for (uint8_t value = 0; value < kSize; ++value)
+    {
+        blobCache.populate(MakeKey(value), MakeBlob(1, value));
+    }
+
+    // Use the oldest value, then insert a new one.  The second oldest value should be evicted.
+    Blob qvalue;
+    EXPECT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(0), &qvalue));
+    blobCache.populate(MakeKey(kSize), MakeBlob(1, kSize));
+
+    EXPECT_EQ(kSize, blobCache.size());
+    EXPECT_EQ(kSize, blobCache.entryCount());
+    EXPECT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(0), &qvalue));
+    EXPECT_FALSE(blobCache.get(nullptr, nullptr, MakeKey(1), &qvalue));
+    EXPECT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(kSize), &qvalue));
+}
+
+// Tests that replacing and removing values keeps the size accounting correct.
+TEST(BlobCacheTest, ReplaceAndRemove)
+{
+    constexpr size_t kSize = 32;
+    BlobCache blobCache(kSize);
+
+    blobCache.populate(MakeKey(0), MakeBlob(8));
+    blobCache.populate(MakeKey(1), MakeBlob(8));
+    EXPECT_EQ(16u, blobCache.size());
+
+    blobCache.populate(MakeKey(0), MakeBlob(4));
+    EXPECT_EQ(12u, blobCache.size());
+    EXPECT_EQ(2u, blobCache.entryCount());
+
+    blobCache.remove(MakeKey(1));
+    EXPECT_EQ(4u, blobCache.size());
+    EXPECT_EQ(1u, blobCache.entryCount());
+
+    const Key *key = nullptr;
+    Blob qvalue;
+    EXPECT_TRUE(blobCache.getAt(0, &key, &qvalue));
+    EXPECT_EQ(MakeKey(0), *key);
+    EXPECT_EQ(4u, qvalue.size());
+    EXPECT_FALSE(blobCache.getAt(1, &key, &qvalue));
+
+    EXPECT_EQ(4u, blobCache.trim(0));
+    EXPECT_TRUE(blobCache.empty());
+}
+
+// Tests that concurrent puts and gets from multiple threads keep the cache within its size limit.
+TEST(BlobCacheTest, ConcurrentAccess)
+{
+    constexpr size_t kSize        = 256;
+    constexpr size_t kThreadCount = 8;
+    constexpr size_t kIterations  = 1000;
+    BlobCache blobCache(kSize);
+
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&blobCache, threadIndex]() {
+            for (size_t iteration = 0; iteration < kIterations; ++iteration)
+            {
+                const uint8_t value     = static_cast<uint8_t>(threadIndex * 31 + iteration);
+                const uint8_t nextValue = static_cast<uint8_t>(value + 1);
+                blobCache.populate(MakeKey(value), MakeBlob(value % 16 + 1, value));
+
+                Blob qvalue;
+                (void)blobCache.get(nullptr, nullptr, MakeKey(nextValue), &qvalue);
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_LE(blobCache.size(), kSize);
+
+    size_t totalSize = 0;
+    for (size_t index = 0; index < blobCache.entryCount(); ++index)
+    {
+        const Key *key = nullptr;
+        Blob qvalue;
+        EXPECT_TRUE(blobCache.getAt(index, &key, &qvalue));
+        totalSize += qvalue.size();
+    }
+    EXPECT_EQ(totalSize, blobCache.size());
+}
+
+// Tests that blobs compressed with any codec, synchronously or on a worker pool, are put in the
+// cache and decompress to the original data.
+TEST(BlobCacheTest, CompressAndPut)
+{
+    constexpr size_t kSize      = 64 * 1024;
+    constexpr size_t kBlobCount = 16;
+    constexpr size_t kBlobSize  = 200;
+
+    std::shared_ptr<angle::WorkerThreadPool> pool =
+        angle::WorkerThreadPool::Create(angle::ThreadPoolType::Asynchronous, 2, nullptr);
+
+    for (angle::BlobCompressionCodec codec :
+         {angle::BlobCompressionCodec::ZlibDefault, angle::BlobCompressionCodec::LZ})
+    {
+        for (bool async : {false, true})
+        {
+            BlobCache blobCache(kSize);
+            blobCache.setCompressionOptions(codec, async ? pool : nullptr);
+
+            // Every other blob is given a callback, which must run on this thread.
+            const std::thread::id callingThread = std::this_thread::get_id();
+            std::atomic<size_t> compressedCount(0);
+            for (uint8_t index = 0; index < kBlobCount; ++index)
+            {
+                if (index % 2 != 0)
+                {
+                    EXPECT_TRUE(blobCache.compressAndPut(nullptr, MakeKey(index),
+                                                         MakeBlob(kBlobSize, index)));
+                    continue;
+                }
+                EXPECT_TRUE(blobCache.compressAndPut(
+                    nullptr, MakeKey(index), MakeBlob(kBlobSize, index),
+                    [&compressedCount, callingThread](const Key &,
+                                                      const angle::MemoryBuffer &compressedValue) {
+                        EXPECT_GT(compressedValue.size(), 0u);
+                        EXPECT_EQ(std::this_thread::get_id(), callingThread);
+                        compressedCount++;
+                    }));
+            }
+            blobCache.waitForPendingCompressions();
+            EXPECT_EQ(compressedCount, (kBlobCount + 1) / 2);
+            EXPECT_EQ(blobCache.entryCount(), kBlobCount);
+
+            for (uint8_t index = 0; index < kBlobCount; ++index)
+            {
+                angle::MemoryBuffer uncompressed;
+                ASSERT_EQ(blobCache.getAndDecompress(nullptr, nullptr, MakeKey(index), kBlobSize,
+                                                     &uncompressed),
+                          BlobCache::GetAndDecompressResult::Success);
+                const BlobPut expected = MakeBlob(kBlobSize, index);
+                ASSERT_EQ(uncompressed.size(), expected.size());
+                EXPECT_TRUE(std::equal(uncompressed.data(),
+                                       uncompressed.data() + uncompressed.size(), expected.data()));
+            }
+        }
+    }
+}
+
 }  // namespace egl
@@ -207,7 +207,7 @@ angle::Result Buffer::setDataWithUsageFlags(const gl::Context *context,
     if (result == angle::Result::Stop)
     {
         // If setData fails, the buffer contents are undefined. Set a zero size to indicate that.
-        mIndexRangeCache.clear();
+        mState.mIndexRangeCache.clear();
         mState.mSize = 0;
 
         // Notify when storage changes.
@@ -242,7 +242,7 @@ angle::Result Buffer::bufferDataImpl(Context *context,
 
     bool wholeBuffer = size == mState.mSize;
 
-    mIndexRangeCache.clear();
+    mState.mIndexRangeCache.clear();
     mState.mUsage                = usage;
     mState.mSize                 = size;
     mState.mImmutable            = (bufferStorage == BufferStorage::Immutable);
@@ -283,7 +283,7 @@ angle::Result Buffer::bufferExternalDataImpl(Context *context,
     ANGLE_TRY(setDataWithUsageFlags(context, target, clientBuffer, nullptr, size,
                                     BufferUsage::DynamicDraw, flags, BufferStorage::Immutable));
 
-    mIndexRangeCache.clear();
+    mState.mIndexRangeCache.clear();
     mState.mUsage                = BufferUsage::DynamicDraw;
     mState.mSize                 = size;
     mState.mImmutable            = GL_TRUE;
@@ -306,8 +306,8 @@ angle::Result Buffer::bufferSubData(const Context *context,
     ANGLE_TRY_WITH_FINALLY(mImpl->setSubData(context, target, data, size, offset, &feedback),
                            applyImplFeedback(context, feedback));
 
-    mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset),
-                                     static_cast<unsigned int>(size));
+    mState.mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset),
+                                            static_cast<unsigned int>(size));
 
     // Notify when data changes.
     onContentsChange(context);
@@ -326,8 +326,8 @@ angle::Result Buffer::copyBufferSubData(const Context *context,
                                               destOffset, size, &feedback),
                            applyImplFeedback(context, feedback));
 
-    mIndexRangeCache.invalidateRange(static_cast<unsigned int>(destOffset),
-                                     static_cast<unsigned int>(size));
+    mState.mIndexRangeCache.invalidateRange(static_cast<unsigned int>(destOffset),
+                                            static_cast<unsigned int>(size));
 
     // Notify when data changes.
     onContentsChange(context);
@@ -351,7 +351,7 @@ angle::Result Buffer::map(const Context *context, GLenum access)
     mState.mMapLength   = mState.mSize;
     mState.mAccess      = access;
     mState.mAccessFlags = GL_MAP_WRITE_BIT;
-    mIndexRangeCache.clear();
+    mState.mIndexRangeCache.clear();
 
     // Notify when state changes.
     onStateChange(context, angle::SubjectMessage::SubjectMapped);
@@ -386,8 +386,8 @@ angle::Result Buffer::mapRange(const Context *context,
 
     if ((access & GL_MAP_WRITE_BIT) > 0)
     {
-        mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset),
-                                         static_cast<unsigned int>(length));
+        mState.mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset),
+                                                static_cast<unsigned int>(length));
     }
 
     // Notify when state changes.
@@ -420,7 +420,7 @@ angle::Result Buffer::unmap(const Context *context, GLboolean *result)
 
 void Buffer::onDataChanged(const Context *context)
 {
-    mIndexRangeCache.clear();
+    mState.mIndexRangeCache.clear();
 
     // Notify when data changes.
     onContentsChange(context);
@@ -435,7 +435,7 @@ angle::Result Buffer::getIndexRange(const gl::Context *context,
                                     bool primitiveRestartEnabled,
                                     IndexRange *outRange) const
 {
-    if (mIndexRangeCache.findRange(type, offset, count, primitiveRestartEnabled, outRange))
+    if (mState.mIndexRangeCache.findRange(type, offset, count, primitiveRestartEnabled, outRange))
     {
         return angle::Result::Continue;
     }
@@ -443,7 +443,7 @@ angle::Result Buffer::getIndexRange(const gl::Context *context,
     ANGLE_TRY(
         mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled, outRange));
 
-    mIndexRangeCache.addRange(type, offset, count, primitiveRestartEnabled, *outRange);
+    mState.mIndexRangeCache.addRange(type, offset, count, primitiveRestartEnabled, *outRange);
 
     return angle::Result::Continue;
 }
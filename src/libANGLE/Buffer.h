@@ -73,6 +73,17 @@ class BufferState final : angle::NonCopyable
     std::string getLabel() const { return mLabel; }
     WebGLBufferType getWebGLType() const { return mWebGLType; }
 
+    // Computes the range of |count| indices of |type| at |offset|, given |indices| which points to
+    // the buffer data at |offset|.  Used by the implementations once they have access to the data.
+    IndexRange computeIndexRange(DrawElementsType type,
+                                 size_t offset,
+                                 size_t count,
+                                 bool primitiveRestartEnabled,
+                                 const uint8_t *indices) const
+    {
+        return mIndexRangeCache.computeRange(type, offset, count, primitiveRestartEnabled, indices);
+    }
+
   private:
     friend class Buffer;
 
@@ -94,6 +105,9 @@ class BufferState final : angle::NonCopyable
     GLbitfield mStorageExtUsageFlags;
     GLboolean mExternal;
     WebGLBufferType mWebGLType;
+
+    // The ranges of indices already computed, and a summary of the buffer to compute new ones.
+    mutable IndexRangeCache mIndexRangeCache;
 };
 
 // Vertex Array and Texture track buffer data updates.
@@ -278,7 +292,6 @@ class Buffer final : public ThreadSafeRefCountObject<BufferID>,
     VertexArrayBufferBindingMaskAndContext mVertexArrayBufferBindingMaskAndContext;
 
     angle::FastVector<ContentsObserver, angle::kMaxFixedObservers> mContentsObservers;
-    mutable IndexRangeCache mIndexRangeCache;
 };
 
 }  // namespace gl
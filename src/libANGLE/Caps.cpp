@@ -1257,6 +1257,7 @@ std::vector<std::string> DisplayExtensions::getStrings() const
     InsertExtensionString("EGL_ANGLE_webgpu_texture_client_buffer",              webgpuTextureClientBuffer,          &extensionStrings);
     InsertExtensionString("EGL_ANGLE_create_context_passthrough_shaders",        createContextPassthroughShadersANGLE, &extensionStrings);
     InsertExtensionString("EGL_NV_context_priority_realtime",                    contextPriorityRealtimeNV,          &extensionStrings);
+    InsertExtensionString("EGL_ANGLE_context_threaded_commands",                 contextThreadedCommandsANGLE,       &extensionStrings);
     // clang-format on
 
     return extensionStrings;
@@ -1324,6 +1325,7 @@ std::vector<std::string> ClientExtensions::getStrings() const
     InsertExtensionString("EGL_ANGLE_feature_control",                        featureControlANGLE,                &extensionStrings);
     InsertExtensionString("EGL_ANGLE_display_power_preference",               displayPowerPreferenceANGLE,        &extensionStrings);
     InsertExtensionString("EGL_ANGLE_no_error",                               noErrorANGLE,                       &extensionStrings);
+    InsertExtensionString("EGL_ANGLE_disk_program_cache",                     diskProgramCacheANGLE,              &extensionStrings);
     // clang-format on
 
     return extensionStrings;
@@ -725,6 +725,9 @@ struct DisplayExtensions
 
     // EGL_NV_context_priority_realtime
     bool contextPriorityRealtimeNV = false;
+
+    // EGL_ANGLE_context_threaded_commands
+    bool contextThreadedCommandsANGLE = false;
 };
 
 struct DeviceExtensions
@@ -859,6 +862,9 @@ struct ClientExtensions
 
     // EGL_ANGLE_no_error
     bool noErrorANGLE = false;
+
+    // EGL_ANGLE_disk_program_cache
+    bool diskProgramCacheANGLE = false;
 };
 
 }  // namespace egl
@@ -0,0 +1,187 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+// CommandStream.cpp: Implements the gl::CommandStream class.
+
+#include "libANGLE/CommandStream.h"
+
+#include <cstring>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "common/system_utils.h"
+#include "libANGLE/Context.h"
+
+namespace gl
+{
+CommandStream::CommandStream(Context *context)
+    : mContext(context),
+      mBatchOffset(0),
+      mIdle(true),
+      mHasEnabledClientAttribs(true),
+      mHasElementArrayBuffer(false),
+      mSubmittedBatchCount(0),
+      mExecutedBatchCount(0),
+      mTerminating(false)
+{
+    mWorkerThread = std::thread(&CommandStream::processBatches, this);
+}
+
+CommandStream::~CommandStream()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTerminating = true;
+    }
+    mBatchSubmitted.notify_one();
+    mWorkerThread.join();
+}
+
+void *CommandStream::allocateCommand(ExecuteFunction execute,
+                                     size_t paramsSize,
+                                     const void *data,
+                                     size_t dataSize)
+{
+    ASSERT(isProducerThread());
+
+    const size_t fixedSize = sizeof(CommandHeader) + paramsSize;
+    ASSERT(fixedSize <= kBatchSize);
+    if (dataSize > kBatchSize - fixedSize)
+    {
+        return nullptr;
+    }
+    const size_t commandSize = rx::roundUpPow2(fixedSize + dataSize, kCommandAlignment);
+
+    // Take the copy of the state needed to record draws before the worker starts changing it.
+    if (mIdle)
+    {
+        refreshDrawState();
+        mIdle = false;
+    }
+
+    if (mBatchOffset + commandSize > kBatchSize)
+    {
+        submitBatch();
+    }
+
+    uint8_t *command = mBatches[mSubmittedBatchCount % kBatchCount].data.data() + mBatchOffset;
+    mBatchOffset += commandSize;
+
+    CommandHeader *header = reinterpret_cast<CommandHeader *>(command);
+    header->execute       = execute;
+    header->size          = commandSize;
+
+    uint8_t *params = reinterpret_cast<uint8_t *>(header + 1);
+    if (dataSize > 0)
+    {
+        memcpy(params + paramsSize, data, dataSize);
+    }
+    return params;
+}
+
+void CommandStream::submitBatch()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mBatches[mSubmittedBatchCount % kBatchCount].size = mBatchOffset;
+    ++mSubmittedBatchCount;
+    mBatchOffset = 0;
+    mBatchSubmitted.notify_one();
+
+    // Wait for the batch that is recorded into next to be free.
+    mBatchExecuted.wait(
+        lock, [this] { return mSubmittedBatchCount - mExecutedBatchCount < kBatchCount; });
+}
+
+void CommandStream::finish()
+{
+    ASSERT(isProducerThread());
+
+    if (mIdle)
+    {
+        return;
+    }
+
+    if (mBatchOffset > 0)
+    {
+        submitBatch();
+    }
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mBatchExecuted.wait(lock, [this] { return mExecutedBatchCount == mSubmittedBatchCount; });
+    mIdle = true;
+}
+
+bool CommandStream::canQueueDrawArrays()
+{
+    if (mIdle)
+    {
+        refreshDrawState();
+    }
+    return !mHasEnabledClientAttribs;
+}
+
+bool CommandStream::canQueueDrawElements()
+{
+    if (mIdle)
+    {
+        refreshDrawState();
+    }
+    return !mHasEnabledClientAttribs && mHasElementArrayBuffer;
+}
+
+void CommandStream::refreshDrawState()
+{
+    mHasEnabledClientAttribs = mContext->hasAnyEnabledClientAttrib();
+    mHasElementArrayBuffer =
+        mContext->getState().getVertexArray()->getElementArrayBuffer() != nullptr;
+}
+
+void CommandStream::processBatches()
+{
+    angle::SetCurrentThreadName("ANGLE-Commands");
+
+    // The recorded calls go through the regular entry points, which execute them directly since
+    // this is not a producer thread.  Only the frontend's current context is set; the extension is
+    // only exposed by backends that don't need anything made current on the executing thread.
+    SetCurrentValidContext(mContext);
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        mBatchSubmitted.wait(
+            lock, [this] { return mTerminating || mExecutedBatchCount < mSubmittedBatchCount; });
+        if (mTerminating)
+        {
+            break;
+        }
+
+        const Batch &batch = mBatches[mExecutedBatchCount % kBatchCount];
+        lock.unlock();
+        executeBatch(batch);
+        lock.lock();
+
+        ++mExecutedBatchCount;
+        mBatchExecuted.notify_one();
+    }
+
+    SetCurrentValidContext(nullptr);
+}
+
+void CommandStream::executeBatch(const Batch &batch)
+{
+    for (size_t offset = 0; offset < batch.size;)
+    {
+        const CommandHeader *header =
+            reinterpret_cast<const CommandHeader *>(batch.data.data() + offset);
+        header->execute(header + 1);
+        offset += header->size;
+    }
+}
+}  // namespace gl
@@ -0,0 +1,130 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CommandStream.h: Defines the gl::CommandStream class, which records the GL calls made on the
+// thread a context is current to, and executes them on a thread dedicated to the context.
+
+#ifndef LIBANGLE_COMMANDSTREAM_H_
+#define LIBANGLE_COMMANDSTREAM_H_
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+#include "common/angleutils.h"
+#include "common/mathutil.h"
+
+namespace gl
+{
+class Context;
+
+// Calls are recorded in fixed size batches.  A batch is handed to the worker thread once it is
+// full, or when the application thread needs the effects of the recorded calls, which is the case
+// for every call that is not recorded.  The worker executes each call through its regular entry
+// point with the context current to it, so validation and errors behave as if the call had been
+// made directly.
+class CommandStream final : angle::NonCopyable
+{
+  public:
+    // Executes a recorded call, given its parameters.
+    using ExecuteFunction = void (*)(const void *params);
+
+    static constexpr size_t kBatchSize  = 4096;
+    static constexpr size_t kBatchCount = 16;
+
+    explicit CommandStream(Context *context);
+    // Calls that are not executed yet are dropped.
+    ~CommandStream();
+
+    // Calls are recorded on any thread but the worker.
+    bool isProducerThread() const { return std::this_thread::get_id() != mWorkerThread.get_id(); }
+
+    // Records a call executed by |execute|, and returns storage for its parameters.
+    template <typename ParamsT>
+    ParamsT *allocate(ExecuteFunction execute)
+    {
+        static_assert(std::is_trivially_copyable<ParamsT>::value);
+        static_assert(alignof(ParamsT) <= kCommandAlignment);
+        return static_cast<ParamsT *>(allocateCommand(execute, sizeof(ParamsT), nullptr, 0));
+    }
+
+    // Same as above, with the parameters followed by a copy of the |dataSize| bytes at |data|.
+    // Returns nullptr if there is no data or if it is too large to be recorded.
+    template <typename ParamsT>
+    ParamsT *allocate(ExecuteFunction execute,
+                      const void *data,
+                      const angle::CheckedNumeric<size_t> &dataSize)
+    {
+        static_assert(std::is_trivially_copyable<ParamsT>::value);
+        static_assert(alignof(ParamsT) <= kCommandAlignment);
+        if (data == nullptr || !dataSize.IsValid())
+        {
+            return nullptr;
+        }
+        return static_cast<ParamsT *>(
+            allocateCommand(execute, sizeof(ParamsT), data, dataSize.ValueOrDie()));
+    }
+
+    // Waits until every recorded call is executed.
+    void finish();
+
+    // Draw calls are recorded only if they don't read from client memory, which the application
+    // may change as soon as the call returns.  This is answered from a copy of the vertex array
+    // state taken when the worker was last idle.  The copy stays valid because the calls that
+    // could change it are never recorded.
+    bool canQueueDrawArrays();
+    bool canQueueDrawElements();
+
+  private:
+    static constexpr size_t kCommandAlignment = alignof(std::max_align_t);
+
+    struct alignas(kCommandAlignment) CommandHeader
+    {
+        ExecuteFunction execute;
+        size_t size;
+    };
+
+    struct alignas(kCommandAlignment) Batch
+    {
+        std::array<uint8_t, kBatchSize> data;
+        size_t size;
+    };
+
+    void *allocateCommand(ExecuteFunction execute,
+                          size_t paramsSize,
+                          const void *data,
+                          size_t dataSize);
+    void submitBatch();
+    void refreshDrawState();
+
+    void processBatches();
+    void executeBatch(const Batch &batch);
+
+    Context *const mContext;
+
+    // Only used by the application thread.  The worker is idle when nothing was recorded since the
+    // last finish().
+    size_t mBatchOffset;
+    bool mIdle;
+    bool mHasEnabledClientAttribs;
+    bool mHasElementArrayBuffer;
+
+    std::mutex mMutex;
+    std::condition_variable mBatchSubmitted;
+    std::condition_variable mBatchExecuted;
+    uint64_t mSubmittedBatchCount;
+    uint64_t mExecutedBatchCount;
+    bool mTerminating;
+
+    std::array<Batch, kBatchCount> mBatches;
+
+    std::thread mWorkerThread;
+};
+}  // namespace gl
+
+#endif  // LIBANGLE_COMMANDSTREAM_H_
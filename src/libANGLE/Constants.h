@@ -19,6 +19,9 @@ namespace gl
 // The binary cache is currently left disable by default, and the application can enable it.
 const size_t kDefaultMaxProgramCacheMemoryBytes = 0;
 
+// The size limit of the disk program cache, see EGL_ANGLE_disk_program_cache.
+const size_t kDefaultMaxDiskProgramCacheBytes = 64 * 1024 * 1024;
+
 enum
 {
     // Implementation upper limits, real maximums depend on the hardware
@@ -394,6 +394,11 @@ bool GetPassthroughShaders(egl::Display *display, const egl::AttributeMap &attri
            static_cast<bool>(attribs.getAsInt(EGL_CONTEXT_PASSTHROUGH_SHADERS_ANGLE, EGL_FALSE));
 }
 
+bool GetThreadedCommands(const egl::AttributeMap &attribs)
+{
+    return static_cast<bool>(attribs.getAsInt(EGL_CONTEXT_THREADED_COMMANDS_ANGLE, EGL_FALSE));
+}
+
 std::string GetObjectLabelFromPointer(GLsizei length, const GLchar *label)
 {
     std::string labelName;
@@ -738,7 +743,11 @@ Context::Context(egl::Display *display,
       mFrameCapture(new angle::FrameCapture),
       mRefCount(0),
       mIsDestroyed(false),
-      mDestroyedManagers(false)
+      mDestroyedManagers(false),
+      mCoalesceDrawElements(display->getFrontendFeatures().coalesceDrawElements.enabled),
+      mDefersCalls(mCoalesceDrawElements || GetThreadedCommands(attribs)),
+      mPendingDrawMode(PrimitiveMode::InvalidEnum),
+      mPendingDrawType(DrawElementsType::InvalidEnum)
 {
     for (angle::SubjectIndex uboIndex = kUniformBuffer0SubjectIndex;
          uboIndex < kUniformBufferMaxSubjectIndex; ++uboIndex)
@@ -770,6 +779,11 @@ Context::Context(egl::Display *display,
         mImageObserverBindings.emplace_back(this, imageIndex);
     }
 
+    if (GetThreadedCommands(attribs))
+    {
+        mCommandStream = std::make_unique<CommandStream>(this);
+    }
+
     // Implementations now require the display to be set at context creation.
     ASSERT(mDisplay);
 }
@@ -932,6 +946,10 @@ void Context::initializeDefaultResources()
 
 egl::Error Context::onDestroy(const egl::Display *display)
 {
+    // The EGL calls that make the context not current wait for the recorded calls, so there is
+    // nothing left to execute.
+    mCommandStream.reset();
+
     if (!mHasBeenCurrent)
     {
         // Shared objects and ShareGroup must be released regardless.
@@ -1127,6 +1145,13 @@ egl::Error Context::makeCurrent(egl::Display *display,
 
 egl::Error Context::unMakeCurrent(const egl::Display *display)
 {
+    // The EGL calls flush the deferred draws already, but the context can also be released when
+    // its thread exits.
+    if (hasPendingDraws())
+    {
+        flushPendingDraws();
+    }
+
     ANGLE_TRY(angle::ResultToEGL(mImplementation->onUnMakeCurrent(this)));
 
     ANGLE_TRY(unsetDefaultFramebuffer());
@@ -3079,6 +3104,30 @@ void Context::drawArraysInstanced(PrimitiveMode mode,
     MarkShaderStorageUsage(this);
 }
 
+void Context::flushPendingDraws()
+{
+    ASSERT(hasPendingDraws());
+
+    // The draws of a lost context are dropped.
+    const angle::Result result = isContextLost() ? angle::Result::Continue : drawPendingDraws();
+    mPendingDrawCounts.clear();
+    mPendingDrawIndices.clear();
+    ANGLE_CONTEXT_TRY(result);
+}
+
+angle::Result Context::drawPendingDraws()
+{
+    ANGLE_TRY(prepareForDraw(mPendingDrawMode));
+    if (mPendingDrawCounts.size() == 1)
+    {
+        return mImplementation->drawElements(this, mPendingDrawMode, mPendingDrawCounts[0],
+                                             mPendingDrawType, mPendingDrawIndices[0]);
+    }
+    return mImplementation->multiDrawElements(this, mPendingDrawMode, mPendingDrawCounts.data(),
+                                              mPendingDrawType, mPendingDrawIndices.data(),
+                                              static_cast<GLsizei>(mPendingDrawCounts.size()));
+}
+
 void Context::drawElementsInstanced(PrimitiveMode mode,
                                     GLsizei count,
                                     DrawElementsType type,
@@ -7252,49 +7301,33 @@ void Context::detachShader(ShaderProgramID program, ShaderProgramID shader)
 
 void Context::genBuffers(GLsizei n, BufferID *buffers)
 {
-    for (int i = 0; i < n; i++)
+    if (!mState.mBufferManager->createEmptyObjects(static_cast<size_t>(n), buffers))
     {
-        if (!createBuffer(&buffers[i]))
-        {
-            handleExhaustionError(angle::EntryPoint::GLGenBuffers);
-            return;
-        }
+        handleExhaustionError(angle::EntryPoint::GLGenBuffers);
     }
 }
 
 void Context::genFramebuffers(GLsizei n, FramebufferID *framebuffers)
 {
-    for (int i = 0; i < n; i++)
+    if (!mState.mFramebufferManager->createEmptyObjects(static_cast<size_t>(n), framebuffers))
     {
-        if (!createFramebuffer(&framebuffers[i]))
-        {
-            handleExhaustionError(angle::EntryPoint::GLGenFramebuffers);
-            return;
-        }
+        handleExhaustionError(angle::EntryPoint::GLGenFramebuffers);
     }
 }
 
 void Context::genRenderbuffers(GLsizei n, RenderbufferID *renderbuffers)
 {
-    for (int i = 0; i < n; i++)
+    if (!mState.mRenderbufferManager->createEmptyObjects(static_cast<size_t>(n), renderbuffers))
     {
-        if (!createRenderbuffer(&renderbuffers[i]))
-        {
-            handleExhaustionError(angle::EntryPoint::GLGenRenderbuffers);
-            return;
-        }
+        handleExhaustionError(angle::EntryPoint::GLGenRenderbuffers);
     }
 }
 
 void Context::genTextures(GLsizei n, TextureID *textures)
 {
-    for (int i = 0; i < n; i++)
+    if (!mState.mTextureManager->createEmptyObjects(static_cast<size_t>(n), textures))
     {
-        if (!createTexture(&textures[i]))
-        {
-            handleExhaustionError(angle::EntryPoint::GLGenTextures);
-            return;
-        }
+        handleExhaustionError(angle::EntryPoint::GLGenTextures);
     }
 }
 
@@ -8289,13 +8322,9 @@ void Context::getBufferParameteri64vRobust(BufferBinding target,
 
 void Context::genSamplers(GLsizei count, SamplerID *samplers)
 {
-    for (int i = 0; i < count; i++)
+    if (!mState.mSamplerManager->createEmptyObjects(static_cast<size_t>(count), samplers))
     {
-        if (!mState.mSamplerManager->createSampler(&samplers[i]))
-        {
-            handleExhaustionError(angle::EntryPoint::GLGenSamplers);
-            return;
-        }
+        handleExhaustionError(angle::EntryPoint::GLGenSamplers);
     }
 }
 
@@ -8684,13 +8713,9 @@ bool Context::isCurrentTransformFeedback(const TransformFeedback *tf) const
 
 void Context::genProgramPipelines(GLsizei count, ProgramPipelineID *pipelines)
 {
-    for (int i = 0; i < count; i++)
+    if (!mState.mProgramPipelineManager->createEmptyObjects(static_cast<size_t>(count), pipelines))
     {
-        if (!createProgramPipeline(&pipelines[i]))
-        {
-            handleExhaustionError(angle::EntryPoint::GLGenProgramPipelines);
-            return;
-        }
+        handleExhaustionError(angle::EntryPoint::GLGenProgramPipelines);
     }
 }
 
@@ -9510,8 +9535,35 @@ std::shared_ptr<angle::WaitableEvent> Context::postCompileLinkTask(
         return event;
     }
 
-    // Otherwise, just schedule the task on the pool
-    return workerPool->postWorkerTask(task);
+    // Otherwise, just schedule the task on the pool.  The application is likely to block on the
+    // results soon, so let it preempt background work.
+    return workerPool->postWorkerTaskWithPriority(task, angle::WorkerTaskPriority::High);
+}
+
+std::shared_ptr<angle::WaitableEvent> Context::postCompileTask(
+    const std::shared_ptr<angle::Closure> &task,
+    angle::JobThreadSafety safety,
+    angle::JobResultExpectancy resultExpectancy) const
+{
+    // Without GL_KHR_parallel_shader_compile, a compile job is done as a tail call of the
+    // glCompileShader call, so the shaders of a program are compiled one after the other.  If the
+    // job is thread-safe, it can instead be threaded regardless, so that all the stages of the
+    // program compile concurrently (each with its own compiler instance) by the time it is linked.
+    // This is not done if the application explicitly asked for no parallel compiling through
+    // glMaxShaderCompilerThreadsKHR(0).
+    const bool parallelCompileDisabled = mState.getExtensions().parallelShaderCompileKHR &&
+                                         mState.getMaxShaderCompilerThreads() == 0;
+    if (safety == angle::JobThreadSafety::Safe &&
+        getFrontendFeatures().alwaysRunCompileJobsThreaded.enabled && !parallelCompileDisabled)
+    {
+        std::shared_ptr<angle::WorkerThreadPool> workerPool = getWorkerThreadPool();
+        if (workerPool->isAsync())
+        {
+            return workerPool->postWorkerTaskWithPriority(task, angle::WorkerTaskPriority::High);
+        }
+    }
+
+    return postCompileLinkTask(task, safety, resultExpectancy);
 }
 
 std::shared_ptr<angle::WorkerThreadPool> Context::getSingleThreadPool() const
@@ -10605,6 +10657,7 @@ StateCache::StateCache()
       mCachedBasicDrawStatesErrorString(kInvalidPointer),
       mCachedBasicDrawStatesErrorCode(GL_NO_ERROR),
       mCachedProgramPipelineError(kInvalidPointer),
+      mLastValidatedDrawKey(kNoValidatedDraw),
       mCachedHasAnyEnabledClientAttrib(false),
       mCachedTransformFeedbackActiveUnpaused(false),
       mCachedCanDraw(false)
@@ -10722,6 +10775,7 @@ intptr_t StateCache::getBasicDrawStatesErrorImpl(const Context *context,
     mCachedBasicDrawStatesErrorString =
         reinterpret_cast<intptr_t>(ValidateDrawStates(context, &errorCode));
     mCachedBasicDrawStatesErrorCode = errorCode;
+    mLastValidatedDrawKey           = kNoValidatedDraw;
 
     // Ensure that if an error is set mCachedBasicDrawStatesErrorCode must be GL_NO_ERROR and if no
     // error is set mCachedBasicDrawStatesErrorCode must be an error.
@@ -10821,6 +10875,8 @@ void StateCache::setValidDrawModes(bool pointsOK,
 
 void StateCache::updateValidDrawModes(Context *context)
 {
+    mLastValidatedDrawKey = kNoValidatedDraw;
+
     const State &state = context->getState();
 
     const ProgramExecutable *programExecutable = context->getState().getProgramExecutable();
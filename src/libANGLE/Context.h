@@ -11,17 +11,20 @@
 #ifndef LIBANGLE_CONTEXT_H_
 #define LIBANGLE_CONTEXT_H_
 
+#include <limits>
 #include <mutex>
 #include <set>
 #include <string>
 #include "common/unsafe_buffers.h"
 
 #include "angle_gl.h"
+#include "common/FastVector.h"
 #include "common/MemoryBuffer.h"
 #include "common/PackedEnums.h"
 #include "common/SimpleMutex.h"
 #include "common/angleutils.h"
 #include "libANGLE/Caps.h"
+#include "libANGLE/CommandStream.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Context_gles_1_0_autogen.h"
 #include "libANGLE/Context_gles_2_0_autogen.h"
@@ -253,6 +256,8 @@ class PrivateStateCache final : angle::NonCopyable
         ASSERT(isCachedBasicDrawElementsErrorValid());
         return mCachedBasicDrawElementsError;
     }
+    // Whether the cached value is valid and has no error.
+    bool hasNoBasicDrawElementsError() const { return mCachedBasicDrawElementsError == 0; }
     void invalidateCachedBasicDrawElementsError()
     {
         mCachedBasicDrawElementsError = kInvalidPointer;
@@ -411,6 +416,30 @@ class StateCache final : angle::NonCopyable
         return mCachedBasicDrawStatesErrorCode;
     }
 
+    // The draw mode and index type of the last draw call that passed the basic draw states and draw
+    // mode checks (and, for indexed draws, the draw elements states and index type checks).  A
+    // draw call with the same parameters can skip these checks as long as the cached results
+    // they rely on stay valid.  The record is dropped whenever the basic draw states error or the
+    // valid draw modes are updated, and non-indexed draws are recorded with
+    // DrawElementsType::InvalidEnum.
+    bool isLastValidatedDraw(const PrivateStateCache *privateStateCache, PrimitiveMode mode) const
+    {
+        return privateStateCache->isCachedBasicDrawStatesErrorValid() &&
+               mLastValidatedDrawKey == GetValidatedDrawKey(mode, DrawElementsType::InvalidEnum);
+    }
+    bool isLastValidatedDrawElements(const PrivateStateCache *privateStateCache,
+                                     PrimitiveMode mode,
+                                     DrawElementsType type) const
+    {
+        return privateStateCache->isCachedBasicDrawStatesErrorValid() &&
+               privateStateCache->hasNoBasicDrawElementsError() &&
+               mLastValidatedDrawKey == GetValidatedDrawKey(mode, type);
+    }
+    void setLastValidatedDraw(PrimitiveMode mode, DrawElementsType type) const
+    {
+        mLastValidatedDrawKey = GetValidatedDrawKey(mode, type);
+    }
+
     // Places that can trigger updateProgramPipelineError:
     // 1. onProgramExecutableChange.
     intptr_t getProgramPipelineError(const Context *context) const
@@ -493,6 +522,7 @@ class StateCache final : angle::NonCopyable
     {
         mCachedBasicDrawStatesErrorString = kInvalidPointer;
         mCachedBasicDrawStatesErrorCode   = GL_NO_ERROR;
+        mLastValidatedDrawKey             = kNoValidatedDraw;
     }
     void updateProgramPipelineError() { mCachedProgramPipelineError = kInvalidPointer; }
     void updateTransformFeedbackActiveUnpaused(Context *context);
@@ -511,7 +541,13 @@ class StateCache final : angle::NonCopyable
                                          const PrivateStateCache *privateStateCache) const;
     intptr_t getProgramPipelineErrorImpl(const Context *context) const;
 
-    static constexpr intptr_t kInvalidPointer = 1;
+    static constexpr uint32_t GetValidatedDrawKey(PrimitiveMode mode, DrawElementsType type)
+    {
+        return static_cast<uint32_t>(mode) << 8 | static_cast<uint32_t>(type);
+    }
+
+    static constexpr intptr_t kInvalidPointer  = 1;
+    static constexpr uint32_t kNoValidatedDraw = std::numeric_limits<uint32_t>::max();
 
     AttributesMask mCachedActiveBufferedAttribsMask;
     AttributesMask mCachedActiveClientAttribsMask;
@@ -574,6 +610,7 @@ class StateCache final : angle::NonCopyable
     // mCachedProgramPipelineError can be no-error or also in error, or
     // unknown due to early exiting.
     mutable intptr_t mCachedProgramPipelineError;
+    mutable uint32_t mLastValidatedDrawKey;
     bool mCachedHasAnyEnabledClientAttrib;
     bool mCachedTransformFeedbackActiveUnpaused;
     StorageBuffersMask mCachedActiveShaderStorageBufferIndices;
@@ -852,6 +889,10 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
         const std::shared_ptr<angle::Closure> &task,
         angle::JobThreadSafety safety,
         angle::JobResultExpectancy resultExpectancy) const;
+    std::shared_ptr<angle::WaitableEvent> postCompileTask(
+        const std::shared_ptr<angle::Closure> &task,
+        angle::JobThreadSafety safety,
+        angle::JobResultExpectancy resultExpectancy) const;
 
     // Single-threaded pool; runs everything instantly
     std::shared_ptr<angle::WorkerThreadPool> getSingleThreadPool() const;
@@ -938,6 +979,32 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     bool isDestroyed() const { return mIsDestroyed; }
     void setIsDestroyed() { mIsDestroyed = true; }
 
+    // Set if the context was created with EGL_CONTEXT_THREADED_COMMANDS_ANGLE.
+    CommandStream *getCommandStream() const { return mCommandStream.get(); }
+    // Whether calls made on this thread may be recorded in the command stream instead of being
+    // executed right away.
+    bool queuesCommands() const
+    {
+        return mCommandStream != nullptr && mCommandStream->isProducerThread();
+    }
+
+    // Consecutive drawElements() calls that can be drawn together are deferred and submitted as a
+    // single multi-draw.  Every entry point but glDrawElements flushes them before doing anything
+    // else, so the deferred draws always execute with the state they were made with.
+    bool hasPendingDraws() const { return !mPendingDrawCounts.empty(); }
+    void flushPendingDraws();
+
+    // Whether the calls made to this context may be recorded in its command stream or deferred as
+    // pending draws.  If not, the entry points don't need to check for either.
+    bool defersCalls() const { return mDefersCalls; }
+
+    // Same as drawElements(), but never defers the draw.  Used when the context may not be current
+    // on the calling thread, in which case nothing would flush it.
+    void drawElementsImmediate(PrimitiveMode mode,
+                               GLsizei count,
+                               DrawElementsType type,
+                               const void *indices);
+
     // This function acts as glEnable(GL_COLOR_LOGIC_OP), but it's called from the GLES1 emulation
     // code to implement logicOp using the non-GLES1 functionality (i.e. GL_ANGLE_logic_op).  The
     // ContextPrivateEnable() entry point implementation cannot be used (as ContextPrivate*
@@ -999,6 +1066,8 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     void releaseSharedObjects();
 
     angle::Result prepareForDraw(PrimitiveMode mode);
+    bool canDeferDrawElements() const;
+    angle::Result drawPendingDraws();
     angle::Result prepareForClear(GLbitfield mask);
     angle::Result prepareForClearBuffer(GLenum buffer, GLint drawbuffer);
     angle::Result syncState(const state::DirtyBits bitMask,
@@ -1179,6 +1248,17 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     bool mDestroyedManagers;
 
     std::unique_ptr<Framebuffer> mDefaultFramebuffer;
+
+    std::unique_ptr<CommandStream> mCommandStream;
+
+    // The draws deferred by drawElements(), which all have the same mode and index type.
+    static constexpr size_t kMaxPendingDraws = 64;
+    const bool mCoalesceDrawElements;
+    const bool mDefersCalls;
+    PrimitiveMode mPendingDrawMode;
+    DrawElementsType mPendingDrawType;
+    angle::FastVector<GLsizei, kMaxPendingDraws> mPendingDrawCounts;
+    angle::FastVector<const void *, kMaxPendingDraws> mPendingDrawIndices;
 };
 
 class [[nodiscard]] ScopedContextRef
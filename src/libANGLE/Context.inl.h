@@ -158,6 +158,16 @@ ANGLE_INLINE angle::Result Context::prepareForDraw(PrimitiveMode mode)
     return syncDirtyBits(kDrawDirtyBits, kDrawExtendedDirtyBits, Command::Draw);
 }
 
+// Deferred draws must not read client memory, which the application may change as soon as the
+// call returns, nor depend on which draw of the multi-draw they are.
+ANGLE_INLINE bool Context::canDeferDrawElements() const
+{
+    return mCoalesceDrawElements && mGLES1Renderer == nullptr &&
+           mState.getVertexArray()->getElementArrayBuffer() != nullptr &&
+           !hasAnyEnabledClientAttrib() && !mStateCache.isTransformFeedbackActiveUnpaused() &&
+           !mState.getProgramExecutable()->hasDrawIDUniform();
+}
+
 ANGLE_INLINE void Context::drawArrays(PrimitiveMode mode, GLint first, GLsizei count)
 {
     // No-op if count draws no primitives for given mode
@@ -177,6 +187,33 @@ ANGLE_INLINE void Context::drawElements(PrimitiveMode mode,
                                         DrawElementsType type,
                                         const void *indices)
 {
+    if (!noopDraw(mode, count) && canDeferDrawElements())
+    {
+        if (hasPendingDraws() && (mode != mPendingDrawMode || type != mPendingDrawType ||
+                                  mPendingDrawCounts.size() == kMaxPendingDraws))
+        {
+            flushPendingDraws();
+        }
+        mPendingDrawMode = mode;
+        mPendingDrawType = type;
+        mPendingDrawCounts.push_back(count);
+        mPendingDrawIndices.push_back(indices);
+        return;
+    }
+
+    drawElementsImmediate(mode, count, type, indices);
+}
+
+ANGLE_INLINE void Context::drawElementsImmediate(PrimitiveMode mode,
+                                                 GLsizei count,
+                                                 DrawElementsType type,
+                                                 const void *indices)
+{
+    if (ANGLE_UNLIKELY(hasPendingDraws()))
+    {
+        flushPendingDraws();
+    }
+
     // No-op if count draws no primitives for given mode
     if (noopDraw(mode, count))
     {
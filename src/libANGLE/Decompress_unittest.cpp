@@ -115,5 +115,74 @@ TEST_F(DecompressTest, CorruptedLastDWord)
     EXPECT_TRUE(checkUncompressedData());
 }
 
+class CodecDecompressTest : public ::testing::TestWithParam<BlobCompressionCodec>
+{
+  protected:
+    void SetUp() override
+    {
+        // Compressible data, so that LZ matches are exercised.
+        constexpr size_t kTestDataSize = 100'000;
+        mTestData.resize(kTestDataSize);
+        for (size_t i = 0; i < kTestDataSize; ++i)
+        {
+            mTestData[i] = static_cast<uint8_t>((i * i) >> 10);
+        }
+
+        ASSERT_TRUE(CompressBlob(mTestData.size(), mTestData.data(), GetParam(), &mCompressedData));
+    }
+
+    bool decompress(size_t compressedSize, size_t maxUncompressedDataSize)
+    {
+        return DecompressBlob(mCompressedData.data(), compressedSize, maxUncompressedDataSize,
+                              &mUncompressedData);
+    }
+
+    std::vector<uint8_t> mTestData;
+    MemoryBuffer mCompressedData;
+    MemoryBuffer mUncompressedData;
+};
+
+// Tests that data compressed with every codec decompresses to the original data.
+TEST_P(CodecDecompressTest, RoundTrip)
+{
+    EXPECT_LT(mCompressedData.size(), mTestData.size());
+    ASSERT_TRUE(decompress(mCompressedData.size(), mTestData.size()));
+    ASSERT_EQ(mUncompressedData.size(), mTestData.size());
+    EXPECT_EQ(ANGLE_UNSAFE_TODO(memcmp(mTestData.data(), mUncompressedData.data(), mTestData.size())),
+              0);
+}
+
+// Tests expected failures with every codec if the data is truncated or too large.
+TEST_P(CodecDecompressTest, Failures)
+{
+    EXPECT_FALSE(decompress(mCompressedData.size(), mTestData.size() - 1));
+    EXPECT_FALSE(decompress(mCompressedData.size() - 1, std::numeric_limits<size_t>::max()));
+    EXPECT_FALSE(decompress(mCompressedData.size() / 2, std::numeric_limits<size_t>::max()));
+}
+
+// Tests that the zlib codecs produce the same gzip format that ANGLE has always stored, so
+// entries cached by older versions remain readable.
+TEST(CompressBlobTest, ZlibCodecsAreGzip)
+{
+    const std::vector<uint8_t> testData(1000, 1);
+    for (BlobCompressionCodec codec :
+         {BlobCompressionCodec::ZlibFastest, BlobCompressionCodec::ZlibDefault,
+          BlobCompressionCodec::ZlibBest})
+    {
+        MemoryBuffer compressedData;
+        ASSERT_TRUE(CompressBlob(testData.size(), testData.data(), codec, &compressedData));
+        ASSERT_GE(compressedData.size(), 2u);
+        EXPECT_EQ(compressedData[0], 0x1F);
+        EXPECT_EQ(compressedData[1], 0x8B);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         CodecDecompressTest,
+                         ::testing::Values(BlobCompressionCodec::ZlibFastest,
+                                           BlobCompressionCodec::ZlibDefault,
+                                           BlobCompressionCodec::ZlibBest,
+                                           BlobCompressionCodec::LZ));
+
 }  // anonymous namespace
 }  // namespace angle
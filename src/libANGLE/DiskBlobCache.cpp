@@ -0,0 +1,680 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskBlobCache: A persistent, size-limited blob cache stored in a directory.
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+#include "libANGLE/DiskBlobCache.h"
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "common/system_utils.h"
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+
+namespace egl
+{
+namespace
+{
+constexpr uint32_t kIndexMagic   = 0x43504E41;  // "ANPC"
+constexpr uint32_t kIndexVersion = 1;
+// Must be a power of two.  The table is never filled beyond three quarters.
+constexpr uint32_t kEntryCapacity = 4096;
+
+constexpr int kInvalidFd = -1;
+
+// Thin wrappers around the file operations the cache needs.  The cache is only supported on POSIX
+// platforms; elsewhere, opening a file fails and the cache is not used.
+#if defined(ANGLE_PLATFORM_POSIX)
+int OpenFile(const std::string &path, bool truncate)
+{
+    int flags = O_RDWR | O_CREAT | O_CLOEXEC;
+    if (truncate)
+    {
+        flags |= O_TRUNC;
+    }
+    int fd;
+    do
+    {
+        fd = open(path.c_str(), flags, 0600);
+    } while (fd < 0 && errno == EINTR);
+    return fd;
+}
+
+void CloseFile(int fd)
+{
+    close(fd);
+}
+
+bool LockFile(int fd)
+{
+    int result;
+    do
+    {
+        result = flock(fd, LOCK_EX);
+    } while (result != 0 && errno == EINTR);
+    return result == 0;
+}
+
+void UnlockFile(int fd)
+{
+    flock(fd, LOCK_UN);
+}
+
+bool GetFileSize(int fd, uint64_t *sizeOut)
+{
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0)
+    {
+        return false;
+    }
+    *sizeOut = static_cast<uint64_t>(fileStat.st_size);
+    return true;
+}
+
+bool ResizeFile(int fd, uint64_t size)
+{
+    return ftruncate(fd, static_cast<off_t>(size)) == 0;
+}
+
+bool ReadFile(int fd, uint64_t offset, void *data, size_t size)
+{
+    uint8_t *dst = static_cast<uint8_t *>(data);
+    while (size > 0)
+    {
+        const ssize_t result = pread(fd, dst, size, static_cast<off_t>(offset));
+        if (result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (result <= 0)
+        {
+            return false;
+        }
+        dst += result;
+        offset += result;
+        size -= result;
+    }
+    return true;
+}
+
+bool WriteFile(int fd, uint64_t offset, const void *data, size_t size)
+{
+    const uint8_t *src = static_cast<const uint8_t *>(data);
+    while (size > 0)
+    {
+        const ssize_t result = pwrite(fd, src, size, static_cast<off_t>(offset));
+        if (result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (result <= 0)
+        {
+            return false;
+        }
+        src += result;
+        offset += result;
+        size -= result;
+    }
+    return true;
+}
+
+bool SyncFile(int fd)
+{
+    return fsync(fd) == 0;
+}
+
+bool RenameFile(const std::string &from, const std::string &to)
+{
+    return rename(from.c_str(), to.c_str()) == 0;
+}
+
+void *MapFile(int fd, size_t size)
+{
+    void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    return mapping == MAP_FAILED ? nullptr : mapping;
+}
+
+void UnmapFile(void *mapping, size_t size)
+{
+    munmap(mapping, size);
+}
+#else
+int OpenFile(const std::string &path, bool truncate)
+{
+    return kInvalidFd;
+}
+void CloseFile(int fd) {}
+bool LockFile(int fd)
+{
+    return false;
+}
+void UnlockFile(int fd) {}
+bool GetFileSize(int fd, uint64_t *sizeOut)
+{
+    return false;
+}
+bool ResizeFile(int fd, uint64_t size)
+{
+    return false;
+}
+bool ReadFile(int fd, uint64_t offset, void *data, size_t size)
+{
+    return false;
+}
+bool WriteFile(int fd, uint64_t offset, const void *data, size_t size)
+{
+    return false;
+}
+bool SyncFile(int fd)
+{
+    return false;
+}
+bool RenameFile(const std::string &from, const std::string &to)
+{
+    return false;
+}
+void *MapFile(int fd, size_t size)
+{
+    return nullptr;
+}
+void UnmapFile(void *mapping, size_t size) {}
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+
+uint32_t GetKeyHash(const angle::BlobCacheKey &key)
+{
+    // The key is itself a hash, so any of its bits are well distributed.
+    uint32_t hash;
+    memcpy(&hash, key.data(), sizeof(hash));
+    return hash;
+}
+}  // anonymous namespace
+
+struct DiskBlobCache::IndexHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    // The layout of the entries, which depends on the build configuration.
+    uint32_t keyLength;
+    uint32_t entrySize;
+    uint32_t entryCapacity;
+    uint32_t entryCount;
+    // Incremented every time the data file is replaced.
+    uint64_t dataGeneration;
+    // The end of the last blob written to the data file.  Anything beyond is garbage left by a
+    // process that died while writing.
+    uint64_t dataSize;
+    // The total size of the blobs referenced by the index.
+    uint64_t liveSize;
+    // Incremented on every use of a blob, to find the least recently used one.
+    uint64_t useCounter;
+};
+
+struct DiskBlobCache::IndexEntry
+{
+    angle::BlobCacheKey key;
+    uint32_t crc;
+    uint64_t offset;
+    uint64_t lastUse;
+    uint32_t size;
+    uint32_t used;
+};
+
+// Serializes access to the cache files with other processes.
+class DiskBlobCache::FileLock final : angle::NonCopyable
+{
+  public:
+    FileLock(int fd) : mFd(fd), mLocked(LockFile(fd)) {}
+    ~FileLock()
+    {
+        if (mLocked)
+        {
+            UnlockFile(mFd);
+        }
+    }
+
+    bool isLocked() const { return mLocked; }
+
+  private:
+    int mFd;
+    bool mLocked;
+};
+
+// static
+std::unique_ptr<DiskBlobCache> DiskBlobCache::Open(const std::string &directory,
+                                                   size_t maxSizeBytes)
+{
+    if (directory.empty() || maxSizeBytes == 0 || !angle::CreateDirectories(directory))
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<DiskBlobCache> cache(new DiskBlobCache(directory, maxSizeBytes));
+    if (!cache->initialize())
+    {
+        WARN() << "Failed to open the disk blob cache in " << directory;
+        return nullptr;
+    }
+    return cache;
+}
+
+DiskBlobCache::DiskBlobCache(const std::string &directory, size_t maxSizeBytes)
+    : mMaxSize(std::min<size_t>(maxSizeBytes, std::numeric_limits<uint32_t>::max())),
+      mIndexFd(kInvalidFd),
+      mDataFd(kInvalidFd),
+      mDataGeneration(0),
+      mIndexMapping(nullptr),
+      mIndexMappingSize(0),
+      mHeader(nullptr),
+      mEntries(nullptr)
+{
+    // The file names include the format, so that builds using different formats don't share
+    // the files.
+    const std::string baseName = angle::ConcatenatePath(
+        directory, "angle_blob_cache_v" + std::to_string(kIndexVersion) + "_k" +
+                       std::to_string(angle::kBlobCacheKeyLength));
+    mIndexPath = baseName + ".index";
+    mDataPath  = baseName + ".data";
+}
+
+DiskBlobCache::~DiskBlobCache()
+{
+    if (mIndexMapping != nullptr)
+    {
+        UnmapFile(mIndexMapping, mIndexMappingSize);
+    }
+    if (mIndexFd != kInvalidFd)
+    {
+        CloseFile(mIndexFd);
+    }
+    if (mDataFd != kInvalidFd)
+    {
+        CloseFile(mDataFd);
+    }
+}
+
+bool DiskBlobCache::initialize()
+{
+    mIndexFd = OpenFile(mIndexPath, false);
+    mDataFd  = OpenFile(mDataPath, false);
+    if (mIndexFd == kInvalidFd || mDataFd == kInvalidFd)
+    {
+        return false;
+    }
+
+    FileLock lock(mIndexFd);
+    if (!lock.isLocked() || !initializeIndex())
+    {
+        return false;
+    }
+
+    mIndexMappingSize = sizeof(IndexHeader) + sizeof(IndexEntry) * kEntryCapacity;
+    mIndexMapping     = MapFile(mIndexFd, mIndexMappingSize);
+    if (mIndexMapping == nullptr)
+    {
+        return false;
+    }
+    mHeader  = static_cast<IndexHeader *>(mIndexMapping);
+    mEntries = reinterpret_cast<IndexEntry *>(mHeader + 1);
+
+    // Recount the entries, in case a process died while updating the index.
+    uint64_t dataFileSize = 0;
+    if (!GetFileSize(mDataFd, &dataFileSize))
+    {
+        return false;
+    }
+    mHeader->dataSize   = std::min(mHeader->dataSize, dataFileSize);
+    mHeader->entryCount = 0;
+    mHeader->liveSize   = 0;
+    for (uint32_t index = 0; index < kEntryCapacity; ++index)
+    {
+        IndexEntry &entry = mEntries[index];
+        if (!entry.used)
+        {
+            continue;
+        }
+        if (entry.offset > mHeader->dataSize || entry.size > mHeader->dataSize - entry.offset)
+        {
+            // The blob was never completely written, so it will fail to be read.  The entry is
+            // not erased here, which would need the file lock to be held for longer, but it's made
+            // the first one to be evicted.
+            entry.lastUse = 0;
+        }
+        mHeader->entryCount++;
+        mHeader->liveSize += entry.size;
+    }
+
+    mDataGeneration = mHeader->dataGeneration;
+    return true;
+}
+
+bool DiskBlobCache::initializeIndex()
+{
+    const uint64_t indexSize = sizeof(IndexHeader) + sizeof(IndexEntry) * kEntryCapacity;
+
+    uint64_t fileSize = 0;
+    if (!GetFileSize(mIndexFd, &fileSize))
+    {
+        return false;
+    }
+
+    IndexHeader header = {};
+    if (fileSize == indexSize && ReadFile(mIndexFd, 0, &header, sizeof(header)) &&
+        header.magic == kIndexMagic && header.version == kIndexVersion &&
+        header.keyLength == angle::kBlobCacheKeyLength && header.entrySize == sizeof(IndexEntry) &&
+        header.entryCapacity == kEntryCapacity)
+    {
+        return true;
+    }
+
+    // The index is new or unusable.  Start over with an empty cache.
+    if (!ResizeFile(mIndexFd, 0) || !ResizeFile(mIndexFd, indexSize) || !ResizeFile(mDataFd, 0))
+    {
+        return false;
+    }
+
+    header                = {};
+    header.magic          = kIndexMagic;
+    header.version        = kIndexVersion;
+    header.keyLength      = static_cast<uint32_t>(angle::kBlobCacheKeyLength);
+    header.entrySize      = sizeof(IndexEntry);
+    header.entryCapacity  = kEntryCapacity;
+    header.dataGeneration = 1;
+    return WriteFile(mIndexFd, 0, &header, sizeof(header));
+}
+
+bool DiskBlobCache::syncDataFile()
+{
+    if (mHeader->dataGeneration == mDataGeneration)
+    {
+        return true;
+    }
+
+    CloseFile(mDataFd);
+    mDataFd = OpenFile(mDataPath, false);
+    if (mDataFd == kInvalidFd)
+    {
+        return false;
+    }
+    mDataGeneration = mHeader->dataGeneration;
+    return true;
+}
+
+DiskBlobCache::IndexEntry *DiskBlobCache::findEntry(const angle::BlobCacheKey &key)
+{
+    const uint32_t mask = kEntryCapacity - 1;
+    for (uint32_t probe = 0, index = GetKeyHash(key) & mask; probe < kEntryCapacity;
+         ++probe, index = (index + 1) & mask)
+    {
+        IndexEntry &entry = mEntries[index];
+        if (!entry.used)
+        {
+            return nullptr;
+        }
+        if (entry.key == key)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+DiskBlobCache::IndexEntry *DiskBlobCache::findFreeEntry(const angle::BlobCacheKey &key)
+{
+    const uint32_t mask = kEntryCapacity - 1;
+    for (uint32_t probe = 0, index = GetKeyHash(key) & mask; probe < kEntryCapacity;
+         ++probe, index = (index + 1) & mask)
+    {
+        if (!mEntries[index].used)
+        {
+            return &mEntries[index];
+        }
+    }
+    return nullptr;
+}
+
+void DiskBlobCache::eraseEntry(IndexEntry *entry)
+{
+    ASSERT(entry->used);
+    mHeader->entryCount--;
+    mHeader->liveSize -= entry->size;
+
+    // Shift the following entries of the probe chain back so that no tombstone is needed.
+    const uint32_t mask = kEntryCapacity - 1;
+    uint32_t hole       = static_cast<uint32_t>(entry - mEntries);
+    for (uint32_t next = (hole + 1) & mask; mEntries[next].used; next = (next + 1) & mask)
+    {
+        const uint32_t home = GetKeyHash(mEntries[next].key) & mask;
+        // Move the entry if its home slot is not between the hole and itself.
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            mEntries[hole] = mEntries[next];
+            hole           = next;
+        }
+    }
+    mEntries[hole] = {};
+}
+
+void DiskBlobCache::evictLeastRecentlyUsed()
+{
+    IndexEntry *oldest = nullptr;
+    for (uint32_t index = 0; index < kEntryCapacity; ++index)
+    {
+        IndexEntry &entry = mEntries[index];
+        if (entry.used && (oldest == nullptr || entry.lastUse < oldest->lastUse))
+        {
+            oldest = &entry;
+        }
+    }
+
+    if (oldest != nullptr)
+    {
+        eraseEntry(oldest);
+    }
+}
+
+bool DiskBlobCache::compactDataFile()
+{
+    const std::string newDataPath = mDataPath + ".tmp";
+    const int newDataFd           = OpenFile(newDataPath, true);
+    if (newDataFd == kInvalidFd)
+    {
+        return false;
+    }
+
+    // Copy the live blobs to the new file.  Their new offsets are only stored in the index once
+    // the new file has replaced the old one.  If the process dies before that, the stale offsets
+    // fail the CRC check and the blobs are dropped.
+    std::vector<uint64_t> newOffsets(kEntryCapacity, 0);
+    std::vector<angle::BlobCacheKey> corruptKeys;
+    uint64_t newDataSize = 0;
+    angle::MemoryBuffer blob;
+    bool success = true;
+    for (uint32_t index = 0; index < kEntryCapacity && success; ++index)
+    {
+        const IndexEntry &entry = mEntries[index];
+        if (!entry.used)
+        {
+            continue;
+        }
+
+        if (!blob.resize(entry.size))
+        {
+            success = false;
+            break;
+        }
+        if (!ReadFile(mDataFd, entry.offset, blob.data(), entry.size) ||
+            angle::GenerateCRC32(blob.data(), entry.size) != entry.crc)
+        {
+            corruptKeys.push_back(entry.key);
+            continue;
+        }
+
+        success           = WriteFile(newDataFd, newDataSize, blob.data(), entry.size);
+        newOffsets[index] = newDataSize;
+        newDataSize += entry.size;
+    }
+
+    if (!success || !SyncFile(newDataFd) || !RenameFile(newDataPath, mDataPath))
+    {
+        CloseFile(newDataFd);
+        return false;
+    }
+
+    for (uint32_t index = 0; index < kEntryCapacity; ++index)
+    {
+        mEntries[index].offset = newOffsets[index];
+    }
+    mHeader->dataSize = newDataSize;
+    mHeader->dataGeneration++;
+
+    CloseFile(mDataFd);
+    mDataFd         = newDataFd;
+    mDataGeneration = mHeader->dataGeneration;
+
+    for (const angle::BlobCacheKey &key : corruptKeys)
+    {
+        IndexEntry *entry = findEntry(key);
+        if (entry != nullptr)
+        {
+            eraseEntry(entry);
+        }
+    }
+
+    return true;
+}
+
+void DiskBlobCache::put(const angle::BlobCacheKey &key, const angle::MemoryBuffer &value)
+{
+    const size_t valueSize = value.size();
+    if (valueSize == 0 || valueSize > mMaxSize)
+    {
+        return;
+    }
+
+    std::scoped_lock<angle::SimpleMutex> mutexLock(mMutex);
+    FileLock lock(mIndexFd);
+    if (!lock.isLocked() || !syncDataFile())
+    {
+        return;
+    }
+
+    IndexEntry *existing = findEntry(key);
+    if (existing != nullptr)
+    {
+        eraseEntry(existing);
+    }
+
+    while (mHeader->entryCount > 0 && (mHeader->liveSize + valueSize > mMaxSize ||
+                                       mHeader->entryCount >= kEntryCapacity / 4 * 3))
+    {
+        evictLeastRecentlyUsed();
+    }
+
+    // Reclaim the space of evicted and replaced blobs once it's as large as the cache itself.
+    if (mHeader->dataSize + valueSize > 2 * static_cast<uint64_t>(mMaxSize) &&
+        !compactDataFile())
+    {
+        WARN() << "Failed to compact the disk blob cache";
+        return;
+    }
+
+    const uint64_t offset = mHeader->dataSize;
+    if (!WriteFile(mDataFd, offset, value.data(), valueSize))
+    {
+        return;
+    }
+    mHeader->dataSize = offset + valueSize;
+
+    // Publish the blob.  |used| is set last so that a process dying midway leaves no entry.
+    IndexEntry *entry = findFreeEntry(key);
+    ASSERT(entry != nullptr);
+    entry->key     = key;
+    entry->crc     = angle::GenerateCRC32(value.data(), valueSize);
+    entry->offset  = offset;
+    entry->size    = static_cast<uint32_t>(valueSize);
+    entry->lastUse = ++mHeader->useCounter;
+    entry->used    = 1;
+
+    mHeader->entryCount++;
+    mHeader->liveSize += valueSize;
+}
+
+bool DiskBlobCache::get(const angle::BlobCacheKey &key, angle::MemoryBuffer *valueOut)
+{
+    std::scoped_lock<angle::SimpleMutex> mutexLock(mMutex);
+    FileLock lock(mIndexFd);
+    if (!lock.isLocked() || !syncDataFile())
+    {
+        return false;
+    }
+
+    IndexEntry *entry = findEntry(key);
+    if (entry == nullptr)
+    {
+        return false;
+    }
+
+    if (!valueOut->resize(entry->size))
+    {
+        ERR() << "Failed to allocate memory for binary blob";
+        return false;
+    }
+
+    if (!ReadFile(mDataFd, entry->offset, valueOut->data(), entry->size) ||
+        angle::GenerateCRC32(valueOut->data(), entry->size) != entry->crc)
+    {
+        WARN() << "Dropping corrupt blob from the disk blob cache";
+        eraseEntry(entry);
+        return false;
+    }
+
+    entry->lastUse = ++mHeader->useCounter;
+    return true;
+}
+
+void DiskBlobCache::remove(const angle::BlobCacheKey &key)
+{
+    std::scoped_lock<angle::SimpleMutex> mutexLock(mMutex);
+    FileLock lock(mIndexFd);
+    if (!lock.isLocked())
+    {
+        return;
+    }
+
+    IndexEntry *entry = findEntry(key);
+    if (entry != nullptr)
+    {
+        eraseEntry(entry);
+    }
+}
+
+size_t DiskBlobCache::entryCount()
+{
+    std::scoped_lock<angle::SimpleMutex> mutexLock(mMutex);
+    FileLock lock(mIndexFd);
+    return mHeader->entryCount;
+}
+
+size_t DiskBlobCache::size()
+{
+    std::scoped_lock<angle::SimpleMutex> mutexLock(mMutex);
+    FileLock lock(mIndexFd);
+    return static_cast<size_t>(mHeader->liveSize);
+}
+}  // namespace egl
@@ -0,0 +1,101 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskBlobCache: A persistent, size-limited blob cache stored in a directory.  Used by BlobCache
+//   to keep compiled programs and shaders across process launches when the application doesn't
+//   provide EGL_ANDROID_blob_cache callbacks.
+//
+//   The cache is made of two files:
+//
+//   - An index, mapped in memory, holding a fixed-size open-addressing hash table of entries.
+//     Each entry records the key, the location and CRC of the blob in the data file, and when the
+//     blob was last used.
+//   - A data file that blobs are only ever appended to.  Once the file holds too many evicted or
+//     replaced blobs, the live ones are copied to a new file which replaces it.
+//
+//   A blob is appended to the data file before its index entry is published, and blobs are
+//   checked against their CRC when read, so a process dying at any point never makes the cache
+//   return a corrupt blob.  Processes sharing the cache serialize access with a file lock on the
+//   index.
+
+#ifndef LIBANGLE_DISK_BLOB_CACHE_H_
+#define LIBANGLE_DISK_BLOB_CACHE_H_
+
+#include <memory>
+#include <string>
+
+#include "common/MemoryBuffer.h"
+#include "common/SimpleMutex.h"
+#include "libANGLE/angletypes.h"
+
+namespace egl
+{
+class DiskBlobCache final : angle::NonCopyable
+{
+  public:
+    // Opens the cache stored in |directory|, creating it if necessary.  Returns nullptr if the
+    // cache can't be used, for example if the directory isn't writable or the platform lacks
+    // support.
+    static std::unique_ptr<DiskBlobCache> Open(const std::string &directory, size_t maxSizeBytes);
+    ~DiskBlobCache();
+
+    // Stores a blob, evicting the least recently used blobs if needed to stay within the size
+    // limit.  Blobs larger than the size limit are not stored.
+    void put(const angle::BlobCacheKey &key, const angle::MemoryBuffer &value);
+
+    // Reads the blob corresponding to this key.  Returns false if it's not in the cache or is
+    // found to be corrupt, in which case it's also removed.
+    [[nodiscard]] bool get(const angle::BlobCacheKey &key, angle::MemoryBuffer *valueOut);
+
+    // Evicts a blob from the cache.
+    void remove(const angle::BlobCacheKey &key);
+
+    // Returns the number of entries in the cache, and the total size of their blobs.
+    size_t entryCount();
+    size_t size();
+
+    size_t maxSize() const { return mMaxSize; }
+
+  private:
+    struct IndexHeader;
+    struct IndexEntry;
+    class FileLock;
+
+    DiskBlobCache(const std::string &directory, size_t maxSizeBytes);
+
+    bool initialize();
+    // Sets the index up if it's missing or from an incompatible version.  Called with the file
+    // lock held.
+    bool initializeIndex();
+    // Reopens the data file if another process has replaced it.  Called with the file lock held.
+    bool syncDataFile();
+    // Replaces the data file with one that only holds the live blobs.
+    bool compactDataFile();
+
+    IndexEntry *findEntry(const angle::BlobCacheKey &key);
+    IndexEntry *findFreeEntry(const angle::BlobCacheKey &key);
+    void eraseEntry(IndexEntry *entry);
+    void evictLeastRecentlyUsed();
+
+    std::string mIndexPath;
+    std::string mDataPath;
+    size_t mMaxSize;
+
+    // Serializes threads of this process.  The file lock serializes processes.
+    angle::SimpleMutex mMutex;
+
+    int mIndexFd;
+    int mDataFd;
+    // The data file generation that |mDataFd| refers to.
+    uint64_t mDataGeneration;
+
+    void *mIndexMapping;
+    size_t mIndexMappingSize;
+    IndexHeader *mHeader;
+    IndexEntry *mEntries;
+};
+}  // namespace egl
+
+#endif  // LIBANGLE_DISK_BLOB_CACHE_H_
@@ -0,0 +1,311 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskBlobCache_unittest.cpp: Unit tests for the persistent blob cache.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <thread>
+
+#include "common/system_utils.h"
+#include "libANGLE/BlobCache.h"
+#include "libANGLE/DiskBlobCache.h"
+#include "util/test_utils.h"
+
+namespace egl
+{
+namespace
+{
+using Key = angle::BlobCacheKey;
+
+Key MakeKey(uint32_t index)
+{
+    Key key = {};
+    for (size_t byte = 0; byte < key.size(); ++byte)
+    {
+        key[byte] = static_cast<uint8_t>((index * 0x9E3779B1u) >> ((byte % 4) * 8)) ^
+                    static_cast<uint8_t>(byte);
+    }
+    return key;
+}
+
+angle::MemoryBuffer MakeBlob(size_t size, uint8_t seed)
+{
+    angle::MemoryBuffer blob;
+    EXPECT_TRUE(blob.resize(size));
+    for (size_t i = 0; i < size; ++i)
+    {
+        blob[i] = static_cast<uint8_t>(i * 7 + seed);
+    }
+    return blob;
+}
+
+bool BlobsEqual(const angle::MemoryBuffer &a, const angle::MemoryBuffer &b)
+{
+    return a.size() == b.size() && std::equal(a.data(), a.data() + a.size(), b.data());
+}
+
+class DiskBlobCacheTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+#if !defined(ANGLE_PLATFORM_POSIX)
+        GTEST_SKIP() << "The disk blob cache is only supported on POSIX platforms";
+#endif
+        // Use the name of a fresh temporary file as the cache directory.
+        Optional<std::string> tempFile = angle::CreateTemporaryFile();
+        ASSERT_TRUE(tempFile.valid());
+        ASSERT_TRUE(angle::DeleteSystemFile(tempFile.value().c_str()));
+        mDirectory = tempFile.value();
+    }
+
+    void TearDown() override
+    {
+        for (const std::string &path : getCacheFiles())
+        {
+            angle::DeleteSystemFile(path.c_str());
+        }
+    }
+
+    std::vector<std::string> getCacheFiles() const
+    {
+        const std::string baseName =
+            angle::ConcatenatePath(mDirectory, "angle_blob_cache_v1_k" +
+                                                   std::to_string(angle::kBlobCacheKeyLength));
+        return {baseName + ".index", baseName + ".data"};
+    }
+
+    std::unique_ptr<DiskBlobCache> open(size_t maxSize)
+    {
+        std::unique_ptr<DiskBlobCache> cache = DiskBlobCache::Open(mDirectory, maxSize);
+        EXPECT_NE(cache, nullptr);
+        return cache;
+    }
+
+    void expectBlob(DiskBlobCache *cache, uint32_t keyIndex, size_t size, uint8_t seed)
+    {
+        angle::MemoryBuffer blob;
+        ASSERT_TRUE(cache->get(MakeKey(keyIndex), &blob));
+        EXPECT_TRUE(BlobsEqual(blob, MakeBlob(size, seed)));
+    }
+
+    std::string mDirectory;
+};
+
+// Tests that blobs can be read back, including after the cache is reopened.
+TEST_F(DiskBlobCacheTest, PutAndGetAcrossReopen)
+{
+    {
+        std::unique_ptr<DiskBlobCache> cache = open(1024 * 1024);
+        ASSERT_NE(cache, nullptr);
+
+        for (uint32_t index = 0; index < 10; ++index)
+        {
+            cache->put(MakeKey(index), MakeBlob(100 + index, static_cast<uint8_t>(index)));
+        }
+        EXPECT_EQ(cache->entryCount(), 10u);
+
+        expectBlob(cache.get(), 3, 103, 3);
+
+        angle::MemoryBuffer blob;
+        EXPECT_FALSE(cache->get(MakeKey(100), &blob));
+    }
+
+    std::unique_ptr<DiskBlobCache> cache = open(1024 * 1024);
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(cache->entryCount(), 10u);
+    for (uint32_t index = 0; index < 10; ++index)
+    {
+        expectBlob(cache.get(), index, 100 + index, static_cast<uint8_t>(index));
+    }
+}
+
+// Tests that replacing and removing blobs works.
+TEST_F(DiskBlobCacheTest, ReplaceAndRemove)
+{
+    std::unique_ptr<DiskBlobCache> cache = open(1024 * 1024);
+    ASSERT_NE(cache, nullptr);
+
+    cache->put(MakeKey(0), MakeBlob(100, 0));
+    cache->put(MakeKey(0), MakeBlob(200, 1));
+    EXPECT_EQ(cache->entryCount(), 1u);
+    EXPECT_EQ(cache->size(), 200u);
+    expectBlob(cache.get(), 0, 200, 1);
+
+    cache->remove(MakeKey(0));
+    EXPECT_EQ(cache->entryCount(), 0u);
+    EXPECT_EQ(cache->size(), 0u);
+
+    angle::MemoryBuffer blob;
+    EXPECT_FALSE(cache->get(MakeKey(0), &blob));
+}
+
+// Tests that the least recently used blobs are evicted to stay within the size limit.
+TEST_F(DiskBlobCacheTest, LeastRecentlyUsedEviction)
+{
+    std::unique_ptr<DiskBlobCache> cache = open(1000);
+    ASSERT_NE(cache, nullptr);
+
+    cache->put(MakeKey(0), MakeBlob(300, 0));
+    cache->put(MakeKey(1), MakeBlob(300, 1));
+    cache->put(MakeKey(2), MakeBlob(300, 2));
+
+    // Use blob 0 so that blob 1 is the least recently used.
+    expectBlob(cache.get(), 0, 300, 0);
+
+    cache->put(MakeKey(3), MakeBlob(300, 3));
+    EXPECT_LE(cache->size(), 1000u);
+
+    angle::MemoryBuffer blob;
+    EXPECT_FALSE(cache->get(MakeKey(1), &blob));
+    expectBlob(cache.get(), 0, 300, 0);
+    expectBlob(cache.get(), 2, 300, 2);
+    expectBlob(cache.get(), 3, 300, 3);
+
+    // Blobs larger than the cache are not stored.
+    cache->put(MakeKey(4), MakeBlob(1001, 4));
+    EXPECT_FALSE(cache->get(MakeKey(4), &blob));
+}
+
+// Tests that the data file is compacted as blobs are evicted, and that blobs survive compaction.
+TEST_F(DiskBlobCacheTest, Compaction)
+{
+    constexpr size_t kMaxSize  = 4096;
+    constexpr size_t kBlobSize = 300;
+
+    std::unique_ptr<DiskBlobCache> cache = open(kMaxSize);
+    ASSERT_NE(cache, nullptr);
+
+    for (uint32_t index = 0; index < 200; ++index)
+    {
+        cache->put(MakeKey(index), MakeBlob(kBlobSize, static_cast<uint8_t>(index)));
+    }
+
+    EXPECT_LE(cache->size(), kMaxSize);
+    for (uint32_t index = 190; index < 200; ++index)
+    {
+        expectBlob(cache.get(), index, kBlobSize, static_cast<uint8_t>(index));
+    }
+
+    FILE *dataFile = fopen(getCacheFiles()[1].c_str(), "rb");
+    ASSERT_NE(dataFile, nullptr);
+    fseek(dataFile, 0, SEEK_END);
+    EXPECT_LE(static_cast<size_t>(ftell(dataFile)), 2 * kMaxSize);
+    fclose(dataFile);
+}
+
+// Tests that corrupt blobs are detected and dropped.
+TEST_F(DiskBlobCacheTest, CorruptBlobIsDropped)
+{
+    std::unique_ptr<DiskBlobCache> cache = open(1024 * 1024);
+    ASSERT_NE(cache, nullptr);
+
+    cache->put(MakeKey(0), MakeBlob(100, 0));
+
+    FILE *dataFile = fopen(getCacheFiles()[1].c_str(), "r+b");
+    ASSERT_NE(dataFile, nullptr);
+    fseek(dataFile, 50, SEEK_SET);
+    fputc(0xFF, dataFile);
+    fclose(dataFile);
+
+    angle::MemoryBuffer blob;
+    EXPECT_FALSE(cache->get(MakeKey(0), &blob));
+    EXPECT_EQ(cache->entryCount(), 0u);
+}
+
+// Tests that an unusable index is discarded.
+TEST_F(DiskBlobCacheTest, InvalidIndexIsReset)
+{
+    {
+        std::unique_ptr<DiskBlobCache> cache = open(1024 * 1024);
+        ASSERT_NE(cache, nullptr);
+        cache->put(MakeKey(0), MakeBlob(100, 0));
+    }
+
+    FILE *indexFile = fopen(getCacheFiles()[0].c_str(), "r+b");
+    ASSERT_NE(indexFile, nullptr);
+    fputc(0, indexFile);
+    fclose(indexFile);
+
+    std::unique_ptr<DiskBlobCache> cache = open(1024 * 1024);
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(cache->entryCount(), 0u);
+}
+
+// Tests that a BlobCache backed by the disk cache finds blobs put by another BlobCache, as on the
+// next launch of the application.
+TEST_F(DiskBlobCacheTest, BacksBlobCache)
+{
+    {
+        // A memory cache size of 0 is the default, where only the disk cache holds blobs.
+        BlobCache blobCache(0);
+        blobCache.setDiskCache(open(1024 * 1024));
+        EXPECT_TRUE(blobCache.isCachingEnabled(nullptr));
+        blobCache.put(nullptr, MakeKey(0), MakeBlob(100, 0));
+    }
+
+    BlobCache blobCache(1024);
+    blobCache.setDiskCache(open(1024 * 1024));
+
+    BlobCache::Value value;
+    ASSERT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(0), &value));
+    EXPECT_EQ(value.size(), 100u);
+    EXPECT_EQ(blobCache.entryCount(), 1u);
+
+    // Removing the blob removes it from the disk too.
+    blobCache.remove(MakeKey(0));
+    blobCache.clear();
+    EXPECT_FALSE(blobCache.get(nullptr, nullptr, MakeKey(0), &value));
+}
+
+// Tests that several instances of the cache, as in different processes, can use the same files
+// concurrently.
+TEST_F(DiskBlobCacheTest, ConcurrentInstances)
+{
+    constexpr size_t kMaxSize       = 16 * 1024;
+    constexpr uint32_t kThreadCount = 4;
+    constexpr uint32_t kIterations  = 200;
+
+    std::vector<std::unique_ptr<DiskBlobCache>> caches;
+    for (uint32_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        caches.push_back(open(kMaxSize));
+        ASSERT_NE(caches.back(), nullptr);
+    }
+
+    std::vector<std::thread> threads;
+    for (uint32_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&caches, threadIndex]() {
+            DiskBlobCache *cache = caches[threadIndex].get();
+            for (uint32_t iteration = 0; iteration < kIterations; ++iteration)
+            {
+                const uint32_t keyIndex = iteration % 50;
+                const uint8_t seed      = static_cast<uint8_t>(keyIndex);
+                cache->put(MakeKey(keyIndex), MakeBlob(200 + keyIndex, seed));
+
+                // Whatever instance wrote it, a blob that is found must be intact.
+                angle::MemoryBuffer blob;
+                const uint32_t otherKeyIndex = (keyIndex * 7) % 50;
+                if (cache->get(MakeKey(otherKeyIndex), &blob))
+                {
+                    EXPECT_TRUE(BlobsEqual(
+                        blob, MakeBlob(200 + otherKeyIndex, static_cast<uint8_t>(otherKeyIndex))));
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_LE(caches[0]->size(), kMaxSize);
+    EXPECT_EQ(caches[0]->size(), caches[1]->size());
+}
+}  // anonymous namespace
+}  // namespace egl
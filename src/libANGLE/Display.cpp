@@ -1146,6 +1146,15 @@ void Display::setupDisplayPlatform(rx::DisplayImpl *impl)
     mState.featureOverrides.disabled = EGLStringArrayToStringVector(featuresForceDisabled);
     mState.featureOverrides.allDisabled =
         static_cast<bool>(mAttributeMap.get(EGL_FEATURE_ALL_DISABLED_ANGLE, 0));
+
+    // The directory string is only valid during eglGetPlatformDisplay, so it's copied here.
+    const char *diskProgramCacheDirectory = reinterpret_cast<const char *>(
+        mAttributeMap.get(EGL_DISK_PROGRAM_CACHE_DIRECTORY_ANGLE, 0));
+    mState.diskProgramCacheDirectory =
+        diskProgramCacheDirectory != nullptr
+            ? std::string(diskProgramCacheDirectory)
+            : angle::GetEnvironmentVar("ANGLE_DISK_PROGRAM_CACHE_DIR");
+
     mImplementation->addObserver(&mGPUSwitchedBinding);
 }
 
@@ -1252,8 +1261,24 @@ Error Display::initialize()
 
     mState.singleThreadPool = angle::WorkerThreadPool::Create(angle::ThreadPoolType::Synchronous, 0,
                                                               ANGLEPlatformCurrent());
-    mState.multiThreadPool = angle::WorkerThreadPool::Create(angle::ThreadPoolType::Asynchronous, 0,
-                                                             ANGLEPlatformCurrent());
+    const angle::ThreadPoolType multiThreadPoolType =
+        mFrontendFeatures.useWorkStealingThreadPool.enabled ? angle::ThreadPoolType::WorkStealing
+                                                            : angle::ThreadPoolType::Asynchronous;
+    mState.multiThreadPool =
+        angle::WorkerThreadPool::Create(multiThreadPoolType, 0, ANGLEPlatformCurrent());
+
+    if (!mState.diskProgramCacheDirectory.empty())
+    {
+        mBlobCache.setDiskCache(DiskBlobCache::Open(mState.diskProgramCacheDirectory,
+                                                    gl::kDefaultMaxDiskProgramCacheBytes));
+    }
+
+    mBlobCache.setCompressionOptions(mFrontendFeatures.useFastBlobCacheCompression.enabled
+                                         ? angle::BlobCompressionCodec::LZ
+                                         : angle::BlobCompressionCodec::ZlibDefault,
+                                     mFrontendFeatures.compressBlobCacheAsynchronously.enabled
+                                         ? mState.multiThreadPool
+                                         : nullptr);
 
     if (kIsContextMutexEnabled)
     {
@@ -1425,9 +1450,13 @@ Error Display::terminate(Thread *thread, TerminateReason terminateReason)
 
     mImplementation->terminate();
 
+    // Stop compressing on the worker pool before it's destroyed.
+    mBlobCache.setCompressionOptions(mBlobCache.getCompressionCodec(), nullptr);
+
     mMemoryProgramCache.clear();
     mMemoryShaderCache.clear();
     mBlobCache.setBlobCacheFuncs(nullptr, nullptr);
+    mBlobCache.setDiskCache(nullptr);
 
     mState.singleThreadPool.reset();
     mState.multiThreadPool.reset();
@@ -2345,6 +2374,10 @@ static ClientExtensions GenerateClientExtensions()
     extensions.noErrorANGLE              = true;
     extensions.platformANGLEDisplayKey   = true;
 
+#if defined(ANGLE_PLATFORM_POSIX)
+    extensions.diskProgramCacheANGLE = true;
+#endif
+
     return extensions;
 }
 
@@ -2512,6 +2545,9 @@ void Display::initializeFrontendFeatures()
 
     ANGLE_FEATURE_CONDITION(&mFrontendFeatures, forceMinimumMaxVertexAttributes, false);
 
+    // Off until it's proven on each backend.
+    ANGLE_FEATURE_CONDITION(&mFrontendFeatures, coalesceDrawElements, false);
+
     // When the IR is built, use it by default.
 #ifdef ANGLE_IR
     ANGLE_FEATURE_CONDITION(&mFrontendFeatures, useIr, true);
@@ -2834,6 +2870,7 @@ angle::ImageLoadContext Display::getImageLoadContext() const
     imageLoadContext.multiThreadPool  = mFrontendFeatures.singleThreadedTextureDecompression.enabled
                                             ? nullptr
                                             : mState.multiThreadPool;
+    imageLoadContext.useSIMD          = !mFrontendFeatures.disableSimdImageLoad.enabled;
 
     return imageLoadContext;
 }
@@ -92,6 +92,9 @@ struct DisplayState final : private angle::NonCopyable
     std::shared_ptr<angle::WorkerThreadPool> singleThreadPool;
     std::shared_ptr<angle::WorkerThreadPool> multiThreadPool;
 
+    // If not empty, programs and shaders are cached persistently in this directory.
+    std::string diskProgramCacheDirectory;
+
     mutable bool deviceLost;
 };
 
@@ -4,16 +4,346 @@
 // found in the LICENSE file.
 //
 
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
 // IndexRangeCache.cpp: Defines the gl::IndexRangeCache class which stores information about
 // ranges of indices.
 
 #include "libANGLE/IndexRangeCache.h"
 
+#include <algorithm>
+
 #include "common/debug.h"
+#include "common/utilities.h"
+#include "image_util/image_simd.h"
 #include "libANGLE/formatutils.h"
 
 namespace gl
 {
+namespace
+{
+using IndexBounds = IndexRangeCache::IndexBounds;
+
+template <typename IndexType>
+void ScanIndices(const IndexType *indices, size_t first, size_t count, IndexBounds *bounds)
+{
+    constexpr IndexType primitiveRestartIndex = std::numeric_limits<IndexType>::max();
+    for (size_t i = first; i < count; ++i)
+    {
+        const IndexType index = indices[i];
+        if (index == primitiveRestartIndex)
+        {
+            bounds->hasPrimitiveRestartIndex = true;
+            continue;
+        }
+        bounds->minIndex = std::min<uint32_t>(bounds->minIndex, index);
+        bounds->maxIndex = std::max<uint32_t>(bounds->maxIndex, index);
+    }
+}
+
+// Merges the bounds that each lane of a vector loop found.  A lane whose minimum is the primitive
+// restart index only saw primitive restart indices.
+template <typename IndexType, size_t kLanes>
+void MergeLanes(const IndexType (&minIndices)[kLanes],
+                const IndexType (&maxIndices)[kLanes],
+                bool hasPrimitiveRestartIndex,
+                IndexBounds *bounds)
+{
+    constexpr IndexType primitiveRestartIndex = std::numeric_limits<IndexType>::max();
+    for (size_t lane = 0; lane < kLanes; ++lane)
+    {
+        if (minIndices[lane] != primitiveRestartIndex)
+        {
+            bounds->minIndex = std::min<uint32_t>(bounds->minIndex, minIndices[lane]);
+        }
+        bounds->maxIndex = std::max<uint32_t>(bounds->maxIndex, maxIndices[lane]);
+    }
+    bounds->hasPrimitiveRestartIndex = bounds->hasPrimitiveRestartIndex || hasPrimitiveRestartIndex;
+}
+
+// The vector loops below return the number of indices they scanned, leaving the rest to the
+// scalar loop.  Primitive restart indices are the largest value of the type, so they never lower
+// the minimum; they are cleared before being compared for the maximum.
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t ScanUbyteIndicesSSE2(const GLubyte *indices, size_t count, IndexBounds *bounds)
+{
+    const __m128i restart = _mm_set1_epi8(-1);
+    __m128i minIndices    = restart;
+    __m128i maxIndices    = _mm_setzero_si128();
+    __m128i restarts      = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+        const __m128i isRestart = _mm_cmpeq_epi8(index, restart);
+        restarts                = _mm_or_si128(restarts, isRestart);
+        minIndices              = _mm_min_epu8(minIndices, index);
+        maxIndices              = _mm_max_epu8(maxIndices, _mm_andnot_si128(isRestart, index));
+    }
+
+    alignas(16) GLubyte mins[16];
+    alignas(16) GLubyte maxs[16];
+    _mm_store_si128(reinterpret_cast<__m128i *>(mins), minIndices);
+    _mm_store_si128(reinterpret_cast<__m128i *>(maxs), maxIndices);
+    MergeLanes(mins, maxs, _mm_movemask_epi8(restarts) != 0, bounds);
+    return i;
+}
+
+// SSE2 only compares signed 16-bit integers, so the indices are biased by 0x8000 to compare them.
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t ScanUshortIndicesSSE2(const GLushort *indices, size_t count, IndexBounds *bounds)
+{
+    const __m128i restart = _mm_set1_epi16(-1);
+    const __m128i bias    = _mm_set1_epi16(-0x8000);
+    __m128i minIndices    = _mm_xor_si128(restart, bias);
+    __m128i maxIndices    = bias;
+    __m128i restarts      = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+        const __m128i isRestart = _mm_cmpeq_epi16(index, restart);
+        restarts                = _mm_or_si128(restarts, isRestart);
+        const __m128i maxIndex  = _mm_andnot_si128(isRestart, index);
+        minIndices              = _mm_min_epi16(minIndices, _mm_xor_si128(index, bias));
+        maxIndices              = _mm_max_epi16(maxIndices, _mm_xor_si128(maxIndex, bias));
+    }
+
+    alignas(16) GLushort mins[8];
+    alignas(16) GLushort maxs[8];
+    _mm_store_si128(reinterpret_cast<__m128i *>(mins), _mm_xor_si128(minIndices, bias));
+    _mm_store_si128(reinterpret_cast<__m128i *>(maxs), _mm_xor_si128(maxIndices, bias));
+    MergeLanes(mins, maxs, _mm_movemask_epi8(restarts) != 0, bounds);
+    return i;
+}
+
+// SSE2 has neither 32-bit minimum nor maximum, so they are selected after a signed comparison of
+// the indices biased by 0x80000000.
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t ScanUintIndicesSSE2(const GLuint *indices, size_t count, IndexBounds *bounds)
+{
+    const __m128i restart = _mm_set1_epi32(-1);
+    const __m128i bias    = _mm_set1_epi32(std::numeric_limits<int32_t>::min());
+    __m128i minIndices    = _mm_xor_si128(restart, bias);
+    __m128i maxIndices    = bias;
+    __m128i restarts      = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+        const __m128i isRestart = _mm_cmpeq_epi32(index, restart);
+        restarts                = _mm_or_si128(restarts, isRestart);
+
+        const __m128i biasedIndex = _mm_xor_si128(index, bias);
+        const __m128i isLess      = _mm_cmplt_epi32(biasedIndex, minIndices);
+        minIndices                = _mm_or_si128(_mm_and_si128(isLess, biasedIndex),
+                                                 _mm_andnot_si128(isLess, minIndices));
+
+        const __m128i biasedMaxIndex = _mm_xor_si128(_mm_andnot_si128(isRestart, index), bias);
+        const __m128i isGreater      = _mm_cmpgt_epi32(biasedMaxIndex, maxIndices);
+        maxIndices                   = _mm_or_si128(_mm_and_si128(isGreater, biasedMaxIndex),
+                                                    _mm_andnot_si128(isGreater, maxIndices));
+    }
+
+    alignas(16) GLuint mins[4];
+    alignas(16) GLuint maxs[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(mins), _mm_xor_si128(minIndices, bias));
+    _mm_store_si128(reinterpret_cast<__m128i *>(maxs), _mm_xor_si128(maxIndices, bias));
+    MergeLanes(mins, maxs, _mm_movemask_epi8(restarts) != 0, bounds);
+    return i;
+}
+#endif  // defined(ANGLE_LOADIMAGE_USE_SSE)
+
+#if defined(ANGLE_LOADIMAGE_USE_NEON)
+size_t ScanUbyteIndicesNEON(const GLubyte *indices, size_t count, IndexBounds *bounds)
+{
+    const uint8x16_t restart = vdupq_n_u8(0xFF);
+    uint8x16_t minIndices    = restart;
+    uint8x16_t maxIndices    = vdupq_n_u8(0);
+    uint8x16_t restarts      = vdupq_n_u8(0);
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16_t index     = vld1q_u8(indices + i);
+        const uint8x16_t isRestart = vceqq_u8(index, restart);
+        restarts                   = vorrq_u8(restarts, isRestart);
+        minIndices                 = vminq_u8(minIndices, index);
+        maxIndices                 = vmaxq_u8(maxIndices, vbicq_u8(index, isRestart));
+    }
+
+    GLubyte mins[16];
+    GLubyte maxs[16];
+    vst1q_u8(mins, minIndices);
+    vst1q_u8(maxs, maxIndices);
+    const uint64x2_t anyRestart = vreinterpretq_u64_u8(restarts);
+    MergeLanes(mins, maxs, (vgetq_lane_u64(anyRestart, 0) | vgetq_lane_u64(anyRestart, 1)) != 0,
+               bounds);
+    return i;
+}
+
+size_t ScanUshortIndicesNEON(const GLushort *indices, size_t count, IndexBounds *bounds)
+{
+    const uint16x8_t restart = vdupq_n_u16(0xFFFF);
+    uint16x8_t minIndices    = restart;
+    uint16x8_t maxIndices    = vdupq_n_u16(0);
+    uint16x8_t restarts      = vdupq_n_u16(0);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const uint16x8_t index     = vld1q_u16(indices + i);
+        const uint16x8_t isRestart = vceqq_u16(index, restart);
+        restarts                   = vorrq_u16(restarts, isRestart);
+        minIndices                 = vminq_u16(minIndices, index);
+        maxIndices                 = vmaxq_u16(maxIndices, vbicq_u16(index, isRestart));
+    }
+
+    GLushort mins[8];
+    GLushort maxs[8];
+    vst1q_u16(mins, minIndices);
+    vst1q_u16(maxs, maxIndices);
+    const uint64x2_t anyRestart = vreinterpretq_u64_u16(restarts);
+    MergeLanes(mins, maxs, (vgetq_lane_u64(anyRestart, 0) | vgetq_lane_u64(anyRestart, 1)) != 0,
+               bounds);
+    return i;
+}
+
+size_t ScanUintIndicesNEON(const GLuint *indices, size_t count, IndexBounds *bounds)
+{
+    const uint32x4_t restart = vdupq_n_u32(0xFFFFFFFF);
+    uint32x4_t minIndices    = restart;
+    uint32x4_t maxIndices    = vdupq_n_u32(0);
+    uint32x4_t restarts      = vdupq_n_u32(0);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const uint32x4_t index     = vld1q_u32(indices + i);
+        const uint32x4_t isRestart = vceqq_u32(index, restart);
+        restarts                   = vorrq_u32(restarts, isRestart);
+        minIndices                 = vminq_u32(minIndices, index);
+        maxIndices                 = vmaxq_u32(maxIndices, vbicq_u32(index, isRestart));
+    }
+
+    GLuint mins[4];
+    GLuint maxs[4];
+    vst1q_u32(mins, minIndices);
+    vst1q_u32(maxs, maxIndices);
+    const uint64x2_t anyRestart = vreinterpretq_u64_u32(restarts);
+    MergeLanes(mins, maxs, (vgetq_lane_u64(anyRestart, 0) | vgetq_lane_u64(anyRestart, 1)) != 0,
+               bounds);
+    return i;
+}
+#endif  // defined(ANGLE_LOADIMAGE_USE_NEON)
+
+size_t ScanIndicesSIMD(const GLubyte *indices, size_t count, IndexBounds *bounds)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (angle::GetSupportedSIMDLevel() >= angle::SIMDLevel::SSE2)
+    {
+        return ScanUbyteIndicesSSE2(indices, count, bounds);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (angle::GetSupportedSIMDLevel() == angle::SIMDLevel::NEON)
+    {
+        return ScanUbyteIndicesNEON(indices, count, bounds);
+    }
+#endif
+    return 0;
+}
+
+size_t ScanIndicesSIMD(const GLushort *indices, size_t count, IndexBounds *bounds)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (angle::GetSupportedSIMDLevel() >= angle::SIMDLevel::SSE2)
+    {
+        return ScanUshortIndicesSSE2(indices, count, bounds);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (angle::GetSupportedSIMDLevel() == angle::SIMDLevel::NEON)
+    {
+        return ScanUshortIndicesNEON(indices, count, bounds);
+    }
+#endif
+    return 0;
+}
+
+size_t ScanIndicesSIMD(const GLuint *indices, size_t count, IndexBounds *bounds)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (angle::GetSupportedSIMDLevel() >= angle::SIMDLevel::SSE2)
+    {
+        return ScanUintIndicesSSE2(indices, count, bounds);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (angle::GetSupportedSIMDLevel() == angle::SIMDLevel::NEON)
+    {
+        return ScanUintIndicesNEON(indices, count, bounds);
+    }
+#endif
+    return 0;
+}
+
+template <typename IndexType>
+IndexBounds ComputeTypedIndexBounds(const uint8_t *indices, size_t count)
+{
+    const IndexType *typedIndices = reinterpret_cast<const IndexType *>(indices);
+
+    IndexBounds bounds;
+    const size_t scanned = ScanIndicesSIMD(typedIndices, count, &bounds);
+    ScanIndices(typedIndices, scanned, count, &bounds);
+    return bounds;
+}
+}  // anonymous namespace
+
+void IndexRangeCache::IndexBounds::merge(const IndexBounds &other)
+{
+    minIndex                 = std::min(minIndex, other.minIndex);
+    maxIndex                 = std::max(maxIndex, other.maxIndex);
+    hasPrimitiveRestartIndex = hasPrimitiveRestartIndex || other.hasPrimitiveRestartIndex;
+}
+
+IndexRange IndexRangeCache::IndexBounds::getRange(DrawElementsType type,
+                                                  bool primitiveRestartEnabled) const
+{
+    const bool hasVertices = minIndex <= maxIndex;
+    if (primitiveRestartEnabled)
+    {
+        return hasVertices ? IndexRange(minIndex, maxIndex) : IndexRange();
+    }
+
+    if (!hasPrimitiveRestartIndex)
+    {
+        return hasVertices ? IndexRange(minIndex, maxIndex) : IndexRange();
+    }
+
+    // Without primitive restart, its index is the largest index there can be.
+    const GLuint primitiveRestartIndex = GetPrimitiveRestartIndex(type);
+    return IndexRange(hasVertices ? minIndex : primitiveRestartIndex, primitiveRestartIndex);
+}
+
+IndexBounds ComputeIndexBounds(DrawElementsType type, const uint8_t *indices, size_t count)
+{
+    switch (type)
+    {
+        case DrawElementsType::UnsignedByte:
+            return ComputeTypedIndexBounds<GLubyte>(indices, count);
+        case DrawElementsType::UnsignedShort:
+            return ComputeTypedIndexBounds<GLushort>(indices, count);
+        case DrawElementsType::UnsignedInt:
+            return ComputeTypedIndexBounds<GLuint>(indices, count);
+        default:
+            UNREACHABLE();
+            return IndexBounds();
+    }
+}
 
 IndexRangeCache::IndexRangeCache() {}
 
@@ -53,6 +383,56 @@ bool IndexRangeCache::findRange(DrawElementsType type,
     }
 }
 
+IndexRange IndexRangeCache::computeRange(DrawElementsType type,
+                                         size_t offset,
+                                         size_t count,
+                                         bool primitiveRestartEnabled,
+                                         const uint8_t *indices)
+{
+    const size_t typeSize   = GetDrawElementsTypeSize(type);
+    const size_t end        = offset + count * typeSize;
+    const size_t firstChunk = rx::roundUpPow2(offset, kChunkSize) / kChunkSize;
+    const size_t chunksEnd  = end / kChunkSize;
+
+    // Indices that don't span a whole chunk, or that are misaligned so that chunks would split
+    // them, are scanned without the summary.
+    if (firstChunk >= chunksEnd || offset % typeSize != 0)
+    {
+        return ComputeIndexBounds(type, indices, count).getRange(type, primitiveRestartEnabled);
+    }
+
+    if (type != mChunkType)
+    {
+        mChunks.clear();
+        mChunkType = type;
+    }
+    if (mChunks.size() < chunksEnd)
+    {
+        mChunks.resize(chunksEnd);
+    }
+
+    // Scan the indices before the first whole chunk and after the last one, and take the bounds
+    // of the whole chunks in between from the summary, summarizing those that are not yet.
+    const size_t headSize = firstChunk * kChunkSize - offset;
+    IndexBounds bounds    = ComputeIndexBounds(type, indices, headSize / typeSize);
+    bounds.merge(ComputeIndexBounds(type, indices + (chunksEnd * kChunkSize - offset),
+                                    (end - chunksEnd * kChunkSize) / typeSize));
+
+    for (size_t chunkIndex = firstChunk; chunkIndex < chunksEnd; ++chunkIndex)
+    {
+        Chunk &chunk = mChunks[chunkIndex];
+        if (!chunk.valid)
+        {
+            chunk.bounds = ComputeIndexBounds(type, indices + (chunkIndex * kChunkSize - offset),
+                                              kChunkSize / typeSize);
+            chunk.valid  = true;
+        }
+        bounds.merge(chunk.bounds);
+    }
+
+    return bounds.getRange(type, primitiveRestartEnabled);
+}
+
 void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 {
     size_t invalidateStart = offset;
@@ -74,11 +454,19 @@ void IndexRangeCache::invalidateRange(size_t offset, size_t size)
             mIndexRangeCache.erase(i++);
         }
     }
+
+    const size_t chunksEnd =
+        std::min(rx::roundUpPow2(invalidateEnd, kChunkSize) / kChunkSize, mChunks.size());
+    for (size_t chunkIndex = invalidateStart / kChunkSize; chunkIndex < chunksEnd; ++chunkIndex)
+    {
+        mChunks[chunkIndex].valid = false;
+    }
 }
 
 void IndexRangeCache::clear()
 {
     mIndexRangeCache.clear();
+    mChunks.clear();
 }
 
 bool IndexRangeKey::operator<(const IndexRangeKey &rhs) const
@@ -15,7 +15,9 @@
 #include "common/angleutils.h"
 #include "common/mathutil.h"
 
+#include <limits>
 #include <map>
+#include <vector>
 
 namespace gl
 {
@@ -50,13 +52,53 @@ class IndexRangeCache
                    bool primitiveRestartEnabled,
                    IndexRange *outRange) const;
 
+    // Computes the range of |count| indices of |type| at |offset| in the buffer, given |indices|
+    // which points to the buffer data at |offset|.  The buffer is summarized in chunks of
+    // kChunkSize bytes, and the chunks whose summary is still valid are not scanned again.
+    IndexRange computeRange(DrawElementsType type,
+                            size_t offset,
+                            size_t count,
+                            bool primitiveRestartEnabled,
+                            const uint8_t *indices);
+
     void invalidateRange(size_t offset, size_t size);
     void clear();
 
+    static constexpr size_t kChunkSize = 4096;
+
+    // The bounds of a run of indices.  The primitive restart index is left out of the minimum and
+    // maximum, so that the bounds of runs can be combined whether or not primitive restart is
+    // enabled.  A run of only primitive restart indices has minIndex > maxIndex.
+    struct IndexBounds
+    {
+        void merge(const IndexBounds &other);
+        IndexRange getRange(DrawElementsType type, bool primitiveRestartEnabled) const;
+
+        uint32_t minIndex             = std::numeric_limits<uint32_t>::max();
+        uint32_t maxIndex             = 0;
+        bool hasPrimitiveRestartIndex = false;
+    };
+
   private:
+    struct Chunk
+    {
+        IndexBounds bounds;
+        bool valid = false;
+    };
+
     std::map<IndexRangeKey, IndexRange> mIndexRangeCache;
+
+    // The summary of the buffer for indices of mChunkType.  Chunk i covers the bytes
+    // [i * kChunkSize, (i + 1) * kChunkSize) of the buffer.
+    DrawElementsType mChunkType = DrawElementsType::InvalidEnum;
+    std::vector<Chunk> mChunks;
 };
 
+// Computes the bounds of |count| indices of |type|, using vector instructions where available.
+IndexRangeCache::IndexBounds ComputeIndexBounds(DrawElementsType type,
+                                                const uint8_t *indices,
+                                                size_t count);
+
 // First level cache stored inline at the query site.
 class IndexRangeInlineCache
 {
@@ -0,0 +1,200 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCache_unittest:
+//   Tests that index ranges computed from the chunked summary of a buffer match those computed by
+//   scanning every index, and that the summary is kept up to date as the buffer changes.
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "common/utilities.h"
+#include "libANGLE/IndexRangeCache.h"
+#include "libANGLE/formatutils.h"
+
+namespace gl
+{
+namespace
+{
+constexpr DrawElementsType kIndexTypes[] = {
+    DrawElementsType::UnsignedByte,
+    DrawElementsType::UnsignedShort,
+    DrawElementsType::UnsignedInt,
+};
+
+constexpr size_t kBufferSize = 8 * IndexRangeCache::kChunkSize + 20;
+
+// Fills |data| with indices of |type| up to |maxIndex|, with primitive restart indices mixed in.
+void FillIndices(DrawElementsType type,
+                 uint32_t maxIndex,
+                 uint32_t seed,
+                 std::vector<uint8_t> *data)
+{
+    std::mt19937 generator(seed);
+    const size_t typeSize = GetDrawElementsTypeSize(type);
+    for (size_t offset = 0; offset + typeSize <= data->size(); offset += typeSize)
+    {
+        uint32_t index = generator() % (maxIndex + 1);
+        if (generator() % 64 == 0)
+        {
+            index = GetPrimitiveRestartIndex(type);
+        }
+        memcpy(data->data() + offset, &index, typeSize);
+    }
+}
+
+void ExpectMatchingRanges(IndexRangeCache *cache,
+                          DrawElementsType type,
+                          const std::vector<uint8_t> &data,
+                          size_t offset,
+                          size_t count)
+{
+    for (bool primitiveRestartEnabled : {false, true})
+    {
+        EXPECT_EQ(ComputeIndexRange(type, data.data() + offset, count, primitiveRestartEnabled),
+                  cache->computeRange(type, offset, count, primitiveRestartEnabled,
+                                      data.data() + offset))
+            << "Type " << type << ", " << count << " indices at offset " << offset
+            << ", primitive restart " << primitiveRestartEnabled;
+    }
+}
+
+// Tests that the vector scan finds the same bounds as the scalar scan, for every kind of remainder.
+TEST(IndexRangeCacheTest, ComputeIndexBounds)
+{
+    for (DrawElementsType type : kIndexTypes)
+    {
+        std::vector<uint8_t> data(256);
+        FillIndices(type, 200, 1, &data);
+
+        const size_t typeSize = GetDrawElementsTypeSize(type);
+        for (size_t offset : {size_t(0), typeSize})
+        {
+            for (size_t count = 0; offset + count * typeSize <= data.size(); ++count)
+            {
+                for (bool primitiveRestartEnabled : {false, true})
+                {
+                    EXPECT_EQ(
+                        ComputeIndexRange(type, data.data() + offset, count,
+                                          primitiveRestartEnabled),
+                        ComputeIndexBounds(type, data.data() + offset, count)
+                            .getRange(type, primitiveRestartEnabled))
+                        << "Type " << type << ", " << count << " indices at offset " << offset;
+                }
+            }
+        }
+    }
+}
+
+// Tests runs of only primitive restart indices, and runs with none.
+TEST(IndexRangeCacheTest, PrimitiveRestartOnly)
+{
+    for (DrawElementsType type : kIndexTypes)
+    {
+        IndexRangeCache cache;
+        std::vector<uint8_t> data(kBufferSize, 0xFF);
+        const size_t typeSize = GetDrawElementsTypeSize(type);
+        const size_t count    = data.size() / typeSize;
+
+        ExpectMatchingRanges(&cache, type, data, 0, count);
+
+        // Replace one index in a chunk, leaving the others all primitive restart indices.
+        data[3 * IndexRangeCache::kChunkSize] = 0;
+        cache.invalidateRange(3 * IndexRangeCache::kChunkSize, 1);
+        ExpectMatchingRanges(&cache, type, data, 0, count);
+
+        std::fill(data.begin(), data.end(), 0);
+        cache.clear();
+        ExpectMatchingRanges(&cache, type, data, 0, count);
+    }
+}
+
+// Tests queries that start and end inside chunks, on chunk boundaries, and that cover no whole
+// chunk.
+TEST(IndexRangeCacheTest, Queries)
+{
+    for (DrawElementsType type : kIndexTypes)
+    {
+        IndexRangeCache cache;
+        std::vector<uint8_t> data(kBufferSize);
+        FillIndices(type, 60000, 2, &data);
+
+        const size_t typeSize    = GetDrawElementsTypeSize(type);
+        const size_t chunkCount  = IndexRangeCache::kChunkSize / typeSize;
+        const size_t bufferCount = data.size() / typeSize;
+
+        ExpectMatchingRanges(&cache, type, data, 0, bufferCount);
+        ExpectMatchingRanges(&cache, type, data, 0, chunkCount);
+        ExpectMatchingRanges(&cache, type, data, IndexRangeCache::kChunkSize, 2 * chunkCount);
+        ExpectMatchingRanges(&cache, type, data, typeSize, chunkCount);
+        ExpectMatchingRanges(&cache, type, data, typeSize, 3 * chunkCount + 5);
+        ExpectMatchingRanges(&cache, type, data, 5 * IndexRangeCache::kChunkSize - typeSize, 7);
+        ExpectMatchingRanges(&cache, type, data, 2 * IndexRangeCache::kChunkSize + 3 * typeSize,
+                             bufferCount - 2 * chunkCount - 3);
+    }
+}
+
+// Tests that the summary of a chunk is used until the chunk is invalidated.
+TEST(IndexRangeCacheTest, Invalidation)
+{
+    for (DrawElementsType type : kIndexTypes)
+    {
+        IndexRangeCache cache;
+        std::vector<uint8_t> data(kBufferSize, 0);
+        FillIndices(type, 100, 3, &data);
+
+        const size_t typeSize    = GetDrawElementsTypeSize(type);
+        const size_t bufferCount = data.size() / typeSize;
+        ExpectMatchingRanges(&cache, type, data, 0, bufferCount);
+
+        // Write a larger index in the middle of a chunk without telling the cache: its summary of
+        // the chunk is used, so the new index is not seen.
+        const size_t modifiedOffset = 4 * IndexRangeCache::kChunkSize + 8 * typeSize;
+        const uint32_t largeIndex   = 150;
+        memcpy(data.data() + modifiedOffset, &largeIndex, typeSize);
+        EXPECT_EQ(100u, cache.computeRange(type, 0, bufferCount, true, data.data()).end());
+
+        // Once the write is known, only that chunk is scanned again and the range is right.
+        cache.invalidateRange(modifiedOffset, typeSize);
+        ExpectMatchingRanges(&cache, type, data, 0, bufferCount);
+        EXPECT_EQ(150u, cache.computeRange(type, 0, bufferCount, true, data.data()).end());
+
+        // A write that straddles two chunks invalidates both.
+        const size_t straddlingOffset = 6 * IndexRangeCache::kChunkSize - typeSize;
+        const uint32_t largerIndex    = 200;
+        memcpy(data.data() + straddlingOffset, &largerIndex, typeSize);
+        memcpy(data.data() + straddlingOffset + typeSize, &largerIndex, typeSize);
+        cache.invalidateRange(straddlingOffset, 2 * typeSize);
+        ExpectMatchingRanges(&cache, type, data, 5 * IndexRangeCache::kChunkSize,
+                             IndexRangeCache::kChunkSize / typeSize);
+        ExpectMatchingRanges(&cache, type, data, 6 * IndexRangeCache::kChunkSize,
+                             IndexRangeCache::kChunkSize / typeSize);
+
+        // Clearing the cache drops the summary.
+        FillIndices(type, 1000, 4, &data);
+        cache.clear();
+        ExpectMatchingRanges(&cache, type, data, 0, bufferCount);
+    }
+}
+
+// Tests that querying indices of another type summarizes the buffer again.
+TEST(IndexRangeCacheTest, TypeChange)
+{
+    IndexRangeCache cache;
+    std::vector<uint8_t> data(kBufferSize);
+    FillIndices(DrawElementsType::UnsignedInt, 70000, 5, &data);
+
+    for (DrawElementsType type : kIndexTypes)
+    {
+        ExpectMatchingRanges(&cache, type, data, 0, data.size() / GetDrawElementsTypeSize(type));
+    }
+    ExpectMatchingRanges(&cache, DrawElementsType::UnsignedInt, data, 0, data.size() / 4);
+}
+}  // anonymous namespace
+}  // namespace gl
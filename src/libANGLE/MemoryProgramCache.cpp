@@ -19,6 +19,7 @@
 
 #include "common/BinaryStream.h"
 #include "common/angle_version_info.h"
+#include "common/span_util.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Debug.h"
@@ -205,27 +206,45 @@ angle::Result MemoryProgramCache::putProgram(const egl::BlobCache::Key &programH
         return angle::Result::Continue;
     }
 
-    angle::MemoryBuffer compressedData;
-    if (!angle::CompressBlob(serializedProgram.size(), serializedProgram.data(), &compressedData))
+    // The serialized binary is owned by the program, so it's copied in case it's compressed
+    // asynchronously.
+    angle::MemoryBuffer uncompressedData;
+    if (!uncompressedData.resize(serializedProgram.size()))
     {
         ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
-                           "Error compressing binary data.");
+                           "Error allocating memory for binary data.");
         return angle::Result::Continue;
     }
+    angle::SpanMemcpy(uncompressedData.span(), serializedProgram.span());
+
+    // TODO: http://anglebug.com/42266037
+    // This was a workaround for Chrome until it added support for EGL_ANDROID_blob_cache,
+    // tracked by http://anglebug.com/42261225. This issue has since been closed, but removing
+    // this still causes a test failure.
+    //
+    // Embedders expect the notification on the thread that linked the program, so it's only
+    // requested when a hook is installed.  The blob is then compressed synchronously.
+    egl::BlobCache::CompressedBlobCallback onCompressed;
+    auto *platform = ANGLEPlatformCurrent();
+    if (platform->cacheProgram != angle::DefaultCacheProgram)
+    {
+        onCompressed = [this, platform](const egl::BlobCache::Key &hash,
+                                        const angle::MemoryBuffer &compressedData) {
+            std::scoped_lock<angle::SimpleMutex> lock(mBlobCache.getMutex());
+            angle::ProgramKeyType key = {};
+            ANGLE_UNSAFE_TODO(memcpy(key.data(), hash.data(), angle::kBlobCacheKeyLength));
+            platform->cacheProgram(platform, key, compressedData.size(), compressedData.data());
+        };
+    }
 
+    if (!mBlobCache.compressAndPut(context, programHash, std::move(uncompressedData),
+                                   onCompressed))
     {
-        std::scoped_lock<angle::SimpleMutex> lock(mBlobCache.getMutex());
-        // TODO: http://anglebug.com/42266037
-        // This was a workaround for Chrome until it added support for EGL_ANDROID_blob_cache,
-        // tracked by http://anglebug.com/42261225. This issue has since been closed, but removing
-        // this still causes a test failure.
-        auto *platform = ANGLEPlatformCurrent();
-        angle::ProgramKeyType key = {};
-        ANGLE_UNSAFE_TODO(memcpy(key.data(), programHash.data(), angle::kBlobCacheKeyLength));
-        platform->cacheProgram(platform, key, compressedData.size(), compressedData.data());
+        ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
+                           "Error compressing binary data.");
+        return angle::Result::Continue;
     }
 
-    mBlobCache.put(context, programHash, std::move(compressedData));
     return angle::Result::Continue;
 }
 
@@ -105,9 +105,7 @@ angle::Result MemoryShaderCache::putShader(const Context *context,
         return angle::Result::Continue;
     }
 
-    size_t compressedSize;
-    if (!mBlobCache.compressAndPut(context, shaderHash, std::move(serializedShader),
-                                   &compressedSize))
+    if (!mBlobCache.compressAndPut(context, shaderHash, std::move(serializedShader)))
     {
         ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                            "Error compressing shader binary data for insertion into cache.");
@@ -107,7 +107,8 @@ void ScheduleSubTasks(const std::shared_ptr<angle::WorkerThreadPool> &workerThre
     eventsOut->reserve(tasks.size());
     for (const std::shared_ptr<rx::LinkSubTask> &subTask : tasks)
     {
-        eventsOut->push_back(workerThreadPool->postWorkerTask(subTask));
+        eventsOut->push_back(
+            workerThreadPool->postWorkerTaskWithPriority(subTask, angle::WorkerTaskPriority::High));
     }
 }
 }  // anonymous namespace
@@ -1554,7 +1555,8 @@ angle::Result Program::loadBinary(const Context *context,
             context->getLinkSubTaskThreadPool(), this, &mState, std::move(loadTask)));
 
         std::shared_ptr<angle::WaitableEvent> mainLoadEvent =
-            context->getShaderCompileThreadPool()->postWorkerTask(mainLoadTask);
+            context->getShaderCompileThreadPool()->postWorkerTaskWithPriority(
+                mainLoadTask, angle::WorkerTaskPriority::High);
         loadEvent = std::make_unique<MainLinkLoadEvent>(mainLoadTask, mainLoadEvent);
     }
     else
@@ -30,7 +30,7 @@ namespace
 {
 
 template <typename ResourceType, typename IDType>
-bool AllocateEmptyObject(HandleAllocator *handleAllocator,
+bool AllocateEmptyObject(BitmapHandleAllocator *handleAllocator,
                          ResourceMap<ResourceType, IDType> *objectMap,
                          IDType *outID)
 {
@@ -42,20 +42,46 @@ bool AllocateEmptyObject(HandleAllocator *handleAllocator,
     return true;
 }
 
+bool AllocateHandles(BitmapHandleAllocator *handleAllocator, size_t count, GLuint *outHandles)
+{
+    return handleAllocator->allocate(count, outHandles);
+}
+
+bool AllocateHandles(HandleAllocator *handleAllocator, size_t count, GLuint *outHandles)
+{
+    for (size_t index = 0; index < count; ++index)
+    {
+        if (!handleAllocator->allocate(&outHandles[index]))
+        {
+            // Either all the handles are allocated or none.
+            while (index > 0)
+            {
+                handleAllocator->release(outHandles[--index]);
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
 }  // anonymous namespace
 
-ResourceManagerBase::ResourceManagerBase()
+template <typename HandleAllocatorType>
+ResourceManagerBase<HandleAllocatorType>::ResourceManagerBase()
     : mHandleAllocator(IMPLEMENTATION_MAX_OBJECT_HANDLES), mRefCount(1)
 {}
 
-ResourceManagerBase::~ResourceManagerBase() = default;
+template <typename HandleAllocatorType>
+ResourceManagerBase<HandleAllocatorType>::~ResourceManagerBase() = default;
 
-void ResourceManagerBase::addRef()
+template <typename HandleAllocatorType>
+void ResourceManagerBase<HandleAllocatorType>::addRef()
 {
     mRefCount++;
 }
 
-void ResourceManagerBase::release(const Context *context)
+template <typename HandleAllocatorType>
+void ResourceManagerBase<HandleAllocatorType>::release(const Context *context)
 {
     if (--mRefCount == 0)
     {
@@ -64,15 +90,19 @@ void ResourceManagerBase::release(const Context *context)
     }
 }
 
-template <typename ResourceType, typename ImplT, typename IDType>
-TypedResourceManager<ResourceType, ImplT, IDType>::~TypedResourceManager()
+template class ResourceManagerBase<HandleAllocator>;
+template class ResourceManagerBase<BitmapHandleAllocator>;
+
+template <typename ResourceType, typename ImplT, typename IDType, typename HandleAllocatorType>
+TypedResourceManager<ResourceType, ImplT, IDType, HandleAllocatorType>::~TypedResourceManager()
 {
     using UnsafeResourceMapIterTyped = UnsafeResourceMapIter<ResourceType, IDType>;
     ASSERT(UnsafeResourceMapIterTyped(mObjectMap).empty());
 }
 
-template <typename ResourceType, typename ImplT, typename IDType>
-void TypedResourceManager<ResourceType, ImplT, IDType>::reset(const Context *context)
+template <typename ResourceType, typename ImplT, typename IDType, typename HandleAllocatorType>
+void TypedResourceManager<ResourceType, ImplT, IDType, HandleAllocatorType>::reset(
+    const Context *context)
 {
     // Note: this function is called when the last context in the share group is destroyed.  Thus
     // there are no thread safety concerns.
@@ -87,9 +117,28 @@ void TypedResourceManager<ResourceType, ImplT, IDType>::reset(const Context *con
     mObjectMap.clear();
 }
 
-template <typename ResourceType, typename ImplT, typename IDType>
-void TypedResourceManager<ResourceType, ImplT, IDType>::deleteObject(const Context *context,
-                                                                     IDType handle)
+template <typename ResourceType, typename ImplT, typename IDType, typename HandleAllocatorType>
+bool TypedResourceManager<ResourceType, ImplT, IDType, HandleAllocatorType>::createEmptyObjects(
+    size_t count,
+    IDType *outIDs)
+{
+    // The IDs only wrap the handle value, so the handles can be allocated in place.
+    static_assert(sizeof(IDType) == sizeof(GLuint));
+    if (!AllocateHandles(&this->mHandleAllocator, count, reinterpret_cast<GLuint *>(outIDs)))
+    {
+        return false;
+    }
+    for (size_t index = 0; index < count; ++index)
+    {
+        mObjectMap.assign(outIDs[index], nullptr);
+    }
+    return true;
+}
+
+template <typename ResourceType, typename ImplT, typename IDType, typename HandleAllocatorType>
+void TypedResourceManager<ResourceType, ImplT, IDType, HandleAllocatorType>::deleteObject(
+    const Context *context,
+    IDType handle)
 {
     ResourceType *resource = nullptr;
     if (!mObjectMap.erase(handle, &resource))
@@ -115,7 +164,7 @@ template class TypedResourceManager<Buffer, BufferManager, BufferID>;
 template class TypedResourceManager<Texture, TextureManager, TextureID>;
 template class TypedResourceManager<Renderbuffer, RenderbufferManager, RenderbufferID>;
 template class TypedResourceManager<Sampler, SamplerManager, SamplerID>;
-template class TypedResourceManager<Sync, SyncManager, SyncID>;
+template class TypedResourceManager<Sync, SyncManager, SyncID, HandleAllocator>;
 template class TypedResourceManager<Framebuffer, FramebufferManager, FramebufferID>;
 template class TypedResourceManager<ProgramPipeline, ProgramPipelineManager, ProgramPipelineID>;
 
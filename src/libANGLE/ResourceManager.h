@@ -12,6 +12,7 @@
 
 #include "angle_gl.h"
 #include "common/angleutils.h"
+#include "libANGLE/BitmapHandleAllocator.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/HandleAllocator.h"
 #include "libANGLE/ResourceMap.h"
@@ -44,6 +45,10 @@ class Shader;
 class Sync;
 class Texture;
 
+// The managers of the objects that glGen* creates in batches use BitmapHandleAllocator, which can
+// allocate many handles at once.  The others keep HandleAllocator, which is faster at allocating a
+// single handle and reuses the released ones in FIFO order.
+template <typename HandleAllocatorType>
 class ResourceManagerBase : angle::NonCopyable
 {
   public:
@@ -56,18 +61,24 @@ class ResourceManagerBase : angle::NonCopyable
     virtual void reset(const Context *context) = 0;
     virtual ~ResourceManagerBase();
 
-    HandleAllocator mHandleAllocator;
+    HandleAllocatorType mHandleAllocator;
 
   private:
     size_t mRefCount;
 };
 
-template <typename ResourceType, typename ImplT, typename IDType>
-class TypedResourceManager : public ResourceManagerBase
+template <typename ResourceType,
+          typename ImplT,
+          typename IDType,
+          typename HandleAllocatorType = BitmapHandleAllocator>
+class TypedResourceManager : public ResourceManagerBase<HandleAllocatorType>
 {
   public:
     TypedResourceManager() {}
 
+    // Allocates the handles of |count| objects that are created when first bound, or none if there
+    // are not that many handles available.
+    bool createEmptyObjects(size_t count, IDType *outIDs);
     void deleteObject(const Context *context, IDType handle);
     ANGLE_INLINE bool isHandleGenerated(IDType handle) const
     {
@@ -170,7 +181,7 @@ class BufferManager
     ~BufferManager() override;
 };
 
-class ShaderProgramManager : public ResourceManagerBase
+class ShaderProgramManager : public ResourceManagerBase<HandleAllocator>
 {
   public:
     ShaderProgramManager();
@@ -283,7 +294,7 @@ class SamplerManager : public TypedResourceManager<Sampler, SamplerManager, Samp
     ~SamplerManager() override;
 };
 
-class SyncManager : public TypedResourceManager<Sync, SyncManager, SyncID>
+class SyncManager : public TypedResourceManager<Sync, SyncManager, SyncID, HandleAllocator>
 {
   public:
     bool createSync(rx::GLImplFactory *factory, SyncID *outSync);
@@ -342,7 +353,7 @@ class ProgramPipelineManager
     ~ProgramPipelineManager() override;
 };
 
-class MemoryObjectManager : public ResourceManagerBase
+class MemoryObjectManager : public ResourceManagerBase<HandleAllocator>
 {
   public:
     MemoryObjectManager();
@@ -360,7 +371,7 @@ class MemoryObjectManager : public ResourceManagerBase
     ResourceMap<MemoryObject, MemoryObjectID> mMemoryObjects;
 };
 
-class SemaphoreManager : public ResourceManagerBase
+class SemaphoreManager : public ResourceManagerBase<HandleAllocator>
 {
   public:
     SemaphoreManager();
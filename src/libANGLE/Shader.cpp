@@ -734,7 +734,7 @@ void Shader::compile(const Context *context, angle::JobResultExpectancy resultEx
             ? angle::JobThreadSafety::Safe
             : angle::JobThreadSafety::Unsafe;
     std::shared_ptr<angle::WaitableEvent> compileEvent =
-        context->postCompileLinkTask(compileTask, threadSafety, resultExpectancy);
+        context->postCompileTask(compileTask, threadSafety, resultExpectancy);
 
     mCompileJob                     = std::make_shared<CompileJob>();
     mCompileJob->shCompilerInstance = std::move(compilerInstance);
@@ -53,6 +53,44 @@ class SizedMRUCache final : angle::NonCopyable
         return true;
     }
 
+    // Same as get(), but lets the caller modify the value in place.  The value's size must not be
+    // changed.
+    bool getMutable(const Key &key, Value **valueOut)
+    {
+        const auto &iter = mStore.Get(key);
+        if (iter == mStore.end())
+        {
+            return false;
+        }
+        *valueOut = &iter->second.value;
+        return true;
+    }
+
+    // Returns the least recently used value without affecting the recency of entries.
+    bool peekLeastRecentlyUsed(const Value **valueOut) const
+    {
+        if (mStore.empty())
+        {
+            return false;
+        }
+        *valueOut = &mStore.rbegin()->second.value;
+        return true;
+    }
+
+    // Evicts the least recently used value and returns its size.
+    size_t evictLeastRecentlyUsed()
+    {
+        if (mStore.empty())
+        {
+            return 0;
+        }
+        auto iter         = mStore.rbegin();
+        const size_t size = iter->second.size;
+        mCurrentSize -= size;
+        mStore.Erase(iter);
+        return size;
+    }
+
     bool getAt(size_t index, const Key **keyOut, const Value **valueOut)
     {
         if (index < mStore.size())
@@ -12,6 +12,7 @@
 #endif
 
 #include "libANGLE/angletypes.h"
+#include "common/lz_utils.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/State.h"
 #include "libANGLE/VertexArray.h"
@@ -1198,8 +1199,127 @@ GLsizeiptr GetBoundBufferAvailableSize(const OffsetBindingPointer<Buffer> &bindi
    //
 namespace angle
 {
+namespace
+{
+// Header of blobs compressed with BlobCompressionCodec::LZ.  The magic can't be mistaken for a
+// gzip stream, which always starts with 0x1F 0x8B.
+constexpr std::array<uint8_t, 4> kLZBlobMagic = {'A', 'N', 'L', 'Z'};
+struct LZBlobHeader
+{
+    std::array<uint8_t, 4> magic;
+    uint32_t uncompressedSize;
+};
+static_assert(sizeof(LZBlobHeader) == 8, "LZBlobHeader must be tightly packed");
+
+bool IsLZBlob(const uint8_t *compressedData, const size_t compressedSize)
+{
+    return compressedSize >= sizeof(LZBlobHeader) &&
+           memcmp(compressedData, kLZBlobMagic.data(), kLZBlobMagic.size()) == 0;
+}
+
+int GetZlibCompressionLevel(BlobCompressionCodec codec)
+{
+    switch (codec)
+    {
+        case BlobCompressionCodec::ZlibFastest:
+            return Z_BEST_SPEED;
+        case BlobCompressionCodec::ZlibDefault:
+            return Z_DEFAULT_COMPRESSION;
+        case BlobCompressionCodec::ZlibBest:
+            return Z_BEST_COMPRESSION;
+        default:
+            UNREACHABLE();
+            return Z_DEFAULT_COMPRESSION;
+    }
+}
+
+bool CompressBlobLZ(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData)
+{
+    if (cacheSize > std::numeric_limits<uint32_t>::max())
+    {
+        ERR() << "Cache data too large to compress";
+        return false;
+    }
+
+    const size_t maxCompressedSize = sizeof(LZBlobHeader) + LZCompressBound(cacheSize);
+    if (!compressedData->resize(maxCompressedSize))
+    {
+        ERR() << "Failed to allocate memory for compression";
+        return false;
+    }
+
+    LZBlobHeader header;
+    header.magic            = kLZBlobMagic;
+    header.uncompressedSize = static_cast<uint32_t>(cacheSize);
+    memcpy(compressedData->data(), &header, sizeof(header));
+
+    const size_t lzSize = LZCompress(angle::Span<const uint8_t>(cacheData, cacheSize),
+                                     compressedData->subspan(sizeof(LZBlobHeader)));
+    if (lzSize == 0)
+    {
+        ERR() << "Failed to compress cache data";
+        return false;
+    }
+
+    compressedData->setSize(sizeof(LZBlobHeader) + lzSize);
+    return true;
+}
+
+bool DecompressBlobLZ(const uint8_t *compressedData,
+                      const size_t compressedSize,
+                      size_t maxUncompressedDataSize,
+                      MemoryBuffer *uncompressedData)
+{
+    LZBlobHeader header;
+    memcpy(&header, compressedData, sizeof(header));
+
+    if (header.uncompressedSize == 0)
+    {
+        ERR() << "Decompressed data size is zero. Wrong or corrupted data? (compressed size is: "
+              << compressedSize << ")";
+        return false;
+    }
+
+    if (header.uncompressedSize > maxUncompressedDataSize)
+    {
+        ERR() << "Decompressed data size is larger than the maximum supported ("
+              << header.uncompressedSize << " vs " << maxUncompressedDataSize << ")";
+        return false;
+    }
+
+    if (!uncompressedData->resize(header.uncompressedSize))
+    {
+        ERR() << "Failed to allocate memory for decompression";
+        return false;
+    }
+
+    if (!LZDecompress(angle::Span<const uint8_t>(compressedData + sizeof(LZBlobHeader),
+                                                 compressedSize - sizeof(LZBlobHeader)),
+                      uncompressedData->span()))
+    {
+        WARN() << "Failed to decompress data\n";
+        return false;
+    }
+
+    return true;
+}
+}  // anonymous namespace
+
 bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData)
 {
+    return CompressBlob(cacheSize, cacheData, BlobCompressionCodec::ZlibDefault, compressedData);
+}
+
+bool CompressBlob(const size_t cacheSize,
+                  const uint8_t *cacheData,
+                  BlobCompressionCodec codec,
+                  MemoryBuffer *compressedData)
+{
+    if (codec == BlobCompressionCodec::LZ)
+    {
+        return CompressBlobLZ(cacheSize, cacheData, compressedData);
+    }
+
     uLong uncompressedSize       = static_cast<uLong>(cacheSize);
     uLong expectedCompressedSize = zlib_internal::GzipExpectedCompressedSize(uncompressedSize);
     uLong actualCompressedSize   = expectedCompressedSize;
@@ -1211,8 +1331,9 @@ bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer
         return false;
     }
 
-    int zResult = zlib_internal::GzipCompressHelper(compressedData->data(), &actualCompressedSize,
-                                                    cacheData, uncompressedSize, nullptr, nullptr);
+    int zResult = zlib_internal::CompressHelper(
+        zlib_internal::GZIP, compressedData->data(), &actualCompressedSize, cacheData,
+        uncompressedSize, GetZlibCompressionLevel(codec), nullptr, nullptr);
 
     if (zResult != Z_OK)
     {
@@ -1232,6 +1353,12 @@ bool DecompressBlob(const uint8_t *compressedData,
                     size_t maxUncompressedDataSize,
                     MemoryBuffer *uncompressedData)
 {
+    if (IsLZBlob(compressedData, compressedSize))
+    {
+        return DecompressBlobLZ(compressedData, compressedSize, maxUncompressedDataSize,
+                                uncompressedData);
+    }
+
     // Call zlib function to decompress.
     uint32_t uncompressedSize =
         zlib_internal::GetGzipUncompressedSize(compressedData, compressedSize);
@@ -1423,7 +1423,25 @@ class BlobCacheValue  // To be replaced with std::span when C++20 is required
     size_t mSize;
 };
 
+// Codecs used to compress blobs.  Zlib blobs are plain gzip streams, which is what ANGLE has always
+// stored.  Blobs compressed with other codecs start with a header that identifies the codec, so
+// DecompressBlob() can read blobs produced with any codec.
+enum class BlobCompressionCodec : uint8_t
+{
+    ZlibFastest,
+    ZlibDefault,
+    ZlibBest,
+    // A fast LZ77 codec (see common/lz_utils.h).  Compresses several times faster than zlib at the
+    // cost of compression ratio.
+    LZ,
+};
+
+// Compresses with BlobCompressionCodec::ZlibDefault.
 bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData);
+bool CompressBlob(const size_t cacheSize,
+                  const uint8_t *cacheData,
+                  BlobCompressionCodec codec,
+                  MemoryBuffer *compressedData);
 bool DecompressBlob(const uint8_t *compressedData,
                     const size_t compressedSize,
                     size_t maxUncompressedDataSize,
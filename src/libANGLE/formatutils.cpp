@@ -9,6 +9,10 @@
 #include "libANGLE/formatutils.h"
 #include "common/unsafe_buffers.h"
 
+#include <array>
+#include <limits>
+#include <vector>
+
 #include "anglebase/no_destructor.h"
 #include "common/mathutil.h"
 #include "gpu_info_util/SystemInfo.h"
@@ -617,11 +621,104 @@ bool InternalFormat::operator!=(const InternalFormat &other) const
     return !(*this == other);
 }
 
-void InsertFormatInfo(InternalFormatInfoMap *map, const InternalFormat &formatInfo)
+// The info of all internal formats, stored contiguously and indexed by an open addressing hash
+// table.  A sized internal format has a single entry, which is returned for any type, so it is
+// indexed with kAnyType instead of its type.  Unsized internal formats are additionally indexed
+// with kUnsizedType, to tell which internal formats exist.
+class InternalFormatInfoTable final
 {
-    ASSERT(!formatInfo.sized || (*map).count(formatInfo.internalFormat) == 0);
-    ASSERT((*map)[formatInfo.internalFormat].count(formatInfo.type) == 0);
-    (*map)[formatInfo.internalFormat][formatInfo.type] = formatInfo;
+  public:
+    static constexpr GLenum kAnyType     = 0xFFFFFFFF;
+    static constexpr GLenum kUnsizedType = 0xFFFFFFFE;
+
+    InternalFormatInfoTable() : mKeyCount(0) { mKeys.fill(kEmptyKey); }
+
+    void insert(const InternalFormat &formatInfo)
+    {
+        ASSERT(!formatInfo.sized || !contains(formatInfo.internalFormat));
+        ASSERT(find(formatInfo.internalFormat, kAnyType) == nullptr);
+
+        const uint16_t index = static_cast<uint16_t>(mInfos.size());
+        mInfos.push_back(formatInfo);
+
+        if (formatInfo.sized)
+        {
+            insertKey(formatInfo.internalFormat, kAnyType, index);
+            return;
+        }
+
+        insertKey(formatInfo.internalFormat, formatInfo.type, index);
+        if (find(formatInfo.internalFormat, kUnsizedType) == nullptr)
+        {
+            insertKey(formatInfo.internalFormat, kUnsizedType, index);
+        }
+    }
+
+    ANGLE_INLINE const InternalFormat *find(GLenum internalFormat, GLenum type) const
+    {
+        const uint64_t key = MakeKey(internalFormat, type);
+        size_t slot        = GetFirstSlot(key);
+        while (mKeys[slot] != kEmptyKey)
+        {
+            if (mKeys[slot] == key)
+            {
+                return &mInfos[mIndices[slot]];
+            }
+            slot = (slot + 1) % kSlotCount;
+        }
+        return nullptr;
+    }
+
+    bool contains(GLenum internalFormat) const
+    {
+        return find(internalFormat, kAnyType) != nullptr ||
+               find(internalFormat, kUnsizedType) != nullptr;
+    }
+
+    const std::vector<InternalFormat> &getInfos() const { return mInfos; }
+
+  private:
+    // Keeping the table at most half full makes for short probe sequences.
+    static constexpr size_t kSlotBits   = 10;
+    static constexpr size_t kSlotCount  = size_t(1) << kSlotBits;
+    static constexpr uint64_t kEmptyKey = std::numeric_limits<uint64_t>::max();
+
+    static constexpr uint64_t MakeKey(GLenum internalFormat, GLenum type)
+    {
+        return static_cast<uint64_t>(type) << 32 | internalFormat;
+    }
+
+    static constexpr size_t GetFirstSlot(uint64_t key)
+    {
+        // Fibonacci hashing, keeping the top bits of the product.
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> (64 - kSlotBits));
+    }
+
+    void insertKey(GLenum internalFormat, GLenum type, uint16_t index)
+    {
+        ASSERT(mKeyCount < kSlotCount / 2);
+        ++mKeyCount;
+
+        const uint64_t key = MakeKey(internalFormat, type);
+        size_t slot        = GetFirstSlot(key);
+        while (mKeys[slot] != kEmptyKey)
+        {
+            ASSERT(mKeys[slot] != key);
+            slot = (slot + 1) % kSlotCount;
+        }
+        mKeys[slot]    = key;
+        mIndices[slot] = index;
+    }
+
+    std::array<uint64_t, kSlotCount> mKeys;
+    std::array<uint16_t, kSlotCount> mIndices;
+    size_t mKeyCount;
+    std::vector<InternalFormat> mInfos;
+};
+
+void InsertFormatInfo(InternalFormatInfoTable *map, const InternalFormat &formatInfo)
+{
+    map->insert(formatInfo);
 }
 
 // YuvFormatInfo implementation
@@ -802,7 +899,7 @@ constexpr FormatBits FB()
     return formatBits;
 }
 
-void AddRGBAXFormat(InternalFormatInfoMap *map,
+void AddRGBAXFormat(InternalFormatInfoTable *map,
                     GLenum internalFormat,
                     bool sized,
                     const FormatBits &formatBits,
@@ -843,7 +940,7 @@ void AddRGBAXFormat(InternalFormatInfoMap *map,
     InsertFormatInfo(map, formatInfo);
 }
 
-void AddRGBAFormat(InternalFormatInfoMap *map,
+void AddRGBAFormat(InternalFormatInfoTable *map,
                    GLenum internalFormat,
                    bool sized,
                    GLuint red,
@@ -866,7 +963,7 @@ void AddRGBAFormat(InternalFormatInfoMap *map,
                           textureAttachmentSupport, renderbufferSupport, blendSupport);
 }
 
-static void AddLUMAFormat(InternalFormatInfoMap *map,
+static void AddLUMAFormat(InternalFormatInfoTable *map,
                           GLenum internalFormat,
                           bool sized,
                           GLuint luminance,
@@ -898,7 +995,7 @@ static void AddLUMAFormat(InternalFormatInfoMap *map,
     InsertFormatInfo(map, formatInfo);
 }
 
-void AddDepthStencilFormat(InternalFormatInfoMap *map,
+void AddDepthStencilFormat(InternalFormatInfoTable *map,
                            GLenum internalFormat,
                            bool sized,
                            GLuint depthBits,
@@ -933,7 +1030,7 @@ void AddDepthStencilFormat(InternalFormatInfoMap *map,
     InsertFormatInfo(map, formatInfo);
 }
 
-void AddCompressedFormat(InternalFormatInfoMap *map,
+void AddCompressedFormat(InternalFormatInfoTable *map,
                          GLenum internalFormat,
                          GLuint compressedBlockWidth,
                          GLuint compressedBlockHeight,
@@ -965,7 +1062,7 @@ void AddCompressedFormat(InternalFormatInfoMap *map,
     InsertFormatInfo(map, formatInfo);
 }
 
-void AddPalettedFormat(InternalFormatInfoMap *map,
+void AddPalettedFormat(InternalFormatInfoTable *map,
                        GLenum internalFormat,
                        GLuint paletteBits,
                        GLuint pixelBytes,
@@ -993,7 +1090,7 @@ void AddPalettedFormat(InternalFormatInfoMap *map,
     InsertFormatInfo(map, formatInfo);
 }
 
-void AddYUVFormat(InternalFormatInfoMap *map,
+void AddYUVFormat(InternalFormatInfoTable *map,
                   GLenum internalFormat,
                   GLuint cr,
                   GLuint y,
@@ -1044,12 +1141,12 @@ static bool RequireBGRXSRGBSupport(const Version &clientVersion, const Extension
            (clientVersion >= Version(3, 0) || extensions.sRGBEXT);
 }
 
-static InternalFormatInfoMap BuildInternalFormatInfoMap()
+static InternalFormatInfoTable BuildInternalFormatInfoTable()
 {
-    InternalFormatInfoMap map;
+    InternalFormatInfoTable map;
 
     // From ES 3.0.1 spec, table 3.12
-    map[GL_NONE][GL_NONE] = InternalFormat();
+    map.insert(InternalFormat());
 
     // clang-format off
 
@@ -1424,6 +1521,23 @@ static InternalFormatInfoMap BuildInternalFormatInfoMap()
     return map;
 }
 
+static const InternalFormatInfoTable &GetInternalFormatInfoTable()
+{
+    static const angle::base::NoDestructor<InternalFormatInfoTable> formatTable(
+        BuildInternalFormatInfoTable());
+    return *formatTable;
+}
+
+static InternalFormatInfoMap BuildInternalFormatInfoMap()
+{
+    InternalFormatInfoMap map;
+    for (const InternalFormat &formatInfo : GetInternalFormatInfoTable().getInfos())
+    {
+        map[formatInfo.internalFormat][formatInfo.type] = formatInfo;
+    }
+    return map;
+}
+
 const InternalFormatInfoMap &GetInternalFormatMap()
 {
     static const angle::base::NoDestructor<InternalFormatInfoMap> formatMap(
@@ -1522,18 +1636,15 @@ static FormatSet BuildAllSizedInternalFormatSet()
 {
     FormatSet result;
 
-    for (const auto &internalFormat : GetInternalFormatMap())
+    for (const InternalFormat &formatInfo : GetInternalFormatInfoTable().getInfos())
     {
-        for (const auto &type : internalFormat.second)
+        if (formatInfo.sized)
         {
-            if (type.second.sized)
-            {
-                // TODO(jmadill): Fix this hack.
-                if (internalFormat.first == GL_BGR565_ANGLEX)
-                    continue;
+            // TODO(jmadill): Fix this hack.
+            if (formatInfo.internalFormat == GL_BGR565_ANGLEX)
+                continue;
 
-                result.insert(internalFormat.first);
-            }
+            result.insert(formatInfo.internalFormat);
         }
     }
 
@@ -1598,48 +1709,24 @@ uint32_t GetPackedTypeInfo(GLenum type)
 const InternalFormat &GetSizedInternalFormatInfo(GLenum internalFormat)
 {
     static const InternalFormat defaultInternalFormat;
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-    auto iter                              = formatMap.find(internalFormat);
-
-    // Sized internal formats only have one type per entry
-    if (iter == formatMap.end() || iter->second.size() != 1)
-    {
-        return defaultInternalFormat;
-    }
-
-    const InternalFormat &internalFormatInfo = iter->second.begin()->second;
-    if (!internalFormatInfo.sized)
-    {
-        return defaultInternalFormat;
-    }
-
-    return internalFormatInfo;
+    const InternalFormat *internalFormatInfo =
+        GetInternalFormatInfoTable().find(internalFormat, InternalFormatInfoTable::kAnyType);
+    return internalFormatInfo ? *internalFormatInfo : defaultInternalFormat;
 }
 
 const InternalFormat &GetInternalFormatInfo(GLenum internalFormat, GLenum type)
 {
     static const InternalFormat defaultInternalFormat;
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-
-    auto internalFormatIter = formatMap.find(internalFormat);
-    if (internalFormatIter == formatMap.end())
-    {
-        return defaultInternalFormat;
-    }
+    const InternalFormatInfoTable &formatTable = GetInternalFormatInfoTable();
 
     // If the internal format is sized, simply return it without the type check.
-    if (internalFormatIter->second.size() == 1 && internalFormatIter->second.begin()->second.sized)
+    const InternalFormat *internalFormatInfo =
+        formatTable.find(internalFormat, InternalFormatInfoTable::kAnyType);
+    if (internalFormatInfo == nullptr && type != InternalFormatInfoTable::kUnsizedType)
     {
-        return internalFormatIter->second.begin()->second;
+        internalFormatInfo = formatTable.find(internalFormat, type);
     }
-
-    auto typeIter = internalFormatIter->second.find(type);
-    if (typeIter == internalFormatIter->second.end())
-    {
-        return defaultInternalFormat;
-    }
-
-    return typeIter->second;
+    return internalFormatInfo ? *internalFormatInfo : defaultInternalFormat;
 }
 
 // Used by validation to determine if an internal format is internal to ANGLE and should not be
@@ -3198,8 +3285,7 @@ angle::FormatID ConvertFormatSignedness(const angle::Format &format)
 
 bool ValidES3InternalFormat(GLenum internalFormat)
 {
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-    return internalFormat != GL_NONE && formatMap.find(internalFormat) != formatMap.end();
+    return internalFormat != GL_NONE && GetInternalFormatInfoTable().contains(internalFormat);
 }
 
 VertexFormat::VertexFormat(GLenum typeIn,
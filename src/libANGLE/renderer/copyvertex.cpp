@@ -0,0 +1,364 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+// copyvertex.cpp: Implements the vector code of the vertex conversion functions, and the
+// conversion of large vertex arrays on a thread pool.
+
+#include "libANGLE/renderer/copyvertex.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include "common/WorkerThread.h"
+#include "image_util/image_simd.h"
+
+namespace rx
+{
+namespace
+{
+// Conversions with less output than this are done on the calling thread, as splitting them would
+// cost more than it saves.
+constexpr size_t kMinParallelCopyBytes = 4 * 1024 * 1024;
+// Each range of vertices of a split conversion outputs at least this much.
+constexpr size_t kMinParallelCopyRangeBytes = 1024 * 1024;
+constexpr size_t kMaxParallelCopyRanges     = 16;
+
+class CopyVerticesTask final : public angle::Closure
+{
+  public:
+    CopyVerticesTask(VertexCopyFunction copyFunction,
+                     const uint8_t *input,
+                     size_t stride,
+                     size_t count,
+                     uint8_t *output)
+        : mCopyFunction(copyFunction),
+          mInput(input),
+          mStride(stride),
+          mCount(count),
+          mOutput(output)
+    {}
+
+    void operator()() override { mCopyFunction(mInput, mStride, mCount, mOutput); }
+
+  private:
+    VertexCopyFunction mCopyFunction;
+    const uint8_t *mInput;
+    size_t mStride;
+    size_t mCount;
+    uint8_t *mOutput;
+};
+
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+ANGLE_LOADIMAGE_TARGET("ssse3")
+size_t Copy3To4ByteVerticesSSSE3(const uint8_t *input, size_t count, uint8_t alpha, uint8_t *output)
+{
+    // Spreads 4 vertices to 4 bytes each, and fills in the alpha bytes.
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alphaBytes = _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(alpha) << 24));
+
+    // Each iteration reads 16 bytes, 4 more than the vertices it converts.
+    size_t i = 0;
+    for (; 3 * i + 16 <= 3 * count; i += 4)
+    {
+        const __m128i vertices = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + 3 * i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 4 * i),
+                         _mm_or_si128(_mm_shuffle_epi8(vertices, shuffle), alphaBytes));
+    }
+    return i;
+}
+
+ANGLE_LOADIMAGE_TARGET("ssse3")
+size_t Copy3To4ShortVerticesSSSE3(const uint8_t *input,
+                                  size_t count,
+                                  uint16_t alpha,
+                                  uint8_t *output)
+{
+    // Spreads 2 vertices to 8 bytes each, and fills in the alpha shorts.
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 3, 4, 5, -1, -1, 6, 7, 8, 9, 10, 11, -1, -1);
+    const __m128i alphaShorts = _mm_setr_epi16(0, 0, 0, static_cast<short>(alpha), 0, 0, 0,
+                                               static_cast<short>(alpha));
+
+    // Each iteration reads 16 bytes, 4 more than the vertices it converts.
+    size_t i = 0;
+    for (; 6 * i + 16 <= 6 * count; i += 2)
+    {
+        const __m128i vertices = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + 6 * i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 8 * i),
+                         _mm_or_si128(_mm_shuffle_epi8(vertices, shuffle), alphaShorts));
+    }
+    return i;
+}
+
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t CopyFixedToFloatComponentsSSE2(const uint8_t *input, size_t componentCount, uint8_t *output)
+{
+    const __m128 divisor = _mm_set1_ps(1.0f / (1 << 16));
+
+    size_t i = 0;
+    for (; i + 4 <= componentCount; i += 4)
+    {
+        const __m128i fixed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + 4 * i));
+        _mm_storeu_ps(reinterpret_cast<float *>(output) + i,
+                      _mm_mul_ps(_mm_cvtepi32_ps(fixed), divisor));
+    }
+    return i;
+}
+
+template <typename T>
+ANGLE_LOADIMAGE_TARGET("sse2")
+size_t CopyIntegerToFloatComponentsSSE2(const uint8_t *input,
+                                        size_t componentCount,
+                                        uint8_t *output)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 4 <= componentCount; i += 4)
+    {
+        __m128i components;
+        if constexpr (sizeof(T) == 1)
+        {
+            uint32_t bytes;
+            memcpy(&bytes, input + i, sizeof(bytes));
+            components = _mm_cvtsi32_si128(static_cast<int>(bytes));
+            // Widen to 16 bits.  Interleaving a signed value with itself and shifting it back
+            // extends its sign.
+            components = std::is_signed<T>::value
+                             ? _mm_srai_epi16(_mm_unpacklo_epi8(components, components), 8)
+                             : _mm_unpacklo_epi8(components, zero);
+        }
+        else
+        {
+            components = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(input + 2 * i));
+        }
+
+        // Widen to 32 bits.
+        components = std::is_signed<T>::value
+                         ? _mm_srai_epi32(_mm_unpacklo_epi16(components, components), 16)
+                         : _mm_unpacklo_epi16(components, zero);
+
+        _mm_storeu_ps(reinterpret_cast<float *>(output) + i, _mm_cvtepi32_ps(components));
+    }
+    return i;
+}
+#endif  // defined(ANGLE_LOADIMAGE_USE_SSE)
+
+#if defined(ANGLE_LOADIMAGE_USE_NEON)
+size_t Copy3To4ByteVerticesNEON(const uint8_t *input, size_t count, uint8_t alpha, uint8_t *output)
+{
+    const uint8x16_t alphaBytes = vdupq_n_u8(alpha);
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16x3_t vertices = vld3q_u8(input + 3 * i);
+        const uint8x16x4_t converted = {
+            {vertices.val[0], vertices.val[1], vertices.val[2], alphaBytes}};
+        vst4q_u8(output + 4 * i, converted);
+    }
+    return i;
+}
+
+size_t Copy3To4ShortVerticesNEON(const uint8_t *input,
+                                 size_t count,
+                                 uint16_t alpha,
+                                 uint8_t *output)
+{
+    const uint16x8_t alphaShorts = vdupq_n_u16(alpha);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const uint16x8x3_t vertices = vld3q_u16(reinterpret_cast<const uint16_t *>(input + 6 * i));
+        const uint16x8x4_t converted = {
+            {vertices.val[0], vertices.val[1], vertices.val[2], alphaShorts}};
+        vst4q_u16(reinterpret_cast<uint16_t *>(output + 8 * i), converted);
+    }
+    return i;
+}
+
+size_t CopyFixedToFloatComponentsNEON(const uint8_t *input, size_t componentCount, uint8_t *output)
+{
+    size_t i = 0;
+    for (; i + 4 <= componentCount; i += 4)
+    {
+        const int32x4_t fixed = vreinterpretq_s32_u8(vld1q_u8(input + 4 * i));
+        vst1q_f32(reinterpret_cast<float *>(output) + i,
+                  vmulq_n_f32(vcvtq_f32_s32(fixed), 1.0f / (1 << 16)));
+    }
+    return i;
+}
+
+template <typename T>
+size_t CopyIntegerToFloatComponentsNEON(const uint8_t *input,
+                                        size_t componentCount,
+                                        uint8_t *output)
+{
+    size_t i = 0;
+    for (; i + 8 <= componentCount; i += 8)
+    {
+        float *floats = reinterpret_cast<float *>(output) + i;
+        if constexpr (std::is_signed<T>::value)
+        {
+            const int16x8_t components =
+                sizeof(T) == 1 ? vmovl_s8(vreinterpret_s8_u8(vld1_u8(input + i)))
+                               : vreinterpretq_s16_u8(vld1q_u8(input + 2 * i));
+            vst1q_f32(floats, vcvtq_f32_s32(vmovl_s16(vget_low_s16(components))));
+            vst1q_f32(floats + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(components))));
+        }
+        else
+        {
+            const uint16x8_t components = sizeof(T) == 1
+                                              ? vmovl_u8(vld1_u8(input + i))
+                                              : vreinterpretq_u16_u8(vld1q_u8(input + 2 * i));
+            vst1q_f32(floats, vcvtq_f32_u32(vmovl_u16(vget_low_u16(components))));
+            vst1q_f32(floats + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(components))));
+        }
+    }
+    return i;
+}
+#endif  // defined(ANGLE_LOADIMAGE_USE_NEON)
+}  // anonymous namespace
+
+void CopyVertexDataInParallel(VertexCopyFunction copyFunction,
+                              angle::WorkerThreadPool *pool,
+                              const uint8_t *input,
+                              size_t stride,
+                              size_t count,
+                              uint8_t *output,
+                              size_t outputStride)
+{
+    const size_t outputSize = count * outputStride;
+
+    size_t rangeCount = 1;
+    if (pool != nullptr && pool->isAsync() && outputSize >= kMinParallelCopyBytes)
+    {
+        rangeCount = std::min(outputSize / kMinParallelCopyRangeBytes, kMaxParallelCopyRanges);
+    }
+
+    if (rangeCount <= 1)
+    {
+        copyFunction(input, stride, count, output);
+        return;
+    }
+
+    const size_t verticesPerRange = (count + rangeCount - 1) / rangeCount;
+    std::vector<std::shared_ptr<CopyVerticesTask>> tasks;
+    for (size_t firstVertex = 0; firstVertex < count; firstVertex += verticesPerRange)
+    {
+        tasks.push_back(std::make_shared<CopyVerticesTask>(
+            copyFunction, input + firstVertex * stride, stride,
+            std::min(verticesPerRange, count - firstVertex), output + firstVertex * outputStride));
+    }
+
+    // The calling thread converts the last range instead of waiting idle.  The draw call is
+    // waiting for the conversion, so the other ranges are given high priority.
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+    for (size_t taskIndex = 0; taskIndex + 1 < tasks.size(); ++taskIndex)
+    {
+        std::shared_ptr<angle::WaitableEvent> waitEvent =
+            pool->postWorkerTaskWithPriority(tasks[taskIndex], angle::WorkerTaskPriority::High);
+        if (waitEvent)
+        {
+            waitEvents.push_back(std::move(waitEvent));
+        }
+        else
+        {
+            (*tasks[taskIndex])();
+        }
+    }
+    (*tasks.back())();
+
+    angle::WaitableEvent::WaitMany(&waitEvents);
+}
+
+namespace priv
+{
+size_t Copy3To4ByteVertices(const uint8_t *input, size_t count, uint8_t alpha, uint8_t *output)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (angle::GetSupportedSIMDLevel() >= angle::SIMDLevel::SSSE3)
+    {
+        return Copy3To4ByteVerticesSSSE3(input, count, alpha, output);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (angle::GetSupportedSIMDLevel() == angle::SIMDLevel::NEON)
+    {
+        return Copy3To4ByteVerticesNEON(input, count, alpha, output);
+    }
+#endif
+    return 0;
+}
+
+size_t Copy3To4ShortVertices(const uint8_t *input, size_t count, uint16_t alpha, uint8_t *output)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (angle::GetSupportedSIMDLevel() >= angle::SIMDLevel::SSSE3)
+    {
+        return Copy3To4ShortVerticesSSSE3(input, count, alpha, output);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (angle::GetSupportedSIMDLevel() == angle::SIMDLevel::NEON)
+    {
+        return Copy3To4ShortVerticesNEON(input, count, alpha, output);
+    }
+#endif
+    return 0;
+}
+
+size_t CopyFixedToFloatComponents(const uint8_t *input, size_t componentCount, uint8_t *output)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (angle::GetSupportedSIMDLevel() >= angle::SIMDLevel::SSE2)
+    {
+        return CopyFixedToFloatComponentsSSE2(input, componentCount, output);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (angle::GetSupportedSIMDLevel() == angle::SIMDLevel::NEON)
+    {
+        return CopyFixedToFloatComponentsNEON(input, componentCount, output);
+    }
+#endif
+    return 0;
+}
+
+template <typename T>
+size_t CopyIntegerToFloatComponents(const uint8_t *input, size_t componentCount, uint8_t *output)
+{
+    static_assert(std::is_integral<T>::value && sizeof(T) <= 2);
+#if defined(ANGLE_LOADIMAGE_USE_SSE)
+    if (angle::GetSupportedSIMDLevel() >= angle::SIMDLevel::SSE2)
+    {
+        return CopyIntegerToFloatComponentsSSE2<T>(input, componentCount, output);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    if (angle::GetSupportedSIMDLevel() == angle::SIMDLevel::NEON)
+    {
+        return CopyIntegerToFloatComponentsNEON<T>(input, componentCount, output);
+    }
+#endif
+    return 0;
+}
+
+template size_t CopyIntegerToFloatComponents<GLbyte>(const uint8_t *input,
+                                                     size_t componentCount,
+                                                     uint8_t *output);
+template size_t CopyIntegerToFloatComponents<GLubyte>(const uint8_t *input,
+                                                      size_t componentCount,
+                                                      uint8_t *output);
+template size_t CopyIntegerToFloatComponents<GLshort>(const uint8_t *input,
+                                                      size_t componentCount,
+                                                      uint8_t *output);
+template size_t CopyIntegerToFloatComponents<GLushort>(const uint8_t *input,
+                                                       size_t componentCount,
+                                                       uint8_t *output);
+}  // namespace priv
+}  // namespace rx
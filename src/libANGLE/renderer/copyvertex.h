@@ -9,8 +9,14 @@
 #ifndef LIBANGLE_RENDERER_COPYVERTEX_H_
 #define LIBANGLE_RENDERER_COPYVERTEX_H_
 
+#include "angle_gl.h"
 #include "common/mathutil.h"
 
+namespace angle
+{
+class WorkerThreadPool;
+}  // namespace angle
+
 namespace rx
 {
 
@@ -19,6 +25,17 @@ using VertexCopyFunction = void (*)(const uint8_t *input,
                                     size_t count,
                                     uint8_t *output);
 
+// Calls |copyFunction| on |count| vertices, whose output is |outputStride| bytes apart.  Large
+// conversions are split into ranges of vertices that are converted concurrently on |pool|, if it
+// is asynchronous.
+void CopyVertexDataInParallel(VertexCopyFunction copyFunction,
+                              angle::WorkerThreadPool *pool,
+                              const uint8_t *input,
+                              size_t stride,
+                              size_t count,
+                              uint8_t *output,
+                              size_t outputStride);
+
 // 'alphaDefaultValueBits' gives the default value for the alpha channel (4th component)
 template <typename T,
           size_t inputComponentCount,
@@ -73,6 +90,20 @@ void CopyW2XYZ10ToXYZWFloatVertexData(const uint8_t *input,
                                       size_t count,
                                       uint8_t *output);
 
+namespace priv
+{
+// Vector code for the vertex formats that most often need converting.  Each function converts as
+// many vertices or components at the start of tightly packed input as it can, and returns how
+// many.  The scalar loops of the functions above convert the rest, and are the reference that the
+// vector code matches.
+size_t Copy3To4ByteVertices(const uint8_t *input, size_t count, uint8_t alpha, uint8_t *output);
+size_t Copy3To4ShortVertices(const uint8_t *input, size_t count, uint16_t alpha, uint8_t *output);
+size_t CopyFixedToFloatComponents(const uint8_t *input, size_t componentCount, uint8_t *output);
+// Implemented for GLbyte, GLubyte, GLshort and GLushort.
+template <typename T>
+size_t CopyIntegerToFloatComponents(const uint8_t *input, size_t componentCount, uint8_t *output);
+}  // namespace priv
+
 }  // namespace rx
 
 #include "copyvertex.inc.h"
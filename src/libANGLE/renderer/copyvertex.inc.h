@@ -89,7 +89,24 @@ inline void CopyNativeVertexData(const uint8_t *input, size_t stride, size_t cou
     const T defaultAlphaValue                = gl::bitCast<T>(alphaDefaultValueBits);
     const size_t lastNonAlphaOutputComponent = std::min<size_t>(outputComponentCount, 3);
 
-    for (size_t i = 0; i < count; i++)
+    size_t first = 0;
+    if constexpr (inputComponentCount == 3 && outputComponentCount == 4 && sizeof(T) <= 2)
+    {
+        if (attribSize == stride && reinterpret_cast<uintptr_t>(input) % sizeof(T) == 0)
+        {
+            const auto alpha = static_cast<typename std::make_unsigned<T>::type>(defaultAlphaValue);
+            if constexpr (sizeof(T) == 1)
+            {
+                first = priv::Copy3To4ByteVertices(input, count, alpha, output);
+            }
+            else
+            {
+                first = priv::Copy3To4ShortVertices(input, count, alpha, output);
+            }
+        }
+    }
+
+    for (size_t i = first; i < count; i++)
     {
         const T *offsetInput = reinterpret_cast<const T *>(input + (i * stride));
         T offsetInputAligned[inputComponentCount];
@@ -197,7 +214,16 @@ inline void Copy32FixedTo32FVertexData(const uint8_t *input,
 {
     static const float divisor = 1.0f / (1 << 16);
 
-    for (size_t i = 0; i < count; i++)
+    size_t first = 0;
+    if (inputComponentCount == outputComponentCount &&
+        stride == sizeof(GLfixed) * inputComponentCount &&
+        reinterpret_cast<uintptr_t>(input) % sizeof(GLfixed) == 0)
+    {
+        first = priv::CopyFixedToFloatComponents(input, count * inputComponentCount, output) /
+                inputComponentCount;
+    }
+
+    for (size_t i = first; i < count; i++)
     {
         const uint8_t *offsetInput = input + i * stride;
         float *offsetOutput        = reinterpret_cast<float *>(output) + i * outputComponentCount;
@@ -246,7 +272,20 @@ inline void CopyToFloatVertexData(const uint8_t *input,
     typedef std::numeric_limits<T> NL;
     typedef typename std::conditional<toHalf, GLhalf, float>::type outputType;
 
-    for (size_t i = 0; i < count; i++)
+    size_t first = 0;
+    if constexpr (std::is_integral<T>::value && sizeof(T) <= 2 && !normalized && !toHalf &&
+                  inputComponentCount == outputComponentCount)
+    {
+        if (stride == sizeof(T) * inputComponentCount &&
+            reinterpret_cast<uintptr_t>(input) % sizeof(T) == 0)
+        {
+            first = priv::CopyIntegerToFloatComponents<T>(input, count * inputComponentCount,
+                                                          output) /
+                    inputComponentCount;
+        }
+    }
+
+    for (size_t i = first; i < count; i++)
     {
         const T *offsetInput = reinterpret_cast<const T *>(input + (stride * i));
         outputType *offsetOutput =
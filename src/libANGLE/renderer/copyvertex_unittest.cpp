@@ -0,0 +1,158 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// copyvertex_unittest:
+//   Tests that the vertex conversion functions convert tightly packed input with vector code the
+//   same as their scalar loops, and that large conversions split across threads match.
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "common/WorkerThread.h"
+#include "libANGLE/renderer/copyvertex.h"
+
+namespace rx
+{
+namespace
+{
+// Vertex counts that cover no vector iterations, some, and every kind of remainder.
+constexpr size_t kVertexCounts[] = {0, 1, 2, 3, 5, 7, 8, 15, 16, 17, 31, 33, 64, 1001};
+
+std::vector<uint8_t> MakeInput(size_t size)
+{
+    std::mt19937 generator(1);
+    std::vector<uint8_t> input(size);
+    for (uint8_t &byte : input)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+    return input;
+}
+
+// Converts |count| tightly packed vertices of |inputSize| bytes with |copyFunction|, from an
+// offset of |inputOffset| bytes, and returns the output.
+std::vector<uint8_t> Convert(VertexCopyFunction copyFunction,
+                             const std::vector<uint8_t> &input,
+                             size_t inputOffset,
+                             size_t inputSize,
+                             size_t count,
+                             size_t outputSize)
+{
+    std::vector<uint8_t> output(count * outputSize, 0xAA);
+    copyFunction(input.data() + inputOffset, inputSize, count, output.data());
+    return output;
+}
+
+template <typename T, uint32_t alphaBits>
+void Test3To4(const char *strCase)
+{
+    for (size_t inputOffset : {0, 1})
+    {
+        for (size_t count : kVertexCounts)
+        {
+            const std::vector<uint8_t> input = MakeInput(inputOffset + count * 3 * sizeof(T));
+            const std::vector<uint8_t> output =
+                Convert(CopyNativeVertexData<T, 3, 4, alphaBits>, input, inputOffset,
+                        3 * sizeof(T), count, 4 * sizeof(T));
+
+            std::vector<uint8_t> expected(count * 4 * sizeof(T));
+            for (size_t i = 0; i < count; ++i)
+            {
+                const T alpha = gl::bitCast<T>(alphaBits);
+                memcpy(&expected[i * 4 * sizeof(T)], &input[inputOffset + i * 3 * sizeof(T)],
+                       3 * sizeof(T));
+                memcpy(&expected[i * 4 * sizeof(T) + 3 * sizeof(T)], &alpha, sizeof(T));
+            }
+
+            EXPECT_EQ(expected, output)
+                << "Case " << strCase << ", " << count << " vertices at offset " << inputOffset;
+        }
+    }
+}
+
+template <typename T, size_t componentCount>
+void TestToFloat(const char *strCase, VertexCopyFunction copyFunction, float scale)
+{
+    for (size_t inputOffset : {size_t(0), sizeof(T)})
+    {
+        for (size_t count : kVertexCounts)
+        {
+            const size_t inputSize = componentCount * sizeof(T);
+            const std::vector<uint8_t> input = MakeInput(inputOffset + count * inputSize);
+            const std::vector<uint8_t> output = Convert(copyFunction, input, inputOffset, inputSize,
+                                                        count, componentCount * sizeof(float));
+
+            std::vector<uint8_t> expected(count * componentCount * sizeof(float));
+            for (size_t i = 0; i < count * componentCount; ++i)
+            {
+                T component;
+                memcpy(&component, &input[inputOffset + i * sizeof(T)], sizeof(T));
+                const float converted = static_cast<float>(component) * scale;
+                memcpy(&expected[i * sizeof(float)], &converted, sizeof(float));
+            }
+
+            EXPECT_EQ(expected, output)
+                << "Case " << strCase << ", " << count << " vertices at offset " << inputOffset;
+        }
+    }
+}
+
+// Tests 3-component byte formats, which are padded to 4 components.
+TEST(CopyVertexTest, Byte3To4)
+{
+    Test3To4<GLubyte, 1>("UbyteInt");
+    Test3To4<GLbyte, 127>("ByteNorm");
+}
+
+// Tests 3-component short formats, which are padded to 4 components.
+TEST(CopyVertexTest, Short3To4)
+{
+    Test3To4<GLushort, 1>("UshortInt");
+    Test3To4<GLshort, 32767>("ShortNorm");
+}
+
+// Tests fixed-point formats, which are converted to float.
+TEST(CopyVertexTest, FixedToFloat)
+{
+    TestToFloat<GLfixed, 2>("Fixed2", Copy32FixedTo32FVertexData<2, 2>, 1.0f / (1 << 16));
+    TestToFloat<GLfixed, 3>("Fixed3", Copy32FixedTo32FVertexData<3, 3>, 1.0f / (1 << 16));
+    TestToFloat<GLfixed, 4>("Fixed4", Copy32FixedTo32FVertexData<4, 4>, 1.0f / (1 << 16));
+}
+
+// Tests scaled formats, which are converted to float.
+TEST(CopyVertexTest, ScaledToFloat)
+{
+    TestToFloat<GLbyte, 3>("Byte3", CopyToFloatVertexData<GLbyte, 3, 3, false, false>, 1.0f);
+    TestToFloat<GLubyte, 4>("Ubyte4", CopyToFloatVertexData<GLubyte, 4, 4, false, false>, 1.0f);
+    TestToFloat<GLshort, 2>("Short2", CopyToFloatVertexData<GLshort, 2, 2, false, false>, 1.0f);
+    TestToFloat<GLushort, 3>("Ushort3", CopyToFloatVertexData<GLushort, 3, 3, false, false>,
+                             1.0f);
+}
+
+// Tests that a large conversion split across threads matches converting it at once.
+TEST(CopyVertexTest, Parallel)
+{
+    std::shared_ptr<angle::WorkerThreadPool> pool = angle::WorkerThreadPool::Create(
+        angle::ThreadPoolType::Asynchronous, 4, ANGLEPlatformCurrent());
+
+    // Enough vertices to be split, and not a multiple of the number of ranges.
+    constexpr size_t kCount = 2 * 1024 * 1024 + 7;
+    const std::vector<uint8_t> input = MakeInput(kCount * 3);
+
+    std::vector<uint8_t> serialOutput(kCount * 4, 0xAA);
+    std::vector<uint8_t> parallelOutput(serialOutput);
+
+    CopyNativeVertexData<GLubyte, 3, 4, 1>(input.data(), 3, kCount, serialOutput.data());
+    CopyVertexDataInParallel(CopyNativeVertexData<GLubyte, 3, 4, 1>, pool.get(), input.data(), 3,
+                             kCount, parallelOutput.data(), 4);
+
+    EXPECT_EQ(serialOutput, parallelOutput);
+}
+}  // anonymous namespace
+}  // namespace rx
@@ -11,6 +11,7 @@
 
 #include "common/mathutil.h"
 #include "common/utilities.h"
+#include "libANGLE/Buffer.h"
 #include "libANGLE/renderer/d3d/IndexBuffer.h"
 #include "libANGLE/renderer/d3d/RendererD3D.h"
 #include "libANGLE/renderer/d3d/VertexBuffer.h"
@@ -189,8 +190,8 @@ angle::Result BufferD3D::getIndexRange(const gl::Context *context,
     const uint8_t *data = nullptr;
     ANGLE_TRY(getData(context, &data));
 
-    *outRange = gl::ComputeIndexRange(type, ANGLE_UNSAFE_TODO(data + offset), count,
-                                      primitiveRestartEnabled);
+    *outRange = mState.computeIndexRange(type, offset, count, primitiveRestartEnabled,
+                                         ANGLE_UNSAFE_TODO(data + offset));
     return angle::Result::Continue;
 }
 
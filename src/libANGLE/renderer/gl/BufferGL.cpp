@@ -331,8 +331,8 @@ angle::Result BufferGL::getIndexRange(const gl::Context *context,
 
     if (mShadowCopy.has_value())
     {
-        *outRange = gl::ComputeIndexRange(type, ANGLE_UNSAFE_TODO(mShadowCopy->data() + offset),
-                                          count, primitiveRestartEnabled);
+        *outRange = mState.computeIndexRange(type, offset, count, primitiveRestartEnabled,
+                                             ANGLE_UNSAFE_TODO(mShadowCopy->data() + offset));
     }
     else
     {
@@ -344,7 +344,8 @@ angle::Result BufferGL::getIndexRange(const gl::Context *context,
                                        count * typeBytes, GL_MAP_READ_BIT);
         if (bufferData)
         {
-            *outRange = gl::ComputeIndexRange(type, bufferData, count, primitiveRestartEnabled);
+            *outRange = mState.computeIndexRange(type, offset, count, primitiveRestartEnabled,
+                                                 bufferData);
             ANGLE_GL_TRY(context, functions->unmapBuffer(gl::ToGLenum(DestBufferOperationTarget)));
         }
         else
@@ -303,7 +303,7 @@ angle::Result BufferMtl::getIndexRange(const gl::Context *context,
 {
     const uint8_t *indices = getBufferDataReadOnly(mtl::GetImpl(context), offset).data();
 
-    *outRange = gl::ComputeIndexRange(type, indices, count, primitiveRestartEnabled);
+    *outRange = mState.computeIndexRange(type, offset, count, primitiveRestartEnabled, indices);
 
     return angle::Result::Continue;
 }
@@ -148,8 +148,8 @@ angle::Result BufferNULL::getIndexRange(const gl::Context *context,
                                         bool primitiveRestartEnabled,
                                         gl::IndexRange *outRange)
 {
-    *outRange = gl::ComputeIndexRange(type, ANGLE_UNSAFE_TODO(mData.data() + offset), count,
-                                      primitiveRestartEnabled);
+    *outRange = mState.computeIndexRange(type, offset, count, primitiveRestartEnabled,
+                                         ANGLE_UNSAFE_TODO(mData.data() + offset));
     return angle::Result::Continue;
 }
 
@@ -314,7 +314,7 @@ ConversionBuffer::ConversionBuffer(vk::Renderer *renderer,
                                    bool hostVisible)
     : mEntireBufferDirty(true)
 {
-    mData = std::make_unique<vk::BufferHelper>();
+    mData = std::make_shared<vk::BufferHelper>();
     mDirtyRanges.reserve(32);
 }
 
@@ -326,6 +326,39 @@ ConversionBuffer::~ConversionBuffer()
 
 ConversionBuffer::ConversionBuffer(ConversionBuffer &&other) = default;
 
+void ConversionBuffer::release(vk::Context *context)
+{
+    if (mData.use_count() > 1)
+    {
+        mData = std::make_shared<vk::BufferHelper>();
+        return;
+    }
+    mData->release(context);
+}
+
+void ConversionBuffer::shareData(vk::Context *context,
+                                 const std::shared_ptr<vk::BufferHelper> &data)
+{
+    ASSERT(data && data->valid());
+    if (data != mData)
+    {
+        release(context);
+        mData = data;
+    }
+    clearDirty();
+}
+
+void ConversionBuffer::detachData(vk::Renderer *renderer)
+{
+    if (mData.use_count() == 1)
+    {
+        mData->release(renderer);
+    }
+    mData = std::make_shared<vk::BufferHelper>();
+    mDirtyRanges.clear();
+    mEntireBufferDirty = true;
+}
+
 // dirtyRanges may be overlap or continuous. In order to reduce the redunant conversion, we try to
 // consolidate the dirty ranges. First we sort it by the range's low. Then we walk the range again
 // and check it with previous range and merge them if possible. That merge will remove the
@@ -375,6 +408,7 @@ BufferVk::BufferVk(const gl::BufferState &state)
       mMemoryTypeIndex(0),
       mMemoryPropertyFlags(0),
       mIsStagingBufferMapped(false),
+      mDataRevision(0),
       mHasValidData(false),
       mIsMappedForWrite(false),
       mUsageType(BufferUsageType::Static)
@@ -988,7 +1022,8 @@ angle::Result BufferVk::getIndexRange(const gl::Context *context,
 
     void *mapPtr;
     ANGLE_TRY(mapRangeForReadAccessOnly(contextVk, offset, getSize() - offset, &mapPtr));
-    *outRange = gl::ComputeIndexRange(type, mapPtr, count, primitiveRestartEnabled);
+    *outRange = mState.computeIndexRange(type, offset, count, primitiveRestartEnabled,
+                                         static_cast<const uint8_t *>(mapPtr));
     ANGLE_TRY(unmapReadAccessOnly(contextVk));
 
     return angle::Result::Continue;
@@ -1305,9 +1340,10 @@ VertexConversionBuffer *BufferVk::getVertexConversionBuffer(
 {
     for (VertexConversionBuffer &buffer : mVertexConversionBuffers)
     {
-        if (buffer.match(cacheKey))
+        if (buffer.match(renderer, cacheKey))
         {
-            ASSERT(buffer.valid());
+            // The buffer has been converted, unless its data was just detached.
+            ASSERT(buffer.valid() || buffer.isEntireBufferDirty());
             return &buffer;
         }
     }
@@ -1318,6 +1354,7 @@ VertexConversionBuffer *BufferVk::getVertexConversionBuffer(
 
 void BufferVk::dataRangeUpdated(const RangeDeviceSize &range)
 {
+    mDataRevision++;
     for (VertexConversionBuffer &buffer : mVertexConversionBuffers)
     {
         buffer.addDirtyBufferRange(range);
@@ -1328,6 +1365,7 @@ void BufferVk::dataRangeUpdated(const RangeDeviceSize &range)
 
 void BufferVk::dataUpdated()
 {
+    mDataRevision++;
     for (VertexConversionBuffer &buffer : mVertexConversionBuffers)
     {
         buffer.setEntireBufferDirty();
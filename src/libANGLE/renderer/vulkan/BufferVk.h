@@ -25,7 +25,7 @@ class ConversionBuffer
   public:
     ConversionBuffer() : mEntireBufferDirty(true)
     {
-        mData = std::make_unique<vk::BufferHelper>();
+        mData = std::make_shared<vk::BufferHelper>();
         mDirtyRanges.reserve(32);
     }
     ConversionBuffer(vk::Renderer *renderer,
@@ -51,9 +51,21 @@ class ConversionBuffer
 
     bool valid() const { return mData && mData->valid(); }
     vk::BufferHelper *getBuffer() const { return mData.get(); }
-    void release(vk::Context *context) { mData->release(context); }
+    // Releases the data, unless other conversion buffers share it.  Either way, the conversion
+    // buffer is left with invalid data.
+    void release(vk::Context *context);
     void destroy(vk::Renderer *renderer) { mData->destroy(renderer); }
 
+    // Vertex conversion buffers of different vertex arrays that convert the same data the same
+    // way share the converted data.  Whichever of them converts updates it for all of them.
+    const std::shared_ptr<vk::BufferHelper> &getSharedData() const { return mData; }
+    void shareData(vk::Context *context, const std::shared_ptr<vk::BufferHelper> &data);
+
+  protected:
+    // Gives the conversion buffer new, invalid data that needs converting entirely.  The old data
+    // is released, unless other conversion buffers share it.
+    void detachData(vk::Renderer *renderer);
+
   private:
     // state value determines if we need to re-stream vertex data. mEntireBufferDirty indicates
     // entire buffer data has changed. mDirtyRange should be ignored when mEntireBufferDirty is
@@ -63,7 +75,7 @@ class ConversionBuffer
     std::vector<RangeDeviceSize> mDirtyRanges;
 
     // Where the conversion data is stored.
-    std::unique_ptr<vk::BufferHelper> mData;
+    std::shared_ptr<vk::BufferHelper> mData;
 };
 
 class VertexConversionBuffer : public ConversionBuffer
@@ -85,7 +97,7 @@ class VertexConversionBuffer : public ConversionBuffer
 
     VertexConversionBuffer(VertexConversionBuffer &&other);
 
-    bool match(const CacheKey &cacheKey)
+    bool match(vk::Renderer *renderer, const CacheKey &cacheKey)
     {
         // If anything other than offset mismatch, it can't reuse.
         if (mCacheKey.vertexArrayVk != cacheKey.vertexArrayVk ||
@@ -113,7 +125,10 @@ class VertexConversionBuffer : public ConversionBuffer
             {
                 if (cacheKey.offset < mCacheKey.offset)
                 {
-                    addDirtyBufferRange(RangeDeviceSize(cacheKey.offset, mCacheKey.offset));
+                    // The converted data now starts at an earlier vertex, so none of it is where
+                    // it used to be.  It is also no longer what other vertex arrays that share it,
+                    // or the renderer's VertexConversionCache, expect.
+                    detachData(renderer);
                     mCacheKey.offset = cacheKey.offset;
                 }
                 return true;
@@ -226,6 +241,9 @@ class BufferVk : public BufferImpl
     }
 
     vk::BufferSerial getBufferSerial() { return mBuffer.getBufferSerial(); }
+    // Changes whenever the buffer's contents may have changed.  Together with the serial, it
+    // identifies the contents that converted vertex data was converted from.
+    uint64_t getDataRevision() const { return mDataRevision; }
 
     bool isBufferValid() const { return mBuffer.valid(); }
     bool isCurrentlyInUse(vk::Renderer *renderer) const;
@@ -376,6 +394,9 @@ class BufferVk : public BufferImpl
     // Tracks whether mStagingBuffer has been mapped to user or not
     bool mIsStagingBufferMapped;
 
+    // Incremented whenever the buffer's contents may have changed.
+    uint64_t mDataRevision;
+
     // Tracks if BufferVk object has valid data or not.
     bool mHasValidData;
 
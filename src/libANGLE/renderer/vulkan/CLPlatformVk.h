@@ -56,7 +56,8 @@ class CLPlatformVk : public CLPlatformImpl, public vk::ErrorContext, public vk::
     void putBlob(const angle::BlobCacheKey &key, const angle::MemoryBuffer &value) override;
     bool getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *valueOut) override;
     std::shared_ptr<angle::WaitableEvent> postMultiThreadWorkerTask(
-        const std::shared_ptr<angle::Closure> &task) override;
+        const std::shared_ptr<angle::Closure> &task,
+        angle::WorkerTaskPriority priority) override;
     void notifyDeviceLost() override;
     GlobalOps::Api getFrontendApi() const override { return GlobalOps::Api::OpenCL; }
 
@@ -3743,6 +3743,12 @@ void ContextVk::syncObjectPerfCounters(const vk::CommandQueuePerfCounters &comma
     // Return current drawFramebuffer's cache stats
     mPerfCounters.framebufferCacheSize = mFramebufferCache.getSize();
 
+    const CacheStats vertexConversionCacheStats =
+        mRenderer->getVertexConversionCache().getCurrentStats();
+    mPerfCounters.vertexConversionCacheHits      = vertexConversionCacheStats.getHitCount();
+    mPerfCounters.vertexConversionCacheMisses    = vertexConversionCacheStats.getMissCount();
+    mPerfCounters.vertexConversionCacheTotalSize = vertexConversionCacheStats.getSize();
+
     mPerfCounters.pendingSubmissionGarbageObjects =
         static_cast<uint64_t>(mRenderer->getPendingSubmissionGarbageSize());
 }
@@ -7307,7 +7313,10 @@ angle::Result ContextVk::initBufferForVertexConversion(ConversionBuffer *convers
             }
         }
 
-        bufferHelper->release(this);
+        // If other vertex arrays share the converted data, they keep it and this conversion buffer
+        // gets new data instead.
+        conversionBuffer->release(this);
+        bufferHelper = conversionBuffer->getBuffer();
     }
 
     //  Mark entire buffer dirty if we have to reallocate the buffer.
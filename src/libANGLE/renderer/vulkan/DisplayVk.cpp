@@ -583,6 +583,11 @@ void DisplayVk::generateExtensions(egl::DisplayExtensions *outExtensions) const
 
     outExtensions->vulkanImageANGLE = true;
 
+    // EGL_ANGLE_context_threaded_commands is implemented in the ANGLE frontend, which executes the
+    // context's calls on another thread than the one it's current on.  That's only possible with
+    // a backend that doesn't depend on a native context being current on the calling thread.
+    outExtensions->contextThreadedCommandsANGLE = true;
+
     outExtensions->lockSurface3KHR = getFeatures().supportsLockSurfaceExtension.enabled;
 
     outExtensions->partialUpdateKHR = true;
@@ -677,9 +682,10 @@ bool DisplayVk::getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *v
 }
 
 std::shared_ptr<angle::WaitableEvent> DisplayVk::postMultiThreadWorkerTask(
-    const std::shared_ptr<angle::Closure> &task)
+    const std::shared_ptr<angle::Closure> &task,
+    angle::WorkerTaskPriority priority)
 {
-    return mState.multiThreadPool->postWorkerTask(task);
+    return mState.multiThreadPool->postWorkerTaskWithPriority(task, priority);
 }
 
 void DisplayVk::notifyDeviceLost()
@@ -633,13 +633,12 @@ angle::Result ProgramInfo::initProgram(vk::ErrorContext *context,
                                        bool isLastPreFragmentStage,
                                        bool isTransformFeedbackProgram,
                                        const ShaderInfo &shaderInfo,
+                                       const SpvTransformCache::ProgramSpirvBlobs &loadedSpirvBlobs,
                                        ProgramTransformOptions optionBits,
                                        const ShaderInterfaceVariableInfoMap &variableInfoMap)
 {
     const gl::ShaderMap<angle::spirv::Blob> &originalSpirvBlobs = shaderInfo.getSpirvBlobs();
     const angle::spirv::Blob &originalSpirvBlob                 = originalSpirvBlobs[shaderType];
-    gl::ShaderMap<angle::spirv::Blob> transformedSpirvBlobs;
-    angle::spirv::Blob &transformedSpirvBlob = transformedSpirvBlobs[shaderType];
 
     SpvTransformOptions options;
     options.shaderType               = shaderType;
@@ -661,10 +660,13 @@ angle::Result ProgramInfo::initProgram(vk::ErrorContext *context,
     options.ditherControl = (shaderType == gl::ShaderType::Fragment) ? optionBits.ditherControl : 0;
     options.roundOutputAfterDithering = context->getFeatures().roundOutputAfterDithering.enabled;
 
-    ANGLE_TRY(
-        SpvTransformSpirvCode(options, variableInfoMap, originalSpirvBlob, &transformedSpirvBlob));
-    ANGLE_TRY(vk::InitShaderModule(context, &mShaders[shaderType], transformedSpirvBlob.data(),
-                                   transformedSpirvBlob.size() * sizeof(uint32_t)));
+    // Programs with identical shaders share the transformation through the renderer's cache.
+    SpvTransformCache::SharedSpirvBlob transformedSpirvBlob;
+    ANGLE_TRY(context->getRenderer()->getSpvTransformCache().getTransformedSpirv(
+        options, variableInfoMap, originalSpirvBlob, loadedSpirvBlobs,
+        &mTransformedSpirvKeys[shaderType], &transformedSpirvBlob));
+    ANGLE_TRY(vk::InitShaderModule(context, &mShaders[shaderType], transformedSpirvBlob->data(),
+                                   transformedSpirvBlob->size() * sizeof(uint32_t)));
 
     mProgramHelper.setShader(shaderType, mShaders[shaderType]);
 
@@ -857,6 +859,8 @@ angle::Result ProgramExecutableVk::load(ContextVk *contextVk,
         }
     }
 
+    loadTransformedSpirv(contextVk, stream);
+
     // Initialize and resize the mDefaultUniformBlocks' memory
     ANGLE_TRY(resizeUniformBlockMemory(contextVk, requiredBufferSize));
 
@@ -911,6 +915,81 @@ void ProgramExecutableVk::save(ContextVk *contextVk,
             stream->writeBytes(cacheData);
         }
     }
+
+    saveTransformedSpirv(contextVk, stream);
+}
+
+void ProgramExecutableVk::loadTransformedSpirv(ContextVk *contextVk, gl::BinaryInputStream *stream)
+{
+    // Keep the transformed SPIR-V stored with the program, so that creating the program's shader
+    // modules after load doesn't need to transform it again.  It's not put in the renderer's
+    // cache, as a stale or corrupt binary would then provide the SPIR-V of other programs too.
+    mLoadedTransformedSpirv.clear();
+
+    const size_t count = stream->readInt<size_t>();
+    for (size_t index = 0; index < count && !stream->error(); ++index)
+    {
+        SpvTransformCache::Key key;
+        stream->readBytes(key);
+
+        auto spirvBlob = std::make_shared<angle::spirv::Blob>();
+        stream->readVector(spirvBlob.get());
+
+        if (!stream->error())
+        {
+            mLoadedTransformedSpirv.emplace_back(key, std::move(spirvBlob));
+        }
+    }
+}
+
+void ProgramExecutableVk::saveTransformedSpirv(ContextVk *contextVk,
+                                               gl::BinaryOutputStream *stream)
+{
+    // Gather the keys of the transformed SPIR-V of every stage of every permutation of the program
+    // that was created.
+    std::vector<SpvTransformCache::Key> keys;
+    auto addKeys = [&keys](const ProgramInfo &programInfo) {
+        for (gl::ShaderType shaderType : gl::AllShaderTypes())
+        {
+            if (!programInfo.valid(shaderType))
+            {
+                continue;
+            }
+            const SpvTransformCache::Key &key = programInfo.getTransformedSpirvKey(shaderType);
+            if (std::find(keys.begin(), keys.end(), key) == keys.end())
+            {
+                keys.push_back(key);
+            }
+        }
+    };
+    for (const auto &iter : mGraphicsProgramInfos)
+    {
+        addKeys(iter.second);
+    }
+    addKeys(mComputeProgramInfo);
+
+    // Only the SPIR-V that was loaded with the program or is still in the renderer's cache is
+    // stored.
+    SpvTransformCache &spvTransformCache = contextVk->getRenderer()->getSpvTransformCache();
+    SpvTransformCache::ProgramSpirvBlobs entries;
+    for (const SpvTransformCache::Key &key : keys)
+    {
+        auto loaded = std::find_if(mLoadedTransformedSpirv.begin(), mLoadedTransformedSpirv.end(),
+                                   [&key](const auto &entry) { return entry.first == key; });
+        SpvTransformCache::SharedSpirvBlob spirvBlob =
+            loaded != mLoadedTransformedSpirv.end() ? loaded->second : spvTransformCache.get(key);
+        if (spirvBlob)
+        {
+            entries.emplace_back(key, std::move(spirvBlob));
+        }
+    }
+
+    stream->writeInt(entries.size());
+    for (const auto &entry : entries)
+    {
+        stream->writeBytes(entry.first);
+        stream->writeVector(*entry.second);
+    }
 }
 
 void ProgramExecutableVk::clearVariableInfoMap()
@@ -81,6 +81,7 @@ class ProgramInfo final : angle::NonCopyable
                               bool isLastPreFragmentStage,
                               bool isTransformFeedbackProgram,
                               const ShaderInfo &shaderInfo,
+                              const SpvTransformCache::ProgramSpirvBlobs &loadedSpirvBlobs,
                               ProgramTransformOptions optionBits,
                               const ShaderInterfaceVariableInfoMap &variableInfoMap);
     void release(ContextVk *contextVk);
@@ -92,9 +93,18 @@ class ProgramInfo final : angle::NonCopyable
 
     vk::ShaderProgramHelper &getShaderProgram() { return mProgramHelper; }
 
+    // The key of the transformed SPIR-V of a valid stage, in the renderer's SpvTransformCache or
+    // in the SPIR-V loaded from the program binary.
+    const SpvTransformCache::Key &getTransformedSpirvKey(gl::ShaderType shaderType) const
+    {
+        ASSERT(valid(shaderType));
+        return mTransformedSpirvKeys[shaderType];
+    }
+
   private:
     vk::ShaderProgramHelper mProgramHelper;
     vk::ShaderModuleMap mShaders;
+    gl::ShaderMap<SpvTransformCache::Key> mTransformedSpirvKeys;
 };
 
 using ImmutableSamplerIndexMap = angle::HashMap<vk::YcbcrConversionDesc, uint32_t>;
@@ -295,6 +305,7 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     void onProgramBind();
 
     const ShaderInterfaceVariableInfoMap &getVariableInfoMap() const { return mVariableInfoMap; }
+    const ShaderInfo &getOriginalShaderInfo() const { return mOriginalShaderInfo; }
 
     angle::Result warmUpPipelineCache(vk::Renderer *renderer,
                                       vk::PipelineRobustness pipelineRobustness,
@@ -424,9 +435,9 @@ class ProgramExecutableVk : public ProgramExecutableImpl
         // specialization constants.
         if (!programInfo->valid(shaderType))
         {
-            ANGLE_TRY(programInfo->initProgram(context, shaderType, isLastPreFragmentStage,
-                                               isTransformFeedbackProgram, mOriginalShaderInfo,
-                                               optionBits, variableInfoMap));
+            ANGLE_TRY(programInfo->initProgram(
+                context, shaderType, isLastPreFragmentStage, isTransformFeedbackProgram,
+                mOriginalShaderInfo, mLoadedTransformedSpirv, optionBits, variableInfoMap));
         }
         ASSERT(programInfo->valid(shaderType));
 
@@ -504,6 +515,9 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                               vk::PipelineHelper *placeholderPipelineHelper);
     void waitForPostLinkTasksImpl(ContextVk *contextVk);
 
+    void loadTransformedSpirv(ContextVk *contextVk, gl::BinaryInputStream *stream);
+    void saveTransformedSpirv(ContextVk *contextVk, gl::BinaryOutputStream *stream);
+
     angle::Result getOrAllocateDescriptorSet(vk::Context *context,
                                              uint32_t currentFrame,
                                              UpdateDescriptorSetsBuilder *updateBuilder,
@@ -587,6 +601,9 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     gl::ShaderBitSet mDefaultUniformBlocksDirty;
 
     ShaderInfo mOriginalShaderInfo;
+    // The transformed SPIR-V stored in the program binary this executable was loaded from.  It's
+    // only used by this executable, and isn't shared through the renderer's SpvTransformCache.
+    SpvTransformCache::ProgramSpirvBlobs mLoadedTransformedSpirv;
 
     // The pipeline cache specific to this program executable.  Currently:
     //
@@ -49,7 +49,7 @@ class ShaderInterfaceVariableInfoMap final : angle::NonCopyable
 
     void clear();
     void load(gl::BinaryInputStream *stream);
-    void save(gl::BinaryOutputStream *stream);
+    void save(gl::BinaryOutputStream *stream) const;
 
     ShaderInterfaceVariableInfo &add(gl::ShaderType shaderType, uint32_t id);
     void addResource(gl::ShaderBitSet shaderTypes,
@@ -227,8 +227,10 @@ angle::Result ShareGroupVk::scheduleMonolithicPipelineCreationTask(
                                                  &compatibleRenderPass));
     taskOut->setRenderPass(compatibleRenderPass);
 
-    mMonolithicPipelineCreationEvent =
-        mRenderer->getGlobalOps()->postMultiThreadWorkerTask(taskOut->getTask());
+    // Monolithic pipelines only replace an already usable linked pipeline, so this is background
+    // work that shouldn't delay compile and link jobs.
+    mMonolithicPipelineCreationEvent = mRenderer->getGlobalOps()->postMultiThreadWorkerTask(
+        taskOut->getTask(), angle::WorkerTaskPriority::Low);
 
     taskOut->onSchedule(mMonolithicPipelineCreationEvent);
 
@@ -12,7 +12,7 @@
 #include "common/unsafe_buffers.h"
 
 #include "common/debug.h"
-#include "image_util/generatemip.inc"
+#include "image_util/generatemip.h"
 #include "libANGLE/Config.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Image.h"
@@ -2935,6 +2935,13 @@ angle::Result TextureVk::generateMipmap(const gl::Context *context)
             gl::IsMipmapFiltered(mState.getSamplerState().getMinFilter()));
     }
 
+    // The CPU path is normally only taken for formats the GPU can't generate mipmaps for, and can
+    // be forced to test it.
+    if (renderer->getFeatures().forceGenerateMipmapOnCPU.enabled)
+    {
+        return generateMipmapsWithCPU(context);
+    }
+
     // If it's possible to generate mipmap in compute, that would give the best possible
     // performance on some hardware.
     if (CanGenerateMipmapWithCompute(renderer, mImage->getType(), mImage->getActualFormatID(),
@@ -4708,10 +4715,12 @@ angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
             gl::OwnerImageIndex::MakeFromType(mState.getType(), currentMipLevel, layer),
             mipLevelExtents, gl::Offset(), &destData, sourceFormat.id));
 
-        // Generate the mipmap into that new buffer
-        sourceFormat.mipGenerationFunction(
-            previousLevelWidth, previousLevelHeight, previousLevelDepth, previousLevelData,
-            previousLevelRowPitch, previousLevelDepthPitch, destData, destRowPitch, destDepthPitch);
+        // Generate the mipmap into that new buffer.  Large levels are split across worker threads.
+        angle::GenerateMipInParallel(sourceFormat.mipGenerationFunction,
+                                     contextVk->getImageLoadContext(), previousLevelWidth,
+                                     previousLevelHeight, previousLevelDepth, previousLevelData,
+                                     previousLevelRowPitch, previousLevelDepthPitch, destData,
+                                     destRowPitch, destDepthPitch);
 
         // Swap for the next iteration
         previousLevelWidth      = mipWidth;
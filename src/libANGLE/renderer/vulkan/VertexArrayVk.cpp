@@ -221,6 +221,7 @@ angle::Result StreamVertexData(ContextVk *contextVk,
                                size_t dstOffset,
                                size_t vertexCount,
                                size_t srcStride,
+                               size_t dstStride,
                                VertexCopyFunction vertexLoadFunction)
 {
     vk::Renderer *renderer = contextVk->getRenderer();
@@ -235,7 +236,10 @@ angle::Result StreamVertexData(ContextVk *contextVk,
 
     if (vertexLoadFunction != nullptr)
     {
-        vertexLoadFunction(srcData, srcStride, vertexCount, dst);
+        // Large client arrays and buffers are converted on the display's worker threads.
+        CopyVertexDataInParallel(vertexLoadFunction,
+                                 contextVk->getImageLoadContext().multiThreadPool.get(), srcData,
+                                 srcStride, vertexCount, dst, dstStride);
     }
     else
     {
@@ -879,7 +883,8 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
         const uint8_t *srcBytes = ANGLE_UNSAFE_TODO(src + srcOffset);
         size_t bytesToCopy      = maxNumVertices * dstFormat.pixelBytes;
         ANGLE_TRY(StreamVertexData(contextVk, conversion->getBuffer(), srcBytes, bytesToCopy,
-                                   dstOffset, maxNumVertices, srcStride, vertexLoadFunction));
+                                   dstOffset, maxNumVertices, srcStride, dstFormat.pixelBytes,
+                                   vertexLoadFunction));
     }
     else
     {
@@ -911,7 +916,7 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
                 size_t bytesToCopy = numVertices * dstFormat.pixelBytes;
                 ANGLE_TRY(StreamVertexData(contextVk, conversion->getBuffer(), srcBytes,
                                            bytesToCopy, dstOffset, numVertices, srcStride,
-                                           vertexLoadFunction));
+                                           dstFormat.pixelBytes, vertexLoadFunction));
             }
         }
     }
@@ -1351,10 +1356,8 @@ angle::Result VertexArrayVk::syncNeedsConversionAttrib(ContextVk *contextVk,
     // buffer as much as possible to reduce the amount of data that has to be converted.
     // When binding's offset changes, it will check if new offset and existing buffer's
     // offset are multiple of strides apart. It yes it will reuse. If new offset is
-    // larger, all existing data are still valid. If the new offset is smaller it will
-    // mark the newly exposed range dirty and then rely on
-    // ContextVk::initBufferForVertexConversion to decide buffer's size is big enough or
-    // not and reallocate (and mark entire buffer dirty) if needed.
+    // larger, all existing data are still valid. If the new offset is smaller, the
+    // converted data starts at a different vertex and it is converted again entirely.
     //
     // bufferVk:-----------------------------------------------------------------------
     //                 |                   |
@@ -1371,18 +1374,46 @@ angle::Result VertexArrayVk::syncNeedsConversionAttrib(ContextVk *contextVk,
 
     if (conversion->dirty())
     {
-        if (bindingIsAligned)
+        // Other vertex arrays that use the buffer the same way may have converted its current
+        // contents already.
+        VertexConversionCache &conversionCache = renderer->getVertexConversionCache();
+        const vk::VertexConversionKey conversionKey{
+            bufferVk->getBufferSerial().getValue(),
+            bufferVk->getDataRevision(),
+            conversion->getCacheKey().offset,
+            static_cast<uint64_t>(bufferVk->getSize()),
+            srcStride,
+            static_cast<uint16_t>(srcFormat.id),
+            static_cast<uint16_t>(conversion->getCacheKey().hostVisible)};
+
+        VertexConversionCache::SharedBufferHelper convertedData =
+            conversionCache.get(conversionKey);
+        if (convertedData)
         {
-            ANGLE_TRY(
-                convertVertexBufferGPU(contextVk, bufferVk, conversion, srcFormat, dstFormat));
+            conversion->shareData(contextVk, convertedData);
         }
         else
         {
-            ANGLE_VK_PERF_WARNING(contextVk, GL_DEBUG_SEVERITY_HIGH,
-                                  "GPU stall due to vertex format conversion of unaligned data");
+            if (bindingIsAligned)
+            {
+                ANGLE_TRY(
+                    convertVertexBufferGPU(contextVk, bufferVk, conversion, srcFormat, dstFormat));
+            }
+            else
+            {
+                ANGLE_VK_PERF_WARNING(
+                    contextVk, GL_DEBUG_SEVERITY_HIGH,
+                    "GPU stall due to vertex format conversion of unaligned data");
 
-            ANGLE_TRY(convertVertexBufferCPU(contextVk, bufferVk, conversion, srcFormat, dstFormat,
-                                             vertexFormat.getVertexLoadFunction()));
+                ANGLE_TRY(convertVertexBufferCPU(contextVk, bufferVk, conversion, srcFormat,
+                                                 dstFormat, vertexFormat.getVertexLoadFunction()));
+            }
+
+            if (conversion->valid())
+            {
+                conversionCache.put(conversionKey, conversion->getSharedData(),
+                                    conversion->getBuffer()->getSize());
+            }
         }
 
         // If conversion happens, the destination buffer stride may be changed,
@@ -1553,7 +1584,7 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
 
                 ANGLE_UNSAFE_TODO(ANGLE_TRY(StreamVertexData(
                     contextVk, vertexDataBuffer, src + srcOffset, bytesToAllocate, dstOffset, count,
-                    binding.getStride(), vertexFormat.getVertexLoadFunction())));
+                    binding.getStride(), stride, vertexFormat.getVertexLoadFunction())));
             }
         }
         else if (attrib.pointer == nullptr)
@@ -1583,7 +1614,7 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
                 ANGLE_TRY(StreamVertexData(contextVk, attribBufferHelper[mergedAttribIdx],
                                            (const uint8_t *)range.copyStartAddr,
                                            bytesToAllocate - destOffset, destOffset, vertexCount,
-                                           stride, nullptr));
+                                           stride, stride, nullptr));
             }
             vertexDataBuffer = attribBufferHelper[mergedAttribIdx];
             startOffset      = reinterpret_cast<uintptr_t>(attrib.pointer) - range.startAddr;
@@ -1603,7 +1634,7 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
                                                               &vertexDataBuffer));
 
             ANGLE_TRY(StreamVertexData(contextVk, vertexDataBuffer, src, bytesToAllocate,
-                                       destOffset, vertexCount, binding.getStride(),
+                                       destOffset, vertexCount, binding.getStride(), stride,
                                        vertexFormat.getVertexLoadFunction()));
             startOffset = 0;
         }
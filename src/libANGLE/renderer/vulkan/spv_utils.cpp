@@ -919,6 +919,11 @@ bool IsNonSemanticInstruction(const uint32_t *instruction)
     return ANGLE_UNSAFE_TODO(instruction[3]) == sh::vk::spirv::kIdNonSemanticInstructionSet;
 }
 
+// The output of a transformation is reserved ahead of time with room for this many words on top of
+// the size of the input, plus a quarter of it.  Transformations mostly patch or drop instructions,
+// and the code they add is small compared to the shader.
+constexpr size_t kTransformOutputReserveWords = 256;
+
 enum class EntryPointList
 {
     // Prior to SPIR-V 1.4, only the Input and Output variables are listed in OpEntryPoint.
@@ -997,6 +1002,10 @@ void SpirvTransformerBase::onTransformBegin()
     // Make sure the spirv::Blob is not reused.
     ASSERT(mSpirvBlobOut->empty());
 
+    // Reserve the output up front, so it doesn't reallocate as instructions are written to it.
+    mSpirvBlobOut->reserve(mSpirvBlobIn.size() + mSpirvBlobIn.size() / 4 +
+                           kTransformOutputReserveWords);
+
     // Copy the header to SPIR-V blob, we need that to be defined for SpirvTransformerBase::getNewId
     // to work.
     mSpirvBlobOut->assign(mSpirvBlobIn.begin(),
@@ -3975,6 +3984,7 @@ class SpirvTransformer final : public SpirvTransformerBase
 
     // Transform instructions:
     void transformInstruction();
+    void copyPendingInstructions();
 
     // Instructions that are purely informational:
     void visitDecorate(const uint32_t *instruction);
@@ -4005,6 +4015,21 @@ class SpirvTransformer final : public SpirvTransformerBase
     TransformationState transformTypeImage(const uint32_t *instruction);
     TransformationState transformImageRead(const uint32_t *instruction);
 
+    // The functions that transform the instructions of each opcode, in the global declarations and
+    // in functions respectively.  Instructions with no function are copied as-is.  Every opcode
+    // that is transformed is below kOpcodeTransformTableSize.
+    using TransformFunction = TransformationState (SpirvTransformer::*)(const uint32_t *);
+    struct OpcodeTransforms
+    {
+        TransformFunction global   = nullptr;
+        TransformFunction function = nullptr;
+    };
+    static constexpr size_t kOpcodeTransformTableSize = 128;
+    using OpcodeTransformTable = std::array<OpcodeTransforms, kOpcodeTransformTableSize>;
+
+    static constexpr OpcodeTransformTable MakeOpcodeTransformTable();
+    static TransformFunction GetTransformFunction(spv::Op opCode, bool isInFunctionSection);
+
     // Helpers:
     void visitTypeHelper(spirv::IdResult id, spirv::IdRef typeId);
     void writePendingDeclarations();
@@ -4016,6 +4041,9 @@ class SpirvTransformer final : public SpirvTransformerBase
 
     // Traversal state:
     spirv::IdRef mCurrentFunctionId;
+    // The start of the instructions that are copied as-is and are not yet output.  They are output
+    // together, either before the next transformation or at the end.
+    size_t mPendingCopyBegin = 0;
 
     // Transformation state:
 
@@ -4043,10 +4071,60 @@ void SpirvTransformer::transform()
     // info.
     resolveVariableIds();
 
+    mPendingCopyBegin = mCurrentWord;
     while (mCurrentWord < mSpirvBlobIn.size())
     {
         transformInstruction();
     }
+    copyPendingInstructions();
+}
+
+// static
+constexpr SpirvTransformer::OpcodeTransformTable SpirvTransformer::MakeOpcodeTransformTable()
+{
+    OpcodeTransformTable table = {};
+
+    // Global declaration opcodes:
+    table[spv::OpExtension].global      = &SpirvTransformer::transformExtension;
+    table[spv::OpExtInstImport].global  = &SpirvTransformer::transformExtInstImport;
+    table[spv::OpExtInst].global        = &SpirvTransformer::transformExtInst;
+    table[spv::OpName].global           = &SpirvTransformer::transformName;
+    table[spv::OpMemberName].global     = &SpirvTransformer::transformMemberName;
+    table[spv::OpCapability].global     = &SpirvTransformer::transformCapability;
+    table[spv::OpEntryPoint].global     = &SpirvTransformer::transformEntryPoint;
+    table[spv::OpDecorate].global       = &SpirvTransformer::transformDecorate;
+    table[spv::OpMemberDecorate].global = &SpirvTransformer::transformMemberDecorate;
+    table[spv::OpTypeImage].global      = &SpirvTransformer::transformTypeImage;
+    table[spv::OpTypePointer].global    = &SpirvTransformer::transformTypePointer;
+    table[spv::OpTypeStruct].global     = &SpirvTransformer::transformTypeStruct;
+    table[spv::OpVariable].global       = &SpirvTransformer::transformVariable;
+
+    // In-function opcodes:
+    table[spv::OpExtInst].function                = &SpirvTransformer::transformExtInst;
+    table[spv::OpAccessChain].function            = &SpirvTransformer::transformAccessChain;
+    table[spv::OpInBoundsAccessChain].function    = &SpirvTransformer::transformAccessChain;
+    table[spv::OpPtrAccessChain].function         = &SpirvTransformer::transformAccessChain;
+    table[spv::OpInBoundsPtrAccessChain].function = &SpirvTransformer::transformAccessChain;
+    table[spv::OpLoad].function                   = &SpirvTransformer::transformLoad;
+    table[spv::OpImageRead].function              = &SpirvTransformer::transformImageRead;
+
+    return table;
+}
+
+// static
+ANGLE_INLINE SpirvTransformer::TransformFunction SpirvTransformer::GetTransformFunction(
+    spv::Op opCode,
+    bool isInFunctionSection)
+{
+    static constexpr OpcodeTransformTable kOpcodeTransforms = MakeOpcodeTransformTable();
+
+    if (static_cast<size_t>(opCode) >= kOpcodeTransforms.size())
+    {
+        return nullptr;
+    }
+
+    const OpcodeTransforms &transforms = kOpcodeTransforms[opCode];
+    return isInFunctionSection ? transforms.function : transforms.global;
 }
 
 void SpirvTransformer::resolveVariableIds()
@@ -4163,92 +4241,34 @@ void SpirvTransformer::transformInstruction()
         mIsInFunctionSection = true;
     }
 
-    // Only look at interesting instructions.
-    TransformationState transformationState = TransformationState::Unchanged;
-
-    if (mIsInFunctionSection)
+    // Only look at interesting instructions.  The others are left to be copied to output as-is
+    // along with the instructions around them.
+    const TransformFunction transformFunction = GetTransformFunction(opCode, mIsInFunctionSection);
+    if (transformFunction != nullptr)
     {
-        // Look at in-function opcodes.
-        switch (opCode)
-        {
-            case spv::OpExtInst:
-                transformationState = transformExtInst(instruction);
-                break;
-            case spv::OpAccessChain:
-            case spv::OpInBoundsAccessChain:
-            case spv::OpPtrAccessChain:
-            case spv::OpInBoundsPtrAccessChain:
-                transformationState = transformAccessChain(instruction);
-                break;
-            case spv::OpLoad:
-                transformationState = transformLoad(instruction);
-                break;
-            case spv::OpImageRead:
-                transformationState = transformImageRead(instruction);
-                break;
-            default:
-                break;
-        }
-    }
-    else
-    {
-        // Look at global declaration opcodes.
-        switch (opCode)
+        // The transformation may write to output, so the instructions before it must be output
+        // first.
+        copyPendingInstructions();
+
+        // If the instruction was transformed, leave it out of the instructions to copy.
+        if ((this->*transformFunction)(instruction) == TransformationState::Transformed)
         {
-            case spv::OpExtension:
-                transformationState = transformExtension(instruction);
-                break;
-            case spv::OpExtInstImport:
-                transformationState = transformExtInstImport(instruction);
-                break;
-            case spv::OpExtInst:
-                transformationState = transformExtInst(instruction);
-                break;
-            case spv::OpName:
-                transformationState = transformName(instruction);
-                break;
-            case spv::OpMemberName:
-                transformationState = transformMemberName(instruction);
-                break;
-            case spv::OpCapability:
-                transformationState = transformCapability(instruction);
-                break;
-            case spv::OpEntryPoint:
-                transformationState = transformEntryPoint(instruction);
-                break;
-            case spv::OpDecorate:
-                transformationState = transformDecorate(instruction);
-                break;
-            case spv::OpMemberDecorate:
-                transformationState = transformMemberDecorate(instruction);
-                break;
-            case spv::OpTypeImage:
-                transformationState = transformTypeImage(instruction);
-                break;
-            case spv::OpTypePointer:
-                transformationState = transformTypePointer(instruction);
-                break;
-            case spv::OpTypeStruct:
-                transformationState = transformTypeStruct(instruction);
-                break;
-            case spv::OpVariable:
-                transformationState = transformVariable(instruction);
-                break;
-            default:
-                break;
+            mPendingCopyBegin = mCurrentWord + wordCount;
         }
     }
 
-    // If the instruction was not transformed, copy it to output as is.
-    if (transformationState == TransformationState::Unchanged)
-    {
-        copyInstruction(instruction, wordCount);
-    }
-
     // Advance to next instruction.
     mCurrentWord += wordCount;
 }
 
+void SpirvTransformer::copyPendingInstructions()
+{
+    ASSERT(mPendingCopyBegin <= mCurrentWord);
+    mSpirvBlobOut->insert(mSpirvBlobOut->end(), mSpirvBlobIn.begin() + mPendingCopyBegin,
+                          mSpirvBlobIn.begin() + mCurrentWord);
+    mPendingCopyBegin = mCurrentWord;
+}
+
 // Called at the end of the declarations section.  Any declarations that are necessary but weren't
 // present in the original shader need to be done here.
 void SpirvTransformer::writePendingDeclarations()
@@ -38,6 +38,12 @@ constexpr bool kDumpPipelineCacheGraph = true;
 constexpr bool kDumpPipelineCacheGraph = false;
 #endif  // ANGLE_DUMP_PIPELINE_CACHE_GRAPH
 
+// Transformed SPIR-V is kept for up to 16MB, which is a few hundred shaders.
+constexpr size_t kSpvTransformCacheMaxSizeBytes = 16 * 1024 * 1024;
+// Converted vertex data is looked up for up to 64MB of it.  The cache doesn't own the data, so
+// this only limits how much of it can be shared.
+constexpr size_t kVertexConversionCacheMaxSizeBytes = 64 * 1024 * 1024;
+
 template <typename T>
 bool AllCacheEntriesHaveUniqueReference(const T &payload)
 {
@@ -7239,6 +7245,17 @@ void PipelineCacheAccess::merge(Renderer *renderer, const vk::PipelineCache &pip
 
     mPipelineCache->merge(renderer->getDevice(), 1, pipelineCache.ptr());
 }
+
+// VertexConversionKey implementation.
+bool VertexConversionKey::operator==(const VertexConversionKey &other) const
+{
+    return memcmp(this, &other, sizeof(VertexConversionKey)) == 0;
+}
+
+size_t VertexConversionKey::hash() const
+{
+    return angle::ComputeGenericHash(angle::byte_span_from_ref(*this));
+}
 }  // namespace vk
 
 // UpdateDescriptorSetsBuilder implementation.
@@ -8708,4 +8725,168 @@ angle::Result SamplerCache::getSampler(ContextVk *contextVk,
 
     return angle::Result::Continue;
 }
+
+// SpvTransformCache implementation.
+SpvTransformCache::SpvTransformCache() : mPayload(kSpvTransformCacheMaxSizeBytes) {}
+
+SpvTransformCache::~SpvTransformCache()
+{
+    ASSERT(mPayload.empty());
+}
+
+void SpvTransformCache::destroy(vk::Renderer *renderer)
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+
+    renderer->accumulateCacheStats(VulkanCacheType::SpvTransform, mCacheStats);
+    mPayload.clear();
+}
+
+// static
+SpvTransformCache::Key SpvTransformCache::ComputeKey(
+    const SpvTransformOptions &options,
+    const ShaderInterfaceVariableInfoMap &variableInfoMap,
+    const angle::spirv::Blob &initialSpirvBlob)
+{
+    angle::BlobCacheHasher hasher;
+    hasher.Init();
+
+    hasher.Update(initialSpirvBlob.data(), initialSpirvBlob.size() * sizeof(uint32_t));
+
+    // The options are hashed one by one, as the struct may contain padding.
+    angle::UpdateHashWithValue(hasher, options.shaderType);
+    angle::UpdateHashWithValue(hasher, options.isLastPreFragmentStage);
+    angle::UpdateHashWithValue(hasher, options.isTransformFeedbackStage);
+    angle::UpdateHashWithValue(hasher, options.isTransformFeedbackEmulated);
+    angle::UpdateHashWithValue(hasher, options.isMultisampledFramebufferFetch);
+    angle::UpdateHashWithValue(hasher, options.enableSampleShading);
+    angle::UpdateHashWithValue(hasher, options.validate);
+    angle::UpdateHashWithValue(hasher, options.useSpirvVaryingPrecisionFixer);
+    angle::UpdateHashWithValue(hasher, options.removeDepthInput);
+    angle::UpdateHashWithValue(hasher, options.removeStencilInput);
+    angle::UpdateHashWithValue(hasher, options.roundOutputAfterDithering);
+    angle::UpdateHashWithValue(hasher, options.ditherControl);
+
+    // The serialized variable info map is the same as what's stored in the program binary, which
+    // is tightly packed.
+    gl::BinaryOutputStream variableInfoStream;
+    variableInfoMap.save(&variableInfoStream);
+    hasher.Update(variableInfoStream.data(), variableInfoStream.size());
+
+    hasher.Final();
+
+    Key key;
+    ANGLE_UNSAFE_TODO(memcpy(key.data(), hasher.Digest(), key.size()));
+    return key;
+}
+
+angle::Result SpvTransformCache::getTransformedSpirv(
+    const SpvTransformOptions &options,
+    const ShaderInterfaceVariableInfoMap &variableInfoMap,
+    const angle::spirv::Blob &initialSpirvBlob,
+    const ProgramSpirvBlobs &programSpirvBlobs,
+    Key *keyOut,
+    SharedSpirvBlob *spirvBlobOut)
+{
+    *keyOut = ComputeKey(options, variableInfoMap, initialSpirvBlob);
+
+    for (const auto &programSpirvBlob : programSpirvBlobs)
+    {
+        if (programSpirvBlob.first == *keyOut)
+        {
+            *spirvBlobOut = programSpirvBlob.second;
+            return angle::Result::Continue;
+        }
+    }
+
+    {
+        std::unique_lock<angle::SimpleMutex> lock(mMutex);
+        const SharedSpirvBlob *cached = nullptr;
+        if (mPayload.get(*keyOut, &cached))
+        {
+            mCacheStats.hit();
+            *spirvBlobOut = *cached;
+            return angle::Result::Continue;
+        }
+        mCacheStats.miss();
+    }
+
+    // Transform outside the lock, so that other threads can use the cache in the meantime.  If
+    // multiple threads transform the same SPIR-V, they produce the same result and the last one
+    // replaces the others' entry.
+    auto transformed = std::make_shared<angle::spirv::Blob>();
+    ANGLE_TRY(SpvTransformSpirvCode(options, variableInfoMap, initialSpirvBlob, transformed.get()));
+
+    *spirvBlobOut = transformed;
+    put(*keyOut, std::move(transformed));
+
+    return angle::Result::Continue;
+}
+
+SpvTransformCache::SharedSpirvBlob SpvTransformCache::get(const Key &key)
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+    const SharedSpirvBlob *cached = nullptr;
+    return mPayload.get(key, &cached) ? *cached : nullptr;
+}
+
+void SpvTransformCache::put(const Key &key, SharedSpirvBlob &&spirvBlob)
+{
+    const size_t size = spirvBlob->size() * sizeof(uint32_t);
+
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+    mPayload.put(key, std::move(spirvBlob), size);
+    mCacheStats.setSize(static_cast<uint32_t>(mPayload.entryCount()));
+}
+
+// VertexConversionCache implementation.
+VertexConversionCache::VertexConversionCache() : mPayload(kVertexConversionCacheMaxSizeBytes) {}
+
+VertexConversionCache::~VertexConversionCache()
+{
+    ASSERT(mPayload.empty());
+}
+
+void VertexConversionCache::destroy(vk::Renderer *renderer)
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+
+    renderer->accumulateCacheStats(VulkanCacheType::VertexConversion, mCacheStats);
+    mPayload.clear();
+}
+
+VertexConversionCache::SharedBufferHelper VertexConversionCache::get(
+    const vk::VertexConversionKey &key)
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+
+    const std::weak_ptr<vk::BufferHelper> *cached = nullptr;
+    if (mPayload.get(key, &cached))
+    {
+        SharedBufferHelper data = cached->lock();
+        if (data && data->valid())
+        {
+            mCacheStats.hit();
+            return data;
+        }
+    }
+
+    mCacheStats.miss();
+    return nullptr;
+}
+
+void VertexConversionCache::put(const vk::VertexConversionKey &key,
+                                const SharedBufferHelper &data,
+                                size_t size)
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+    mPayload.put(key, std::weak_ptr<vk::BufferHelper>(data), size);
+    mCacheStats.setSize(static_cast<uint32_t>(mPayload.entryCount()));
+}
+
+CacheStats VertexConversionCache::getCurrentStats() const
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+    return mCacheStats;
+}
 }  // namespace rx
@@ -18,6 +18,7 @@
 #include "common/FixedVector.h"
 #include "common/SimpleMutex.h"
 #include "common/WorkerThread.h"
+#include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/renderer/vulkan/ShaderInterfaceVariableInfoMap.h"
 #include "libANGLE/renderer/vulkan/vk_resource.h"
@@ -2363,6 +2364,25 @@ void FramebufferCacheManager::addKey(const SharedFramebufferCacheKey &key);
 using DescriptorSetCacheManager = SharedCacheKeyManager<SharedDescriptorSetCacheKey>;
 template <>
 void DescriptorSetCacheManager::addKey(const SharedDescriptorSetCacheKey &key);
+
+// Identifies converted vertex data by what it was converted from.  The serial and data revision of
+// the source buffer identify its contents.
+struct VertexConversionKey
+{
+    bool operator==(const VertexConversionKey &other) const;
+    size_t hash() const;
+
+    uint64_t srcBufferSerial;
+    uint64_t srcDataRevision;
+    uint64_t srcOffset;
+    uint64_t srcSize;
+    uint32_t srcStride;
+    uint16_t srcFormatID;
+    uint16_t hostVisible;
+};
+
+// The key is hashed and compared as bytes.
+static_assert(sizeof(VertexConversionKey) == 40, "Unexpected VertexConversionKey padding");
 }  // namespace vk
 }  // namespace rx
 
@@ -2426,6 +2446,12 @@ struct hash<rx::vk::SamplerDesc>
     size_t operator()(const rx::vk::SamplerDesc &key) const { return key.hash(); }
 };
 
+template <>
+struct hash<rx::vk::VertexConversionKey>
+{
+    size_t operator()(const rx::vk::VertexConversionKey &key) const { return key.hash(); }
+};
+
 // See Resource Serial types defined in vk_utils.h.
 #define ANGLE_HASH_VK_SERIAL(Type)                               \
     template <>                                                  \
@@ -2460,6 +2486,8 @@ enum class VulkanCacheType
     ShaderResourcesDescriptors,
     Framebuffer,
     DescriptorMetaCache,
+    SpvTransform,
+    VertexConversion,
     EnumCount
 };
 
@@ -2906,6 +2934,85 @@ class SamplerYcbcrConversionCache final
     SamplerYcbcrConversionMap mVkFormatPayload;
 };
 
+// Transformed SPIR-V Cache
+//
+// Programs often have identical shaders, which SpvTransformSpirvCode transforms to the same module
+// given the same options and shader interface variable info.  The transformed modules are kept in
+// this cache, shared by the whole renderer and keyed by a hash of all three inputs.  The least
+// recently used modules are evicted once the cache exceeds its size limit.
+class SpvTransformCache final : public HasCacheStats<VulkanCacheType::SpvTransform>
+{
+  public:
+    using Key             = angle::BlobCacheKey;
+    using SharedSpirvBlob = std::shared_ptr<const angle::spirv::Blob>;
+    // Transformed SPIR-V owned by a single program, such as that loaded from its binary.
+    using ProgramSpirvBlobs = std::vector<std::pair<Key, SharedSpirvBlob>>;
+
+    SpvTransformCache();
+    ~SpvTransformCache() override;
+
+    void destroy(vk::Renderer *renderer);
+
+    // Returns the transformed SPIR-V and its key, transforming and caching it on a miss.  The
+    // SPIR-V in |programSpirvBlobs| is used if it has the key, but is never put in the cache, so
+    // that what a program binary provides can't be used by other programs.
+    angle::Result getTransformedSpirv(const SpvTransformOptions &options,
+                                      const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                      const angle::spirv::Blob &initialSpirvBlob,
+                                      const ProgramSpirvBlobs &programSpirvBlobs,
+                                      Key *keyOut,
+                                      SharedSpirvBlob *spirvBlobOut);
+
+    // Used to store the transformed SPIR-V in the program binary.
+    SharedSpirvBlob get(const Key &key);
+
+    // Helpers for white box tests
+    size_t getCacheHitCount() const { return mCacheStats.getHitCount(); }
+    size_t getCacheMissCount() const { return mCacheStats.getMissCount(); }
+
+  private:
+    static Key ComputeKey(const SpvTransformOptions &options,
+                          const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                          const angle::spirv::Blob &initialSpirvBlob);
+
+    void put(const Key &key, SharedSpirvBlob &&spirvBlob);
+
+    mutable angle::SimpleMutex mMutex;
+    angle::SizedMRUCache<Key, SharedSpirvBlob> mPayload;
+};
+
+// Converted Vertex Data Cache
+//
+// Vertex arrays that use the same buffer with the same format, stride and offset need the same
+// converted data.  Each has its own VertexConversionBuffer in the BufferVk, but those can share the
+// converted data.  This cache finds the converted data of the source buffer's current contents,
+// so that one vertex array's conversion is reused by the others instead of being redone.  The
+// cache doesn't keep the data alive; the conversion buffers own it, and an entry whose data none of
+// them use anymore misses.  The least recently used entries are evicted once the data they refer
+// to exceeds the cache's size limit.
+class VertexConversionCache final : public HasCacheStats<VulkanCacheType::VertexConversion>
+{
+  public:
+    using SharedBufferHelper = std::shared_ptr<vk::BufferHelper>;
+
+    VertexConversionCache();
+    ~VertexConversionCache() override;
+
+    void destroy(vk::Renderer *renderer);
+
+    // Returns the converted data for |key|, or null on a miss.
+    SharedBufferHelper get(const vk::VertexConversionKey &key);
+    // Called once |data|, which is |size| bytes, holds the converted data for |key|.
+    void put(const vk::VertexConversionKey &key, const SharedBufferHelper &data, size_t size);
+
+    // Used for perf counters, and by white box tests.
+    CacheStats getCurrentStats() const;
+
+  private:
+    mutable angle::SimpleMutex mMutex;
+    angle::SizedMRUCache<vk::VertexConversionKey, std::weak_ptr<vk::BufferHelper>> mPayload;
+};
+
 // Descriptor Set Cache
 template <typename T>
 class DescriptorSetCache final : angle::NonCopyable
@@ -8614,6 +8614,8 @@ angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
     uint32_t bufferRowLength;
     uint32_t bufferImageHeight;
     size_t allocationSize;
+    // The height of the rows of blocks that outputRowPitch applies to.
+    size_t outputBlockHeight = 1;
 
     LoadImageFunctionInfo loadFunctionInfo = vkFormat.getTextureLoadFunction(formatSupport, type);
     LoadImageFunction stencilLoadFunction  = nullptr;
@@ -8645,9 +8647,10 @@ angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
         ANGLE_VK_CHECK_MATH(contextVk,
                             storageFormatInfo.computeCompressedImageSize(glExtents, &totalSize));
 
-        outputRowPitch   = rowPitch;
-        outputDepthPitch = depthPitch;
-        allocationSize   = totalSize;
+        outputRowPitch    = rowPitch;
+        outputDepthPitch  = depthPitch;
+        allocationSize    = totalSize;
+        outputBlockHeight = storageFormatInfo.compressedBlockHeight;
 
         ANGLE_VK_CHECK_MATH(
             contextVk, storageFormatInfo.computeBufferRowLength(glExtents.width, &bufferRowLength));
@@ -8768,9 +8771,27 @@ angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
                                                 MemoryCoherency::CachedNonCoherent, storageFormatID,
                                                 &stagingOffset, &stagingPointer));
 
-    loadFunctionInfo.loadFunction(
-        contextVk->getImageLoadContext(), glExtents.width, glExtents.height, glExtents.depth,
-        source, inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch, outputDepthPitch);
+    // Large uploads are split across the worker threads, unless the load function needs the whole
+    // image: ASTC decompression uses the worker threads itself, and paletted data starts with the
+    // palette.
+    const bool loadInParallel = !storageFormat.isYUV && !formatInfo.paletted &&
+                                !gl::IsASTC2DFormat(formatInfo.internalFormat) &&
+                                !gl::IsASTC3DFormat(formatInfo.internalFormat);
+    if (loadInParallel)
+    {
+        const size_t inputBlockHeight = formatInfo.compressed ? formatInfo.compressedBlockHeight : 1;
+        angle::LoadImageInParallel(loadFunctionInfo.loadFunction, contextVk->getImageLoadContext(),
+                                   glExtents.width, glExtents.height, glExtents.depth, source,
+                                   inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch,
+                                   outputDepthPitch, inputBlockHeight, outputBlockHeight);
+    }
+    else
+    {
+        loadFunctionInfo.loadFunction(contextVk->getImageLoadContext(), glExtents.width,
+                                      glExtents.height, glExtents.depth, source, inputRowPitch,
+                                      inputDepthPitch, stagingPointer, outputRowPitch,
+                                      outputDepthPitch);
+    }
 
     // YUV formats need special handling.
     if (storageFormat.isYUV)
@@ -2199,6 +2199,8 @@ void Renderer::onDestroy(vk::ErrorContext *context)
     ASSERT(mOrphanedBufferBlockList.empty());
     mSamplerCache.destroy(this);
     mYuvConversionCache.destroy(this);
+    mSpvTransformCache.destroy(this);
+    mVertexConversionCache.destroy(this);
 
     mRefCountedEventRecycler.destroy(mDevice);
 
@@ -6052,6 +6054,8 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                                 maxComputeWorkGroupInvocations >= 256 &&
                                 ((isAMD && !IsWindows()) || isNvidia || isSamsung));
 
+    ANGLE_FEATURE_CONDITION(&mFeatures, forceGenerateMipmapOnCPU, false);
+
     bool isAdreno540 = mPhysicalDeviceProperties.deviceID == angle::kDeviceID_Adreno540;
     ANGLE_FEATURE_CONDITION(&mFeatures, forceMaxUniformBufferSize16KB,
                             isQualcommProprietary && isAdreno540);
@@ -7313,6 +7317,9 @@ void Renderer::initializeFrontendFeatures(angle::FrontendFeatures *features) con
     // Always run the link's warm up job in a thread.  It's an optimization only, and does not block
     // the link resolution.
     ANGLE_FEATURE_CONDITION(features, alwaysRunLinkSubJobsThreaded, true);
+    // Compile the stages of a program concurrently even if GL_KHR_parallel_shader_compile is not
+    // used.  Each compile job uses its own compiler instance, and thus its own pool allocator.
+    ANGLE_FEATURE_CONDITION(features, alwaysRunCompileJobsThreaded, true);
 
     // Enable the program binary blob compression for glGetProgramBinary and glGetProgramiv.  It
     // will be decompressed when loading the program binary by glProgramBinary.
@@ -7422,9 +7429,10 @@ angle::Result Renderer::syncPipelineCacheVk(const gl::Context *contextGL)
         constexpr size_t kMaxTotalSize = 64 * 1024 * 1024;
 
         // Create task to compress.
-        mCompressEvent = contextGL->getWorkerThreadPool()->postWorkerTask(
+        mCompressEvent = contextGL->getWorkerThreadPool()->postWorkerTaskWithPriority(
             std::make_shared<CompressAndStorePipelineCacheTask>(
-                globalOps, this, std::move(pipelineCacheData), kMaxTotalSize));
+                globalOps, this, std::move(pipelineCacheData), kMaxTotalSize),
+            angle::WorkerTaskPriority::Low);
     }
     else
     {
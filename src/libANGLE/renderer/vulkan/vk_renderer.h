@@ -591,6 +591,8 @@ class Renderer : angle::NonCopyable
     void addBufferBlockToOrphanList(vk::BufferBlock *block) { mOrphanedBufferBlockList.add(block); }
     SamplerCache &getSamplerCache() { return mSamplerCache; }
     SamplerYcbcrConversionCache &getYuvConversionCache() { return mYuvConversionCache; }
+    SpvTransformCache &getSpvTransformCache() { return mSpvTransformCache; }
+    VertexConversionCache &getVertexConversionCache() { return mVertexConversionCache; }
 
     VkDeviceSize getSuballocationDestroyedSize() const
     {
@@ -970,6 +972,8 @@ class Renderer : angle::NonCopyable
 
     SamplerCache mSamplerCache;
     SamplerYcbcrConversionCache mYuvConversionCache;
+    SpvTransformCache mSpvTransformCache;
+    VertexConversionCache mVertexConversionCache;
 
     VkDeviceSize mPendingGarbageSizeLimit;
 
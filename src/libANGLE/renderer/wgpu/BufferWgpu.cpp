@@ -198,7 +198,8 @@ angle::Result BufferWgpu::getIndexRange(const gl::Context *context,
     ANGLE_TRY(mBuffer.readDataImmediate(contextWgpu, offset, count * typeBytes,
                                         webgpu::RenderPassClosureReason::IndexRangeReadback,
                                         &readback));
-    *outRange = gl::ComputeIndexRange(type, readback.data, count, primitiveRestartEnabled);
+    *outRange =
+        mState.computeIndexRange(type, offset, count, primitiveRestartEnabled, readback.data);
 
     return angle::Result::Continue;
 }
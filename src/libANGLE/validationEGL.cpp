@@ -1188,6 +1188,20 @@ bool ValidateGetPlatformDisplayCommon(const ValidationContext *val,
             return false;
         }
     }
+    if (attribMap.contains(EGL_DISK_PROGRAM_CACHE_DIRECTORY_ANGLE))
+    {
+        if (!clientExtensions.diskProgramCacheANGLE)
+        {
+            val->setError(EGL_BAD_ATTRIBUTE, "EGL_ANGLE_disk_program_cache is not supported");
+            return false;
+        }
+        else if (attribMap.get(EGL_DISK_PROGRAM_CACHE_DIRECTORY_ANGLE, 0) == 0)
+        {
+            val->setError(EGL_BAD_ATTRIBUTE,
+                          "EGL_DISK_PROGRAM_CACHE_DIRECTORY_ANGLE must be a valid pointer");
+            return false;
+        }
+    }
 
     return true;
 }
@@ -2065,6 +2079,16 @@ bool ValidateCreateContextAttribute(const ValidationContext *val,
             }
             break;
 
+        case EGL_CONTEXT_THREADED_COMMANDS_ANGLE:
+            if (!display->getExtensions().contextThreadedCommandsANGLE)
+            {
+                val->setError(EGL_BAD_ATTRIBUTE,
+                              "Attribute EGL_CONTEXT_THREADED_COMMANDS_ANGLE requires "
+                              "EGL_ANGLE_context_threaded_commands.");
+                return false;
+            }
+            break;
+
         default:
             val->setError(EGL_BAD_ATTRIBUTE, "Unknown attribute: 0x%04" PRIxPTR "X", attribute);
             return false;
@@ -2350,6 +2374,16 @@ bool ValidateCreateContextAttributeValue(const ValidationContext *val,
             }
             break;
 
+        case EGL_CONTEXT_THREADED_COMMANDS_ANGLE:
+            if (value != EGL_TRUE && value != EGL_FALSE)
+            {
+                val->setError(EGL_BAD_ATTRIBUTE,
+                              "EGL_CONTEXT_THREADED_COMMANDS_ANGLE must "
+                              "be either EGL_TRUE or EGL_FALSE.");
+                return false;
+            }
+            break;
+
         default:
             UNREACHABLE();
             return false;
@@ -382,9 +382,10 @@ bool ValidateCopyTexImageParametersBase(const Context *context,
 void RecordDrawModeError(const Context *context, angle::EntryPoint entryPoint, PrimitiveMode mode);
 const char *ValidateDrawElementsStates(const Context *context);
 
-ANGLE_INLINE bool ValidateDrawBase(const Context *context,
-                                   angle::EntryPoint entryPoint,
-                                   PrimitiveMode mode)
+// Checks the basic draw states and the draw mode, whose results are cached in the StateCache.
+ANGLE_INLINE bool ValidateDrawStatesAndMode(const Context *context,
+                                            angle::EntryPoint entryPoint,
+                                            PrimitiveMode mode)
 {
     intptr_t drawStatesError = context->getStateCache().getBasicDrawStatesErrorString(
         context, &context->getPrivateStateCache());
@@ -405,6 +406,25 @@ ANGLE_INLINE bool ValidateDrawBase(const Context *context,
     return true;
 }
 
+ANGLE_INLINE bool ValidateDrawBase(const Context *context,
+                                   angle::EntryPoint entryPoint,
+                                   PrimitiveMode mode)
+{
+    const StateCache &stateCache = context->getStateCache();
+    if (ANGLE_LIKELY(stateCache.isLastValidatedDraw(&context->getPrivateStateCache(), mode)))
+    {
+        return true;
+    }
+
+    if (ANGLE_UNLIKELY(!ValidateDrawStatesAndMode(context, entryPoint, mode)))
+    {
+        return false;
+    }
+
+    stateCache.setLastValidatedDraw(mode, DrawElementsType::InvalidEnum);
+    return true;
+}
+
 bool ValidateDrawArraysInstancedBase(const Context *context,
                                      angle::EntryPoint entryPoint,
                                      PrimitiveMode mode,
@@ -1039,6 +1059,21 @@ ANGLE_INLINE bool ValidateDrawElementsBase(const Context *context,
     return true;
 }
 
+// Same as ValidateDrawBase, for indexed draw calls that passed ValidateDrawElementsBase.
+ANGLE_INLINE bool ValidateDrawElementsStatesAndMode(const Context *context,
+                                                    angle::EntryPoint entryPoint,
+                                                    PrimitiveMode mode,
+                                                    DrawElementsType type)
+{
+    if (ANGLE_UNLIKELY(!ValidateDrawStatesAndMode(context, entryPoint, mode)))
+    {
+        return false;
+    }
+
+    context->getStateCache().setLastValidatedDraw(mode, type);
+    return true;
+}
+
 ANGLE_INLINE bool ValidateDrawElementsCommon(const Context *context,
                                              angle::EntryPoint entryPoint,
                                              PrimitiveMode mode,
@@ -1047,7 +1082,13 @@ ANGLE_INLINE bool ValidateDrawElementsCommon(const Context *context,
                                              const void *indices,
                                              GLsizei primcount)
 {
-    if (ANGLE_UNLIKELY(!ValidateDrawElementsBase(context, entryPoint, mode, type)))
+    // Repeating the last validated draw skips the checks whose results are cached.
+    const StateCache &stateCache = context->getStateCache();
+    const bool isLastValidatedDraw =
+        stateCache.isLastValidatedDrawElements(&context->getPrivateStateCache(), mode, type);
+
+    if (!isLastValidatedDraw &&
+        ANGLE_UNLIKELY(!ValidateDrawElementsBase(context, entryPoint, mode, type)))
     {
         return false;
     }
@@ -1094,10 +1135,12 @@ ANGLE_INLINE bool ValidateDrawElementsCommon(const Context *context,
         }
 
         // Early exit.
-        return ValidateDrawBase(context, entryPoint, mode);
+        return isLastValidatedDraw ||
+               ValidateDrawElementsStatesAndMode(context, entryPoint, mode, type);
     }
 
-    if (ANGLE_UNLIKELY(!ValidateDrawBase(context, entryPoint, mode)))
+    if (!isLastValidatedDraw &&
+        ANGLE_UNLIKELY(!ValidateDrawElementsStatesAndMode(context, entryPoint, mode, type)))
     {
         return false;
     }
@@ -0,0 +1,2151 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by generate_entry_points.py using data from gl.xml and entry_point_command_stream.json.
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// command_stream_autogen.cpp:
+//   Records GL calls in the command stream of a context, and executes them on its thread.
+
+#include "libGLESv2/command_stream_autogen.h"
+
+#include "common/entry_points_enum_autogen.h"
+#include "common/mathutil.h"
+#include "libANGLE/CommandStream.h"
+#include "libANGLE/Context.h"
+#include "libGLESv2/entry_points_gles_1_0_autogen.h"
+#include "libGLESv2/entry_points_gles_2_0_autogen.h"
+#include "libGLESv2/entry_points_gles_3_0_autogen.h"
+#include "libGLESv2/entry_points_gles_3_1_autogen.h"
+#include "libGLESv2/entry_points_gles_3_2_autogen.h"
+#include "libGLESv2/entry_points_gles_ext_autogen.h"
+#include "libGLESv2/global_state.h"
+
+namespace gl
+{
+namespace
+{
+struct ActiveTextureParams
+{
+    GLenum texture;
+};
+
+void ExecuteActiveTexture(const void *params)
+{
+    const auto *cmd = static_cast<const ActiveTextureParams *>(params);
+    GL_ActiveTexture(cmd->texture);
+}
+
+struct BindBufferParams
+{
+    GLenum target;
+    GLuint buffer;
+};
+
+void ExecuteBindBuffer(const void *params)
+{
+    const auto *cmd = static_cast<const BindBufferParams *>(params);
+    GL_BindBuffer(cmd->target, cmd->buffer);
+}
+
+struct BindFramebufferParams
+{
+    GLenum target;
+    GLuint framebuffer;
+};
+
+void ExecuteBindFramebuffer(const void *params)
+{
+    const auto *cmd = static_cast<const BindFramebufferParams *>(params);
+    GL_BindFramebuffer(cmd->target, cmd->framebuffer);
+}
+
+struct BindTextureParams
+{
+    GLenum target;
+    GLuint texture;
+};
+
+void ExecuteBindTexture(const void *params)
+{
+    const auto *cmd = static_cast<const BindTextureParams *>(params);
+    GL_BindTexture(cmd->target, cmd->texture);
+}
+
+struct BlendColorParams
+{
+    GLfloat red;
+    GLfloat green;
+    GLfloat blue;
+    GLfloat alpha;
+};
+
+void ExecuteBlendColor(const void *params)
+{
+    const auto *cmd = static_cast<const BlendColorParams *>(params);
+    GL_BlendColor(cmd->red, cmd->green, cmd->blue, cmd->alpha);
+}
+
+struct BlendEquationParams
+{
+    GLenum mode;
+};
+
+void ExecuteBlendEquation(const void *params)
+{
+    const auto *cmd = static_cast<const BlendEquationParams *>(params);
+    GL_BlendEquation(cmd->mode);
+}
+
+struct BlendEquationSeparateParams
+{
+    GLenum modeRGB;
+    GLenum modeAlpha;
+};
+
+void ExecuteBlendEquationSeparate(const void *params)
+{
+    const auto *cmd = static_cast<const BlendEquationSeparateParams *>(params);
+    GL_BlendEquationSeparate(cmd->modeRGB, cmd->modeAlpha);
+}
+
+struct BlendFuncParams
+{
+    GLenum sfactor;
+    GLenum dfactor;
+};
+
+void ExecuteBlendFunc(const void *params)
+{
+    const auto *cmd = static_cast<const BlendFuncParams *>(params);
+    GL_BlendFunc(cmd->sfactor, cmd->dfactor);
+}
+
+struct BlendFuncSeparateParams
+{
+    GLenum sfactorRGB;
+    GLenum dfactorRGB;
+    GLenum sfactorAlpha;
+    GLenum dfactorAlpha;
+};
+
+void ExecuteBlendFuncSeparate(const void *params)
+{
+    const auto *cmd = static_cast<const BlendFuncSeparateParams *>(params);
+    GL_BlendFuncSeparate(cmd->sfactorRGB, cmd->dfactorRGB, cmd->sfactorAlpha, cmd->dfactorAlpha);
+}
+
+struct BufferSubDataParams
+{
+    GLenum target;
+    GLintptr offset;
+    GLsizeiptr size;
+    const void *data;
+};
+
+void ExecuteBufferSubData(const void *params)
+{
+    const auto *cmd = static_cast<const BufferSubDataParams *>(params);
+    GL_BufferSubData(cmd->target, cmd->offset, cmd->size, cmd->data);
+}
+
+struct ClearParams
+{
+    GLbitfield mask;
+};
+
+void ExecuteClear(const void *params)
+{
+    const auto *cmd = static_cast<const ClearParams *>(params);
+    GL_Clear(cmd->mask);
+}
+
+struct ClearColorParams
+{
+    GLfloat red;
+    GLfloat green;
+    GLfloat blue;
+    GLfloat alpha;
+};
+
+void ExecuteClearColor(const void *params)
+{
+    const auto *cmd = static_cast<const ClearColorParams *>(params);
+    GL_ClearColor(cmd->red, cmd->green, cmd->blue, cmd->alpha);
+}
+
+struct ClearDepthfParams
+{
+    GLfloat d;
+};
+
+void ExecuteClearDepthf(const void *params)
+{
+    const auto *cmd = static_cast<const ClearDepthfParams *>(params);
+    GL_ClearDepthf(cmd->d);
+}
+
+struct ClearStencilParams
+{
+    GLint s;
+};
+
+void ExecuteClearStencil(const void *params)
+{
+    const auto *cmd = static_cast<const ClearStencilParams *>(params);
+    GL_ClearStencil(cmd->s);
+}
+
+struct ColorMaskParams
+{
+    GLboolean red;
+    GLboolean green;
+    GLboolean blue;
+    GLboolean alpha;
+};
+
+void ExecuteColorMask(const void *params)
+{
+    const auto *cmd = static_cast<const ColorMaskParams *>(params);
+    GL_ColorMask(cmd->red, cmd->green, cmd->blue, cmd->alpha);
+}
+
+struct CullFaceParams
+{
+    GLenum mode;
+};
+
+void ExecuteCullFace(const void *params)
+{
+    const auto *cmd = static_cast<const CullFaceParams *>(params);
+    GL_CullFace(cmd->mode);
+}
+
+struct DepthFuncParams
+{
+    GLenum func;
+};
+
+void ExecuteDepthFunc(const void *params)
+{
+    const auto *cmd = static_cast<const DepthFuncParams *>(params);
+    GL_DepthFunc(cmd->func);
+}
+
+struct DepthMaskParams
+{
+    GLboolean flag;
+};
+
+void ExecuteDepthMask(const void *params)
+{
+    const auto *cmd = static_cast<const DepthMaskParams *>(params);
+    GL_DepthMask(cmd->flag);
+}
+
+struct DepthRangefParams
+{
+    GLfloat n;
+    GLfloat f;
+};
+
+void ExecuteDepthRangef(const void *params)
+{
+    const auto *cmd = static_cast<const DepthRangefParams *>(params);
+    GL_DepthRangef(cmd->n, cmd->f);
+}
+
+struct DisableParams
+{
+    GLenum cap;
+};
+
+void ExecuteDisable(const void *params)
+{
+    const auto *cmd = static_cast<const DisableParams *>(params);
+    GL_Disable(cmd->cap);
+}
+
+struct DrawArraysParams
+{
+    GLenum mode;
+    GLint first;
+    GLsizei count;
+};
+
+void ExecuteDrawArrays(const void *params)
+{
+    const auto *cmd = static_cast<const DrawArraysParams *>(params);
+    GL_DrawArrays(cmd->mode, cmd->first, cmd->count);
+}
+
+struct DrawElementsParams
+{
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+};
+
+void ExecuteDrawElements(const void *params)
+{
+    const auto *cmd = static_cast<const DrawElementsParams *>(params);
+    GL_DrawElements(cmd->mode, cmd->count, cmd->type, cmd->indices);
+}
+
+struct EnableParams
+{
+    GLenum cap;
+};
+
+void ExecuteEnable(const void *params)
+{
+    const auto *cmd = static_cast<const EnableParams *>(params);
+    GL_Enable(cmd->cap);
+}
+
+struct FrontFaceParams
+{
+    GLenum mode;
+};
+
+void ExecuteFrontFace(const void *params)
+{
+    const auto *cmd = static_cast<const FrontFaceParams *>(params);
+    GL_FrontFace(cmd->mode);
+}
+
+struct LineWidthParams
+{
+    GLfloat width;
+};
+
+void ExecuteLineWidth(const void *params)
+{
+    const auto *cmd = static_cast<const LineWidthParams *>(params);
+    GL_LineWidth(cmd->width);
+}
+
+struct PolygonOffsetParams
+{
+    GLfloat factor;
+    GLfloat units;
+};
+
+void ExecutePolygonOffset(const void *params)
+{
+    const auto *cmd = static_cast<const PolygonOffsetParams *>(params);
+    GL_PolygonOffset(cmd->factor, cmd->units);
+}
+
+struct ScissorParams
+{
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+};
+
+void ExecuteScissor(const void *params)
+{
+    const auto *cmd = static_cast<const ScissorParams *>(params);
+    GL_Scissor(cmd->x, cmd->y, cmd->width, cmd->height);
+}
+
+struct StencilFuncParams
+{
+    GLenum func;
+    GLint ref;
+    GLuint mask;
+};
+
+void ExecuteStencilFunc(const void *params)
+{
+    const auto *cmd = static_cast<const StencilFuncParams *>(params);
+    GL_StencilFunc(cmd->func, cmd->ref, cmd->mask);
+}
+
+struct StencilFuncSeparateParams
+{
+    GLenum face;
+    GLenum func;
+    GLint ref;
+    GLuint mask;
+};
+
+void ExecuteStencilFuncSeparate(const void *params)
+{
+    const auto *cmd = static_cast<const StencilFuncSeparateParams *>(params);
+    GL_StencilFuncSeparate(cmd->face, cmd->func, cmd->ref, cmd->mask);
+}
+
+struct StencilMaskParams
+{
+    GLuint mask;
+};
+
+void ExecuteStencilMask(const void *params)
+{
+    const auto *cmd = static_cast<const StencilMaskParams *>(params);
+    GL_StencilMask(cmd->mask);
+}
+
+struct StencilMaskSeparateParams
+{
+    GLenum face;
+    GLuint mask;
+};
+
+void ExecuteStencilMaskSeparate(const void *params)
+{
+    const auto *cmd = static_cast<const StencilMaskSeparateParams *>(params);
+    GL_StencilMaskSeparate(cmd->face, cmd->mask);
+}
+
+struct StencilOpParams
+{
+    GLenum fail;
+    GLenum zfail;
+    GLenum zpass;
+};
+
+void ExecuteStencilOp(const void *params)
+{
+    const auto *cmd = static_cast<const StencilOpParams *>(params);
+    GL_StencilOp(cmd->fail, cmd->zfail, cmd->zpass);
+}
+
+struct StencilOpSeparateParams
+{
+    GLenum face;
+    GLenum sfail;
+    GLenum dpfail;
+    GLenum dppass;
+};
+
+void ExecuteStencilOpSeparate(const void *params)
+{
+    const auto *cmd = static_cast<const StencilOpSeparateParams *>(params);
+    GL_StencilOpSeparate(cmd->face, cmd->sfail, cmd->dpfail, cmd->dppass);
+}
+
+struct Uniform1fParams
+{
+    GLint location;
+    GLfloat v0;
+};
+
+void ExecuteUniform1f(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform1fParams *>(params);
+    GL_Uniform1f(cmd->location, cmd->v0);
+}
+
+struct Uniform1fvParams
+{
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+void ExecuteUniform1fv(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform1fvParams *>(params);
+    GL_Uniform1fv(cmd->location, cmd->count, cmd->value);
+}
+
+struct Uniform1iParams
+{
+    GLint location;
+    GLint v0;
+};
+
+void ExecuteUniform1i(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform1iParams *>(params);
+    GL_Uniform1i(cmd->location, cmd->v0);
+}
+
+struct Uniform1ivParams
+{
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+void ExecuteUniform1iv(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform1ivParams *>(params);
+    GL_Uniform1iv(cmd->location, cmd->count, cmd->value);
+}
+
+struct Uniform2fParams
+{
+    GLint location;
+    GLfloat v0;
+    GLfloat v1;
+};
+
+void ExecuteUniform2f(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform2fParams *>(params);
+    GL_Uniform2f(cmd->location, cmd->v0, cmd->v1);
+}
+
+struct Uniform2fvParams
+{
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+void ExecuteUniform2fv(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform2fvParams *>(params);
+    GL_Uniform2fv(cmd->location, cmd->count, cmd->value);
+}
+
+struct Uniform2iParams
+{
+    GLint location;
+    GLint v0;
+    GLint v1;
+};
+
+void ExecuteUniform2i(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform2iParams *>(params);
+    GL_Uniform2i(cmd->location, cmd->v0, cmd->v1);
+}
+
+struct Uniform2ivParams
+{
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+void ExecuteUniform2iv(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform2ivParams *>(params);
+    GL_Uniform2iv(cmd->location, cmd->count, cmd->value);
+}
+
+struct Uniform3fParams
+{
+    GLint location;
+    GLfloat v0;
+    GLfloat v1;
+    GLfloat v2;
+};
+
+void ExecuteUniform3f(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform3fParams *>(params);
+    GL_Uniform3f(cmd->location, cmd->v0, cmd->v1, cmd->v2);
+}
+
+struct Uniform3fvParams
+{
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+void ExecuteUniform3fv(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform3fvParams *>(params);
+    GL_Uniform3fv(cmd->location, cmd->count, cmd->value);
+}
+
+struct Uniform3iParams
+{
+    GLint location;
+    GLint v0;
+    GLint v1;
+    GLint v2;
+};
+
+void ExecuteUniform3i(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform3iParams *>(params);
+    GL_Uniform3i(cmd->location, cmd->v0, cmd->v1, cmd->v2);
+}
+
+struct Uniform3ivParams
+{
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+void ExecuteUniform3iv(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform3ivParams *>(params);
+    GL_Uniform3iv(cmd->location, cmd->count, cmd->value);
+}
+
+struct Uniform4fParams
+{
+    GLint location;
+    GLfloat v0;
+    GLfloat v1;
+    GLfloat v2;
+    GLfloat v3;
+};
+
+void ExecuteUniform4f(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform4fParams *>(params);
+    GL_Uniform4f(cmd->location, cmd->v0, cmd->v1, cmd->v2, cmd->v3);
+}
+
+struct Uniform4fvParams
+{
+    GLint location;
+    GLsizei count;
+    const GLfloat *value;
+};
+
+void ExecuteUniform4fv(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform4fvParams *>(params);
+    GL_Uniform4fv(cmd->location, cmd->count, cmd->value);
+}
+
+struct Uniform4iParams
+{
+    GLint location;
+    GLint v0;
+    GLint v1;
+    GLint v2;
+    GLint v3;
+};
+
+void ExecuteUniform4i(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform4iParams *>(params);
+    GL_Uniform4i(cmd->location, cmd->v0, cmd->v1, cmd->v2, cmd->v3);
+}
+
+struct Uniform4ivParams
+{
+    GLint location;
+    GLsizei count;
+    const GLint *value;
+};
+
+void ExecuteUniform4iv(const void *params)
+{
+    const auto *cmd = static_cast<const Uniform4ivParams *>(params);
+    GL_Uniform4iv(cmd->location, cmd->count, cmd->value);
+}
+
+struct UniformMatrix2fvParams
+{
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+void ExecuteUniformMatrix2fv(const void *params)
+{
+    const auto *cmd = static_cast<const UniformMatrix2fvParams *>(params);
+    GL_UniformMatrix2fv(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+struct UniformMatrix3fvParams
+{
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+void ExecuteUniformMatrix3fv(const void *params)
+{
+    const auto *cmd = static_cast<const UniformMatrix3fvParams *>(params);
+    GL_UniformMatrix3fv(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+struct UniformMatrix4fvParams
+{
+    GLint location;
+    GLsizei count;
+    GLboolean transpose;
+    const GLfloat *value;
+};
+
+void ExecuteUniformMatrix4fv(const void *params)
+{
+    const auto *cmd = static_cast<const UniformMatrix4fvParams *>(params);
+    GL_UniformMatrix4fv(cmd->location, cmd->count, cmd->transpose, cmd->value);
+}
+
+struct UseProgramParams
+{
+    GLuint program;
+};
+
+void ExecuteUseProgram(const void *params)
+{
+    const auto *cmd = static_cast<const UseProgramParams *>(params);
+    GL_UseProgram(cmd->program);
+}
+
+struct ViewportParams
+{
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+};
+
+void ExecuteViewport(const void *params)
+{
+    const auto *cmd = static_cast<const ViewportParams *>(params);
+    GL_Viewport(cmd->x, cmd->y, cmd->width, cmd->height);
+}
+
+struct BindBufferBaseParams
+{
+    GLenum target;
+    GLuint index;
+    GLuint buffer;
+};
+
+void ExecuteBindBufferBase(const void *params)
+{
+    const auto *cmd = static_cast<const BindBufferBaseParams *>(params);
+    GL_BindBufferBase(cmd->target, cmd->index, cmd->buffer);
+}
+
+struct BindBufferRangeParams
+{
+    GLenum target;
+    GLuint index;
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr size;
+};
+
+void ExecuteBindBufferRange(const void *params)
+{
+    const auto *cmd = static_cast<const BindBufferRangeParams *>(params);
+    GL_BindBufferRange(cmd->target, cmd->index, cmd->buffer, cmd->offset, cmd->size);
+}
+
+struct BindSamplerParams
+{
+    GLuint unit;
+    GLuint sampler;
+};
+
+void ExecuteBindSampler(const void *params)
+{
+    const auto *cmd = static_cast<const BindSamplerParams *>(params);
+    GL_BindSampler(cmd->unit, cmd->sampler);
+}
+
+struct DrawArraysInstancedParams
+{
+    GLenum mode;
+    GLint first;
+    GLsizei count;
+    GLsizei instancecount;
+};
+
+void ExecuteDrawArraysInstanced(const void *params)
+{
+    const auto *cmd = static_cast<const DrawArraysInstancedParams *>(params);
+    GL_DrawArraysInstanced(cmd->mode, cmd->first, cmd->count, cmd->instancecount);
+}
+
+struct DrawElementsInstancedParams
+{
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+    GLsizei instancecount;
+};
+
+void ExecuteDrawElementsInstanced(const void *params)
+{
+    const auto *cmd = static_cast<const DrawElementsInstancedParams *>(params);
+    GL_DrawElementsInstanced(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount);
+}
+
+struct DrawRangeElementsParams
+{
+    GLenum mode;
+    GLuint start;
+    GLuint end;
+    GLsizei count;
+    GLenum type;
+    const void *indices;
+};
+
+void ExecuteDrawRangeElements(const void *params)
+{
+    const auto *cmd = static_cast<const DrawRangeElementsParams *>(params);
+    GL_DrawRangeElements(cmd->mode, cmd->start, cmd->end, cmd->count, cmd->type, cmd->indices);
+}
+
+}  // anonymous namespace
+
+bool QueueActiveTexture(Context *context, GLenum texture)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<ActiveTextureParams>(ExecuteActiveTexture);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLActiveTexture);
+        return true;
+    }
+
+    cmd->texture = texture;
+    return true;
+}
+
+bool QueueBindBuffer(Context *context, GLenum target, GLuint buffer)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    BindBufferParams *cmd = nullptr;
+    if (target != GL_ELEMENT_ARRAY_BUFFER)
+    {
+        cmd = stream->allocate<BindBufferParams>(ExecuteBindBuffer);
+    }
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLBindBuffer);
+        return true;
+    }
+
+    cmd->target = target;
+    cmd->buffer = buffer;
+    return true;
+}
+
+bool QueueBindFramebuffer(Context *context, GLenum target, GLuint framebuffer)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<BindFramebufferParams>(ExecuteBindFramebuffer);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLBindFramebuffer);
+        return true;
+    }
+
+    cmd->target      = target;
+    cmd->framebuffer = framebuffer;
+    return true;
+}
+
+bool QueueBindTexture(Context *context, GLenum target, GLuint texture)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<BindTextureParams>(ExecuteBindTexture);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLBindTexture);
+        return true;
+    }
+
+    cmd->target  = target;
+    cmd->texture = texture;
+    return true;
+}
+
+bool QueueBlendColor(Context *context, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<BlendColorParams>(ExecuteBlendColor);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLBlendColor);
+        return true;
+    }
+
+    cmd->red   = red;
+    cmd->green = green;
+    cmd->blue  = blue;
+    cmd->alpha = alpha;
+    return true;
+}
+
+bool QueueBlendEquation(Context *context, GLenum mode)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<BlendEquationParams>(ExecuteBlendEquation);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLBlendEquation);
+        return true;
+    }
+
+    cmd->mode = mode;
+    return true;
+}
+
+bool QueueBlendEquationSeparate(Context *context, GLenum modeRGB, GLenum modeAlpha)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<BlendEquationSeparateParams>(ExecuteBlendEquationSeparate);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLBlendEquationSeparate);
+        return true;
+    }
+
+    cmd->modeRGB   = modeRGB;
+    cmd->modeAlpha = modeAlpha;
+    return true;
+}
+
+bool QueueBlendFunc(Context *context, GLenum sfactor, GLenum dfactor)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<BlendFuncParams>(ExecuteBlendFunc);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLBlendFunc);
+        return true;
+    }
+
+    cmd->sfactor = sfactor;
+    cmd->dfactor = dfactor;
+    return true;
+}
+
+bool QueueBlendFuncSeparate(Context *context,
+                            GLenum sfactorRGB,
+                            GLenum dfactorRGB,
+                            GLenum sfactorAlpha,
+                            GLenum dfactorAlpha)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<BlendFuncSeparateParams>(ExecuteBlendFuncSeparate);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLBlendFuncSeparate);
+        return true;
+    }
+
+    cmd->sfactorRGB   = sfactorRGB;
+    cmd->dfactorRGB   = dfactorRGB;
+    cmd->sfactorAlpha = sfactorAlpha;
+    cmd->dfactorAlpha = dfactorAlpha;
+    return true;
+}
+
+bool QueueBufferSubData(Context *context,
+                        GLenum target,
+                        GLintptr offset,
+                        GLsizeiptr size,
+                        const void *data)
+{
+    CommandStream *stream = context->getCommandStream();
+    angle::CheckedNumeric<size_t> dataSize(size);
+
+    auto *cmd = stream->allocate<BufferSubDataParams>(ExecuteBufferSubData, data, dataSize);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLBufferSubData);
+        return true;
+    }
+
+    cmd->target = target;
+    cmd->offset = offset;
+    cmd->size   = size;
+    cmd->data   = reinterpret_cast<const void *>(cmd + 1);
+    return true;
+}
+
+bool QueueClear(Context *context, GLbitfield mask)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<ClearParams>(ExecuteClear);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLClear);
+        return true;
+    }
+
+    cmd->mask = mask;
+    return true;
+}
+
+bool QueueClearColor(Context *context, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<ClearColorParams>(ExecuteClearColor);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLClearColor);
+        return true;
+    }
+
+    cmd->red   = red;
+    cmd->green = green;
+    cmd->blue  = blue;
+    cmd->alpha = alpha;
+    return true;
+}
+
+bool QueueClearDepthf(Context *context, GLfloat d)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<ClearDepthfParams>(ExecuteClearDepthf);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLClearDepthf);
+        return true;
+    }
+
+    cmd->d = d;
+    return true;
+}
+
+bool QueueClearStencil(Context *context, GLint s)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<ClearStencilParams>(ExecuteClearStencil);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLClearStencil);
+        return true;
+    }
+
+    cmd->s = s;
+    return true;
+}
+
+bool QueueColorMask(Context *context,
+                    GLboolean red,
+                    GLboolean green,
+                    GLboolean blue,
+                    GLboolean alpha)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<ColorMaskParams>(ExecuteColorMask);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLColorMask);
+        return true;
+    }
+
+    cmd->red   = red;
+    cmd->green = green;
+    cmd->blue  = blue;
+    cmd->alpha = alpha;
+    return true;
+}
+
+bool QueueCullFace(Context *context, GLenum mode)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<CullFaceParams>(ExecuteCullFace);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLCullFace);
+        return true;
+    }
+
+    cmd->mode = mode;
+    return true;
+}
+
+bool QueueDepthFunc(Context *context, GLenum func)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<DepthFuncParams>(ExecuteDepthFunc);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLDepthFunc);
+        return true;
+    }
+
+    cmd->func = func;
+    return true;
+}
+
+bool QueueDepthMask(Context *context, GLboolean flag)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<DepthMaskParams>(ExecuteDepthMask);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLDepthMask);
+        return true;
+    }
+
+    cmd->flag = flag;
+    return true;
+}
+
+bool QueueDepthRangef(Context *context, GLfloat n, GLfloat f)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<DepthRangefParams>(ExecuteDepthRangef);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLDepthRangef);
+        return true;
+    }
+
+    cmd->n = n;
+    cmd->f = f;
+    return true;
+}
+
+bool QueueDisable(Context *context, GLenum cap)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<DisableParams>(ExecuteDisable);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLDisable);
+        return true;
+    }
+
+    cmd->cap = cap;
+    return true;
+}
+
+bool QueueDrawArrays(Context *context, GLenum mode, GLint first, GLsizei count)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    DrawArraysParams *cmd = nullptr;
+    if (stream->canQueueDrawArrays())
+    {
+        cmd = stream->allocate<DrawArraysParams>(ExecuteDrawArrays);
+    }
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLDrawArrays);
+        return true;
+    }
+
+    cmd->mode  = mode;
+    cmd->first = first;
+    cmd->count = count;
+    return true;
+}
+
+bool QueueDrawElements(Context *context,
+                       GLenum mode,
+                       GLsizei count,
+                       GLenum type,
+                       const void *indices)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    DrawElementsParams *cmd = nullptr;
+    if (stream->canQueueDrawElements())
+    {
+        cmd = stream->allocate<DrawElementsParams>(ExecuteDrawElements);
+    }
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLDrawElements);
+        return true;
+    }
+
+    cmd->mode    = mode;
+    cmd->count   = count;
+    cmd->type    = type;
+    cmd->indices = indices;
+    return true;
+}
+
+bool QueueEnable(Context *context, GLenum cap)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<EnableParams>(ExecuteEnable);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLEnable);
+        return true;
+    }
+
+    cmd->cap = cap;
+    return true;
+}
+
+bool QueueFrontFace(Context *context, GLenum mode)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<FrontFaceParams>(ExecuteFrontFace);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLFrontFace);
+        return true;
+    }
+
+    cmd->mode = mode;
+    return true;
+}
+
+bool QueueLineWidth(Context *context, GLfloat width)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<LineWidthParams>(ExecuteLineWidth);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLLineWidth);
+        return true;
+    }
+
+    cmd->width = width;
+    return true;
+}
+
+bool QueuePolygonOffset(Context *context, GLfloat factor, GLfloat units)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<PolygonOffsetParams>(ExecutePolygonOffset);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLPolygonOffset);
+        return true;
+    }
+
+    cmd->factor = factor;
+    cmd->units  = units;
+    return true;
+}
+
+bool QueueScissor(Context *context, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<ScissorParams>(ExecuteScissor);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLScissor);
+        return true;
+    }
+
+    cmd->x      = x;
+    cmd->y      = y;
+    cmd->width  = width;
+    cmd->height = height;
+    return true;
+}
+
+bool QueueStencilFunc(Context *context, GLenum func, GLint ref, GLuint mask)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<StencilFuncParams>(ExecuteStencilFunc);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLStencilFunc);
+        return true;
+    }
+
+    cmd->func = func;
+    cmd->ref  = ref;
+    cmd->mask = mask;
+    return true;
+}
+
+bool QueueStencilFuncSeparate(Context *context, GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<StencilFuncSeparateParams>(ExecuteStencilFuncSeparate);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLStencilFuncSeparate);
+        return true;
+    }
+
+    cmd->face = face;
+    cmd->func = func;
+    cmd->ref  = ref;
+    cmd->mask = mask;
+    return true;
+}
+
+bool QueueStencilMask(Context *context, GLuint mask)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<StencilMaskParams>(ExecuteStencilMask);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLStencilMask);
+        return true;
+    }
+
+    cmd->mask = mask;
+    return true;
+}
+
+bool QueueStencilMaskSeparate(Context *context, GLenum face, GLuint mask)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<StencilMaskSeparateParams>(ExecuteStencilMaskSeparate);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLStencilMaskSeparate);
+        return true;
+    }
+
+    cmd->face = face;
+    cmd->mask = mask;
+    return true;
+}
+
+bool QueueStencilOp(Context *context, GLenum fail, GLenum zfail, GLenum zpass)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<StencilOpParams>(ExecuteStencilOp);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLStencilOp);
+        return true;
+    }
+
+    cmd->fail  = fail;
+    cmd->zfail = zfail;
+    cmd->zpass = zpass;
+    return true;
+}
+
+bool QueueStencilOpSeparate(Context *context,
+                            GLenum face,
+                            GLenum sfail,
+                            GLenum dpfail,
+                            GLenum dppass)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<StencilOpSeparateParams>(ExecuteStencilOpSeparate);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLStencilOpSeparate);
+        return true;
+    }
+
+    cmd->face   = face;
+    cmd->sfail  = sfail;
+    cmd->dpfail = dpfail;
+    cmd->dppass = dppass;
+    return true;
+}
+
+bool QueueUniform1f(Context *context, GLint location, GLfloat v0)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<Uniform1fParams>(ExecuteUniform1f);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform1f);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->v0       = v0;
+    return true;
+}
+
+bool QueueUniform1fv(Context *context, GLint location, GLsizei count, const GLfloat *value)
+{
+    CommandStream *stream = context->getCommandStream();
+    angle::CheckedNumeric<size_t> dataSize(count);
+    dataSize *= sizeof(GLfloat);
+
+    auto *cmd = stream->allocate<Uniform1fvParams>(ExecuteUniform1fv, value, dataSize);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform1fv);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->count    = count;
+    cmd->value    = reinterpret_cast<const GLfloat *>(cmd + 1);
+    return true;
+}
+
+bool QueueUniform1i(Context *context, GLint location, GLint v0)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<Uniform1iParams>(ExecuteUniform1i);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform1i);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->v0       = v0;
+    return true;
+}
+
+bool QueueUniform1iv(Context *context, GLint location, GLsizei count, const GLint *value)
+{
+    CommandStream *stream = context->getCommandStream();
+    angle::CheckedNumeric<size_t> dataSize(count);
+    dataSize *= sizeof(GLint);
+
+    auto *cmd = stream->allocate<Uniform1ivParams>(ExecuteUniform1iv, value, dataSize);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform1iv);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->count    = count;
+    cmd->value    = reinterpret_cast<const GLint *>(cmd + 1);
+    return true;
+}
+
+bool QueueUniform2f(Context *context, GLint location, GLfloat v0, GLfloat v1)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<Uniform2fParams>(ExecuteUniform2f);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform2f);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->v0       = v0;
+    cmd->v1       = v1;
+    return true;
+}
+
+bool QueueUniform2fv(Context *context, GLint location, GLsizei count, const GLfloat *value)
+{
+    CommandStream *stream = context->getCommandStream();
+    angle::CheckedNumeric<size_t> dataSize(count);
+    dataSize *= 2 * sizeof(GLfloat);
+
+    auto *cmd = stream->allocate<Uniform2fvParams>(ExecuteUniform2fv, value, dataSize);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform2fv);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->count    = count;
+    cmd->value    = reinterpret_cast<const GLfloat *>(cmd + 1);
+    return true;
+}
+
+bool QueueUniform2i(Context *context, GLint location, GLint v0, GLint v1)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<Uniform2iParams>(ExecuteUniform2i);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform2i);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->v0       = v0;
+    cmd->v1       = v1;
+    return true;
+}
+
+bool QueueUniform2iv(Context *context, GLint location, GLsizei count, const GLint *value)
+{
+    CommandStream *stream = context->getCommandStream();
+    angle::CheckedNumeric<size_t> dataSize(count);
+    dataSize *= 2 * sizeof(GLint);
+
+    auto *cmd = stream->allocate<Uniform2ivParams>(ExecuteUniform2iv, value, dataSize);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform2iv);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->count    = count;
+    cmd->value    = reinterpret_cast<const GLint *>(cmd + 1);
+    return true;
+}
+
+bool QueueUniform3f(Context *context, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<Uniform3fParams>(ExecuteUniform3f);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform3f);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->v0       = v0;
+    cmd->v1       = v1;
+    cmd->v2       = v2;
+    return true;
+}
+
+bool QueueUniform3fv(Context *context, GLint location, GLsizei count, const GLfloat *value)
+{
+    CommandStream *stream = context->getCommandStream();
+    angle::CheckedNumeric<size_t> dataSize(count);
+    dataSize *= 3 * sizeof(GLfloat);
+
+    auto *cmd = stream->allocate<Uniform3fvParams>(ExecuteUniform3fv, value, dataSize);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform3fv);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->count    = count;
+    cmd->value    = reinterpret_cast<const GLfloat *>(cmd + 1);
+    return true;
+}
+
+bool QueueUniform3i(Context *context, GLint location, GLint v0, GLint v1, GLint v2)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<Uniform3iParams>(ExecuteUniform3i);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform3i);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->v0       = v0;
+    cmd->v1       = v1;
+    cmd->v2       = v2;
+    return true;
+}
+
+bool QueueUniform3iv(Context *context, GLint location, GLsizei count, const GLint *value)
+{
+    CommandStream *stream = context->getCommandStream();
+    angle::CheckedNumeric<size_t> dataSize(count);
+    dataSize *= 3 * sizeof(GLint);
+
+    auto *cmd = stream->allocate<Uniform3ivParams>(ExecuteUniform3iv, value, dataSize);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform3iv);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->count    = count;
+    cmd->value    = reinterpret_cast<const GLint *>(cmd + 1);
+    return true;
+}
+
+bool QueueUniform4f(Context *context,
+                    GLint location,
+                    GLfloat v0,
+                    GLfloat v1,
+                    GLfloat v2,
+                    GLfloat v3)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<Uniform4fParams>(ExecuteUniform4f);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform4f);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->v0       = v0;
+    cmd->v1       = v1;
+    cmd->v2       = v2;
+    cmd->v3       = v3;
+    return true;
+}
+
+bool QueueUniform4fv(Context *context, GLint location, GLsizei count, const GLfloat *value)
+{
+    CommandStream *stream = context->getCommandStream();
+    angle::CheckedNumeric<size_t> dataSize(count);
+    dataSize *= 4 * sizeof(GLfloat);
+
+    auto *cmd = stream->allocate<Uniform4fvParams>(ExecuteUniform4fv, value, dataSize);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform4fv);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->count    = count;
+    cmd->value    = reinterpret_cast<const GLfloat *>(cmd + 1);
+    return true;
+}
+
+bool QueueUniform4i(Context *context, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<Uniform4iParams>(ExecuteUniform4i);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform4i);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->v0       = v0;
+    cmd->v1       = v1;
+    cmd->v2       = v2;
+    cmd->v3       = v3;
+    return true;
+}
+
+bool QueueUniform4iv(Context *context, GLint location, GLsizei count, const GLint *value)
+{
+    CommandStream *stream = context->getCommandStream();
+    angle::CheckedNumeric<size_t> dataSize(count);
+    dataSize *= 4 * sizeof(GLint);
+
+    auto *cmd = stream->allocate<Uniform4ivParams>(ExecuteUniform4iv, value, dataSize);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniform4iv);
+        return true;
+    }
+
+    cmd->location = location;
+    cmd->count    = count;
+    cmd->value    = reinterpret_cast<const GLint *>(cmd + 1);
+    return true;
+}
+
+bool QueueUniformMatrix2fv(Context *context,
+                           GLint location,
+                           GLsizei count,
+                           GLboolean transpose,
+                           const GLfloat *value)
+{
+    CommandStream *stream = context->getCommandStream();
+    angle::CheckedNumeric<size_t> dataSize(count);
+    dataSize *= 4 * sizeof(GLfloat);
+
+    auto *cmd = stream->allocate<UniformMatrix2fvParams>(ExecuteUniformMatrix2fv, value, dataSize);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniformMatrix2fv);
+        return true;
+    }
+
+    cmd->location  = location;
+    cmd->count     = count;
+    cmd->transpose = transpose;
+    cmd->value     = reinterpret_cast<const GLfloat *>(cmd + 1);
+    return true;
+}
+
+bool QueueUniformMatrix3fv(Context *context,
+                           GLint location,
+                           GLsizei count,
+                           GLboolean transpose,
+                           const GLfloat *value)
+{
+    CommandStream *stream = context->getCommandStream();
+    angle::CheckedNumeric<size_t> dataSize(count);
+    dataSize *= 9 * sizeof(GLfloat);
+
+    auto *cmd = stream->allocate<UniformMatrix3fvParams>(ExecuteUniformMatrix3fv, value, dataSize);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniformMatrix3fv);
+        return true;
+    }
+
+    cmd->location  = location;
+    cmd->count     = count;
+    cmd->transpose = transpose;
+    cmd->value     = reinterpret_cast<const GLfloat *>(cmd + 1);
+    return true;
+}
+
+bool QueueUniformMatrix4fv(Context *context,
+                           GLint location,
+                           GLsizei count,
+                           GLboolean transpose,
+                           const GLfloat *value)
+{
+    CommandStream *stream = context->getCommandStream();
+    angle::CheckedNumeric<size_t> dataSize(count);
+    dataSize *= 16 * sizeof(GLfloat);
+
+    auto *cmd = stream->allocate<UniformMatrix4fvParams>(ExecuteUniformMatrix4fv, value, dataSize);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUniformMatrix4fv);
+        return true;
+    }
+
+    cmd->location  = location;
+    cmd->count     = count;
+    cmd->transpose = transpose;
+    cmd->value     = reinterpret_cast<const GLfloat *>(cmd + 1);
+    return true;
+}
+
+bool QueueUseProgram(Context *context, GLuint program)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<UseProgramParams>(ExecuteUseProgram);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLUseProgram);
+        return true;
+    }
+
+    cmd->program = program;
+    return true;
+}
+
+bool QueueViewport(Context *context, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<ViewportParams>(ExecuteViewport);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLViewport);
+        return true;
+    }
+
+    cmd->x      = x;
+    cmd->y      = y;
+    cmd->width  = width;
+    cmd->height = height;
+    return true;
+}
+
+bool QueueBindBufferBase(Context *context, GLenum target, GLuint index, GLuint buffer)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<BindBufferBaseParams>(ExecuteBindBufferBase);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLBindBufferBase);
+        return true;
+    }
+
+    cmd->target = target;
+    cmd->index  = index;
+    cmd->buffer = buffer;
+    return true;
+}
+
+bool QueueBindBufferRange(Context *context,
+                          GLenum target,
+                          GLuint index,
+                          GLuint buffer,
+                          GLintptr offset,
+                          GLsizeiptr size)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<BindBufferRangeParams>(ExecuteBindBufferRange);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLBindBufferRange);
+        return true;
+    }
+
+    cmd->target = target;
+    cmd->index  = index;
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+    cmd->size   = size;
+    return true;
+}
+
+bool QueueBindSampler(Context *context, GLuint unit, GLuint sampler)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    auto *cmd = stream->allocate<BindSamplerParams>(ExecuteBindSampler);
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLBindSampler);
+        return true;
+    }
+
+    cmd->unit    = unit;
+    cmd->sampler = sampler;
+    return true;
+}
+
+bool QueueDrawArraysInstanced(Context *context,
+                              GLenum mode,
+                              GLint first,
+                              GLsizei count,
+                              GLsizei instancecount)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    DrawArraysInstancedParams *cmd = nullptr;
+    if (stream->canQueueDrawArrays())
+    {
+        cmd = stream->allocate<DrawArraysInstancedParams>(ExecuteDrawArraysInstanced);
+    }
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLDrawArraysInstanced);
+        return true;
+    }
+
+    cmd->mode          = mode;
+    cmd->first         = first;
+    cmd->count         = count;
+    cmd->instancecount = instancecount;
+    return true;
+}
+
+bool QueueDrawElementsInstanced(Context *context,
+                                GLenum mode,
+                                GLsizei count,
+                                GLenum type,
+                                const void *indices,
+                                GLsizei instancecount)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    DrawElementsInstancedParams *cmd = nullptr;
+    if (stream->canQueueDrawElements())
+    {
+        cmd = stream->allocate<DrawElementsInstancedParams>(ExecuteDrawElementsInstanced);
+    }
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLDrawElementsInstanced);
+        return true;
+    }
+
+    cmd->mode          = mode;
+    cmd->count         = count;
+    cmd->type          = type;
+    cmd->indices       = indices;
+    cmd->instancecount = instancecount;
+    return true;
+}
+
+bool QueueDrawRangeElements(Context *context,
+                            GLenum mode,
+                            GLuint start,
+                            GLuint end,
+                            GLsizei count,
+                            GLenum type,
+                            const void *indices)
+{
+    CommandStream *stream = context->getCommandStream();
+
+    DrawRangeElementsParams *cmd = nullptr;
+    if (stream->canQueueDrawElements())
+    {
+        cmd = stream->allocate<DrawRangeElementsParams>(ExecuteDrawRangeElements);
+    }
+    if (ANGLE_UNLIKELY(cmd == nullptr))
+    {
+        if (SyncCommandStream(context))
+        {
+            return false;
+        }
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLDrawRangeElements);
+        return true;
+    }
+
+    cmd->mode    = mode;
+    cmd->start   = start;
+    cmd->end     = end;
+    cmd->count   = count;
+    cmd->type    = type;
+    cmd->indices = indices;
+    return true;
+}
+
+}  // namespace gl
@@ -0,0 +1,143 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by generate_entry_points.py using data from gl.xml and entry_point_command_stream.json.
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// command_stream_autogen.h:
+//   Records GL calls in the command stream of a context created with
+//   EGL_CONTEXT_THREADED_COMMANDS_ANGLE.
+
+#ifndef LIBGLESV2_COMMAND_STREAM_AUTOGEN_H_
+#define LIBGLESV2_COMMAND_STREAM_AUTOGEN_H_
+
+#include "angle_gl.h"
+
+namespace gl
+{
+class Context;
+
+// Each function records its call and returns true.  If the call can't be recorded, it returns
+// false once the recorded calls are executed, so that the call is executed directly.  It also
+// returns true if the context was lost by the recorded calls, after generating the error.
+bool QueueActiveTexture(Context *context, GLenum texture);
+bool QueueBindBuffer(Context *context, GLenum target, GLuint buffer);
+bool QueueBindFramebuffer(Context *context, GLenum target, GLuint framebuffer);
+bool QueueBindTexture(Context *context, GLenum target, GLuint texture);
+bool QueueBlendColor(Context *context, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+bool QueueBlendEquation(Context *context, GLenum mode);
+bool QueueBlendEquationSeparate(Context *context, GLenum modeRGB, GLenum modeAlpha);
+bool QueueBlendFunc(Context *context, GLenum sfactor, GLenum dfactor);
+bool QueueBlendFuncSeparate(Context *context,
+                            GLenum sfactorRGB,
+                            GLenum dfactorRGB,
+                            GLenum sfactorAlpha,
+                            GLenum dfactorAlpha);
+bool QueueBufferSubData(Context *context,
+                        GLenum target,
+                        GLintptr offset,
+                        GLsizeiptr size,
+                        const void *data);
+bool QueueClear(Context *context, GLbitfield mask);
+bool QueueClearColor(Context *context, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+bool QueueClearDepthf(Context *context, GLfloat d);
+bool QueueClearStencil(Context *context, GLint s);
+bool QueueColorMask(Context *context,
+                    GLboolean red,
+                    GLboolean green,
+                    GLboolean blue,
+                    GLboolean alpha);
+bool QueueCullFace(Context *context, GLenum mode);
+bool QueueDepthFunc(Context *context, GLenum func);
+bool QueueDepthMask(Context *context, GLboolean flag);
+bool QueueDepthRangef(Context *context, GLfloat n, GLfloat f);
+bool QueueDisable(Context *context, GLenum cap);
+bool QueueDrawArrays(Context *context, GLenum mode, GLint first, GLsizei count);
+bool QueueDrawElements(Context *context,
+                       GLenum mode,
+                       GLsizei count,
+                       GLenum type,
+                       const void *indices);
+bool QueueEnable(Context *context, GLenum cap);
+bool QueueFrontFace(Context *context, GLenum mode);
+bool QueueLineWidth(Context *context, GLfloat width);
+bool QueuePolygonOffset(Context *context, GLfloat factor, GLfloat units);
+bool QueueScissor(Context *context, GLint x, GLint y, GLsizei width, GLsizei height);
+bool QueueStencilFunc(Context *context, GLenum func, GLint ref, GLuint mask);
+bool QueueStencilFuncSeparate(Context *context, GLenum face, GLenum func, GLint ref, GLuint mask);
+bool QueueStencilMask(Context *context, GLuint mask);
+bool QueueStencilMaskSeparate(Context *context, GLenum face, GLuint mask);
+bool QueueStencilOp(Context *context, GLenum fail, GLenum zfail, GLenum zpass);
+bool QueueStencilOpSeparate(Context *context,
+                            GLenum face,
+                            GLenum sfail,
+                            GLenum dpfail,
+                            GLenum dppass);
+bool QueueUniform1f(Context *context, GLint location, GLfloat v0);
+bool QueueUniform1fv(Context *context, GLint location, GLsizei count, const GLfloat *value);
+bool QueueUniform1i(Context *context, GLint location, GLint v0);
+bool QueueUniform1iv(Context *context, GLint location, GLsizei count, const GLint *value);
+bool QueueUniform2f(Context *context, GLint location, GLfloat v0, GLfloat v1);
+bool QueueUniform2fv(Context *context, GLint location, GLsizei count, const GLfloat *value);
+bool QueueUniform2i(Context *context, GLint location, GLint v0, GLint v1);
+bool QueueUniform2iv(Context *context, GLint location, GLsizei count, const GLint *value);
+bool QueueUniform3f(Context *context, GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
+bool QueueUniform3fv(Context *context, GLint location, GLsizei count, const GLfloat *value);
+bool QueueUniform3i(Context *context, GLint location, GLint v0, GLint v1, GLint v2);
+bool QueueUniform3iv(Context *context, GLint location, GLsizei count, const GLint *value);
+bool QueueUniform4f(Context *context,
+                    GLint location,
+                    GLfloat v0,
+                    GLfloat v1,
+                    GLfloat v2,
+                    GLfloat v3);
+bool QueueUniform4fv(Context *context, GLint location, GLsizei count, const GLfloat *value);
+bool QueueUniform4i(Context *context, GLint location, GLint v0, GLint v1, GLint v2, GLint v3);
+bool QueueUniform4iv(Context *context, GLint location, GLsizei count, const GLint *value);
+bool QueueUniformMatrix2fv(Context *context,
+                           GLint location,
+                           GLsizei count,
+                           GLboolean transpose,
+                           const GLfloat *value);
+bool QueueUniformMatrix3fv(Context *context,
+                           GLint location,
+                           GLsizei count,
+                           GLboolean transpose,
+                           const GLfloat *value);
+bool QueueUniformMatrix4fv(Context *context,
+                           GLint location,
+                           GLsizei count,
+                           GLboolean transpose,
+                           const GLfloat *value);
+bool QueueUseProgram(Context *context, GLuint program);
+bool QueueViewport(Context *context, GLint x, GLint y, GLsizei width, GLsizei height);
+bool QueueBindBufferBase(Context *context, GLenum target, GLuint index, GLuint buffer);
+bool QueueBindBufferRange(Context *context,
+                          GLenum target,
+                          GLuint index,
+                          GLuint buffer,
+                          GLintptr offset,
+                          GLsizeiptr size);
+bool QueueBindSampler(Context *context, GLuint unit, GLuint sampler);
+bool QueueDrawArraysInstanced(Context *context,
+                              GLenum mode,
+                              GLint first,
+                              GLsizei count,
+                              GLsizei instancecount);
+bool QueueDrawElementsInstanced(Context *context,
+                                GLenum mode,
+                                GLsizei count,
+                                GLenum type,
+                                const void *indices,
+                                GLsizei instancecount);
+bool QueueDrawRangeElements(Context *context,
+                            GLenum mode,
+                            GLuint start,
+                            GLuint end,
+                            GLsizei count,
+                            GLenum type,
+                            const void *indices);
+}  // namespace gl
+
+#endif  // LIBGLESV2_COMMAND_STREAM_AUTOGEN_H_
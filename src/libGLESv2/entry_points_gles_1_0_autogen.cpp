@@ -19,6 +19,7 @@
 #include "libANGLE/context_private_call_autogen.h"
 #include "libANGLE/entry_points_utils.h"
 #include "libANGLE/validationES1.h"
+#include "libGLESv2/command_stream_autogen.h"
 #include "libGLESv2/global_state.h"
 
 using namespace gl;
@@ -19,6 +19,7 @@
 #include "libANGLE/context_private_call_autogen.h"
 #include "libANGLE/entry_points_utils.h"
 #include "libANGLE/validationES2.h"
+#include "libGLESv2/command_stream_autogen.h"
 #include "libGLESv2/global_state.h"
 
 using namespace gl;
@@ -27,12 +28,16 @@ extern "C" {
 void GL_APIENTRY GL_ActiveTexture(GLenum texture)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLActiveTexture, "context = %d, texture = %s", CID(context),
                             GLenumToString(GLESEnum::TextureUnit, texture)));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueActiveTexture(context, texture))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -154,13 +159,17 @@ void GL_APIENTRY GL_BindAttribLocation(GLuint program, GLuint index, const GLcha
 void GL_APIENTRY GL_BindBuffer(GLenum target, GLuint buffer)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLBindBuffer, "context = %d, target = %s, buffer = %u",
                             CID(context), GLenumToString(GLESEnum::BufferTargetARB, target),
                             buffer));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueBindBuffer(context, target, buffer))
+        {
+            return;
+        }
         BufferBinding targetPacked = PackParam<BufferBinding>(target);
         BufferID bufferPacked      = PackParam<BufferID>(buffer);
 
@@ -195,13 +204,18 @@ void GL_APIENTRY GL_BindBuffer(GLenum target, GLuint buffer)
 void GL_APIENTRY GL_BindFramebuffer(GLenum target, GLuint framebuffer)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLBindFramebuffer,
                             "context = %d, target = %s, framebuffer = %u", CID(context),
                             GLenumToString(GLESEnum::FramebufferTarget, target), framebuffer));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueBindFramebuffer(context, target, framebuffer))
+        {
+            return;
+        }
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
         if (context->getState().getPixelLocalStorageActivePlanes() != 0)
@@ -287,13 +301,17 @@ void GL_APIENTRY GL_BindRenderbuffer(GLenum target, GLuint renderbuffer)
 void GL_APIENTRY GL_BindTexture(GLenum target, GLuint texture)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLBindTexture, "context = %d, target = %s, texture = %u",
                             CID(context), GLenumToString(GLESEnum::TextureTarget, target),
                             texture));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueBindTexture(context, target, texture))
+        {
+            return;
+        }
         TextureType targetPacked = PackParam<TextureType>(target);
         TextureID texturePacked  = PackParam<TextureID>(texture);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -328,13 +346,18 @@ void GL_APIENTRY GL_BindTexture(GLenum target, GLuint texture)
 void GL_APIENTRY GL_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLBlendColor,
                             "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
                             CID(context), red, green, blue, alpha));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueBlendColor(context, red, green, blue, alpha))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -371,12 +394,16 @@ void GL_APIENTRY GL_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
 void GL_APIENTRY GL_BlendEquation(GLenum mode)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLBlendEquation, "context = %d, mode = %s", CID(context),
                             GLenumToString(GLESEnum::BlendEquationModeEXT, mode)));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueBlendEquation(context, mode))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -414,7 +441,7 @@ void GL_APIENTRY GL_BlendEquation(GLenum mode)
 void GL_APIENTRY GL_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLBlendEquationSeparate,
                             "context = %d, modeRGB = %s, modeAlpha = %s", CID(context),
                             GLenumToString(GLESEnum::BlendEquationModeEXT, modeRGB),
@@ -422,6 +449,11 @@ void GL_APIENTRY GL_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueBlendEquationSeparate(context, modeRGB, modeAlpha))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -460,13 +492,17 @@ void GL_APIENTRY GL_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 void GL_APIENTRY GL_BlendFunc(GLenum sfactor, GLenum dfactor)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLBlendFunc, "context = %d, sfactor = %s, dfactor = %s",
                             CID(context), GLenumToString(GLESEnum::BlendingFactor, sfactor),
                             GLenumToString(GLESEnum::BlendingFactor, dfactor)));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueBlendFunc(context, sfactor, dfactor))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -503,7 +539,7 @@ void GL_APIENTRY GL_BlendFuncSeparate(GLenum sfactorRGB,
                                       GLenum dfactorAlpha)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(
         context, GLBlendFuncSeparate,
         "context = %d, sfactorRGB = %s, dfactorRGB = %s, sfactorAlpha = %s, dfactorAlpha = %s",
@@ -514,6 +550,11 @@ void GL_APIENTRY GL_BlendFuncSeparate(GLenum sfactorRGB,
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueBlendFuncSeparate(context, sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -598,7 +639,7 @@ void GL_APIENTRY GL_BufferData(GLenum target, GLsizeiptr size, const void *data,
 void GL_APIENTRY GL_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(
         EVENT(context, GLBufferSubData,
               "context = %d, target = %s, offset = %llu, size = %llu, data = 0x%016" PRIxPTR "",
@@ -608,6 +649,11 @@ void GL_APIENTRY GL_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr siz
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueBufferSubData(context, target, offset, size, data))
+        {
+            return;
+        }
         BufferBinding targetPacked = PackParam<BufferBinding>(target);
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = context->skipValidation();
@@ -691,12 +737,16 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatus(GLenum target)
 void GL_APIENTRY GL_Clear(GLbitfield mask)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLClear, "context = %d, mask = %s", CID(context),
                             GLbitfieldToString(GLESEnum::ClearBufferMask, mask).c_str()));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueClear(context, mask))
+        {
+            return;
+        }
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
@@ -728,13 +778,18 @@ void GL_APIENTRY GL_Clear(GLbitfield mask)
 void GL_APIENTRY GL_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLClearColor,
                             "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
                             CID(context), red, green, blue, alpha));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueClearColor(context, red, green, blue, alpha))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -767,11 +822,15 @@ void GL_APIENTRY GL_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
 void GL_APIENTRY GL_ClearDepthf(GLfloat d)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLClearDepthf, "context = %d, d = %f", CID(context), d));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueClearDepthf(context, d))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -803,11 +862,15 @@ void GL_APIENTRY GL_ClearDepthf(GLfloat d)
 void GL_APIENTRY GL_ClearStencil(GLint s)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLClearStencil, "context = %d, s = %d", CID(context), s));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueClearStencil(context, s))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -839,7 +902,7 @@ void GL_APIENTRY GL_ClearStencil(GLint s)
 void GL_APIENTRY GL_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLColorMask,
                             "context = %d, red = %s, green = %s, blue = %s, alpha = %s",
                             CID(context), GLbooleanToString(red), GLbooleanToString(green),
@@ -847,6 +910,11 @@ void GL_APIENTRY GL_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GL
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueColorMask(context, red, green, blue, alpha))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -1241,12 +1309,16 @@ GLuint GL_APIENTRY GL_CreateShader(GLenum type)
 void GL_APIENTRY GL_CullFace(GLenum mode)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLCullFace, "context = %d, mode = %s", CID(context),
                             GLenumToString(GLESEnum::TriangleFace, mode)));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueCullFace(context, mode))
+        {
+            return;
+        }
         CullFaceMode modePacked = PackParam<CullFaceMode>(mode);
         bool isCallValid        = context->skipValidation();
         if (!isCallValid)
@@ -1536,12 +1608,16 @@ void GL_APIENTRY GL_DeleteTextures(GLsizei n, const GLuint *textures)
 void GL_APIENTRY GL_DepthFunc(GLenum func)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLDepthFunc, "context = %d, func = %s", CID(context),
                             GLenumToString(GLESEnum::DepthFunction, func)));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueDepthFunc(context, func))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -1575,12 +1651,16 @@ void GL_APIENTRY GL_DepthFunc(GLenum func)
 void GL_APIENTRY GL_DepthMask(GLboolean flag)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLDepthMask, "context = %d, flag = %s", CID(context),
                             GLbooleanToString(flag)));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueDepthMask(context, flag))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -1612,12 +1692,16 @@ void GL_APIENTRY GL_DepthMask(GLboolean flag)
 void GL_APIENTRY GL_DepthRangef(GLfloat n, GLfloat f)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(
         EVENT(context, GLDepthRangef, "context = %d, n = %f, f = %f", CID(context), n, f));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueDepthRangef(context, n, f))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -1695,12 +1779,16 @@ void GL_APIENTRY GL_DetachShader(GLuint program, GLuint shader)
 void GL_APIENTRY GL_Disable(GLenum cap)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLDisable, "context = %d, cap = %s", CID(context),
                             GLenumToString(GLESEnum::EnableCap, cap)));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueDisable(context, cap))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -1778,13 +1866,18 @@ void GL_APIENTRY GL_DisableVertexAttribArray(GLuint index)
 void GL_APIENTRY GL_DrawArrays(GLenum mode, GLint first, GLsizei count)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLDrawArrays,
                             "context = %d, mode = %s, first = %d, count = %d", CID(context),
                             GLenumToString(GLESEnum::PrimitiveType, mode), first, count));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueDrawArrays(context, mode, first, count))
+        {
+            return;
+        }
         PrimitiveMode modePacked = PackParam<PrimitiveMode>(mode);
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = context->skipValidation();
@@ -1818,7 +1911,7 @@ void GL_APIENTRY GL_DrawArrays(GLenum mode, GLint first, GLsizei count)
 void GL_APIENTRY GL_DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = LoadValidGlobalContext();
     ANGLE_UNSAFE_TODO(
         EVENT(context, GLDrawElements,
               "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR "",
@@ -1827,6 +1920,11 @@ void GL_APIENTRY GL_DrawElements(GLenum mode, GLsizei count, GLenum type, const
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueDrawElements(context, mode, count, type, indices))
+        {
+            return;
+        }
         PrimitiveMode modePacked    = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked = PackParam<DrawElementsType>(type);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1862,12 +1960,16 @@ void GL_APIENTRY GL_DrawElements(GLenum mode, GLsizei count, GLenum type, const
 void GL_APIENTRY GL_Enable(GLenum cap)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLEnable, "context = %d, cap = %s", CID(context),
                             GLenumToString(GLESEnum::EnableCap, cap)));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueEnable(context, cap))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -2134,12 +2236,16 @@ void GL_APIENTRY GL_FramebufferTexture2D(GLenum target,
 void GL_APIENTRY GL_FrontFace(GLenum mode)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLFrontFace, "context = %d, mode = %s", CID(context),
                             GLenumToString(GLESEnum::FrontFaceDirection, mode)));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueFrontFace(context, mode))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -3963,11 +4069,15 @@ GLboolean GL_APIENTRY GL_IsTexture(GLuint texture)
 void GL_APIENTRY GL_LineWidth(GLfloat width)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLLineWidth, "context = %d, width = %f", CID(context), width));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueLineWidth(context, width))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -4085,12 +4195,16 @@ void GL_APIENTRY GL_PixelStorei(GLenum pname, GLint param)
 void GL_APIENTRY GL_PolygonOffset(GLfloat factor, GLfloat units)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLPolygonOffset, "context = %d, factor = %f, units = %f",
                             CID(context), factor, units));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueuePolygonOffset(context, factor, units))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -4302,13 +4416,17 @@ void GL_APIENTRY GL_SampleCoverage(GLfloat value, GLboolean invert)
 void GL_APIENTRY GL_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLScissor,
                             "context = %d, x = %d, y = %d, width = %d, height = %d", CID(context),
                             x, y, width, height));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueScissor(context, x, y, width, height))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -4443,13 +4561,17 @@ void GL_APIENTRY GL_ShaderSource(GLuint shader,
 void GL_APIENTRY GL_StencilFunc(GLenum func, GLint ref, GLuint mask)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLStencilFunc, "context = %d, func = %s, ref = %d, mask = %u",
                             CID(context), GLenumToString(GLESEnum::StencilFunction, func), ref,
                             mask));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueStencilFunc(context, func, ref, mask))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -4483,7 +4605,7 @@ void GL_APIENTRY GL_StencilFunc(GLenum func, GLint ref, GLuint mask)
 void GL_APIENTRY GL_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLStencilFuncSeparate,
                             "context = %d, face = %s, func = %s, ref = %d, mask = %u", CID(context),
                             GLenumToString(GLESEnum::TriangleFace, face),
@@ -4491,6 +4613,11 @@ void GL_APIENTRY GL_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLu
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueStencilFuncSeparate(context, face, func, ref, mask))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -4529,11 +4656,15 @@ void GL_APIENTRY GL_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLu
 void GL_APIENTRY GL_StencilMask(GLuint mask)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLStencilMask, "context = %d, mask = %u", CID(context), mask));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueStencilMask(context, mask))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -4565,12 +4696,17 @@ void GL_APIENTRY GL_StencilMask(GLuint mask)
 void GL_APIENTRY GL_StencilMaskSeparate(GLenum face, GLuint mask)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLStencilMaskSeparate, "context = %d, face = %s, mask = %u",
                             CID(context), GLenumToString(GLESEnum::TriangleFace, face), mask));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueStencilMaskSeparate(context, face, mask))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -4608,7 +4744,7 @@ void GL_APIENTRY GL_StencilMaskSeparate(GLenum face, GLuint mask)
 void GL_APIENTRY GL_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLStencilOp, "context = %d, fail = %s, zfail = %s, zpass = %s",
                             CID(context), GLenumToString(GLESEnum::StencilOp, fail),
                             GLenumToString(GLESEnum::StencilOp, zfail),
@@ -4616,6 +4752,11 @@ void GL_APIENTRY GL_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueStencilOp(context, fail, zfail, zpass))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -4649,7 +4790,7 @@ void GL_APIENTRY GL_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 void GL_APIENTRY GL_StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(
         context, GLStencilOpSeparate,
         "context = %d, face = %s, sfail = %s, dpfail = %s, dppass = %s", CID(context),
@@ -4658,6 +4799,11 @@ void GL_APIENTRY GL_StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail,
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueStencilOpSeparate(context, face, sfail, dpfail, dppass))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -4972,12 +5118,16 @@ void GL_APIENTRY GL_TexSubImage2D(GLenum target,
 void GL_APIENTRY GL_Uniform1f(GLint location, GLfloat v0)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform1f, "context = %d, location = %d, v0 = %f",
                             CID(context), location, v0));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueUniform1f(context, location, v0))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5015,13 +5165,18 @@ void GL_APIENTRY GL_Uniform1f(GLint location, GLfloat v0)
 void GL_APIENTRY GL_Uniform1fv(GLint location, GLsizei count, const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform1fv,
                             "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "",
                             CID(context), location, count, (uintptr_t)value));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniform1fv(context, location, count, value))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5059,12 +5214,16 @@ void GL_APIENTRY GL_Uniform1fv(GLint location, GLsizei count, const GLfloat *val
 void GL_APIENTRY GL_Uniform1i(GLint location, GLint v0)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform1i, "context = %d, location = %d, v0 = %d",
                             CID(context), location, v0));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueUniform1i(context, location, v0))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = context->skipValidation();
@@ -5102,13 +5261,18 @@ void GL_APIENTRY GL_Uniform1i(GLint location, GLint v0)
 void GL_APIENTRY GL_Uniform1iv(GLint location, GLsizei count, const GLint *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform1iv,
                             "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "",
                             CID(context), location, count, (uintptr_t)value));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniform1iv(context, location, count, value))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = context->skipValidation();
@@ -5146,12 +5310,16 @@ void GL_APIENTRY GL_Uniform1iv(GLint location, GLsizei count, const GLint *value
 void GL_APIENTRY GL_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform2f, "context = %d, location = %d, v0 = %f, v1 = %f",
                             CID(context), location, v0, v1));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueUniform2f(context, location, v0, v1))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5189,13 +5357,18 @@ void GL_APIENTRY GL_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 void GL_APIENTRY GL_Uniform2fv(GLint location, GLsizei count, const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform2fv,
                             "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "",
                             CID(context), location, count, (uintptr_t)value));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniform2fv(context, location, count, value))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5233,12 +5406,16 @@ void GL_APIENTRY GL_Uniform2fv(GLint location, GLsizei count, const GLfloat *val
 void GL_APIENTRY GL_Uniform2i(GLint location, GLint v0, GLint v1)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform2i, "context = %d, location = %d, v0 = %d, v1 = %d",
                             CID(context), location, v0, v1));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueUniform2i(context, location, v0, v1))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5276,13 +5453,18 @@ void GL_APIENTRY GL_Uniform2i(GLint location, GLint v0, GLint v1)
 void GL_APIENTRY GL_Uniform2iv(GLint location, GLsizei count, const GLint *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform2iv,
                             "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "",
                             CID(context), location, count, (uintptr_t)value));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniform2iv(context, location, count, value))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5320,13 +5502,18 @@ void GL_APIENTRY GL_Uniform2iv(GLint location, GLsizei count, const GLint *value
 void GL_APIENTRY GL_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform3f,
                             "context = %d, location = %d, v0 = %f, v1 = %f, v2 = %f", CID(context),
                             location, v0, v1, v2));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniform3f(context, location, v0, v1, v2))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5364,13 +5551,18 @@ void GL_APIENTRY GL_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
 void GL_APIENTRY GL_Uniform3fv(GLint location, GLsizei count, const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform3fv,
                             "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "",
                             CID(context), location, count, (uintptr_t)value));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniform3fv(context, location, count, value))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5408,13 +5600,18 @@ void GL_APIENTRY GL_Uniform3fv(GLint location, GLsizei count, const GLfloat *val
 void GL_APIENTRY GL_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform3i,
                             "context = %d, location = %d, v0 = %d, v1 = %d, v2 = %d", CID(context),
                             location, v0, v1, v2));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniform3i(context, location, v0, v1, v2))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5452,13 +5649,18 @@ void GL_APIENTRY GL_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 void GL_APIENTRY GL_Uniform3iv(GLint location, GLsizei count, const GLint *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform3iv,
                             "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "",
                             CID(context), location, count, (uintptr_t)value));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniform3iv(context, location, count, value))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5496,13 +5698,18 @@ void GL_APIENTRY GL_Uniform3iv(GLint location, GLsizei count, const GLint *value
 void GL_APIENTRY GL_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform4f,
                             "context = %d, location = %d, v0 = %f, v1 = %f, v2 = %f, v3 = %f",
                             CID(context), location, v0, v1, v2, v3));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniform4f(context, location, v0, v1, v2, v3))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5540,13 +5747,18 @@ void GL_APIENTRY GL_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
 void GL_APIENTRY GL_Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform4fv,
                             "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "",
                             CID(context), location, count, (uintptr_t)value));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniform4fv(context, location, count, value))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5584,13 +5796,18 @@ void GL_APIENTRY GL_Uniform4fv(GLint location, GLsizei count, const GLfloat *val
 void GL_APIENTRY GL_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform4i,
                             "context = %d, location = %d, v0 = %d, v1 = %d, v2 = %d, v3 = %d",
                             CID(context), location, v0, v1, v2, v3));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniform4i(context, location, v0, v1, v2, v3))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5628,13 +5845,18 @@ void GL_APIENTRY GL_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLin
 void GL_APIENTRY GL_Uniform4iv(GLint location, GLsizei count, const GLint *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLUniform4iv,
                             "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "",
                             CID(context), location, count, (uintptr_t)value));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniform4iv(context, location, count, value))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5675,7 +5897,7 @@ void GL_APIENTRY GL_UniformMatrix2fv(GLint location,
                                      const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(
         EVENT(context, GLUniformMatrix2fv,
               "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
@@ -5683,6 +5905,11 @@ void GL_APIENTRY GL_UniformMatrix2fv(GLint location,
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniformMatrix2fv(context, location, count, transpose, value))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5725,7 +5952,7 @@ void GL_APIENTRY GL_UniformMatrix3fv(GLint location,
                                      const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(
         EVENT(context, GLUniformMatrix3fv,
               "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
@@ -5733,6 +5960,11 @@ void GL_APIENTRY GL_UniformMatrix3fv(GLint location,
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniformMatrix3fv(context, location, count, transpose, value))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5775,7 +6007,7 @@ void GL_APIENTRY GL_UniformMatrix4fv(GLint location,
                                      const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(
         EVENT(context, GLUniformMatrix4fv,
               "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
@@ -5783,6 +6015,11 @@ void GL_APIENTRY GL_UniformMatrix4fv(GLint location,
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueUniformMatrix4fv(context, location, count, transpose, value))
+        {
+            return;
+        }
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
 
         bool isCallValid = context->skipValidation();
@@ -5822,12 +6059,16 @@ void GL_APIENTRY GL_UniformMatrix4fv(GLint location,
 void GL_APIENTRY GL_UseProgram(GLuint program)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(
         EVENT(context, GLUseProgram, "context = %d, program = %u", CID(context), program));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueUseProgram(context, program))
+        {
+            return;
+        }
         ShaderProgramID programPacked = PackParam<ShaderProgramID>(program);
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = context->skipValidation();
@@ -6312,13 +6553,18 @@ void GL_APIENTRY GL_VertexAttribPointer(GLuint index,
 void GL_APIENTRY GL_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLViewport,
                             "context = %d, x = %d, y = %d, width = %d, height = %d", CID(context),
                             x, y, width, height));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueViewport(context, x, y, width, height))
+        {
+            return;
+        }
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
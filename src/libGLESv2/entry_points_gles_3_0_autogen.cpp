@@ -19,6 +19,7 @@
 #include "libANGLE/context_private_call_autogen.h"
 #include "libANGLE/entry_points_utils.h"
 #include "libANGLE/validationES3.h"
+#include "libGLESv2/command_stream_autogen.h"
 #include "libGLESv2/global_state.h"
 
 using namespace gl;
@@ -118,13 +119,18 @@ void GL_APIENTRY GL_BeginTransformFeedback(GLenum primitiveMode)
 void GL_APIENTRY GL_BindBufferBase(GLenum target, GLuint index, GLuint buffer)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLBindBufferBase,
                             "context = %d, target = %s, index = %u, buffer = %u", CID(context),
                             GLenumToString(GLESEnum::BufferTargetARB, target), index, buffer));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueBindBufferBase(context, target, index, buffer))
+        {
+            return;
+        }
         BufferBinding targetPacked = PackParam<BufferBinding>(target);
         BufferID bufferPacked      = PackParam<BufferID>(buffer);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -213,12 +219,16 @@ GL_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset,
 void GL_APIENTRY GL_BindSampler(GLuint unit, GLuint sampler)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLBindSampler, "context = %d, unit = %u, sampler = %u",
                             CID(context), unit, sampler));
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) && QueueBindSampler(context, unit, sampler))
+        {
+            return;
+        }
         SamplerID samplerPacked = PackParam<SamplerID>(sampler);
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = context->skipValidation();
@@ -1097,7 +1107,7 @@ void GL_APIENTRY GL_DrawArraysInstanced(GLenum mode,
                                         GLsizei instancecount)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLDrawArraysInstanced,
                             "context = %d, mode = %s, first = %d, count = %d, instancecount = %d",
                             CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), first,
@@ -1105,6 +1115,11 @@ void GL_APIENTRY GL_DrawArraysInstanced(GLenum mode,
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueDrawArraysInstanced(context, mode, first, count, instancecount))
+        {
+            return;
+        }
         PrimitiveMode modePacked = PackParam<PrimitiveMode>(mode);
         SCOPED_SHARE_CONTEXT_LOCK(context);
         bool isCallValid = context->skipValidation();
@@ -1195,7 +1210,7 @@ void GL_APIENTRY GL_DrawElementsInstanced(GLenum mode,
                                           GLsizei instancecount)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(
         EVENT(context, GLDrawElementsInstanced,
               "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
@@ -1205,6 +1220,11 @@ void GL_APIENTRY GL_DrawElementsInstanced(GLenum mode,
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueDrawElementsInstanced(context, mode, count, type, indices, instancecount))
+        {
+            return;
+        }
         PrimitiveMode modePacked    = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked = PackParam<DrawElementsType>(type);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -1250,7 +1270,7 @@ void GL_APIENTRY GL_DrawRangeElements(GLenum mode,
                                       const void *indices)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = PeekValidGlobalContext();
     ANGLE_UNSAFE_TODO(EVENT(context, GLDrawRangeElements,
                             "context = %d, mode = %s, start = %u, end = %u, count = %d, type = %s, "
                             "indices = 0x%016" PRIxPTR "",
@@ -1260,6 +1280,11 @@ void GL_APIENTRY GL_DrawRangeElements(GLenum mode,
 
     if (ANGLE_LIKELY(context != nullptr))
     {
+        if (ANGLE_UNLIKELY(context->queuesCommands()) &&
+            QueueDrawRangeElements(context, mode, start, end, count, type, indices))
+        {
+            return;
+        }
         PrimitiveMode modePacked    = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked = PackParam<DrawElementsType>(type);
         SCOPED_SHARE_CONTEXT_LOCK(context);
@@ -19,6 +19,7 @@
 #include "libANGLE/context_private_call_autogen.h"
 #include "libANGLE/entry_points_utils.h"
 #include "libANGLE/validationESEXT.h"
+#include "libGLESv2/command_stream_autogen.h"
 #include "libGLESv2/global_state.h"
 
 using namespace gl;
@@ -1965,7 +1966,7 @@ void GL_APIENTRY GL_DrawElementsContextANGLE(GLeglDisplayANGLE dpy,
         }
         if (ANGLE_LIKELY(isCallValid))
         {
-            context->drawElements(modePacked, count, typePacked, indices);
+            context->drawElementsImmediate(modePacked, count, typePacked, indices);
         }
         ANGLE_CAPTURE_GL(DrawElements, isCallValid, context, modePacked, count, typePacked,
                          indices);
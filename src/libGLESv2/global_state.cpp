@@ -145,7 +145,18 @@ ANGLE_NO_SANITIZE_MEMORY ANGLE_NO_SANITIZE_THREAD Thread *GetCurrentThread()
 #else
     Thread *current = gCurrentThread;
 #endif
-    return (current ? current : AllocateCurrentThread());
+    if (ANGLE_UNLIKELY(current == nullptr))
+    {
+        return AllocateCurrentThread();
+    }
+
+    // Every EGL call observes the effects of the GL calls made before it.
+    gl::Context *context = current->getContext();
+    if (context != nullptr)
+    {
+        (void)gl::SyncContext(context);
+    }
+    return current;
 }
 
 void SetContextCurrent(Thread *thread, gl::Context *context)
@@ -190,6 +201,47 @@ bool IsEGLValidationEnabled()
 
 namespace gl
 {
+bool SyncCommandStream(Context *context)
+{
+    context->getCommandStream()->finish();
+    if (!context->isContextLost())
+    {
+        // The worker is idle, so the draws it deferred can be flushed from this thread.
+        if (context->hasPendingDraws())
+        {
+            FlushPendingDraws(context);
+        }
+        return true;
+    }
+
+    // The context was lost on the worker thread, which only updated its own TLS.
+    if (LoadValidGlobalContext() == context)
+    {
+        SetCurrentValidContext(nullptr);
+    }
+    return false;
+}
+
+bool SyncDeferredCalls(Context *context)
+{
+    if (context->queuesCommands())
+    {
+        return SyncCommandStream(context);
+    }
+    if (context->hasPendingDraws())
+    {
+        FlushPendingDraws(context);
+    }
+    return true;
+}
+
+void FlushPendingDraws(Context *context)
+{
+    // The entry points flush the draws before taking the lock.
+    SCOPED_SHARE_CONTEXT_LOCK(context);
+    context->flushPendingDraws();
+}
+
 void GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint entryPoint)
 {
     // If the client starts issuing GL calls before ANGLE has had a chance to initialize,
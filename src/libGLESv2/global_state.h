@@ -128,6 +128,28 @@ ANGLE_INLINE ScopedContextMutexLock LockAndTryMergeContextMutexes(gl::Context *c
 
 namespace gl
 {
+// Waits for the calls recorded in the command stream of |context| to be executed, and flushes the
+// draws they deferred.  Returns false if that made the context lost, in which case it is no longer
+// the current valid context.
+bool SyncCommandStream(Context *context);
+
+// Submits the draws deferred by |context|.
+void FlushPendingDraws(Context *context);
+
+// Implements SyncContext() for the contexts that may defer calls.
+bool SyncDeferredCalls(Context *context);
+
+// Makes the effects of the calls made so far to |context| visible to the next one.  Returns false
+// if that made the context lost.  Contexts that don't defer calls only pay for the one check.
+ANGLE_INLINE bool SyncContext(Context *context)
+{
+    if (ANGLE_LIKELY(!context->defersCalls()))
+    {
+        return true;
+    }
+    return SyncDeferredCalls(context);
+}
+
 ANGLE_INLINE Context *GetGlobalContext()
 {
 #if defined(ANGLE_PLATFORM_APPLE) || defined(ANGLE_USE_STATIC_THREAD_LOCAL_VARIABLES)
@@ -136,10 +158,17 @@ ANGLE_INLINE Context *GetGlobalContext()
     egl::Thread *currentThread = egl::gCurrentThread;
 #endif
     ASSERT(currentThread);
-    return currentThread->getContext();
+    Context *context = currentThread->getContext();
+    if (context != nullptr)
+    {
+        (void)SyncContext(context);
+    }
+    return context;
 }
 
-ANGLE_INLINE Context *GetValidGlobalContext()
+// Returns the current valid context as is.  Only glDrawElements uses this, as it may defer its draw
+// to submit it with the previous ones.
+ANGLE_INLINE Context *LoadValidGlobalContext()
 {
 #if defined(ANGLE_USE_ANDROID_TLS_SLOT)
     // TODO: Replace this branch with a compile time flag (http://anglebug.com/42263361)
@@ -156,12 +185,42 @@ ANGLE_INLINE Context *GetValidGlobalContext()
 #endif
 }
 
+// Returns the current valid context without waiting for the calls recorded in its command stream.
+// Only the entry points that can record their call use this.
+ANGLE_INLINE Context *PeekValidGlobalContext()
+{
+    Context *context = LoadValidGlobalContext();
+    // The draws deferred by the thread executing the recorded calls are flushed when it's waited
+    // for.
+    if (context != nullptr && ANGLE_UNLIKELY(context->defersCalls()) &&
+        !context->queuesCommands() && context->hasPendingDraws())
+    {
+        FlushPendingDraws(context);
+    }
+    return context;
+}
+
+ANGLE_INLINE Context *GetValidGlobalContext()
+{
+    Context *context = LoadValidGlobalContext();
+    if (context != nullptr && !SyncContext(context))
+    {
+        return nullptr;
+    }
+    return context;
+}
+
 ANGLE_INLINE Context *GetContext(GLeglDisplayANGLE dpy, GLeglContextANGLE ctx)
 {
     egl::Display *dpyPacked = egl::PackParam<egl::Display *>(static_cast<EGLDisplay>(dpy));
     ASSERT(dpyPacked);
     ContextID ctxPacked = egl::PackParam<ContextID>(static_cast<EGLContext>(ctx));
-    return dpyPacked->getContext(ctxPacked);
+    Context *context    = dpyPacked->getContext(ctxPacked);
+    if (context != nullptr)
+    {
+        (void)SyncContext(context);
+    }
+    return context;
 }
 
 ANGLE_INLINE Context *GetValidContext(GLeglDisplayANGLE dpy, GLeglContextANGLE ctx)
@@ -7,6 +7,10 @@
 //   Test the sh::ConstructCompiler interface with different parameters.
 //
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "GLSLANG/ShaderLang.h"
 #include "angle_gl.h"
 #include "gtest/gtest.h"
@@ -44,3 +48,79 @@ TEST(ConstructCompilerTest, InvalidMaxDualSourceDrawBuffers)
                                                                SH_GLSL_150_CORE_OUTPUT, &resources);
     ASSERT_EQ(nullptr, compiler);
 }
+
+// Test that compilers constructed with different resources, which don't share their built-in
+// variables, each see the values of their own resources.
+TEST(ConstructCompilerTest, BuiltInVariablesOfDifferentResources)
+{
+    constexpr char kShader[] = R"(precision mediump float;
+void main()
+{
+    // Only valid if gl_MaxDrawBuffers is at most 4.
+    float values[5 - gl_MaxDrawBuffers];
+    values[0] = 1.0;
+    gl_FragColor = vec4(values[0]);
+})";
+    const char *shaderStrings[] = {kShader};
+
+    ShCompileOptions compileOptions = {};
+
+    for (int maxDrawBuffers : {4, 8, 4, 1})
+    {
+        ShBuiltInResources resources;
+        sh::InitBuiltInResources(&resources);
+        resources.MaxDrawBuffers = maxDrawBuffers;
+        ShHandle compiler        = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC,
+                                                         SH_ESSL_OUTPUT, &resources);
+        ASSERT_NE(nullptr, compiler);
+        EXPECT_EQ(maxDrawBuffers <= 4, sh::Compile(compiler, shaderStrings, 1, compileOptions))
+            << maxDrawBuffers;
+        sh::Destruct(compiler);
+    }
+}
+
+// Test that compilers constructed with the same resources on several threads, which share their
+// built-in variables, compile correctly.
+TEST(ConstructCompilerTest, BuiltInVariablesSharedAcrossThreads)
+{
+    constexpr char kShader[] = R"(#version 300 es
+precision mediump float;
+uniform vec4 color[gl_MaxFragmentUniformVectors - 1];
+out vec4 fragColor;
+void main()
+{
+    fragColor = color[0] * gl_DepthRange.far + vec4(gl_MaxDrawBuffers);
+})";
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+
+    constexpr size_t kThreadCount = 4;
+    std::vector<std::thread> threads;
+    std::atomic<int> failureCount(0);
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&]() {
+            for (int iteration = 0; iteration < 8; ++iteration)
+            {
+                ShHandle compiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC,
+                                                          SH_ESSL_OUTPUT, &resources);
+                const char *shaderStrings[] = {kShader};
+
+                ShCompileOptions compileOptions = {};
+                compileOptions.objectCode       = true;
+                if (compiler == nullptr || !sh::Compile(compiler, shaderStrings, 1, compileOptions))
+                {
+                    ++failureCount;
+                }
+                sh::Destruct(compiler);
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, failureCount);
+}
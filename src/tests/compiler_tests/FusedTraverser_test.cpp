@@ -0,0 +1,363 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser_test.cpp:
+//   Tests that traversers fused into a single walk of the tree visit it and change it the same way
+//   as they do on their own, and the records of the passes run on the AST.
+//
+
+#include <sstream>
+#include <string>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "compiler/translator/Compiler.h"
+#include "compiler/translator/InfoSink.h"
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/OutputTree.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+#include "gtest/gtest.h"
+#include "tests/test_utils/ShaderCompileTreeTest.h"
+
+using namespace sh;
+
+namespace
+{
+
+constexpr char kShader[] = R"(#version 300 es
+precision highp float;
+uniform float u;
+out vec4 color;
+float f(float x)
+{
+    return x + 1.0;
+}
+void main()
+{
+    float a = 1.0;
+    for (int i = 0; i < 4; ++i)
+    {
+        a = f(a) + u * 2.0;
+        if (a > 1.0)
+        {
+            a -= (a + 1.0) * 0.5;
+        }
+    }
+    switch (int(u))
+    {
+        case 0:
+            a += 1.0;
+            break;
+        default:
+            a = -a;
+    }
+    color = vec4(a, a + 1.0, u, 1.0);
+})";
+
+// Logs every visit along with the traversal state, and skips the subtree of the nodes it's told
+// to.
+class VisitLogTraverser : public TIntermTraverser
+{
+  public:
+    VisitLogTraverser(bool preVisit, bool inVisit, bool postVisit, TOperator skippedOp)
+        : TIntermTraverser(preVisit, inVisit, postVisit), mSkippedOp(skippedOp)
+    {}
+
+    const std::string &log() const { return mLog; }
+
+    void visitSymbol(TIntermSymbol *node) override { log(PreVisit, node, "symbol"); }
+    void visitConstantUnion(TIntermConstantUnion *node) override
+    {
+        log(PreVisit, node, "constant");
+    }
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        log(visit, node, "binary");
+        return visit != PreVisit || node->getOp() != mSkippedOp;
+    }
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        log(visit, node, "unary");
+        return true;
+    }
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override
+    {
+        log(visit, node, "if");
+        return mSkippedOp != EOpNull;
+    }
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override
+    {
+        log(visit, node, "switch");
+        return true;
+    }
+    bool visitCase(Visit visit, TIntermCase *node) override
+    {
+        log(visit, node, "case");
+        return true;
+    }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        log(visit, node, "aggregate");
+        return visit != InVisit || node->getOp() != mSkippedOp;
+    }
+    bool visitBlock(Visit visit, TIntermBlock *node) override
+    {
+        log(visit, node, "block");
+        return true;
+    }
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override
+    {
+        log(visit, node, "function");
+        return true;
+    }
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        log(visit, node, "declaration");
+        return true;
+    }
+    bool visitLoop(Visit visit, TIntermLoop *node) override
+    {
+        log(visit, node, "loop");
+        return true;
+    }
+    bool visitBranch(Visit visit, TIntermBranch *node) override
+    {
+        log(visit, node, "branch");
+        return true;
+    }
+
+  private:
+    void log(Visit visit, TIntermNode *node, const char *kind)
+    {
+        std::ostringstream stream;
+        stream << visit << " " << kind << " " << node << " parent " << getParentNode()
+               << " block " << getParentBlock() << " depth " << getCurrentTraversalDepth() << " "
+               << getCurrentBlockDepth() << " global " << mInGlobalScope;
+        if (visit == PreVisit)
+        {
+            stream << " index " << getParentChildIndex(visit);
+        }
+        stream << "\n";
+        mLog += stream.str();
+    }
+
+    const TOperator mSkippedOp;
+    std::string mLog;
+};
+
+// Replaces additions with subtractions.
+class AddToSubTraverser : public TIntermTraverser
+{
+  public:
+    AddToSubTraverser() : TIntermTraverser(true, false, false) {}
+
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        if (node->getOp() == EOpAdd)
+        {
+            queueReplacement(new TIntermBinary(EOpSub, node->getLeft(), node->getRight()),
+                             OriginalNode::IS_DROPPED);
+        }
+        return true;
+    }
+};
+
+// Replaces the float constants 1.0 with 3.0.
+class ReplaceOneTraverser : public TIntermTraverser
+{
+  public:
+    ReplaceOneTraverser() : TIntermTraverser(true, false, false) {}
+
+    void visitConstantUnion(TIntermConstantUnion *node) override
+    {
+        if (node->getBasicType() == EbtFloat && node->getType().getObjectSize() == 1 &&
+            node->getFConst(0) == 1.0f)
+        {
+            TConstantUnion *value = new TConstantUnion;
+            value->setFConst(3.0f);
+            queueReplacement(new TIntermConstantUnion(value, node->getType()),
+                             OriginalNode::IS_DROPPED);
+        }
+    }
+};
+
+// Inserts the assigned variable as a statement after each assignment statement.
+class InsertAssignedVariablesTraverser : public TIntermTraverser
+{
+  public:
+    InsertAssignedVariablesTraverser() : TIntermTraverser(true, false, false) {}
+
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        if (node->getOp() == EOpAssign && getParentNode()->getAsBlock() != nullptr)
+        {
+            insertStatementsInParentBlock({}, {node->getLeft()->deepCopy()});
+        }
+        return true;
+    }
+};
+
+std::string DumpTree(TIntermNode *root)
+{
+    TInfoSinkBase sink;
+    OutputTree(root, sink);
+    return sink.str();
+}
+
+class FusedTraverserTest : public ShaderCompileTreeTest
+{
+  public:
+    FusedTraverserTest() {}
+
+  protected:
+    ::GLenum getShaderType() const override { return GL_FRAGMENT_SHADER; }
+    ShShaderSpec getShaderSpec() const override { return SH_GLES3_SPEC; }
+};
+
+// Tests that fused traversers visit the same nodes with the same traversal state as they do on
+// their own, including when they skip subtrees or visit in-order.
+TEST_F(FusedTraverserTest, SameVisits)
+{
+    compileAssumeSuccess(kShader);
+
+    VisitLogTraverser all(true, true, true, EOpMul);
+    VisitLogTraverser preOnly(true, false, false, EOpNull);
+    VisitLogTraverser postOnly(false, false, true, EOpAdd);
+    VisitLogTraverser inOrder(true, true, false, EOpConstruct);
+    mASTRoot->traverse(&all);
+    mASTRoot->traverse(&preOnly);
+    mASTRoot->traverse(&postOnly);
+    mASTRoot->traverse(&inOrder);
+
+    VisitLogTraverser fusedAll(true, true, true, EOpMul);
+    VisitLogTraverser fusedPreOnly(true, false, false, EOpNull);
+    VisitLogTraverser fusedPostOnly(false, false, true, EOpAdd);
+    VisitLogTraverser fusedInOrder(true, true, false, EOpConstruct);
+    TIntermTraverser *traversers[] = {&fusedAll, &fusedPreOnly, &fusedPostOnly, &fusedInOrder};
+    ASSERT_TRUE(TraverseFused(getCompiler(), mASTRoot, traversers));
+
+    EXPECT_EQ(all.log(), fusedAll.log());
+    EXPECT_EQ(preOnly.log(), fusedPreOnly.log());
+    EXPECT_EQ(postOnly.log(), fusedPostOnly.log());
+    EXPECT_EQ(inOrder.log(), fusedInOrder.log());
+}
+
+// Tests that the changes queued by fused traversers, including replacements inside replaced
+// nodes and insertions, are applied as if the traversers ran one after the other.
+TEST_F(FusedTraverserTest, SameChanges)
+{
+    compileAssumeSuccess(kShader);
+    TIntermBlock *separateRoot = mASTRoot;
+
+    AddToSubTraverser addToSub;
+    ReplaceOneTraverser replaceOne;
+    InsertAssignedVariablesTraverser insertAssignedVariables;
+    TIntermTraverser *separateTraversers[] = {&addToSub, &replaceOne, &insertAssignedVariables};
+    for (TIntermTraverser *traverser : separateTraversers)
+    {
+        separateRoot->traverse(traverser);
+        ASSERT_TRUE(traverser->updateTree(getCompiler(), separateRoot));
+    }
+    const std::string expected = DumpTree(separateRoot);
+
+    compileAssumeSuccess(kShader);
+    AddToSubTraverser fusedAddToSub;
+    ReplaceOneTraverser fusedReplaceOne;
+    InsertAssignedVariablesTraverser fusedInsertAssignedVariables;
+    TIntermTraverser *traversers[] = {&fusedAddToSub, &fusedReplaceOne,
+                                      &fusedInsertAssignedVariables};
+    ASSERT_TRUE(TraverseFused(getCompiler(), mASTRoot, traversers));
+
+    EXPECT_EQ(expected, DumpTree(mASTRoot));
+    EXPECT_EQ(std::string::npos, expected.find("add ("));
+    EXPECT_EQ(std::string::npos, expected.find("1.0"));
+}
+
+// Tests that the passes run on the AST are recorded with the recordCompileStages option, along with
+// whether they changed it.
+TEST_F(FusedTraverserTest, PassRecords)
+{
+    mCompileOptions.recordCompileStages = true;
+    compileAssumeSuccess(R"(#version 300 es
+precision highp float;
+out vec4 color;
+void main()
+{
+    1.0;
+    color = vec4(0);
+})");
+
+    bool foundPruneNoOps              = false;
+    bool foundRemoveArrayLengthMethod = false;
+    for (const ShCompileStageRecord &record : getCompiler()->getCompileStageRecords())
+    {
+        const std::string name = record.name;
+        if (name == "PruneNoOps")
+        {
+            foundPruneNoOps = true;
+            EXPECT_TRUE(record.changedTree);
+        }
+        else if (name == "RemoveArrayLengthMethod")
+        {
+            foundRemoveArrayLengthMethod = true;
+            EXPECT_FALSE(record.changedTree);
+        }
+    }
+    EXPECT_TRUE(foundPruneNoOps);
+    EXPECT_TRUE(foundRemoveArrayLengthMethod);
+}
+
+class EmulateMultiDrawShaderBuiltinsTest : public ShaderCompileTreeTest
+{
+  public:
+    EmulateMultiDrawShaderBuiltinsTest()
+    {
+        mCompileOptions.emulateGLDrawID                 = true;
+        mCompileOptions.emulateGLBaseVertexBaseInstance = true;
+    }
+
+  protected:
+    void initResources(ShBuiltInResources *resources) override
+    {
+        resources->ANGLE_multi_draw                                = 1;
+        resources->ANGLE_base_vertex_base_instance_shader_builtin = 1;
+    }
+    ::GLenum getShaderType() const override { return GL_VERTEX_SHADER; }
+    ShShaderSpec getShaderSpec() const override { return SH_GLES3_SPEC; }
+};
+
+// Tests that gl_DrawID, gl_BaseVertex and gl_BaseInstance, which are looked for in a single walk
+// of the tree, are all replaced with uniforms.
+TEST_F(EmulateMultiDrawShaderBuiltinsTest, AllBuiltins)
+{
+    compileAssumeSuccess(R"(#version 300 es
+#extension GL_ANGLE_multi_draw : require
+#extension GL_ANGLE_base_vertex_base_instance_shader_builtin : require
+void main()
+{
+    gl_Position = vec4(float(gl_DrawID), float(gl_BaseVertex), float(gl_BaseInstance), 1.0);
+})");
+
+    const std::string tree = DumpTree(mASTRoot);
+    EXPECT_EQ(std::string::npos, tree.find("gl_DrawID"));
+    EXPECT_EQ(std::string::npos, tree.find("gl_BaseVertex"));
+    EXPECT_EQ(std::string::npos, tree.find("gl_BaseInstance"));
+
+    bool foundDrawID       = false;
+    bool foundBaseVertex   = false;
+    bool foundBaseInstance = false;
+    for (const ShaderVariable &uniform : getUniforms())
+    {
+        foundDrawID       = foundDrawID || uniform.name == "angle_DrawID";
+        foundBaseVertex   = foundBaseVertex || uniform.name == "angle_BaseVertex";
+        foundBaseInstance = foundBaseInstance || uniform.name == "angle_BaseInstance";
+    }
+    EXPECT_TRUE(foundDrawID);
+    EXPECT_TRUE(foundBaseVertex);
+    EXPECT_TRUE(foundBaseInstance);
+}
+
+}  // anonymous namespace
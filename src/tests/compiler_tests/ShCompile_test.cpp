@@ -140,6 +140,35 @@ TEST_F(ShCompileTest, TokensSplitInShaderStrings)
     testCompile(shaderStrings, 3, true);
 }
 
+// Test that the stages of a compilation are recorded only with the recordCompileStages option.
+TEST_F(ShCompileTest, CompileStageRecords)
+{
+    const char *shaderStrings[] = {
+        "precision mediump float;\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(0.0);\n"
+        "}"};
+
+    ShCompileOptions options = {};
+    options.objectCode       = true;
+    ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, options));
+    EXPECT_TRUE(sh::GetCompileStageRecords(mCompiler)->empty());
+
+    options.recordCompileStages = true;
+    ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, options));
+    const std::vector<ShCompileStageRecord> &stages = *sh::GetCompileStageRecords(mCompiler);
+    ASSERT_GE(stages.size(), 3u);
+    EXPECT_STREQ("Preprocess", stages[0].name);
+    EXPECT_STREQ("Parse", stages[1].name);
+    EXPECT_STREQ("Translate", stages.back().name);
+
+    // Pool memory is only released at the end of the compilation.
+    for (size_t stageIndex = 1; stageIndex < stages.size(); ++stageIndex)
+    {
+        EXPECT_GE(stages[stageIndex].poolBytes, stages[stageIndex - 1].poolBytes);
+    }
+}
+
 // Parsing floats in shaders can run afoul of locale settings.
 // Eg. in de_DE, `strtof("1.5")` will yield `1.0f`. (It's expecting "1.5")
 TEST_F(ShCompileTest, DecimalSepLocale)
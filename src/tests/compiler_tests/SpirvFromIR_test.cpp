@@ -0,0 +1,404 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SpirvFromIR_test.cpp:
+//   Test that the SPIR-V generated directly from the IR (generateSpirvFromIR) is valid and results
+//   in the same reflection info as the SPIR-V generated from the AST, and that shaders and options
+//   the IR's SPIR-V generator doesn't support fall back to the AST path.
+//
+
+#include <set>
+
+#include <spirv-tools/libspirv.hpp>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "common/spirv/spirv_instruction_parser_autogen.h"
+#include "gtest/gtest.h"
+
+namespace spirv = angle::spirv;
+
+namespace
+{
+struct CompileResult
+{
+    spirv::Blob spirv;
+    // Whether the AST-based generator produced the SPIR-V.
+    bool generatedFromAST = false;
+
+    std::vector<sh::ShaderVariable> attributes;
+    std::vector<sh::ShaderVariable> inputVaryings;
+    std::vector<sh::ShaderVariable> outputVaryings;
+    std::vector<sh::ShaderVariable> outputVariables;
+    std::vector<sh::ShaderVariable> uniforms;
+};
+
+class SpirvFromIRTest : public testing::Test
+{
+  protected:
+    void SetUp() override { sh::InitBuiltInResources(&mResources); }
+
+    void TearDown() override
+    {
+        for (ShHandle compiler : mCompilers)
+        {
+            sh::Destruct(compiler);
+        }
+    }
+
+    testing::AssertionResult compile(GLenum shaderType,
+                                     ShShaderSpec spec,
+                                     const char *shaderSource,
+                                     ShCompileOptions options,
+                                     bool generateSpirvFromIR,
+                                     CompileResult *resultOut)
+    {
+        ShHandle compiler =
+            sh::ConstructCompiler(shaderType, spec, SH_SPIRV_VULKAN_OUTPUT, &mResources);
+        if (compiler == nullptr)
+        {
+            return testing::AssertionFailure() << "Compiler could not be constructed.";
+        }
+        mCompilers.push_back(compiler);
+
+        options.objectCode          = true;
+        options.recordCompileStages = true;
+        options.useIR               = true;
+        options.generateSpirvFromIR = generateSpirvFromIR;
+
+        const char *shaderStrings[] = {shaderSource};
+        if (!sh::Compile(compiler, shaderStrings, 1, options))
+        {
+            return testing::AssertionFailure() << sh::GetInfoLog(compiler);
+        }
+
+        resultOut->spirv = sh::GetObjectBinaryBlob(compiler);
+        for (const ShCompileStageRecord &stage : *sh::GetCompileStageRecords(compiler))
+        {
+            if (std::string(stage.name) == "OutputSPIRV")
+            {
+                resultOut->generatedFromAST = true;
+            }
+        }
+
+        resultOut->attributes      = *sh::GetAttributes(compiler);
+        resultOut->inputVaryings   = *sh::GetInputVaryings(compiler);
+        resultOut->outputVaryings  = *sh::GetOutputVaryings(compiler);
+        resultOut->outputVariables = *sh::GetOutputVariables(compiler);
+        resultOut->uniforms        = *sh::GetUniforms(compiler);
+
+        return testing::AssertionSuccess();
+    }
+
+    // Compiles the shader through both paths, validates both results and compares their
+    // reflection info.  Whether the SPIR-V was generated directly from the IR is returned in
+    // |generatedFromIROut|.
+    void compileAndCompare(GLenum shaderType,
+                           ShShaderSpec spec,
+                           const char *shaderSource,
+                           const ShCompileOptions &options,
+                           bool compareIds,
+                           bool *generatedFromIROut)
+    {
+        CompileResult ast;
+        CompileResult fromIR;
+        ASSERT_TRUE(compile(shaderType, spec, shaderSource, options, false, &ast));
+        ASSERT_TRUE(compile(shaderType, spec, shaderSource, options, true, &fromIR));
+
+        EXPECT_TRUE(ast.generatedFromAST);
+        ValidateSpirv(ast.spirv);
+        ValidateSpirv(fromIR.spirv);
+
+        ExpectSameVariables(ast.attributes, fromIR.attributes, compareIds);
+        ExpectSameVariables(ast.inputVaryings, fromIR.inputVaryings, compareIds);
+        ExpectSameVariables(ast.outputVaryings, fromIR.outputVaryings, compareIds);
+        ExpectSameVariables(ast.outputVariables, fromIR.outputVariables, compareIds);
+        ExpectSameVariables(ast.uniforms, fromIR.uniforms, compareIds);
+
+        ExpectIdsAreVariables(fromIR);
+
+        *generatedFromIROut = !fromIR.generatedFromAST;
+    }
+
+    void expectGeneratedFromIR(GLenum shaderType, ShShaderSpec spec, const char *shaderSource)
+    {
+        bool generatedFromIR = false;
+        compileAndCompare(shaderType, spec, shaderSource, {}, true, &generatedFromIR);
+        EXPECT_TRUE(generatedFromIR);
+    }
+
+    void expectFallback(GLenum shaderType,
+                        ShShaderSpec spec,
+                        const char *shaderSource,
+                        const ShCompileOptions &options = {})
+    {
+        bool generatedFromIR = true;
+        compileAndCompare(shaderType, spec, shaderSource, options, true, &generatedFromIR);
+        EXPECT_FALSE(generatedFromIR);
+    }
+
+    static void ValidateSpirv(const spirv::Blob &blob);
+    static void ExpectSameVariables(const std::vector<sh::ShaderVariable> &expected,
+                                    const std::vector<sh::ShaderVariable> &actual,
+                                    bool compareIds);
+    static void ExpectIdsAreVariables(const CompileResult &result);
+
+    ShBuiltInResources mResources;
+    std::vector<ShHandle> mCompilers;
+};
+
+void SpirvFromIRTest::ValidateSpirv(const spirv::Blob &blob)
+{
+    ASSERT_GT(blob.size(), spirv::kHeaderIndexInstructions);
+
+    const spv_target_env env = blob[spirv::kHeaderIndexVersion] == spirv::kVersion_1_4
+                                   ? SPV_ENV_VULKAN_1_1_SPIRV_1_4
+                                   : SPV_ENV_VULKAN_1_1;
+    spvtools::SpirvTools spirvTools(env);
+
+    std::string messages;
+    spirvTools.SetMessageConsumer([&messages](spv_message_level_t, const char *,
+                                              const spv_position_t &, const char *message) {
+        messages += message;
+        messages += "\n";
+    });
+
+    EXPECT_TRUE(spirvTools.Validate(blob)) << messages;
+}
+
+void SpirvFromIRTest::ExpectSameVariables(const std::vector<sh::ShaderVariable> &expected,
+                                          const std::vector<sh::ShaderVariable> &actual,
+                                          bool compareIds)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t index = 0; index < expected.size(); ++index)
+    {
+        // Note: ShaderVariable::operator== doesn't compare the ids.
+        EXPECT_TRUE(expected[index] == actual[index]) << expected[index].name;
+        if (compareIds)
+        {
+            EXPECT_EQ(expected[index].id, actual[index].id) << expected[index].name;
+        }
+    }
+}
+
+// Verify that every id recorded in the reflection info is the id of a variable in the SPIR-V.
+void SpirvFromIRTest::ExpectIdsAreVariables(const CompileResult &result)
+{
+    std::set<uint32_t> variableIds;
+    size_t currentWord = spirv::kHeaderIndexInstructions;
+    while (currentWord < result.spirv.size())
+    {
+        uint32_t wordCount;
+        spv::Op opCode;
+        const uint32_t *instruction = &result.spirv[currentWord];
+        spirv::GetInstructionOpAndLength(instruction, &opCode, &wordCount);
+        ASSERT_GT(wordCount, 0u);
+        currentWord += wordCount;
+
+        if (opCode == spv::OpVariable)
+        {
+            spirv::IdResultType type;
+            spirv::IdResult id;
+            spv::StorageClass storageClass;
+            spirv::ParseVariable(instruction, &type, &id, &storageClass, nullptr);
+            variableIds.insert(id);
+        }
+    }
+
+    for (const std::vector<sh::ShaderVariable> *variables :
+         {&result.attributes, &result.inputVaryings, &result.outputVaryings,
+          &result.outputVariables, &result.uniforms})
+    {
+        for (const sh::ShaderVariable &variable : *variables)
+        {
+            if (variable.id != 0)
+            {
+                EXPECT_GE(variable.id, static_cast<uint32_t>(sh::vk::spirv::kIdFirstUnreserved))
+                    << variable.name;
+                EXPECT_EQ(variableIds.count(variable.id), 1u) << variable.name;
+            }
+        }
+    }
+}
+
+constexpr char kBasicVS[] = R"(#version 300 es
+precision highp float;
+
+in vec4 position;
+in vec3 normal;
+in vec2 uv;
+
+uniform mat4 mvp;
+uniform mat3 normalMatrix;
+uniform float pointSize;
+
+out vec3 vNormal;
+out vec2 vUV;
+flat out int vIndex;
+
+void main()
+{
+    vec3 n = normalMatrix * normal;
+    for (int i = 0; i < 2; ++i)
+    {
+        n = normalize(n);
+    }
+    if (gl_VertexID % 2 == 0)
+    {
+        n = -n;
+    }
+
+    vNormal      = n;
+    vUV          = uv * 0.5 + 0.5;
+    vIndex       = gl_InstanceID;
+    gl_Position  = mvp * position;
+    gl_PointSize = pointSize;
+})";
+
+// Test a vertex shader with attributes, varyings, default uniforms, control flow and the supported
+// built-ins.
+TEST_F(SpirvFromIRTest, VertexShader)
+{
+    expectGeneratedFromIR(GL_VERTEX_SHADER, SH_GLES3_SPEC, kBasicVS);
+}
+
+// Test a fragment shader with varyings, default uniforms, samplers of every supported type and
+// texelFetch.
+TEST_F(SpirvFromIRTest, FragmentShader)
+{
+    constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+
+in vec3 vNormal;
+in vec2 vUV;
+flat in int vIndex;
+
+uniform vec4 tint;
+uniform sampler2D tex2D;
+uniform highp sampler3D tex3D;
+uniform samplerCube texCube;
+uniform highp sampler2DArray tex2DArray;
+
+out vec4 color;
+
+void main()
+{
+    vec4 c = texture(tex2D, vUV);
+    c += texture(tex3D, vec3(vUV, 0.5));
+    c += texture(texCube, vNormal);
+    c += texture(tex2DArray, vec3(vUV, float(vIndex)));
+    c += texelFetch(tex2D, ivec2(vIndex, 0), 0);
+
+    if (!gl_FrontFacing)
+    {
+        c.rgb = vec3(1) - c.rgb;
+    }
+
+    color = c * tint;
+})";
+
+    expectGeneratedFromIR(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, kFS);
+}
+
+// Test an ESSL 1.00 fragment shader that writes gl_FragColor.  gl_FragColor is declared by the
+// translator in the AST path, so only the ids found in the SPIR-V are verified.
+TEST_F(SpirvFromIRTest, FragColor)
+{
+    constexpr char kFS[] = R"(precision mediump float;
+varying vec2 vUV;
+uniform sampler2D tex;
+void main()
+{
+    gl_FragColor = texture2D(tex, vUV);
+})";
+
+    bool generatedFromIR = false;
+    compileAndCompare(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, kFS, {}, false, &generatedFromIR);
+    EXPECT_TRUE(generatedFromIR);
+}
+
+// Test that shader stages other than vertex and fragment fall back to the AST path.
+TEST_F(SpirvFromIRTest, FallbackComputeShader)
+{
+    constexpr char kCS[] = R"(#version 310 es
+layout(local_size_x = 4) in;
+shared uint data[4];
+void main()
+{
+    data[gl_LocalInvocationIndex] = gl_LocalInvocationIndex;
+})";
+
+    expectFallback(GL_COMPUTE_SHADER, SH_GLES3_1_SPEC, kCS);
+}
+
+// Test that unsupported built-ins fall back to the AST path.
+TEST_F(SpirvFromIRTest, FallbackUnsupportedBuiltIn)
+{
+    constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+out vec4 color;
+void main()
+{
+    color = vec4(gl_FragCoord.xy, 0, 1);
+})";
+
+    expectFallback(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, kFS);
+}
+
+// Test that struct uniforms fall back to the AST path.
+TEST_F(SpirvFromIRTest, FallbackStructUniform)
+{
+    constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+struct Light
+{
+    vec3 color;
+    float intensity;
+};
+uniform Light light;
+out vec4 color;
+void main()
+{
+    color = vec4(light.color * light.intensity, 1);
+})";
+
+    expectFallback(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, kFS);
+}
+
+// Test that invariant(all) falls back to the AST path.
+TEST_F(SpirvFromIRTest, FallbackInvariantAll)
+{
+    constexpr char kVS[] = R"(#version 300 es
+#pragma STDGL invariant(all)
+in vec4 position;
+void main()
+{
+    gl_Position = position;
+})";
+
+    expectFallback(GL_VERTEX_SHADER, SH_GLES3_SPEC, kVS);
+}
+
+// Test that the compile options that alter the SPIR-V output fall back to the AST path.
+TEST_F(SpirvFromIRTest, FallbackUnsupportedOptions)
+{
+    ShCompileOptions emitSPIRV14 = {};
+    emitSPIRV14.emitSPIRV14      = true;
+    expectFallback(GL_VERTEX_SHADER, SH_GLES3_SPEC, kBasicVS, emitSPIRV14);
+
+    ShCompileOptions outputDebugInfo = {};
+    outputDebugInfo.outputDebugInfo  = true;
+    expectFallback(GL_VERTEX_SHADER, SH_GLES3_SPEC, kBasicVS, outputDebugInfo);
+
+    ShCompileOptions ignorePrecisionQualifiers          = {};
+    ignorePrecisionQualifiers.ignorePrecisionQualifiers = true;
+    expectFallback(GL_VERTEX_SHADER, SH_GLES3_SPEC, kBasicVS, ignorePrecisionQualifiers);
+
+    ShCompileOptions wrapSwitchInIfTrue   = {};
+    wrapSwitchInIfTrue.wrapSwitchInIfTrue = true;
+    expectFallback(GL_VERTEX_SHADER, SH_GLES3_SPEC, kBasicVS, wrapSwitchInIfTrue);
+}
+}  // anonymous namespace
@@ -0,0 +1,241 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EGLThreadedCommandsTest.cpp:
+//   Tests for the EGL extension EGL_ANGLE_context_threaded_commands.
+//
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+class EGLThreadedCommandsTest : public ANGLETest<>
+{
+  protected:
+    EGLThreadedCommandsTest()
+    {
+        setWindowWidth(16);
+        setWindowHeight(16);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void testTearDown() override
+    {
+        if (mContext != EGL_NO_CONTEXT)
+        {
+            EGLWindow *window = getEGLWindow();
+            window->makeCurrent();
+            eglDestroyContext(window->getDisplay(), mContext);
+        }
+    }
+
+    bool hasThreadedCommands()
+    {
+        return IsEGLDisplayExtensionEnabled(getEGLWindow()->getDisplay(),
+                                            "EGL_ANGLE_context_threaded_commands");
+    }
+
+    // Creates a context whose calls are executed on its own thread, and makes it current.
+    void makeThreadedContextCurrent()
+    {
+        EGLWindow *window    = getEGLWindow();
+        EGLint clientVersion = window->getClientMajorVersion();
+
+        const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, clientVersion,
+                                         EGL_CONTEXT_THREADED_COMMANDS_ANGLE, EGL_TRUE, EGL_NONE};
+        mContext = eglCreateContext(window->getDisplay(), window->getConfig(), EGL_NO_CONTEXT,
+                                    contextAttribs);
+        ASSERT_NE(EGL_NO_CONTEXT, mContext);
+        ASSERT_EGL_TRUE(eglMakeCurrent(window->getDisplay(), window->getSurface(),
+                                       window->getSurface(), mContext));
+    }
+
+    // Sets up a program drawing a quad in the color of its uniform, with its vertices in a buffer.
+    void setUpUniformColorQuad(GLuint program, GLuint buffer, GLint *colorLocation)
+    {
+        const std::array<Vector3, 6> &vertices = GetQuadVertices();
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), nullptr, GL_STATIC_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices.data());
+
+        GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+        glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(positionLocation);
+
+        glUseProgram(program);
+        *colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+        ASSERT_NE(-1, *colorLocation);
+    }
+
+    EGLContext mContext = EGL_NO_CONTEXT;
+};
+
+// Tests that the extension rejects values other than EGL_TRUE and EGL_FALSE.
+TEST_P(EGLThreadedCommandsTest, InvalidAttributeValue)
+{
+    ANGLE_SKIP_TEST_IF(!hasThreadedCommands());
+
+    EGLWindow *window = getEGLWindow();
+
+    const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, window->getClientMajorVersion(),
+                                     EGL_CONTEXT_THREADED_COMMANDS_ANGLE, 2, EGL_NONE};
+    EXPECT_EQ(EGL_NO_CONTEXT, eglCreateContext(window->getDisplay(), window->getConfig(),
+                                               EGL_NO_CONTEXT, contextAttribs));
+    EXPECT_EGL_ERROR(EGL_BAD_ATTRIBUTE);
+}
+
+// Tests that recorded clears and draws are visible to glReadPixels.
+TEST_P(EGLThreadedCommandsTest, DrawAndRead)
+{
+    ANGLE_SKIP_TEST_IF(!hasThreadedCommands());
+    makeThreadedContextCurrent();
+
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    GLBuffer buffer;
+    GLint colorLocation = -1;
+    setUpUniformColorQuad(program, buffer, &colorLocation);
+
+    glUniform4f(colorLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    const GLfloat green[4] = {0.0f, 1.0f, 0.0f, 1.0f};
+    glUniform4fv(colorLocation, 1, green);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Tests that enough calls to fill many batches are all executed in order.
+TEST_P(EGLThreadedCommandsTest, ManyCalls)
+{
+    ANGLE_SKIP_TEST_IF(!hasThreadedCommands());
+    makeThreadedContextCurrent();
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    GLBuffer buffer;
+    GLint colorLocation = -1;
+    setUpUniformColorQuad(program, buffer, &colorLocation);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Every draw adds 1 to the red channel.  The state changes in between make sure the calls fill
+    // several batches.
+    constexpr int kDrawCount = 255;
+    for (int draw = 0; draw < kDrawCount; ++draw)
+    {
+        glUniform4f(colorLocation, 1.0f / 255.0f, 0.0f, 0.0f, 0.0f);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        glDisable(GL_SCISSOR_TEST);
+    }
+    EXPECT_PIXEL_NEAR(0, 0, 255, 0, 0, 0, 1);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Tests that the updates recorded in buffers reach the data that was copied with them.
+TEST_P(EGLThreadedCommandsTest, BufferSubData)
+{
+    ANGLE_SKIP_TEST_IF(!hasThreadedCommands());
+    makeThreadedContextCurrent();
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, 4, nullptr, GL_STATIC_DRAW);
+
+    // The data is copied when the call is made, so it can be changed right after.
+    GLColor color = GLColor::red;
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(color), &color);
+    color = GLColor::green;
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Tests that draws reading vertices from client memory see the memory as it was at the call.
+TEST_P(EGLThreadedCommandsTest, ClientMemoryDraw)
+{
+    ANGLE_SKIP_TEST_IF(!hasThreadedCommands());
+    makeThreadedContextCurrent();
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    glUniform4f(colorLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+
+    std::array<Vector3, 6> vertices = GetQuadVertices();
+    GLint positionLocation          = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, vertices.data());
+    glEnableVertexAttribArray(positionLocation);
+
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    vertices.fill(Vector3(2.0f, 2.0f, 0.0f));
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Tests that errors generated by recorded calls are reported by glGetError.
+TEST_P(EGLThreadedCommandsTest, RecordedErrors)
+{
+    ANGLE_SKIP_TEST_IF(!hasThreadedCommands());
+    makeThreadedContextCurrent();
+
+    glEnable(GL_TEXTURE_2D);
+    glDrawArrays(GL_TRIANGLES, 0, -1);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Tests that the recorded calls are executed before the context is made current to another thread.
+TEST_P(EGLThreadedCommandsTest, MakeCurrentOnOtherThread)
+{
+    ANGLE_SKIP_TEST_IF(!hasThreadedCommands());
+    makeThreadedContextCurrent();
+
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    EGLWindow *window = getEGLWindow();
+    EXPECT_EGL_TRUE(
+        eglMakeCurrent(window->getDisplay(), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+
+    std::thread thread([&]() {
+        EXPECT_EGL_TRUE(eglMakeCurrent(window->getDisplay(), window->getSurface(),
+                                       window->getSurface(), mContext));
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+        EXPECT_EGL_TRUE(
+            eglMakeCurrent(window->getDisplay(), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    });
+    thread.join();
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLThreadedCommandsTest);
+ANGLE_INSTANTIATE_TEST(EGLThreadedCommandsTest, ES3_VULKAN());
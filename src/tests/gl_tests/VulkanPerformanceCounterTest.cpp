@@ -6492,6 +6492,73 @@ TEST_P(VulkanPerformanceCounterTest, BufferSubDataShouldNotTriggerSyncState_Copy
     bufferSubDataShouldNotTriggerSyncState(BufferUpdate::Copy);
 }
 
+// Verifies that vertex arrays that use the same buffer with a format that needs conversion share
+// the converted data, and that only one of them converts it again after the buffer is updated.
+TEST_P(VulkanPerformanceCounterTest, VertexConversionSharedBetweenVertexArrays)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    ANGLE_GL_PROGRAM(testProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    glUseProgram(testProgram);
+
+    GLint posLoc = glGetAttribLocation(testProgram, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, posLoc);
+
+    // Vulkan has no fixed-point vertex formats, so GL_FIXED data is always converted.
+    const std::array<Vector3, 6> &quadVertices = GetQuadVertices();
+    std::array<GLfixed, 12> fixedQuadVertices;
+    for (size_t vertex = 0; vertex < quadVertices.size(); ++vertex)
+    {
+        fixedQuadVertices[vertex * 2]     = static_cast<GLfixed>(quadVertices[vertex].x() * 65536);
+        fixedQuadVertices[vertex * 2 + 1] = static_cast<GLfixed>(quadVertices[vertex].y() * 65536);
+    }
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(fixedQuadVertices), fixedQuadVertices.data(),
+                 GL_STATIC_DRAW);
+
+    std::array<GLVertexArray, 2> vertexArrays;
+    for (GLVertexArray &vertexArray : vertexArrays)
+    {
+        glBindVertexArray(vertexArray);
+        glVertexAttribPointer(posLoc, 2, GL_FIXED, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(posLoc);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    const angle::VulkanPerfCounters countersBefore = getPerfCounters();
+
+    // The first vertex array converts the data, and the second uses its conversion.
+    for (GLVertexArray &vertexArray : vertexArrays)
+    {
+        glBindVertexArray(vertexArray);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    EXPECT_EQ(getPerfCounters().vertexConversionCacheMisses,
+              countersBefore.vertexConversionCacheMisses + 1);
+    EXPECT_EQ(getPerfCounters().vertexConversionCacheHits,
+              countersBefore.vertexConversionCacheHits + 1);
+
+    // Same after the data is updated.
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(fixedQuadVertices), fixedQuadVertices.data());
+    for (GLVertexArray &vertexArray : vertexArrays)
+    {
+        glBindVertexArray(vertexArray);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    EXPECT_EQ(getPerfCounters().vertexConversionCacheMisses,
+              countersBefore.vertexConversionCacheMisses + 2);
+    EXPECT_EQ(getPerfCounters().vertexConversionCacheHits,
+              countersBefore.vertexConversionCacheHits + 2);
+}
+
 // Verifies that rendering to backbuffer discards depth/stencil.
 TEST_P(VulkanPerformanceCounterTest_DepthStencilLoadStoreOps, SwapShouldInvalidateDepthStencil)
 {
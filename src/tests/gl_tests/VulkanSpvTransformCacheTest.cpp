@@ -0,0 +1,74 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// VulkanSpvTransformCacheTest:
+//   Tests that the SPIR-V transformed for programs is shared between programs.
+//
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+
+#include "libANGLE/Context.h"
+#include "libANGLE/Display.h"
+#include "libANGLE/renderer/vulkan/ContextVk.h"
+#include "libANGLE/renderer/vulkan/vk_renderer.h"
+
+using namespace angle;
+
+namespace
+{
+
+class VulkanSpvTransformCacheTest : public ANGLETest<>
+{
+  protected:
+    VulkanSpvTransformCacheTest()
+    {
+        setWindowWidth(16);
+        setWindowHeight(16);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    rx::SpvTransformCache &hackSpvTransformCache() const
+    {
+        egl::Display *display   = static_cast<egl::Display *>(getEGLWindow()->getDisplay());
+        gl::ContextID contextID = {
+            static_cast<GLuint>(reinterpret_cast<uintptr_t>(getEGLWindow()->getContext()))};
+        gl::Context *context = display->getContext(contextID);
+        return rx::GetImplAs<rx::ContextVk>(context)->getRenderer()->getSpvTransformCache();
+    }
+};
+
+// Test that a program with the same shaders as a previous one reuses its transformed SPIR-V.
+TEST_P(VulkanSpvTransformCacheTest, IdenticalProgramsShareTransformedSpirv)
+{
+    const rx::SpvTransformCache &cache = hackSpvTransformCache();
+
+    ANGLE_GL_PROGRAM(program1, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    drawQuad(program1, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    ASSERT_GL_NO_ERROR();
+
+    const size_t hitCount  = cache.getCacheHitCount();
+    const size_t missCount = cache.getCacheMissCount();
+
+    // Draw with a second, identical program.  Its shaders are not transformed again.
+    ANGLE_GL_PROGRAM(program2, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    drawQuad(program2, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_GT(cache.getCacheHitCount(), hitCount);
+    EXPECT_EQ(cache.getCacheMissCount(), missCount);
+}
+
+ANGLE_INSTANTIATE_TEST(VulkanSpvTransformCacheTest, ES2_VULKAN(), ES3_VULKAN());
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanSpvTransformCacheTest);
+
+}  // anonymous namespace
@@ -1609,6 +1609,16 @@ void ANGLERenderTest::setRobustResourceInit(bool enabled)
     mConfigParams.robustResourceInit = enabled;
 }
 
+void ANGLERenderTest::setThreadedCommandsEnabled(bool enabled)
+{
+    mConfigParams.threadedCommands = enabled;
+}
+
+void ANGLERenderTest::setNoErrorEnabled(bool enabled)
+{
+    mConfigParams.noError = enabled;
+}
+
 void ANGLERenderTest::onErrorMessage(const char *errorMessage)
 {
     abortTest();
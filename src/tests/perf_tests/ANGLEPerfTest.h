@@ -243,6 +243,8 @@ class ANGLERenderTest : public ANGLEPerfTest
     void setWebGLCompatibilityEnabled(bool webglCompatibility);
     void setHardenedContextEnabled(bool hardenedContext);
     void setRobustResourceInit(bool enabled);
+    void setThreadedCommandsEnabled(bool enabled);
+    void setNoErrorEnabled(bool enabled);
 
     virtual void startGpuTimer();
     virtual void stopGpuTimer(bool mayNeedFlush = true);
@@ -23,15 +23,26 @@ using angle::WorkerThreadPool;
 
 struct AstcDecompressorParams
 {
-    AstcDecompressorParams(uint32_t width, uint32_t height) : width(width), height(height) {}
+    AstcDecompressorParams(uint32_t width, uint32_t height, uint32_t threadCount)
+        : width(width), height(height), threadCount(threadCount)
+    {}
 
     uint32_t width;
     uint32_t height;
+    uint32_t threadCount;
 };
 
 std::ostream &operator<<(std::ostream &os, const AstcDecompressorParams &params)
 {
     os << params.width << "x" << params.height;
+    if (params.threadCount == AstcDecompressor::kAutomaticThreadCount)
+    {
+        os << "_auto_threads";
+    }
+    else
+    {
+        os << "_" << params.threadCount << "_threads";
+    }
     return os;
 }
 
@@ -45,6 +56,9 @@ class AstcDecompressorPerfTest : public ANGLEPerfTest,
 
     std::string getName();
 
+    // Records the decompression throughput of the last trial, in MB of output per second.
+    void recordThroughput();
+
     AstcDecompressor &mDecompressor;
     std::vector<uint8_t> mInput;
     std::vector<uint8_t> mOutput;
@@ -66,7 +80,20 @@ AstcDecompressorPerfTest::AstcDecompressorPerfTest()
 void AstcDecompressorPerfTest::step()
 {
     mDecompressor.decompress(mSingleThreadPool, mMultiThreadPool, GetParam().width,
-                             GetParam().height, 8, 8, mInput.data(), mInput.size(), mOutput.data());
+                             GetParam().height, 8, 8, mInput.data(), mInput.size(), mOutput.data(),
+                             GetParam().threadCount);
+}
+
+void AstcDecompressorPerfTest::recordThroughput()
+{
+    const double seconds = mTrialTimer.getElapsedWallClockTime();
+    if (seconds <= 0.0 || getNumStepsPerformed() == 0)
+    {
+        return;
+    }
+
+    const double megabytes = static_cast<double>(mOutput.size()) * getNumStepsPerformed() / 1e6;
+    recordDoubleMetric(".throughput", megabytes / seconds, "MB/s");
 }
 
 std::string AstcDecompressorPerfTest::getName()
@@ -83,13 +110,22 @@ TEST_P(AstcDecompressorPerfTest, Run)
         skipTest("ASTC decompressor not available");
 
     this->run();
+    recordThroughput();
 }
 
 INSTANTIATE_TEST_SUITE_P(,
                          AstcDecompressorPerfTest,
-                         Values(AstcDecompressorParams(16, 16),
-                                AstcDecompressorParams(256, 256),
-                                AstcDecompressorParams(1024, 1024)),
+                         Values(AstcDecompressorParams(16, 16, 1),
+                                AstcDecompressorParams(256, 256, 1),
+                                AstcDecompressorParams(256, 256, 4),
+                                AstcDecompressorParams(1024, 1024, 1),
+                                AstcDecompressorParams(1024, 1024, 2),
+                                AstcDecompressorParams(1024, 1024, 4),
+                                AstcDecompressorParams(1024, 1024, 8),
+                                AstcDecompressorParams(1024, 1024, 16),
+                                AstcDecompressorParams(1024,
+                                                       1024,
+                                                       AstcDecompressor::kAutomaticThreadCount)),
                          PrintToStringParamName());
 
 }  // anonymous namespace
@@ -0,0 +1,165 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCachePerf:
+//   Performance test for concurrent lookups in the blob cache.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <thread>
+
+#include "libANGLE/BlobCache.h"
+#include "util/random_utils.h"
+
+using namespace testing;
+
+namespace
+{
+constexpr size_t kEntryCount       = 256;
+constexpr size_t kEntrySize        = 16 * 1024;
+constexpr size_t kLookupsPerThread = 1000;
+
+enum class LookupType
+{
+    // Look up and copy out the blob.
+    Get,
+    // Look up and decompress the blob, as the program and shader caches do.
+    GetAndDecompress,
+};
+
+struct BlobCacheParams
+{
+    LookupType lookupType;
+    size_t threadCount;
+};
+
+std::ostream &operator<<(std::ostream &os, const BlobCacheParams &params)
+{
+    os << (params.lookupType == LookupType::Get ? "Get" : "GetAndDecompress") << "_"
+       << params.threadCount << "_threads";
+    return os;
+}
+
+egl::BlobCache::Key MakeKey(size_t index)
+{
+    // Spread the index over the key like a hash would.
+    egl::BlobCache::Key key = {};
+    for (size_t byte = 0; byte < key.size(); ++byte)
+    {
+        key[byte] = static_cast<uint8_t>((index * 0x9E3779B1u) >> ((byte % 4) * 8)) ^
+                    static_cast<uint8_t>(byte);
+    }
+    return key;
+}
+
+class BlobCachePerfTest : public ANGLEPerfTest, public WithParamInterface<BlobCacheParams>
+{
+  public:
+    BlobCachePerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+    std::string getName();
+
+  private:
+    egl::BlobCache mBlobCache;
+};
+
+BlobCachePerfTest::BlobCachePerfTest()
+    : ANGLEPerfTest(getName(), "", "_run", 1, "us"), mBlobCache(kEntryCount * kEntrySize * 2)
+{}
+
+void BlobCachePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    angle::RNG rng(0x12345678u);
+    std::vector<uint8_t> data(kEntrySize);
+
+    for (size_t index = 0; index < kEntryCount; ++index)
+    {
+        // Half random, half constant data so that compression does some actual work.
+        FillVectorWithRandomUBytes(&rng, &data);
+        std::fill(data.begin() + kEntrySize / 2, data.end(), static_cast<uint8_t>(index));
+
+        angle::MemoryBuffer blob;
+        if (GetParam().lookupType == LookupType::Get)
+        {
+            ASSERT_TRUE(blob.resize(kEntrySize));
+            std::copy(data.begin(), data.end(), blob.data());
+        }
+        else
+        {
+            ASSERT_TRUE(angle::CompressBlob(data.size(), data.data(), &blob));
+        }
+        mBlobCache.populate(MakeKey(index), std::move(blob));
+    }
+}
+
+void BlobCachePerfTest::step()
+{
+    std::vector<std::thread> threads;
+    threads.reserve(GetParam().threadCount);
+
+    for (size_t threadIndex = 0; threadIndex < GetParam().threadCount; ++threadIndex)
+    {
+        threads.emplace_back([this, threadIndex]() {
+            angle::ScratchBuffer scratchBuffer;
+            angle::MemoryBuffer output;
+            for (size_t lookup = 0; lookup < kLookupsPerThread; ++lookup)
+            {
+                const egl::BlobCache::Key key = MakeKey((threadIndex * 7 + lookup) % kEntryCount);
+                if (GetParam().lookupType == LookupType::Get)
+                {
+                    egl::BlobCache::Value value;
+                    if (mBlobCache.get(nullptr, &scratchBuffer, key, &value) &&
+                        output.resize(value.size()))
+                    {
+                        std::copy(value.data(), value.data() + value.size(), output.data());
+                    }
+                }
+                else
+                {
+                    (void)mBlobCache.getAndDecompress(nullptr, &scratchBuffer, key, kEntrySize,
+                                                      &output);
+                }
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+std::string BlobCachePerfTest::getName()
+{
+    std::stringstream ss;
+    ss << UnitTest::GetInstance()->current_test_suite()->name() << "/" << GetParam();
+    return ss.str();
+}
+
+// Measures the time for several threads to look up blobs in the cache at the same time.
+TEST_P(BlobCachePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         BlobCachePerfTest,
+                         Values(BlobCacheParams{LookupType::Get, 1},
+                                BlobCacheParams{LookupType::Get, 4},
+                                BlobCacheParams{LookupType::Get, 8},
+                                BlobCacheParams{LookupType::Get, 32},
+                                BlobCacheParams{LookupType::GetAndDecompress, 1},
+                                BlobCacheParams{LookupType::GetAndDecompress, 4},
+                                BlobCacheParams{LookupType::GetAndDecompress, 8},
+                                BlobCacheParams{LookupType::GetAndDecompress, 32}),
+                         PrintToStringParamName());
+
+}  // anonymous namespace
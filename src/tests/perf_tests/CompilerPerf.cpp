@@ -6,11 +6,21 @@
 // CompilerPerfTest:
 //   Performance test for the shader translator. The test initializes the compiler once and then
 //   compiles the same shader repeatedly. There are different variations of the tests using
-//   different shaders.
+//   different shaders, including one that is passed after a large header shared by many shaders.
+//   At the end, the time and pool memory taken by each stage of the compilation are printed.
+//   The SPIR-V variants compare the AST path against the IR, which either turns into AST
+//   (suffix _IR) or generates the SPIR-V directly (suffix _FromIR).
+//
+// CompilerInitPerfTest:
+//   Performance test for creating the compilers of a context. The test constructs and initializes
+//   a compiler for each shader type, as a context does, and destroys them.
 //
 
 #include "ANGLEPerfTest.h"
 
+#include <iomanip>
+#include <sstream>
+
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
@@ -180,6 +190,8 @@ struct CompilerParameters
                 return "GLSL_4_50";
             case SH_ESSL_OUTPUT:
                 return "ESSL";
+            case SH_SPIRV_VULKAN_OUTPUT:
+                return "SPIRV";
             default:
                 UNREACHABLE();
                 return "unk";
@@ -189,11 +201,45 @@ struct CompilerParameters
     ShShaderOutput output;
 };
 
+// The shader is passed after MakeSharedHeaderESSL300().
+const char *kSharedHeaderESSL300FragSource = R"(
+uniform vec4 uColor;
+out vec4 outColor;
+void main()
+{
+    outColor = helper0(uColor) + helper31(uColor) + helper63(uColor) * SCALE_5;
+}
+)";
+
+const char *kSharedHeaderESSL300Id = "SharedHeaderESSL300";
+
+// A header of macros and helper functions, like the ones apps paste in front of each of their
+// shaders as the first string.
+std::string MakeSharedHeaderESSL300()
+{
+    std::ostringstream header;
+    header << "#version 300 es\n"
+           << "precision highp float;\n";
+    for (int index = 0; index < 64; ++index)
+    {
+        header << "#define SCALE_" << index << " " << index << ".5\n"
+               << "#define OFFSET_" << index << "(x) ((x) + SCALE_" << index << ")\n"
+               << "/* Helper " << index << " of the shared header. */\n"
+               << "vec4 helper" << index << "(vec4 color)\n"
+               << "{\n"
+               << "    return clamp(OFFSET_" << index << "(color) * SCALE_" << index
+               << ", 0.0, 1.0);\n"
+               << "}\n";
+    }
+    return header.str();
+}
+
 bool IsPlatformAvailable(const CompilerParameters &param)
 {
     switch (param.output)
     {
         case SH_HLSL_4_1_OUTPUT:
+        case SH_SPIRV_VULKAN_OUTPUT:
         {
             angle::PoolAllocator allocator;
             InitializePoolIndex();
@@ -219,8 +265,9 @@ struct CompilerPerfParameters final : public CompilerParameters
 {
     CompilerPerfParameters(ShShaderOutput output,
                            const char *shaderSource,
-                           const char *shaderSourceId)
-        : CompilerParameters(output), shaderSource(shaderSource)
+                           const char *shaderSourceId,
+                           bool sharedHeader = false)
+        : CompilerParameters(output), shaderSource(shaderSource), sharedHeader(sharedHeader)
     {
         testId = shaderSourceId;
         testId += "_";
@@ -228,9 +275,30 @@ struct CompilerPerfParameters final : public CompilerParameters
     }
 
     const char *shaderSource;
+    // Whether the shader is passed after MakeSharedHeaderESSL300().
+    bool sharedHeader;
+    // Whether the shader is compiled through the IR, and whether the SPIR-V is then generated
+    // directly from the IR.
+    bool useIR               = false;
+    bool generateSpirvFromIR = false;
     std::string testId;
 };
 
+CompilerPerfParameters ThroughIR(CompilerPerfParameters params)
+{
+    params.useIR = true;
+    params.testId += "_IR";
+    return params;
+}
+
+CompilerPerfParameters SpirvFromIR(CompilerPerfParameters params)
+{
+    params.useIR               = true;
+    params.generateSpirvFromIR = true;
+    params.testId += "_FromIR";
+    return params;
+}
+
 std::ostream &operator<<(std::ostream &stream, const CompilerPerfParameters &p)
 {
     stream << p.testId;
@@ -252,7 +320,13 @@ class CompilerPerfTest : public ANGLEPerfTest,
     void setTestShader(const char *str) { mTestShader = str; }
 
   private:
+    angle::Span<const char *const> getShaderStrings() const;
+    ShCompileOptions getCompileOptions() const;
+    void printCompileStages();
+
     const char *mTestShader;
+    std::string mHeader;
+    const char *mShaderStringsWithHeader[2];
 
     ShBuiltInResources mResources;
     angle::PoolAllocator mAllocator;
@@ -280,10 +354,20 @@ void CompilerPerfTest::SetUp()
     }
 
     setTestShader(params.shaderSource);
+    if (params.sharedHeader)
+    {
+        mHeader = MakeSharedHeaderESSL300();
+    }
+    mShaderStringsWithHeader[0] = mHeader.c_str();
+    mShaderStringsWithHeader[1] = mTestShader;
 }
 
 void CompilerPerfTest::TearDown()
 {
+    if (mTranslator)
+    {
+        printCompileStages();
+    }
     SafeDelete(mTranslator);
 
     SetGlobalPoolAllocator(nullptr);
@@ -294,14 +378,57 @@ void CompilerPerfTest::TearDown()
     ANGLEPerfTest::TearDown();
 }
 
-void CompilerPerfTest::step()
+angle::Span<const char *const> CompilerPerfTest::getShaderStrings() const
 {
-    const char *shaderStrings[] = {mTestShader};
+    angle::Span<const char *const> shaderStrings(mShaderStringsWithHeader);
+    return mHeader.empty() ? shaderStrings.subspan(1) : shaderStrings;
+}
 
+ShCompileOptions CompilerPerfTest::getCompileOptions() const
+{
     ShCompileOptions compileOptions              = {};
     compileOptions.objectCode                    = true;
     compileOptions.initializeUninitializedLocals = true;
     compileOptions.initOutputVariables           = true;
+    compileOptions.useIR                         = GetParam().useIR;
+    compileOptions.generateSpirvFromIR           = GetParam().generateSpirvFromIR;
+    return compileOptions;
+}
+
+// Compiles the shader once more outside of the measured steps, and prints where the compilation
+// spends its time.
+void CompilerPerfTest::printCompileStages()
+{
+    ShCompileOptions compileOptions    = getCompileOptions();
+    compileOptions.recordCompileStages = true;
+    if (!mTranslator->compile(getShaderStrings(), compileOptions))
+    {
+        return;
+    }
+
+    const std::vector<ShCompileStageRecord> &stages = mTranslator->getCompileStageRecords();
+    uint64_t totalTimeNs                             = 0;
+    for (const ShCompileStageRecord &stage : stages)
+    {
+        totalTimeNs += stage.timeNs;
+    }
+
+    std::cout << "Compile stages of " << GetParam().testId << ":\n";
+    for (const ShCompileStageRecord &stage : stages)
+    {
+        std::cout << "  " << std::left << std::setw(48) << stage.name << std::right
+                  << std::setw(10) << stage.timeNs << " ns " << std::setw(5)
+                  << (totalTimeNs > 0 ? stage.timeNs * 100 / totalTimeNs : 0) << "% "
+                  << std::setw(10) << stage.poolBytes << " pool bytes\n";
+    }
+    std::cout << "  " << std::left << std::setw(48) << "Total" << std::right << std::setw(10)
+              << totalTimeNs << " ns\n";
+}
+
+void CompilerPerfTest::step()
+{
+    const angle::Span<const char *const> shaderStrings = getShaderStrings();
+    const ShCompileOptions compileOptions              = getCompileOptions();
 
 #if !defined(NDEBUG)
     // Make sure that compilation succeeds and print the info log if it doesn't in debug mode.
@@ -329,15 +456,122 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT,
+                           kSharedHeaderESSL300FragSource,
+                           kSharedHeaderESSL300Id,
+                           true),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
                            kRealWorldESSL100FragSource,
                            kRealWorldESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           kSharedHeaderESSL300FragSource,
+                           kSharedHeaderESSL300Id,
+                           true),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           kSharedHeaderESSL300FragSource,
+                           kSharedHeaderESSL300Id,
+                           true),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kRealWorldESSL100FragSource,
+                           kRealWorldESSL100Id),
+    ThroughIR(CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                                     kSimpleESSL100FragSource,
+                                     kSimpleESSL100Id)),
+    ThroughIR(CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                                     kSimpleESSL300FragSource,
+                                     kSimpleESSL300Id)),
+    ThroughIR(CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                                     kRealWorldESSL100FragSource,
+                                     kRealWorldESSL100Id)),
+    SpirvFromIR(CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                                       kSimpleESSL100FragSource,
+                                       kSimpleESSL100Id)),
+    SpirvFromIR(CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                                       kSimpleESSL300FragSource,
+                                       kSimpleESSL300Id)),
+    SpirvFromIR(CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                                       kRealWorldESSL100FragSource,
+                                       kRealWorldESSL100Id)));
+
+std::ostream &operator<<(std::ostream &stream, const CompilerParameters &p)
+{
+    stream << p.str();
+    return stream;
+}
+
+class CompilerInitPerfTest : public ANGLEPerfTest,
+                             public ::testing::WithParamInterface<CompilerParameters>
+{
+  public:
+    CompilerInitPerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    ShBuiltInResources mResources;
+};
+
+CompilerInitPerfTest::CompilerInitPerfTest()
+    : ANGLEPerfTest("CompilerInitPerf", "", GetParam().str(), kNumIterationsPerStep)
+{}
+
+void CompilerInitPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    // Each compiler sets its own pool as the global one.
+    InitializePoolIndex();
+
+    sh::InitBuiltInResources(&mResources);
+}
+
+void CompilerInitPerfTest::TearDown()
+{
+    FreePoolIndex();
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CompilerInitPerfTest::step()
+{
+    constexpr sh::GLenum kShaderTypes[] = {GL_VERTEX_SHADER, GL_FRAGMENT_SHADER,
+                                           GL_COMPUTE_SHADER};
+
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        for (sh::GLenum shaderType : kShaderTypes)
+        {
+            sh::TCompiler *translator =
+                sh::ConstructCompiler(shaderType, SH_GLES3_1_SPEC, GetParam().output);
+            if (!translator->Init(mResources))
+            {
+                std::cout << "Initializing perf test compiler failed.\n";
+            }
+            SafeDelete(translator);
+        }
+    }
+}
+
+TEST_P(CompilerInitPerfTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(CompilerInitPerfTest,
+                       CompilerParameters(SH_HLSL_4_1_OUTPUT),
+                       CompilerParameters(SH_GLSL_450_CORE_OUTPUT),
+                       CompilerParameters(SH_ESSL_OUTPUT));
 
 }  // anonymous namespace
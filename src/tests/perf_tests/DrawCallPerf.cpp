@@ -30,6 +30,20 @@ enum class StateChange
     Scissor,
     ManyTextureDraw,
     Uniform,
+    SameStateElements,
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+// Options of the context the draw calls are made to.  Comparing the NoError variant with the
+// Default one isolates the cost of validating the draw calls, and comparing the DrawCoalescing
+// one with it shows what is saved by submitting consecutive indexed draws together.
+enum class ContextOption
+{
+    Default,
+    ThreadedCommands,
+    NoError,
+    DrawCoalescing,
     InvalidEnum,
     EnumCount = InvalidEnum,
 };
@@ -44,7 +58,8 @@ struct DrawArraysPerfParams : public DrawCallPerfParams
 
     std::string story() const override;
 
-    StateChange stateChange = StateChange::NoChange;
+    StateChange stateChange     = StateChange::NoChange;
+    ContextOption contextOption = ContextOption::Default;
 };
 
 std::string DrawArraysPerfParams::story() const
@@ -82,6 +97,24 @@ std::string DrawArraysPerfParams::story() const
         case StateChange::Uniform:
             strstr << "_uniform";
             break;
+        case StateChange::SameStateElements:
+            strstr << "_same_state_elements";
+            break;
+        default:
+            break;
+    }
+
+    switch (contextOption)
+    {
+        case ContextOption::ThreadedCommands:
+            strstr << "_threaded_commands";
+            break;
+        case ContextOption::NoError:
+            strstr << "_no_error";
+            break;
+        case ContextOption::DrawCoalescing:
+            strstr << "_draw_coalescing";
+            break;
         default:
             break;
     }
@@ -136,13 +169,14 @@ class DrawCallPerfBenchmark : public ANGLERenderTest,
     void drawBenchmark() override;
 
   private:
-    GLuint mProgram1   = 0;
-    GLuint mProgram2   = 0;
-    GLuint mProgram3   = 0;
-    GLuint mBuffer1    = 0;
-    GLuint mBuffer2    = 0;
-    GLuint mFBO        = 0;
-    GLuint mFBOTexture = 0;
+    GLuint mProgram1    = 0;
+    GLuint mProgram2    = 0;
+    GLuint mProgram3    = 0;
+    GLuint mBuffer1     = 0;
+    GLuint mBuffer2     = 0;
+    GLuint mIndexBuffer = 0;
+    GLuint mFBO         = 0;
+    GLuint mFBOTexture  = 0;
     std::vector<GLuint> mTextures;
     int mNumTris = GetParam().numTris;
     std::vector<GLuint> mVBOPool;
@@ -159,6 +193,16 @@ DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf",
     {
         skipTest("https://issuetracker.google.com/issues/298407224 Fails on Pixel 6 GLES");
     }
+
+    // EGL_ANGLE_context_threaded_commands is only exposed by the Vulkan backend.
+    if (params.contextOption == ContextOption::ThreadedCommands &&
+        params.eglParameters.renderer != EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE)
+    {
+        skipTest("EGL_ANGLE_context_threaded_commands is only supported on Vulkan");
+    }
+
+    setThreadedCommandsEnabled(params.contextOption == ContextOption::ThreadedCommands);
+    setNoErrorEnabled(params.contextOption == ContextOption::NoError);
 }
 
 void DrawCallPerfBenchmark::initializeBenchmark()
@@ -281,6 +325,23 @@ void main()
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
     glEnableVertexAttribArray(0);
 
+    if (params.stateChange == StateChange::SameStateElements)
+    {
+        // The indices are repeated so that consecutive draws can use different offsets.
+        const GLsizei numElements = 3 * mNumTris;
+        ASSERT_LE(numElements, 0x10000);
+        std::vector<GLushort> indices(2 * numElements);
+        for (size_t index = 0; index < indices.size(); ++index)
+        {
+            indices[index] = static_cast<GLushort>(index % numElements);
+        }
+
+        glGenBuffers(1, &mIndexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(indices[0]), indices.data(),
+                     GL_STATIC_DRAW);
+    }
+
     // Set the viewport
     glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
 
@@ -343,6 +404,7 @@ void DrawCallPerfBenchmark::destroyBenchmark()
     glDeleteProgram(mProgram3);
     glDeleteBuffers(1, &mBuffer1);
     glDeleteBuffers(1, &mBuffer2);
+    glDeleteBuffers(1, &mIndexBuffer);
     glDeleteTextures(1, &mFBOTexture);
     glDeleteTextures(mTextures.size(), mTextures.data());
     glDeleteFramebuffers(1, &mFBO);
@@ -570,6 +632,16 @@ void UpdateUniformThenDraw(unsigned int iterations, GLsizei numElements)
     }
 }
 
+void DrawElementsWithSameState(unsigned int iterations, GLsizei numElements)
+{
+    for (unsigned int it = 0; it < iterations; it++)
+    {
+        const size_t offset = (it % 2) * numElements * sizeof(GLushort);
+        glDrawElements(GL_TRIANGLES, numElements, GL_UNSIGNED_SHORT,
+                       reinterpret_cast<const void *>(offset));
+    }
+}
+
 void DrawCallPerfBenchmark::drawBenchmark()
 {
     // This workaround fixes a huge queue of graphics commands accumulating on the GL
@@ -626,6 +698,9 @@ void DrawCallPerfBenchmark::drawBenchmark()
         case StateChange::Uniform:
             UpdateUniformThenDraw(params.iterationsPerStep, numElements);
             break;
+        case StateChange::SameStateElements:
+            DrawElementsWithSameState(params.iterationsPerStep, numElements);
+            break;
         case StateChange::InvalidEnum:
             ADD_FAILURE() << "Invalid state change.";
             break;
@@ -655,14 +730,43 @@ DrawArraysPerfParams CombineStateChange(const DrawArraysPerfParams &in, StateCha
     return out;
 }
 
+DrawArraysPerfParams CombineOption(const DrawArraysPerfParams &in, ContextOption option)
+{
+    DrawArraysPerfParams out = in;
+    out.contextOption        = option;
+    return out;
+}
+
 using P = DrawArraysPerfParams;
 
+// Only the indexed draws are coalesced.
+bool IsOptionApplicable(const P &params)
+{
+    return params.contextOption != ContextOption::DrawCoalescing ||
+           params.stateChange == StateChange::SameStateElements;
+}
+
+// The features are overridden once the renderer is chosen, as that resets the EGL parameters.
+P OverrideFeatures(const P &in)
+{
+    P out = in;
+    if (in.contextOption == ContextOption::DrawCoalescing)
+    {
+        out.eglParameters.enable(Feature::CoalesceDrawElements);
+    }
+    return out;
+}
+
 std::vector<P> gTestsWithStateChange =
     CombineWithValues({P()}, angle::AllEnums<StateChange>(), CombineStateChange);
+std::vector<P> gTestsWithContextOption = FilterWithFunc(
+    CombineWithValues(gTestsWithStateChange, angle::AllEnums<ContextOption>(), CombineOption),
+    IsOptionApplicable);
 std::vector<P> gTestsWithRenderer =
-    CombineWithFuncs(gTestsWithStateChange, {D3D11<P>, GL<P>, Metal<P>, Vulkan<P>, WGL<P>});
+    CombineWithFuncs(gTestsWithContextOption, {D3D11<P>, GL<P>, Metal<P>, Vulkan<P>, WGL<P>});
+std::vector<P> gTestsWithFeatures = CombineWithFuncs(gTestsWithRenderer, {OverrideFeatures});
 std::vector<P> gTestsWithDevice =
-    CombineWithFuncs(gTestsWithRenderer, {Passthrough<P>, Offscreen<P>, NullDevice<P>});
+    CombineWithFuncs(gTestsWithFeatures, {Passthrough<P>, Offscreen<P>, NullDevice<P>});
 
 ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, gTestsWithDevice);
 
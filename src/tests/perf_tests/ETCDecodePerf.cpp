@@ -0,0 +1,119 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ETCDecodePerf:
+//   Performance test for decoding ETC and EAC textures on the CPU, with the fast paths of the
+//   decoder compared against its per-pixel decoding.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "image_util/loadimage.h"
+#include "util/random_utils.h"
+
+using namespace testing;
+
+namespace
+{
+constexpr size_t kSize = 1024;
+
+struct ETCFormat
+{
+    const char *name;
+    angle::LoadImageFunction loadFunction;
+    size_t blockBytes;
+    size_t outputPixelBytes;
+};
+
+constexpr ETCFormat kETC1RGB8       = {"ETC1RGB8ToRGBA8", angle::LoadETC1RGB8ToRGBA8, 8, 4};
+constexpr ETCFormat kETC2RGB8A1     = {"ETC2RGB8A1ToRGBA8", angle::LoadETC2RGB8A1ToRGBA8, 8, 4};
+constexpr ETCFormat kETC2RGBA8      = {"ETC2RGBA8ToRGBA8", angle::LoadETC2RGBA8ToRGBA8, 16, 4};
+constexpr ETCFormat kEACR11         = {"EACR11ToR8", angle::LoadEACR11ToR8, 8, 1};
+constexpr ETCFormat kEACRG11ToRG16F = {"EACRG11ToRG16F", angle::LoadEACRG11ToRG16F, 16, 8};
+
+struct ETCDecodeParams
+{
+    ETCFormat format;
+    // Whether to use the fast paths of the decoder, or only the per-pixel decoding.
+    bool fastPaths;
+};
+
+std::ostream &operator<<(std::ostream &os, const ETCDecodeParams &params)
+{
+    os << params.format.name << (params.fastPaths ? "_fast" : "_reference");
+    return os;
+}
+
+class ETCDecodePerfTest : public ANGLEPerfTest, public WithParamInterface<ETCDecodeParams>
+{
+  public:
+    ETCDecodePerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+    std::string getName();
+
+  private:
+    angle::ImageLoadContext mContext;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+ETCDecodePerfTest::ETCDecodePerfTest() : ANGLEPerfTest(getName(), "", "_run", 1, "us") {}
+
+void ETCDecodePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    const ETCFormat &format = GetParam().format;
+    mContext.useSIMD        = GetParam().fastPaths;
+
+    // Random blocks use all the modes, most of them individual and differential.
+    angle::RNG rng(0x12345678u);
+    mInput.resize((kSize / 4) * (kSize / 4) * format.blockBytes);
+    FillVectorWithRandomUBytes(&rng, &mInput);
+
+    mOutput.resize(kSize * kSize * format.outputPixelBytes);
+}
+
+void ETCDecodePerfTest::step()
+{
+    const ETCFormat &format     = GetParam().format;
+    const size_t inputRowPitch  = (kSize / 4) * format.blockBytes;
+    const size_t outputRowPitch = kSize * format.outputPixelBytes;
+
+    format.loadFunction(mContext, kSize, kSize, 1, mInput.data(), inputRowPitch, mInput.size(),
+                        mOutput.data(), outputRowPitch, mOutput.size());
+}
+
+std::string ETCDecodePerfTest::getName()
+{
+    std::stringstream ss;
+    ss << UnitTest::GetInstance()->current_test_suite()->name() << "/" << GetParam();
+    return ss.str();
+}
+
+// Measures the time to decode a 1024x1024 texture.
+TEST_P(ETCDecodePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         ETCDecodePerfTest,
+                         Values(ETCDecodeParams{kETC1RGB8, true},
+                                ETCDecodeParams{kETC1RGB8, false},
+                                ETCDecodeParams{kETC2RGB8A1, true},
+                                ETCDecodeParams{kETC2RGB8A1, false},
+                                ETCDecodeParams{kETC2RGBA8, true},
+                                ETCDecodeParams{kETC2RGBA8, false},
+                                ETCDecodeParams{kEACR11, true},
+                                ETCDecodeParams{kEACR11, false},
+                                ETCDecodeParams{kEACRG11ToRG16F, true},
+                                ETCDecodeParams{kEACRG11ToRG16F, false}),
+                         PrintToStringParamName());
+
+}  // anonymous namespace
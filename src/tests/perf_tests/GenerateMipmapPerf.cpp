@@ -13,6 +13,7 @@
 #include <random>
 #include <sstream>
 
+#include "common/mathutil.h"
 #include "test_utils/gl_raii.h"
 #include "util/shader_utils.h"
 
@@ -33,8 +34,11 @@ struct GenerateMipmapParams final : public RenderTestParams
         textureHeight = 1080;
 
         internalFormat = GL_RGBA;
+        format         = GL_RGBA;
+        type           = GL_UNSIGNED_BYTE;
 
         webgl = false;
+        cpu   = false;
     }
 
     std::string story() const override;
@@ -43,8 +47,13 @@ struct GenerateMipmapParams final : public RenderTestParams
     GLsizei textureHeight;
 
     GLenum internalFormat;
+    GLenum format;
+    GLenum type;
 
     bool webgl;
+    // Whether mipmaps are generated on the CPU, as they are for formats the GPU can't generate
+    // mipmaps for.
+    bool cpu;
 };
 
 std::ostream &operator<<(std::ostream &os, const GenerateMipmapParams &params)
@@ -68,6 +77,16 @@ std::string GenerateMipmapParams::story() const
         strstr << "_rgb";
     }
 
+    if (type == GL_HALF_FLOAT)
+    {
+        strstr << "_rgba16f";
+    }
+
+    if (cpu)
+    {
+        strstr << "_cpu";
+    }
+
     return strstr.str();
 }
 
@@ -80,6 +99,28 @@ void FillWithRandomData(T *storage)
     }
 }
 
+// Fills the texture data with random colors of the type of the texture.
+template <typename T>
+void FillWithRandomColors(T *storage, GLenum type)
+{
+    if (type != GL_HALF_FLOAT)
+    {
+        FillWithRandomData(storage);
+        return;
+    }
+
+    for (size_t index = 0; index + 1 < storage->size(); index += 2)
+    {
+        const uint16_t half = gl::float32ToFloat16(static_cast<float>(rand()) / RAND_MAX);
+        memcpy(storage->data() + index, &half, sizeof(half));
+    }
+}
+
+size_t GetPixelBytes(GLenum type)
+{
+    return type == GL_HALF_FLOAT ? 8 : 4;
+}
+
 class GenerateMipmapBenchmarkBase : public ANGLERenderTest,
                                     public ::testing::WithParamInterface<GenerateMipmapParams>
 {
@@ -154,11 +195,11 @@ void GenerateMipmapBenchmarkBase::initializeBenchmark()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-    mTextureData.resize(params.textureWidth * params.textureHeight * 4);
-    FillWithRandomData(&mTextureData);
+    mTextureData.resize(params.textureWidth * params.textureHeight * GetPixelBytes(params.type));
+    FillWithRandomColors(&mTextureData, params.type);
 
     glTexImage2D(GL_TEXTURE_2D, 0, params.internalFormat, params.textureWidth, params.textureHeight,
-                 0, params.internalFormat, GL_UNSIGNED_BYTE, mTextureData.data());
+                 0, params.format, params.type, mTextureData.data());
 
     // Perform a draw so the image data is flushed.
     glDrawArrays(GL_TRIANGLES, 0, 3);
@@ -216,10 +257,10 @@ void GenerateMipmapBenchmark::drawBenchmark()
     for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
     {
         // Slightly modify the base texture so the mipmap is definitely regenerated.
-        std::array<uint8_t, 4> randomData;
-        FillWithRandomData(&randomData);
+        std::array<uint8_t, 8> randomData;
+        FillWithRandomColors(&randomData, params.type);
 
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, params.internalFormat, GL_UNSIGNED_BYTE,
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, params.format, params.type,
                         randomData.data());
 
         // Generate mipmaps
@@ -248,7 +289,7 @@ void GenerateMipmapWithRedefineBenchmark::drawBenchmark()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
     glTexImage2D(GL_TEXTURE_2D, 0, params.internalFormat, params.textureWidth, params.textureHeight,
-                 0, params.internalFormat, GL_UNSIGNED_BYTE, mTextureData.data());
+                 0, params.format, params.type, mTextureData.data());
 
     // Perform a draw so the image data is flushed.
     glDrawArrays(GL_TRIANGLES, 0, 3);
@@ -324,6 +365,7 @@ GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool e
     if (emulatedFormat)
     {
         params.internalFormat = GL_RGB;
+        params.format         = GL_RGB;
     }
     if (singleIteration)
     {
@@ -332,6 +374,19 @@ GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool e
     return params;
 }
 
+GenerateMipmapParams VulkanCPUParams(bool singleIteration, bool halfFloat)
+{
+    GenerateMipmapParams params = VulkanParams(false, singleIteration, false);
+    params.eglParameters.enable(Feature::ForceGenerateMipmapOnCPU);
+    params.cpu = true;
+    if (halfFloat)
+    {
+        params.internalFormat = GL_RGBA16F;
+        params.type           = GL_HALF_FLOAT;
+    }
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(GenerateMipmapBenchmark, Run)
@@ -356,7 +411,9 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapBenchmark,
                        VulkanParams(false, false, false),
                        VulkanParams(true, false, false),
                        VulkanParams(false, false, true),
-                       VulkanParams(true, false, true));
+                       VulkanParams(true, false, true),
+                       VulkanCPUParams(false, false),
+                       VulkanCPUParams(false, true));
 
 ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        D3D11Params(false, true),
@@ -368,4 +425,6 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        VulkanParams(false, true, false),
                        VulkanParams(true, true, false),
                        VulkanParams(false, true, true),
-                       VulkanParams(true, true, true));
+                       VulkanParams(true, true, true),
+                       VulkanCPUParams(true, false),
+                       VulkanCPUParams(true, true));
@@ -0,0 +1,221 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HandleAllocatorPerf:
+//   Performance test comparing the handle allocators.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "libANGLE/BitmapHandleAllocator.h"
+#include "libANGLE/HandleAllocator.h"
+
+using namespace testing;
+
+namespace
+{
+constexpr GLuint kMaxHandle    = 1 << 24;
+constexpr size_t kHandleCount  = 100000;
+constexpr size_t kChurnCount   = 100000;
+constexpr size_t kReserveCount = 10000;
+constexpr size_t kBatchSize    = 256;
+constexpr size_t kBatchCount   = 64;
+
+enum class AllocatorType
+{
+    // gl::HandleAllocator, which reuses released handles in FIFO order.
+    Fifo,
+    // gl::BitmapHandleAllocator, which reuses the lowest released handle.
+    Bitmap,
+};
+
+enum class Workload
+{
+    // Release and allocate handles at random among many live ones.
+    Churn,
+    // Reserve handles in random order, as capture replay does, then allocate as many.
+    Reserve,
+    // Allocate handles in batches, as glGen* calls do, then release them all.
+    Batch,
+};
+
+struct HandleAllocatorParams
+{
+    AllocatorType allocatorType;
+    Workload workload;
+};
+
+std::ostream &operator<<(std::ostream &os, const HandleAllocatorParams &params)
+{
+    os << (params.allocatorType == AllocatorType::Fifo ? "Fifo" : "Bitmap") << "_";
+    switch (params.workload)
+    {
+        case Workload::Churn:
+            os << "Churn";
+            break;
+        case Workload::Reserve:
+            os << "Reserve";
+            break;
+        case Workload::Batch:
+            os << "Batch";
+            break;
+    }
+    return os;
+}
+
+void AllocateBatch(gl::HandleAllocator *allocator, size_t count, GLuint *handles)
+{
+    for (size_t index = 0; index < count; ++index)
+    {
+        allocator->allocate(&handles[index]);
+    }
+}
+
+void AllocateBatch(gl::BitmapHandleAllocator *allocator, size_t count, GLuint *handles)
+{
+    allocator->allocate(count, handles);
+}
+
+class HandleAllocatorPerfTest : public ANGLEPerfTest,
+                                public WithParamInterface<HandleAllocatorParams>
+{
+  public:
+    HandleAllocatorPerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+    std::string getName();
+
+  private:
+    template <typename AllocatorT>
+    void runWorkload(AllocatorT *allocator);
+
+    gl::HandleAllocator mFifoAllocator;
+    gl::BitmapHandleAllocator mBitmapAllocator;
+
+    std::vector<GLuint> mHandles;
+    // Indices into |mHandles| for the churn, and handles to reserve otherwise.
+    std::vector<GLuint> mRandomValues;
+};
+
+HandleAllocatorPerfTest::HandleAllocatorPerfTest()
+    : ANGLEPerfTest(getName(), "", "_run", 1, "us"),
+      mFifoAllocator(kMaxHandle),
+      mBitmapAllocator(kMaxHandle)
+{}
+
+void HandleAllocatorPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    std::mt19937 generator(0x12345678u);
+    switch (GetParam().workload)
+    {
+        case Workload::Churn:
+            mHandles.resize(kHandleCount);
+            if (GetParam().allocatorType == AllocatorType::Fifo)
+            {
+                AllocateBatch(&mFifoAllocator, mHandles.size(), mHandles.data());
+            }
+            else
+            {
+                AllocateBatch(&mBitmapAllocator, mHandles.size(), mHandles.data());
+            }
+            mRandomValues.resize(kChurnCount);
+            for (GLuint &value : mRandomValues)
+            {
+                value = generator() % kHandleCount;
+            }
+            break;
+        case Workload::Reserve:
+            mRandomValues.resize(kReserveCount * 2);
+            for (size_t index = 0; index < mRandomValues.size(); ++index)
+            {
+                mRandomValues[index] = static_cast<GLuint>(index + 1);
+            }
+            std::shuffle(mRandomValues.begin(), mRandomValues.end(), generator);
+            mRandomValues.resize(kReserveCount);
+            mHandles.resize(kReserveCount);
+            break;
+        case Workload::Batch:
+            mHandles.resize(kBatchSize * kBatchCount);
+            break;
+    }
+}
+
+template <typename AllocatorT>
+void HandleAllocatorPerfTest::runWorkload(AllocatorT *allocator)
+{
+    switch (GetParam().workload)
+    {
+        case Workload::Churn:
+            for (GLuint index : mRandomValues)
+            {
+                allocator->release(mHandles[index]);
+                allocator->allocate(&mHandles[index]);
+            }
+            break;
+        case Workload::Reserve:
+            allocator->reset();
+            for (GLuint handle : mRandomValues)
+            {
+                allocator->reserve(handle);
+            }
+            AllocateBatch(allocator, mHandles.size(), mHandles.data());
+            break;
+        case Workload::Batch:
+            for (size_t batch = 0; batch < kBatchCount; ++batch)
+            {
+                AllocateBatch(allocator, kBatchSize, &mHandles[batch * kBatchSize]);
+            }
+            for (GLuint handle : mHandles)
+            {
+                allocator->release(handle);
+            }
+            break;
+    }
+}
+
+void HandleAllocatorPerfTest::step()
+{
+    if (GetParam().allocatorType == AllocatorType::Fifo)
+    {
+        runWorkload(&mFifoAllocator);
+    }
+    else
+    {
+        runWorkload(&mBitmapAllocator);
+    }
+}
+
+std::string HandleAllocatorPerfTest::getName()
+{
+    std::stringstream ss;
+    ss << UnitTest::GetInstance()->current_test_suite()->name() << "/" << GetParam();
+    return ss.str();
+}
+
+// Measures the time spent allocating, releasing and reserving handles.
+TEST_P(HandleAllocatorPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         HandleAllocatorPerfTest,
+                         Values(HandleAllocatorParams{AllocatorType::Fifo, Workload::Churn},
+                                HandleAllocatorParams{AllocatorType::Bitmap, Workload::Churn},
+                                HandleAllocatorParams{AllocatorType::Fifo, Workload::Reserve},
+                                HandleAllocatorParams{AllocatorType::Bitmap, Workload::Reserve},
+                                HandleAllocatorParams{AllocatorType::Fifo, Workload::Batch},
+                                HandleAllocatorParams{AllocatorType::Bitmap, Workload::Batch}),
+                         PrintToStringParamName());
+
+}  // anonymous namespace
@@ -27,6 +27,11 @@ struct IndexConversionPerfParams final : public RenderTestParams
             strstr << "_index_range";
         }
 
+        if (subDataUpdate)
+        {
+            strstr << "_sub_data_update";
+        }
+
         strstr << RenderTestParams::story();
 
         return strstr.str();
@@ -36,6 +41,10 @@ struct IndexConversionPerfParams final : public RenderTestParams
 
     // A second test, which covers using index ranges with an offset.
     unsigned int indexRangeOffset;
+
+    // A third test, which covers computing the index range of a large draw after a small part of
+    // the index buffer is updated.
+    bool subDataUpdate = false;
 };
 
 // Provide a custom gtest parameter name function for IndexConversionPerfParams.
@@ -59,6 +68,7 @@ class IndexConversionPerfTest : public ANGLERenderTest,
     void updateBufferData();
     void drawConversion();
     void drawIndexRange();
+    void drawSubDataUpdate();
 
     GLuint mProgram;
     GLuint mVertexBuffer;
@@ -95,6 +105,17 @@ void IndexConversionPerfTest::initializeBenchmark()
     // Initialize the index buffer
     for (unsigned int triIndex = 0; triIndex < params.numIndexTris; ++triIndex)
     {
+        // Spread the indices of the sub-data update test over the vertices, so that updates change
+        // the index range of parts of the buffer.
+        if (params.subDataUpdate)
+        {
+            for (GLushort vertex = 0; vertex < 3; ++vertex)
+            {
+                mIndexData.push_back(static_cast<GLushort>((triIndex * 3 + vertex) % 0xFFFF));
+            }
+            continue;
+        }
+
         // Handle two different types of tests, one with index conversion triggered by a -1 index.
         if (params.indexRangeOffset == 0)
         {
@@ -136,7 +157,11 @@ void IndexConversionPerfTest::drawBenchmark()
 {
     const auto &params = GetParam();
 
-    if (params.indexRangeOffset == 0)
+    if (params.subDataUpdate)
+    {
+        drawSubDataUpdate();
+    }
+    else if (params.indexRangeOffset == 0)
     {
         drawConversion();
     }
@@ -183,6 +208,25 @@ void IndexConversionPerfTest::drawIndexRange()
     ASSERT_GL_NO_ERROR();
 }
 
+void IndexConversionPerfTest::drawSubDataUpdate()
+{
+    const auto &params = GetParam();
+
+    // Each draw follows an update of one triangle, so only the part of the index buffer around it
+    // needs to be scanned again to find the index range of the draw.
+    for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+    {
+        size_t triIndex =
+            (getNumStepsPerformed() * params.iterationsPerStep + it) % params.numIndexTris;
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, triIndex * 3 * sizeof(GLushort),
+                        3 * sizeof(GLushort), &mIndexData[triIndex * 3]);
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(params.numIndexTris * 3),
+                       GL_UNSIGNED_SHORT, reinterpret_cast<void *>(0));
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
 IndexConversionPerfParams IndexConversionPerfD3D11Params()
 {
     IndexConversionPerfParams params;
@@ -211,6 +255,21 @@ IndexConversionPerfParams IndexRangeOffsetPerfD3D11Params()
     return params;
 }
 
+IndexConversionPerfParams IndexSubDataUpdatePerfD3D11Params()
+{
+    IndexConversionPerfParams params;
+    params.eglParameters     = egl_platform::D3D11_NULL();
+    params.majorVersion      = 2;
+    params.minorVersion      = 0;
+    params.windowWidth       = 256;
+    params.windowHeight      = 256;
+    params.iterationsPerStep = 16;
+    params.numIndexTris      = 100000;
+    params.indexRangeOffset  = 0;
+    params.subDataUpdate     = true;
+    return params;
+}
+
 TEST_P(IndexConversionPerfTest, Run)
 {
     run();
@@ -218,7 +277,8 @@ TEST_P(IndexConversionPerfTest, Run)
 
 ANGLE_INSTANTIATE_TEST(IndexConversionPerfTest,
                        IndexConversionPerfD3D11Params(),
-                       IndexRangeOffsetPerfD3D11Params());
+                       IndexRangeOffsetPerfD3D11Params(),
+                       IndexSubDataUpdatePerfD3D11Params());
 
 // This test suite is not instantiated on some OSes.
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(IndexConversionPerfTest);
@@ -4,7 +4,9 @@
 // found in the LICENSE file.
 //
 // ParallelLinkProgramPerfTest:
-//   Tests performance of compiling and linking many shaders and programs in sequence.
+//   Tests performance of compiling and linking many shaders and programs in sequence.  Programs
+//   either have a vertex and a fragment shader, or additionally have tessellation and geometry
+//   shaders.
 //
 
 #include "ANGLEPerfTest.h"
@@ -34,17 +36,26 @@ enum class CompileLinkOrder
     Unspecified,
 };
 
+enum class ProgramStages
+{
+    // Vertex and fragment shaders.
+    VertexFragment,
+    // Vertex, tessellation control, tessellation evaluation, geometry and fragment shaders.
+    AllGraphics,
+};
+
 struct ParallelLinkProgramParams final : public RenderTestParams
 {
-    ParallelLinkProgramParams(CompileLinkOrder order)
+    ParallelLinkProgramParams(CompileLinkOrder order, ProgramStages stages)
     {
         iterationsPerStep = 100;
 
         majorVersion     = 3;
-        minorVersion     = 0;
+        minorVersion     = stages == ProgramStages::AllGraphics ? 1 : 0;
         windowWidth      = 256;
         windowHeight     = 256;
         compileLinkOrder = order;
+        programStages    = stages;
     }
 
     std::string story() const override
@@ -65,6 +76,11 @@ struct ParallelLinkProgramParams final : public RenderTestParams
             strstr << "_interleaved_compile_and_link_with_immediate_query";
         }
 
+        if (programStages == ProgramStages::AllGraphics)
+        {
+            strstr << "_5_stages";
+        }
+
         if (std::find(eglParameters.disabledFeatureOverrides.begin(),
                       eglParameters.disabledFeatureOverrides.end(),
                       Feature::EnableParallelCompileAndLink) !=
@@ -73,6 +89,14 @@ struct ParallelLinkProgramParams final : public RenderTestParams
             strstr << "_serial";
         }
 
+        if (std::find(eglParameters.disabledFeatureOverrides.begin(),
+                      eglParameters.disabledFeatureOverrides.end(),
+                      Feature::AlwaysRunCompileJobsThreaded) !=
+            eglParameters.disabledFeatureOverrides.end())
+        {
+            strstr << "_unthreaded_compile";
+        }
+
         if (eglParameters.deviceType == EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE)
         {
             strstr << "_null";
@@ -82,6 +106,7 @@ struct ParallelLinkProgramParams final : public RenderTestParams
     }
 
     CompileLinkOrder compileLinkOrder;
+    ProgramStages programStages;
 };
 
 std::ostream &operator<<(std::ostream &os, const ParallelLinkProgramParams &params)
@@ -103,11 +128,9 @@ class ParallelLinkProgramBenchmark : public ANGLERenderTest,
   protected:
     struct Program
     {
-        std::string vertexShader;
-        std::string fragmentShader;
+        std::vector<std::string> shaderSources;
 
-        GLuint vs;
-        GLuint fs;
+        std::vector<GLuint> shaders;
         GLuint program;
     };
 
@@ -128,19 +151,35 @@ ParallelLinkProgramBenchmark::ParallelLinkProgramBenchmark()
     {
         skipTest("http://anglebug.com/42266835 flakily crashes the GL driver");
     }
+
+    if (GetParam().programStages == ProgramStages::AllGraphics)
+    {
+        addExtensionPrerequisite("GL_EXT_tessellation_shader");
+        addExtensionPrerequisite("GL_EXT_geometry_shader");
+    }
 }
 
 void ParallelLinkProgramBenchmark::initializeBenchmark()
 {
     const ParallelLinkProgramParams &params = GetParam();
 
+    const bool allGraphicsStages = params.programStages == ProgramStages::AllGraphics;
+    const char *version          = allGraphicsStages ? "#version 310 es" : "#version 300 es";
+
+    std::vector<GLenum> shaderTypes = {GL_VERTEX_SHADER, GL_FRAGMENT_SHADER};
+    if (allGraphicsStages)
+    {
+        shaderTypes = {GL_VERTEX_SHADER, GL_TESS_CONTROL_SHADER_EXT, GL_TESS_EVALUATION_SHADER_EXT,
+                       GL_GEOMETRY_SHADER_EXT, GL_FRAGMENT_SHADER};
+    }
+
     // Generate N shaders and create the GL objects.  DrawBenchmark would then _only_ do compilation
     // and link.
     mPrograms.resize(params.iterationsPerStep);
     for (uint32_t i = 0; i < params.iterationsPerStep; ++i)
     {
         std::ostringstream vs;
-        vs << R"(#version 300 es
+        vs << version << R"(
 uniform UBO
 {
     vec4 data[)"
@@ -172,10 +211,75 @@ void main()
            << i << R"(].xxw);
     var2 = uvec2(1, 3) * uvec2(6, 3);
 })";
-        mPrograms[i].vertexShader = vs.str();
+
+        // The tessellation and geometry stages pass var1 along, and the geometry shader regenerates
+        // var2 for the fragment shader.
+        std::ostringstream tcs;
+        tcs << version << R"(
+#extension GL_EXT_tessellation_shader : require
+layout(vertices = 3) out;
+
+in highp vec3 var1[];
+out highp vec3 tcsVar1[];
+
+void main()
+{
+    gl_out[gl_InvocationID].gl_Position = gl_in[gl_InvocationID].gl_Position;
+    tcsVar1[gl_InvocationID] = var1[gl_InvocationID];
+
+    gl_TessLevelInner[0] = 1.0;
+    gl_TessLevelOuter[0] = 1.0;
+    gl_TessLevelOuter[1] = 1.0;
+    gl_TessLevelOuter[2] = 1.0;
+})";
+
+        std::ostringstream tes;
+        tes << version << R"(
+#extension GL_EXT_tessellation_shader : require
+layout(triangles, equal_spacing, ccw) in;
+
+in highp vec3 tcsVar1[];
+out highp vec3 tesVar1;
+
+void main()
+{
+    gl_Position = gl_in[0].gl_Position * gl_TessCoord.x + gl_in[1].gl_Position * gl_TessCoord.y +
+                  gl_in[2].gl_Position * gl_TessCoord.z;
+    highp vec3 p = tcsVar1[0] * gl_TessCoord.x + tcsVar1[1] * gl_TessCoord.y +
+                   tcsVar1[2] * gl_TessCoord.z;)";
+        for (uint32_t j = 0; j < i * 5; ++j)
+        {
+            tes << R"(
+    p = p.yzx * 0.5 + p;)";
+        }
+        tes << R"(
+    tesVar1 = p;
+})";
+
+        std::ostringstream gs;
+        gs << version << R"(
+#extension GL_EXT_geometry_shader : require
+layout(triangles) in;
+layout(triangle_strip, max_vertices = 3) out;
+
+in highp vec3 tesVar1[];
+out highp vec3 var1;
+flat out lowp uvec2 var2;
+
+void main()
+{
+    for (int v = 0; v < 3; ++v)
+    {
+        gl_Position = gl_in[v].gl_Position;
+        var1 = tesVar1[v];
+        var2 = uvec2(1, 3) * uvec2(v, 3);
+        EmitVertex();
+    }
+    EndPrimitive();
+})";
 
         std::ostringstream fs;
-        fs << R"(#version 300 es
+        fs << version << R"(
 uniform UBO
 {
     highp vec4 data[)"
@@ -207,19 +311,37 @@ void main()
         fs << R"(
     color2 = res;
 })";
-        mPrograms[i].fragmentShader = fs.str();
-
-        mPrograms[i].vs      = glCreateShader(GL_VERTEX_SHADER);
-        mPrograms[i].fs      = glCreateShader(GL_FRAGMENT_SHADER);
-        mPrograms[i].program = glCreateProgram();
 
-        const char *vsCStr = mPrograms[i].vertexShader.c_str();
-        const char *fsCStr = mPrograms[i].fragmentShader.c_str();
-        glShaderSource(mPrograms[i].vs, 1, &vsCStr, 0);
-        glShaderSource(mPrograms[i].fs, 1, &fsCStr, 0);
+        Program &program = mPrograms[i];
+        program.program  = glCreateProgram();
+        for (GLenum shaderType : shaderTypes)
+        {
+            switch (shaderType)
+            {
+                case GL_VERTEX_SHADER:
+                    program.shaderSources.push_back(vs.str());
+                    break;
+                case GL_TESS_CONTROL_SHADER_EXT:
+                    program.shaderSources.push_back(tcs.str());
+                    break;
+                case GL_TESS_EVALUATION_SHADER_EXT:
+                    program.shaderSources.push_back(tes.str());
+                    break;
+                case GL_GEOMETRY_SHADER_EXT:
+                    program.shaderSources.push_back(gs.str());
+                    break;
+                default:
+                    ASSERT(shaderType == GL_FRAGMENT_SHADER);
+                    program.shaderSources.push_back(fs.str());
+                    break;
+            }
 
-        glAttachShader(mPrograms[i].program, mPrograms[i].vs);
-        glAttachShader(mPrograms[i].program, mPrograms[i].fs);
+            const GLuint shader = glCreateShader(shaderType);
+            const char *srcCStr = program.shaderSources.back().c_str();
+            glShaderSource(shader, 1, &srcCStr, 0);
+            glAttachShader(program.program, shader);
+            program.shaders.push_back(shader);
+        }
     }
 
     ASSERT_GL_NO_ERROR();
@@ -227,15 +349,14 @@ void main()
 
 void ParallelLinkProgramBenchmark::destroyBenchmark()
 {
-    const ParallelLinkProgramParams &params = GetParam();
-
-    for (uint32_t i = 0; i < params.iterationsPerStep; ++i)
+    for (Program &program : mPrograms)
     {
-        glDetachShader(mPrograms[i].program, mPrograms[i].vs);
-        glDetachShader(mPrograms[i].program, mPrograms[i].fs);
-        glDeleteShader(mPrograms[i].vs);
-        glDeleteShader(mPrograms[i].fs);
-        glDeleteProgram(mPrograms[i].program);
+        for (GLuint shader : program.shaders)
+        {
+            glDetachShader(program.program, shader);
+            glDeleteShader(shader);
+        }
+        glDeleteProgram(program.program);
     }
 }
 
@@ -245,9 +366,13 @@ void ParallelLinkProgramBenchmark::drawBenchmark()
 
     for (uint32_t i = 0; i < params.iterationsPerStep; ++i)
     {
-        // Compile the shaders, and if interleaved, link the corresponding programs.
-        glCompileShader(mPrograms[i].vs);
-        glCompileShader(mPrograms[i].fs);
+        // Compile the shaders, and if interleaved, link the corresponding programs.  With
+        // InterleavedAndImmediateQuery, this measures the end-to-end latency of compiling all the
+        // stages of a program and linking it.
+        for (GLuint shader : mPrograms[i].shaders)
+        {
+            glCompileShader(shader);
+        }
         if (params.compileLinkOrder != CompileLinkOrder::AllCompilesFirst)
         {
             glLinkProgram(mPrograms[i].program);
@@ -273,11 +398,12 @@ void ParallelLinkProgramBenchmark::drawBenchmark()
     // Now that all the compile and link jobs have been scheduled, wait for them all to finish.
     for (uint32_t i = 0; i < params.iterationsPerStep; ++i)
     {
-        GLint compileResult;
-        glGetShaderiv(mPrograms[i].vs, GL_COMPILE_STATUS, &compileResult);
-        EXPECT_NE(compileResult, 0) << i;
-        glGetShaderiv(mPrograms[i].fs, GL_COMPILE_STATUS, &compileResult);
-        EXPECT_NE(compileResult, 0) << i;
+        for (GLuint shader : mPrograms[i].shaders)
+        {
+            GLint compileResult;
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &compileResult);
+            EXPECT_NE(compileResult, 0) << i;
+        }
 
         GLint linkStatus = GL_TRUE;
         glGetProgramiv(mPrograms[i].program, GL_LINK_STATUS, &linkStatus);
@@ -287,9 +413,9 @@ void ParallelLinkProgramBenchmark::drawBenchmark()
     // ANGLE supports running some optional link subtasks beyond the actual end of the link.  Ensure
     // those are all finished by triggerring a wait on the jobs of the last program.  Currently,
     // detaching and attaching shaders does that (among other operations).
-    const uint32_t last = params.iterationsPerStep - 1;
-    glDetachShader(mPrograms[last].program, mPrograms[last].vs);
-    glAttachShader(mPrograms[last].program, mPrograms[last].vs);
+    const Program &last = mPrograms.back();
+    glDetachShader(last.program, last.shaders[0]);
+    glAttachShader(last.program, last.shaders[0]);
 
     ASSERT_GL_NO_ERROR();
 }
@@ -298,41 +424,55 @@ using namespace egl_platform;
 
 ParallelLinkProgramParams ParallelLinkProgramD3D11Params(CompileLinkOrder compileLinkOrder)
 {
-    ParallelLinkProgramParams params(compileLinkOrder);
+    ParallelLinkProgramParams params(compileLinkOrder, ProgramStages::VertexFragment);
     params.eglParameters = D3D11();
     return params;
 }
 
 ParallelLinkProgramParams ParallelLinkProgramMetalParams(CompileLinkOrder compileLinkOrder)
 {
-    ParallelLinkProgramParams params(compileLinkOrder);
+    ParallelLinkProgramParams params(compileLinkOrder, ProgramStages::VertexFragment);
     params.eglParameters = METAL();
     return params;
 }
 
 ParallelLinkProgramParams ParallelLinkProgramOpenGLOrGLESParams(CompileLinkOrder compileLinkOrder)
 {
-    ParallelLinkProgramParams params(compileLinkOrder);
+    ParallelLinkProgramParams params(compileLinkOrder, ProgramStages::VertexFragment);
     params.eglParameters = OPENGL_OR_GLES();
     return params;
 }
 
-ParallelLinkProgramParams ParallelLinkProgramVulkanParams(CompileLinkOrder compileLinkOrder)
+ParallelLinkProgramParams ParallelLinkProgramVulkanParams(CompileLinkOrder compileLinkOrder,
+                                                          ProgramStages programStages)
 {
-    ParallelLinkProgramParams params(compileLinkOrder);
+    ParallelLinkProgramParams params(compileLinkOrder, programStages);
     params.eglParameters = VULKAN();
     params.enable(Feature::EnableParallelCompileAndLink);
     return params;
 }
 
-ParallelLinkProgramParams SerialLinkProgramVulkanParams(CompileLinkOrder compileLinkOrder)
+ParallelLinkProgramParams SerialLinkProgramVulkanParams(CompileLinkOrder compileLinkOrder,
+                                                        ProgramStages programStages)
 {
-    ParallelLinkProgramParams params(compileLinkOrder);
+    ParallelLinkProgramParams params(compileLinkOrder, programStages);
     params.eglParameters = VULKAN();
     params.disable(Feature::EnableParallelCompileAndLink);
     return params;
 }
 
+// Without GL_KHR_parallel_shader_compile, and without threading the compile jobs regardless.  The
+// stages of each program are then compiled one after the other.
+ParallelLinkProgramParams UnthreadedCompileSerialLinkProgramVulkanParams(
+    CompileLinkOrder compileLinkOrder,
+    ProgramStages programStages)
+{
+    ParallelLinkProgramParams params =
+        SerialLinkProgramVulkanParams(compileLinkOrder, programStages);
+    params.disable(Feature::AlwaysRunCompileJobsThreaded);
+    return params;
+}
+
 // Test parallel link performance
 TEST_P(ParallelLinkProgramBenchmark, Run)
 {
@@ -347,11 +487,23 @@ ANGLE_INSTANTIATE_TEST(
     ParallelLinkProgramMetalParams(CompileLinkOrder::Interleaved),
     ParallelLinkProgramOpenGLOrGLESParams(CompileLinkOrder::AllCompilesFirst),
     ParallelLinkProgramOpenGLOrGLESParams(CompileLinkOrder::Interleaved),
-    ParallelLinkProgramVulkanParams(CompileLinkOrder::AllCompilesFirst),
-    ParallelLinkProgramVulkanParams(CompileLinkOrder::Interleaved),
-    ParallelLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery),
-    SerialLinkProgramVulkanParams(CompileLinkOrder::AllCompilesFirst),
-    SerialLinkProgramVulkanParams(CompileLinkOrder::Interleaved),
-    SerialLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery));
+    ParallelLinkProgramVulkanParams(CompileLinkOrder::AllCompilesFirst,
+                                    ProgramStages::VertexFragment),
+    ParallelLinkProgramVulkanParams(CompileLinkOrder::Interleaved, ProgramStages::VertexFragment),
+    ParallelLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery,
+                                    ProgramStages::VertexFragment),
+    ParallelLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery,
+                                    ProgramStages::AllGraphics),
+    SerialLinkProgramVulkanParams(CompileLinkOrder::AllCompilesFirst,
+                                  ProgramStages::VertexFragment),
+    SerialLinkProgramVulkanParams(CompileLinkOrder::Interleaved, ProgramStages::VertexFragment),
+    SerialLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery,
+                                  ProgramStages::VertexFragment),
+    SerialLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery,
+                                  ProgramStages::AllGraphics),
+    UnthreadedCompileSerialLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery,
+                                                   ProgramStages::VertexFragment),
+    UnthreadedCompileSerialLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery,
+                                                   ProgramStages::AllGraphics));
 
 }  // anonymous namespace
@@ -0,0 +1,462 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SpirvTransformPerf:
+//   Performance benchmark for the transformation the Vulkan backend applies to the SPIR-V of
+//   programs before creating their shader modules.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "libANGLE/Context.h"
+#include "libANGLE/Display.h"
+#include "libANGLE/Program.h"
+#include "libANGLE/renderer/vulkan/ContextVk.h"
+#include "libANGLE/renderer/vulkan/ProgramExecutableVk.h"
+#include "libANGLE/renderer/vulkan/spv_utils.h"
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 10;
+
+// A corpus of shaders in the style of those found in games: lit skinned meshes, post-processing,
+// text, particles and terrain.
+struct ShaderSources
+{
+    const char *vertexShader;
+    const char *fragmentShader;
+};
+
+constexpr char kSkinnedMeshVS[] = R"(#version 300 es
+layout(std140) uniform Camera
+{
+    mat4 viewProjection;
+    mat4 view;
+    vec4 cameraPosition;
+    vec4 fogParams;
+};
+uniform mat4 model;
+uniform mat4 bones[48];
+
+in vec3 position;
+in vec3 normal;
+in vec4 tangent;
+in vec2 texCoord;
+in vec4 boneWeights;
+in uvec4 boneIndices;
+
+out vec3 vWorldPosition;
+out vec3 vNormal;
+out vec3 vTangent;
+out vec3 vBitangent;
+out vec2 vTexCoord;
+out float vFogFactor;
+
+void main()
+{
+    mat4 skin = bones[boneIndices.x] * boneWeights.x + bones[boneIndices.y] * boneWeights.y +
+                bones[boneIndices.z] * boneWeights.z + bones[boneIndices.w] * boneWeights.w;
+    mat4 skinnedModel = model * skin;
+    vec4 worldPosition = skinnedModel * vec4(position, 1.0);
+    mat3 normalMatrix = mat3(skinnedModel);
+
+    vWorldPosition = worldPosition.xyz;
+    vNormal = normalize(normalMatrix * normal);
+    vTangent = normalize(normalMatrix * tangent.xyz);
+    vBitangent = cross(vNormal, vTangent) * tangent.w;
+    vTexCoord = texCoord;
+
+    float viewDepth = -(view * worldPosition).z;
+    vFogFactor = clamp((fogParams.y - viewDepth) / (fogParams.y - fogParams.x), 0.0, 1.0);
+
+    gl_Position = viewProjection * worldPosition;
+})";
+
+constexpr char kSkinnedMeshFS[] = R"(#version 300 es
+precision highp float;
+layout(std140) uniform Camera
+{
+    mat4 viewProjection;
+    mat4 view;
+    vec4 cameraPosition;
+    vec4 fogParams;
+};
+struct Light
+{
+    vec4 position;
+    vec4 color;
+    vec4 attenuation;
+};
+layout(std140) uniform Lights
+{
+    Light lights[4];
+    vec4 ambient;
+    int lightCount;
+};
+uniform sampler2D albedoMap;
+uniform sampler2D normalMap;
+uniform sampler2D specularMap;
+uniform vec3 fogColor;
+uniform float shininess;
+
+in vec3 vWorldPosition;
+in vec3 vNormal;
+in vec3 vTangent;
+in vec3 vBitangent;
+in vec2 vTexCoord;
+in float vFogFactor;
+
+out vec4 color;
+
+void main()
+{
+    vec4 albedo = texture(albedoMap, vTexCoord);
+    if (albedo.a < 0.1)
+    {
+        discard;
+    }
+    vec3 tangentNormal = texture(normalMap, vTexCoord).xyz * 2.0 - 1.0;
+    vec3 n = normalize(mat3(vTangent, vBitangent, vNormal) * tangentNormal);
+    vec3 v = normalize(cameraPosition.xyz - vWorldPosition);
+    float specularStrength = texture(specularMap, vTexCoord).r;
+
+    vec3 lighting = ambient.rgb * albedo.rgb;
+    for (int i = 0; i < lightCount; ++i)
+    {
+        vec3 toLight = lights[i].position.xyz - vWorldPosition * lights[i].position.w;
+        float lightDistance = length(toLight);
+        vec3 l = toLight / lightDistance;
+        vec3 h = normalize(l + v);
+        float attenuation =
+            1.0 / (lights[i].attenuation.x + lights[i].attenuation.y * lightDistance +
+                   lights[i].attenuation.z * lightDistance * lightDistance);
+        float diffuse = max(dot(n, l), 0.0);
+        float specular = pow(max(dot(n, h), 0.0), shininess) * specularStrength;
+        lighting += (albedo.rgb * diffuse + specular) * lights[i].color.rgb * attenuation;
+    }
+
+    color = vec4(mix(fogColor, lighting, vFogFactor), albedo.a);
+})";
+
+constexpr char kFullscreenVS[] = R"(#version 300 es
+out vec2 vTexCoord;
+void main()
+{
+    vec2 position = vec2(gl_VertexID & 1, gl_VertexID >> 1) * 2.0;
+    vTexCoord = position;
+    gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+})";
+
+constexpr char kBloomBlurFS[] = R"(#version 300 es
+precision mediump float;
+uniform sampler2D sceneColor;
+uniform sampler2D bloomColor;
+uniform vec2 texelSize;
+uniform vec2 direction;
+uniform float bloomThreshold;
+uniform float bloomIntensity;
+uniform float exposure;
+
+in vec2 vTexCoord;
+out vec4 color;
+
+const float kWeights[5] = float[5](0.227027, 0.1945946, 0.1216216, 0.054054, 0.016216);
+
+vec3 threshold(vec3 c)
+{
+    float brightness = dot(c, vec3(0.2126, 0.7152, 0.0722));
+    return c * smoothstep(bloomThreshold, bloomThreshold + 0.5, brightness);
+}
+
+void main()
+{
+    vec3 bloom = threshold(texture(bloomColor, vTexCoord).rgb) * kWeights[0];
+    for (int i = 1; i < 5; ++i)
+    {
+        vec2 offset = direction * texelSize * float(i);
+        bloom += threshold(texture(bloomColor, vTexCoord + offset).rgb) * kWeights[i];
+        bloom += threshold(texture(bloomColor, vTexCoord - offset).rgb) * kWeights[i];
+    }
+
+    vec3 hdr = texture(sceneColor, vTexCoord).rgb + bloom * bloomIntensity;
+    vec3 mapped = vec3(1.0) - exp(-hdr * exposure);
+    color = vec4(pow(mapped, vec3(1.0 / 2.2)), 1.0);
+})";
+
+constexpr char kTextVS[] = R"(#version 300 es
+uniform mat3 transform;
+uniform vec2 viewportSize;
+in vec2 position;
+in vec2 texCoord;
+in vec4 vertexColor;
+out vec2 vTexCoord;
+out vec4 vColor;
+void main()
+{
+    vec2 pixel = (transform * vec3(position, 1.0)).xy;
+    vTexCoord = texCoord;
+    vColor = vertexColor;
+    gl_Position = vec4(pixel / viewportSize * vec2(2.0, -2.0) + vec2(-1.0, 1.0), 0.0, 1.0);
+})";
+
+constexpr char kTextFS[] = R"(#version 300 es
+precision mediump float;
+uniform sampler2D glyphAtlas;
+uniform vec4 outlineColor;
+uniform float outlineWidth;
+uniform float smoothing;
+in vec2 vTexCoord;
+in vec4 vColor;
+out vec4 color;
+void main()
+{
+    float glyphDistance = texture(glyphAtlas, vTexCoord).a;
+    float outline = smoothstep(0.5 - outlineWidth - smoothing, 0.5 - outlineWidth + smoothing,
+                               glyphDistance);
+    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, glyphDistance);
+    vec4 fill = vec4(vColor.rgb, vColor.a * alpha);
+    color = mix(vec4(outlineColor.rgb, outlineColor.a * outline), fill, alpha);
+})";
+
+constexpr char kParticleVS[] = R"(#version 300 es
+uniform mat4 viewProjection;
+uniform vec3 cameraRight;
+uniform vec3 cameraUp;
+uniform float time;
+in vec2 corner;
+in vec4 particlePositionAndSize;
+in vec4 particleVelocityAndAge;
+in vec4 particleColor;
+out vec2 vTexCoord;
+out vec4 vColor;
+out float vViewDepth;
+void main()
+{
+    float age = particleVelocityAndAge.w + time;
+    vec3 center = particlePositionAndSize.xyz + particleVelocityAndAge.xyz * age -
+                  vec3(0.0, 4.9, 0.0) * age * age;
+    float size = particlePositionAndSize.w * (1.0 + age);
+    vec3 position = center + (cameraRight * corner.x + cameraUp * corner.y) * size;
+
+    vTexCoord = corner * 0.5 + 0.5;
+    vColor = vec4(particleColor.rgb, particleColor.a * clamp(1.0 - age, 0.0, 1.0));
+    gl_Position = viewProjection * vec4(position, 1.0);
+    vViewDepth = gl_Position.w;
+})";
+
+constexpr char kParticleFS[] = R"(#version 300 es
+precision highp float;
+uniform sampler2D particleTexture;
+uniform highp sampler2D sceneDepth;
+uniform vec2 viewportSize;
+uniform vec2 depthRange;
+uniform float softness;
+in vec2 vTexCoord;
+in vec4 vColor;
+in float vViewDepth;
+out vec4 color;
+float linearizeDepth(float depth)
+{
+    return depthRange.x * depthRange.y / (depthRange.y - depth * (depthRange.y - depthRange.x));
+}
+void main()
+{
+    float sceneViewDepth = linearizeDepth(texture(sceneDepth, gl_FragCoord.xy / viewportSize).r);
+    float fade = clamp((sceneViewDepth - vViewDepth) / softness, 0.0, 1.0);
+    color = texture(particleTexture, vTexCoord) * vColor;
+    color.a *= fade;
+})";
+
+constexpr char kTerrainVS[] = R"(#version 300 es
+uniform mat4 viewProjection;
+uniform highp sampler2D heightMap;
+uniform vec2 terrainSize;
+uniform float heightScale;
+in vec2 gridPosition;
+out vec2 vTexCoord;
+out vec3 vNormal;
+out float vHeight;
+void main()
+{
+    vec2 uv = gridPosition / terrainSize;
+    float height = textureLod(heightMap, uv, 0.0).r * heightScale;
+    float left = textureLodOffset(heightMap, uv, 0.0, ivec2(-1, 0)).r * heightScale;
+    float right = textureLodOffset(heightMap, uv, 0.0, ivec2(1, 0)).r * heightScale;
+    float down = textureLodOffset(heightMap, uv, 0.0, ivec2(0, -1)).r * heightScale;
+    float up = textureLodOffset(heightMap, uv, 0.0, ivec2(0, 1)).r * heightScale;
+
+    vTexCoord = uv;
+    vNormal = normalize(vec3(left - right, 2.0, down - up));
+    vHeight = height;
+    gl_Position = viewProjection * vec4(gridPosition.x, height, gridPosition.y, 1.0);
+})";
+
+constexpr char kTerrainFS[] = R"(#version 300 es
+precision mediump float;
+uniform sampler2D splatMap;
+uniform mediump sampler2DArray layers;
+uniform vec4 layerTiling;
+uniform vec3 sunDirection;
+uniform vec3 sunColor;
+in vec2 vTexCoord;
+in vec3 vNormal;
+in float vHeight;
+layout(location = 0) out vec4 color;
+layout(location = 1) out vec4 normalAndHeight;
+void main()
+{
+    vec4 weights = texture(splatMap, vTexCoord);
+    weights /= max(dot(weights, vec4(1.0)), 0.001);
+
+    vec3 albedo = vec3(0.0);
+    for (int i = 0; i < 4; ++i)
+    {
+        albedo += texture(layers, vec3(vTexCoord * layerTiling[i], float(i))).rgb * weights[i];
+    }
+
+    float diffuse = max(dot(normalize(vNormal), -sunDirection), 0.0);
+    color = vec4(albedo * (0.2 + sunColor * diffuse), 1.0);
+    normalAndHeight = vec4(vNormal * 0.5 + 0.5, vHeight);
+})";
+
+constexpr ShaderSources kCorpus[] = {
+    {kSkinnedMeshVS, kSkinnedMeshFS}, {kFullscreenVS, kBloomBlurFS}, {kTextVS, kTextFS},
+    {kParticleVS, kParticleFS},       {kTerrainVS, kTerrainFS},
+};
+
+struct SpirvTransformPerfParams final : public RenderTestParams
+{
+    SpirvTransformPerfParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+
+        eglParameters = egl_platform::VULKAN();
+        majorVersion  = 3;
+        minorVersion  = 0;
+        windowWidth   = 64;
+        windowHeight  = 64;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const SpirvTransformPerfParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class SpirvTransformPerfBenchmark : public ANGLERenderTest,
+                                    public ::testing::WithParamInterface<SpirvTransformPerfParams>
+{
+  public:
+    SpirvTransformPerfBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    // A stage of a program of the corpus, as the backend transforms it for the pipeline.
+    struct Stage
+    {
+        rx::SpvTransformOptions options;
+        const rx::ShaderInterfaceVariableInfoMap *variableInfoMap;
+        const angle::spirv::Blob *spirvBlob;
+    };
+
+    gl::Context *getContext();
+
+    std::vector<GLuint> mPrograms;
+    std::vector<Stage> mStages;
+};
+
+SpirvTransformPerfBenchmark::SpirvTransformPerfBenchmark()
+    : ANGLERenderTest("SpirvTransformPerf", GetParam())
+{}
+
+gl::Context *SpirvTransformPerfBenchmark::getContext()
+{
+    EGLWindow *window     = static_cast<EGLWindow *>(getGLWindow());
+    egl::Display *display = static_cast<egl::Display *>(window->getDisplay());
+    gl::ContextID contextID = {
+        static_cast<GLuint>(reinterpret_cast<uintptr_t>(window->getContext()))};
+    return display->getContext(contextID);
+}
+
+void SpirvTransformPerfBenchmark::initializeBenchmark()
+{
+    gl::Context *context              = getContext();
+    const rx::ContextVk *contextVk    = rx::GetImplAs<rx::ContextVk>(context);
+    const angle::FeaturesVk &features = contextVk->getFeatures();
+
+    for (const ShaderSources &sources : kCorpus)
+    {
+        GLuint program = CompileProgram(sources.vertexShader, sources.fragmentShader);
+        ASSERT_NE(0u, program);
+        mPrograms.push_back(program);
+
+        // Take the SPIR-V the backend generated when linking, and the options it uses to
+        // transform it when drawing without transform feedback.
+        const gl::Program *programGL = context->getProgramResolveLink({program});
+        const rx::ProgramExecutableVk *executableVk = rx::vk::GetImpl(&programGL->getExecutable());
+        const gl::ShaderMap<angle::spirv::Blob> &spirvBlobs =
+            executableVk->getOriginalShaderInfo().getSpirvBlobs();
+
+        for (gl::ShaderType shaderType : {gl::ShaderType::Vertex, gl::ShaderType::Fragment})
+        {
+            Stage stage;
+            stage.options.shaderType             = shaderType;
+            stage.options.isLastPreFragmentStage = shaderType == gl::ShaderType::Vertex;
+            stage.options.isTransformFeedbackEmulated = features.emulateTransformFeedback.enabled;
+            stage.options.useSpirvVaryingPrecisionFixer =
+                features.varyingsRequireMatchingPrecisionInSpirv.enabled;
+            stage.options.roundOutputAfterDithering = features.roundOutputAfterDithering.enabled;
+            stage.options.validate                  = false;
+            stage.variableInfoMap                   = &executableVk->getVariableInfoMap();
+            stage.spirvBlob                         = &spirvBlobs[shaderType];
+            ASSERT_FALSE(stage.spirvBlob->empty());
+
+            mStages.push_back(stage);
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void SpirvTransformPerfBenchmark::destroyBenchmark()
+{
+    for (GLuint program : mPrograms)
+    {
+        glDeleteProgram(program);
+    }
+    mPrograms.clear();
+    mStages.clear();
+}
+
+void SpirvTransformPerfBenchmark::drawBenchmark()
+{
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        for (const Stage &stage : mStages)
+        {
+            angle::spirv::Blob transformed;
+            ASSERT_EQ(rx::SpvTransformSpirvCode(stage.options, *stage.variableInfoMap,
+                                                *stage.spirvBlob, &transformed),
+                      angle::Result::Continue);
+            ASSERT_FALSE(transformed.empty());
+        }
+    }
+}
+}  // anonymous namespace
+
+TEST_P(SpirvTransformPerfBenchmark, Run)
+{
+    run();
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(SpirvTransformPerfBenchmark);
+ANGLE_INSTANTIATE_TEST(SpirvTransformPerfBenchmark, SpirvTransformPerfParams());
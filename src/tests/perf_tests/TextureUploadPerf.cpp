@@ -33,7 +33,11 @@ struct TextureUploadParams final : public RenderTestParams
         baseSize     = 1024;
         subImageSize = 64;
 
-        webgl = false;
+        format = GL_RGBA;
+        type   = GL_UNSIGNED_BYTE;
+
+        webgl      = false;
+        scalarLoad = false;
     }
 
     std::string story() const override;
@@ -41,7 +45,13 @@ struct TextureUploadParams final : public RenderTestParams
     GLsizei baseSize;
     GLsizei subImageSize;
 
+    // The format and type of the uploaded data, which select the pixel conversion done on upload.
+    GLenum format;
+    GLenum type;
+
     bool webgl;
+    // Whether the pixel conversions are done without their vectorized implementations.
+    bool scalarLoad;
 };
 
 std::ostream &operator<<(std::ostream &os, const TextureUploadParams &params)
@@ -61,6 +71,26 @@ std::string TextureUploadParams::story() const
         strstr << "_webgl";
     }
 
+    switch (format)
+    {
+        case GL_RGB:
+            strstr << (type == GL_UNSIGNED_SHORT_5_6_5 ? "_rgb565" : "_rgb8");
+            break;
+        case GL_LUMINANCE:
+            strstr << "_l8";
+            break;
+        case GL_LUMINANCE_ALPHA:
+            strstr << "_la8";
+            break;
+        default:
+            break;
+    }
+
+    if (scalarLoad)
+    {
+        strstr << "_scalar_load";
+    }
+
     return strstr.str();
 }
 
@@ -390,8 +420,8 @@ void TextureUploadFullMipBenchmark::drawBenchmark()
         GLint mip = 0;
         for (GLsizei levelSize = params.baseSize; levelSize > 0; levelSize >>= 1)
         {
-            glTexImage2D(GL_TEXTURE_2D, mip++, GL_RGBA, levelSize, levelSize, 0, GL_RGBA,
-                         GL_UNSIGNED_BYTE, mTextureData.data());
+            glTexImage2D(GL_TEXTURE_2D, mip++, params.format, levelSize, levelSize, 0, params.format,
+                         params.type, mTextureData.data());
         }
 
         // Perform a draw just so the texture data is flushed.  With the position attributes not
@@ -475,6 +505,21 @@ TextureUploadParams VulkanParams(bool webglCompat)
     return params;
 }
 
+// Uploads data that needs converting to the format of the Vulkan image, optionally without the
+// vectorized conversion functions to measure their benefit.
+TextureUploadParams VulkanConversionParams(GLenum format, GLenum type, bool scalarLoad)
+{
+    TextureUploadParams params = VulkanParams(false);
+    params.format              = format;
+    params.type                = type;
+    params.scalarLoad          = scalarLoad;
+    if (scalarLoad)
+    {
+        params.enable(Feature::DisableSimdImageLoad);
+    }
+    return params;
+}
+
 TextureUploadParams ES3VulkanParams(bool webglCompat)
 {
     TextureUploadParams params;
@@ -578,7 +623,15 @@ ANGLE_INSTANTIATE_TEST(TextureUploadFullMipBenchmark,
                        OpenGLOrGLESParams(false),
                        OpenGLOrGLESParams(true),
                        VulkanParams(false),
-                       VulkanParams(true));
+                       VulkanParams(true),
+                       VulkanConversionParams(GL_RGB, GL_UNSIGNED_BYTE, false),
+                       VulkanConversionParams(GL_RGB, GL_UNSIGNED_BYTE, true),
+                       VulkanConversionParams(GL_RGB, GL_UNSIGNED_SHORT_5_6_5, false),
+                       VulkanConversionParams(GL_RGB, GL_UNSIGNED_SHORT_5_6_5, true),
+                       VulkanConversionParams(GL_LUMINANCE, GL_UNSIGNED_BYTE, false),
+                       VulkanConversionParams(GL_LUMINANCE, GL_UNSIGNED_BYTE, true),
+                       VulkanConversionParams(GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, false),
+                       VulkanConversionParams(GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, true));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(PBOSubImageBenchmark);
 ANGLE_INSTANTIATE_TEST(PBOSubImageBenchmark,
@@ -4,7 +4,8 @@
 // found in the LICENSE file.
 //
 // VertexArrayPerfTest:
-//   Performance test for glBindVertexArray.
+//   Performance test for glBindVertexArray, and for vertex data whose format the backend converts
+//   on the CPU.
 //
 
 #include "ANGLEPerfTest.h"
@@ -21,6 +22,10 @@ enum class TestMode
     BufferData,
     BindBuffer,
     UpdateBufferData,
+    // Draw with vertex data of a format the backend doesn't support natively, after updating the
+    // buffer it is in or from a client array, so that it is converted every frame.
+    ConvertBufferData,
+    ConvertClientData,
 };
 
 struct VertexArrayParams final : public RenderTestParams
@@ -42,6 +47,12 @@ struct VertexArrayParams final : public RenderTestParams
     int numBuffers       = 5;
     GLuint bufferSize[5] = {384, 1028, 192, 384, 192};
     TestMode testMode    = TestMode::BufferData;
+
+    // For the Convert* modes.  Vertices have 3 components of this type, which is GL_BYTE,
+    // GL_SHORT or GL_FIXED.
+    GLenum convertedType          = GL_BYTE;
+    GLboolean convertedNormalized = GL_FALSE;
+    GLsizei numConvertedVertices  = 1 << 20;
 };
 
 std::ostream &operator<<(std::ostream &os, const VertexArrayParams &params)
@@ -64,6 +75,30 @@ std::string VertexArrayParams::story() const
     {
         strstr << "_updatebufferdata";
     }
+    else if (testMode == TestMode::ConvertBufferData || testMode == TestMode::ConvertClientData)
+    {
+        strstr << (testMode == TestMode::ConvertBufferData ? "_convertbufferdata"
+                                                           : "_convertclientdata");
+        switch (convertedType)
+        {
+            case GL_BYTE:
+                strstr << "_byte";
+                break;
+            case GL_SHORT:
+                strstr << "_short";
+                break;
+            case GL_FIXED:
+                strstr << "_fixed";
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+        if (convertedNormalized)
+        {
+            strstr << "_norm";
+        }
+    }
 
     return strstr.str();
 }
@@ -82,16 +117,27 @@ class VertexArrayBenchmark : public ANGLERenderTest,
     void updateBufferData(GLuint vertexArrayID, GLuint bufferID, GLuint bufferSize);
 
   private:
+    void initializeConversionBenchmark();
+
     std::vector<GLuint> mBuffers;
     GLuint mProgram       = 0;
     GLint mAttribLocation = 0;
     std::vector<GLuint> mVertexArrays;
+    std::vector<uint8_t> mConvertedVertexData;
 };
 
 VertexArrayBenchmark::VertexArrayBenchmark() : ANGLERenderTest("VertexArrayPerf", GetParam()) {}
 
 void VertexArrayBenchmark::initializeBenchmark()
 {
+    const VertexArrayParams &params = GetParam();
+    if (params.testMode == TestMode::ConvertBufferData ||
+        params.testMode == TestMode::ConvertClientData)
+    {
+        initializeConversionBenchmark();
+        return;
+    }
+
     constexpr char kVS[] = R"(attribute vec4 position;
 attribute float in_attrib;
 varying float v_attrib;
@@ -133,6 +179,60 @@ void main()
     glBindBuffer(GL_ARRAY_BUFFER, mBuffers[0]);
 }
 
+void VertexArrayBenchmark::initializeConversionBenchmark()
+{
+    const VertexArrayParams &params = GetParam();
+
+    constexpr char kVS[] = R"(attribute vec3 in_attrib;
+varying vec3 v_attrib;
+void main()
+{
+    v_attrib = in_attrib;
+    gl_Position = vec4(0, 0, 0, 1);
+    gl_PointSize = 1.0;
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+varying vec3 v_attrib;
+void main()
+{
+    gl_FragColor = vec4(v_attrib, 1);
+})";
+
+    mProgram = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    mAttribLocation = glGetAttribLocation(mProgram, "in_attrib");
+    ASSERT_NE(mAttribLocation, -1);
+
+    size_t componentSize = params.convertedType == GL_BYTE    ? sizeof(GLbyte)
+                           : params.convertedType == GL_SHORT ? sizeof(GLshort)
+                                                              : sizeof(GLfixed);
+    mConvertedVertexData.resize(params.numConvertedVertices * 3 * componentSize);
+    for (size_t byteIndex = 0; byteIndex < mConvertedVertexData.size(); ++byteIndex)
+    {
+        mConvertedVertexData[byteIndex] = static_cast<uint8_t>(byteIndex * 7);
+    }
+
+    const void *pointer = mConvertedVertexData.data();
+    if (params.testMode == TestMode::ConvertBufferData)
+    {
+        mBuffers.resize(1, 0);
+        glGenBuffers(1, mBuffers.data());
+        glBindBuffer(GL_ARRAY_BUFFER, mBuffers[0]);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(mConvertedVertexData.size()),
+                     mConvertedVertexData.data(), GL_DYNAMIC_DRAW);
+        pointer = nullptr;
+    }
+
+    glEnableVertexAttribArray(mAttribLocation);
+    glVertexAttribPointer(mAttribLocation, 3, params.convertedType, params.convertedNormalized, 0,
+                          pointer);
+
+    ASSERT_GL_NO_ERROR();
+}
+
 void VertexArrayBenchmark::rebindVertexArray(GLuint vertexArrayID, GLuint bufferID)
 {
     // Rebind a vertex array object and a generic vertex attribute inside of it.
@@ -174,6 +274,17 @@ void VertexArrayBenchmark::drawBenchmark()
     {
         glBufferData(GL_ARRAY_BUFFER, 128, nullptr, GL_STATIC_DRAW);
     }
+    else if (params.testMode == TestMode::ConvertBufferData)
+    {
+        // Dirty the whole buffer so that all of it is converted again.
+        glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(mConvertedVertexData.size()),
+                        mConvertedVertexData.data());
+        glDrawArrays(GL_POINTS, 0, params.numConvertedVertices);
+    }
+    else if (params.testMode == TestMode::ConvertClientData)
+    {
+        glDrawArrays(GL_POINTS, 0, params.numConvertedVertices);
+    }
     else if (params.testMode == TestMode::UpdateBufferData)
     {
         int bufferSizeIndex = 0;
@@ -222,6 +333,18 @@ VertexArrayParams VulkanNullParams(TestMode testMode)
     return params;
 }
 
+VertexArrayParams VulkanConvertParams(TestMode testMode,
+                                      GLenum convertedType,
+                                      GLboolean convertedNormalized)
+{
+    VertexArrayParams params;
+    params.eglParameters       = egl_platform::VULKAN();
+    params.testMode            = testMode;
+    params.convertedType       = convertedType;
+    params.convertedNormalized = convertedNormalized;
+    return params;
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VertexArrayBenchmark);
 ANGLE_INSTANTIATE_TEST(VertexArrayBenchmark,
                        MetalParams(),
@@ -229,5 +352,11 @@ ANGLE_INSTANTIATE_TEST(VertexArrayBenchmark,
                        VulkanNullParams(TestMode::BindBuffer),
                        VulkanNullParams(TestMode::BufferData),
                        VulkanNullParams(TestMode::UpdateBufferData),
+                       VulkanConvertParams(TestMode::ConvertBufferData, GL_BYTE, GL_FALSE),
+                       VulkanConvertParams(TestMode::ConvertBufferData, GL_SHORT, GL_TRUE),
+                       VulkanConvertParams(TestMode::ConvertBufferData, GL_FIXED, GL_FALSE),
+                       VulkanConvertParams(TestMode::ConvertClientData, GL_BYTE, GL_FALSE),
+                       VulkanConvertParams(TestMode::ConvertClientData, GL_SHORT, GL_TRUE),
+                       VulkanConvertParams(TestMode::ConvertClientData, GL_FIXED, GL_FALSE),
                        params::Native(VertexArrayParams()));
 }  // namespace
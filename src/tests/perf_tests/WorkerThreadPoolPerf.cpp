@@ -0,0 +1,124 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// WorkerThreadPoolPerf:
+//   Performance test for posting tasks to the worker thread pools from many threads at once.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <atomic>
+#include <thread>
+
+#include "common/WorkerThread.h"
+
+using namespace testing;
+
+namespace
+{
+using angle::ThreadPoolType;
+using angle::WaitableEvent;
+using angle::WorkerTaskPriority;
+using angle::WorkerThreadPool;
+
+constexpr size_t kTasksPerPoster = 1000;
+
+struct WorkerThreadPoolParams
+{
+    ThreadPoolType poolType;
+    size_t posterCount;
+};
+
+std::ostream &operator<<(std::ostream &os, const WorkerThreadPoolParams &params)
+{
+    os << (params.poolType == ThreadPoolType::WorkStealing ? "WorkStealing" : "Asynchronous")
+       << "_" << params.posterCount << "_posters";
+    return os;
+}
+
+// A tiny task, so that the cost of the measurement is dominated by the pool's overhead.
+class CountingTask : public angle::Closure
+{
+  public:
+    CountingTask(std::atomic<size_t> *counter) : mCounter(counter) {}
+    void operator()() override { mCounter->fetch_add(1, std::memory_order_relaxed); }
+
+  private:
+    std::atomic<size_t> *mCounter;
+};
+
+class WorkerThreadPoolPerfTest : public ANGLEPerfTest,
+                                 public WithParamInterface<WorkerThreadPoolParams>
+{
+  public:
+    WorkerThreadPoolPerfTest();
+
+    void step() override;
+
+    std::string getName();
+
+  private:
+    std::shared_ptr<WorkerThreadPool> mPool;
+    std::atomic<size_t> mCounter;
+};
+
+WorkerThreadPoolPerfTest::WorkerThreadPoolPerfTest()
+    : ANGLEPerfTest(getName(), "", "_run", 1, "us"),
+      mPool(WorkerThreadPool::Create(GetParam().poolType, 0, ANGLEPlatformCurrent())),
+      mCounter(0)
+{}
+
+void WorkerThreadPoolPerfTest::step()
+{
+    std::vector<std::thread> posters;
+    posters.reserve(GetParam().posterCount);
+
+    for (size_t posterIndex = 0; posterIndex < GetParam().posterCount; ++posterIndex)
+    {
+        posters.emplace_back([this, posterIndex]() {
+            std::vector<std::shared_ptr<WaitableEvent>> waitables;
+            waitables.reserve(kTasksPerPoster);
+
+            // Mix priorities as compile, link and pipeline warming do in practice.
+            const WorkerTaskPriority priority = static_cast<WorkerTaskPriority>(posterIndex % 3);
+            for (size_t taskIndex = 0; taskIndex < kTasksPerPoster; ++taskIndex)
+            {
+                waitables.push_back(mPool->postWorkerTaskWithPriority(
+                    std::make_shared<CountingTask>(&mCounter), priority));
+            }
+            WaitableEvent::WaitMany(&waitables);
+        });
+    }
+
+    for (std::thread &poster : posters)
+    {
+        poster.join();
+    }
+}
+
+std::string WorkerThreadPoolPerfTest::getName()
+{
+    std::stringstream ss;
+    ss << UnitTest::GetInstance()->current_test_suite()->name() << "/" << GetParam();
+    return ss.str();
+}
+
+// Measures the time to post and wait for tasks from several threads in parallel.
+TEST_P(WorkerThreadPoolPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         WorkerThreadPoolPerfTest,
+                         Values(WorkerThreadPoolParams{ThreadPoolType::Asynchronous, 1},
+                                WorkerThreadPoolParams{ThreadPoolType::Asynchronous, 4},
+                                WorkerThreadPoolParams{ThreadPoolType::Asynchronous, 16},
+                                WorkerThreadPoolParams{ThreadPoolType::WorkStealing, 1},
+                                WorkerThreadPoolParams{ThreadPoolType::WorkStealing, 4},
+                                WorkerThreadPoolParams{ThreadPoolType::WorkStealing, 16}),
+                         PrintToStringParamName());
+
+}  // anonymous namespace
@@ -0,0 +1,213 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/DirectiveHandlerBase.h"
+#include "compiler/preprocessor/Macro.h"
+#include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
+#include "compiler/preprocessor/TokenStreamCache.h"
+
+namespace angle
+{
+
+namespace
+{
+
+constexpr char kPrologue[] = R"(#version 300 es
+// A prologue that is shared by several shaders.
+#define PI 3.14159
+#define TWO_PI (2.0 * PI)
+#define SCALE(x) ((x) * TWO_PI)
+/* A comment that spans
+   several lines. */
+#if defined(GL_ES) && __VERSION__ >= 300
+precision highp float;
+#else
+#error not reached
+#endif
+#pragma optimize(off)
+#extension GL_OES_EGL_image_external_essl3 : enable
+uniform float uTime; int line = __LINE__; int file = __FILE__;
+float wave(float t) { return sin(SCALE(t)) + PI; }
+)";
+
+// Records everything the preprocessor produces in order, so that runs can be compared.
+class RecordingDiagnostics : public pp::Diagnostics
+{
+  public:
+    RecordingDiagnostics(std::vector<std::string> *log) : mLog(log) {}
+
+  protected:
+    void print(ID id, const pp::SourceLocation &loc, const std::string &text) override
+    {
+        std::ostringstream stream;
+        stream << "diagnostic " << id << " " << loc.file << ":" << loc.line << " " << text;
+        mLog->push_back(stream.str());
+    }
+
+  private:
+    std::vector<std::string> *mLog;
+};
+
+class RecordingDirectiveHandler : public pp::DirectiveHandler
+{
+  public:
+    RecordingDirectiveHandler(std::vector<std::string> *log) : mLog(log) {}
+
+    void handleError(const pp::SourceLocation &loc, const std::string &msg) override
+    {
+        record("error", loc, msg);
+    }
+
+    void handlePragma(const pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {
+        record("pragma", loc, name + " " + value);
+    }
+
+    void handleExtension(const pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {
+        record("extension", loc, name + " " + behavior);
+    }
+
+    void handleVersion(const pp::SourceLocation &loc,
+                       int version,
+                       ShShaderSpec spec,
+                       pp::MacroSet *macro_set) override
+    {
+        record("version", loc, std::to_string(version));
+        pp::PredefineMacro(macro_set, "__VERSION__", version);
+    }
+
+  private:
+    void record(const char *directive, const pp::SourceLocation &loc, const std::string &text)
+    {
+        std::ostringstream stream;
+        stream << directive << " " << loc.file << ":" << loc.line << " " << text;
+        mLog->push_back(stream.str());
+    }
+
+    std::vector<std::string> *mLog;
+};
+
+class TokenStreamCacheTest : public testing::Test
+{
+  protected:
+    void TearDown() override { pp::TokenStreamCache::Clear(); }
+
+    static std::vector<std::string> Preprocess(const std::vector<const char *> &strings,
+                                               size_t minStringLength)
+    {
+        std::vector<std::string> log;
+        RecordingDiagnostics diagnostics(&log);
+        RecordingDirectiveHandler directiveHandler(&log);
+
+        pp::PreprocessorSettings settings(SH_GLES3_SPEC,
+                                          pp::WebGLExtensionDisableBehavior::Standard);
+        settings.tokenStreamCacheMinStringLength = minStringLength;
+        pp::Preprocessor preprocessor(&diagnostics, &directiveHandler, settings);
+        EXPECT_TRUE(preprocessor.init(strings.size(), strings.data(), nullptr));
+
+        pp::Token token;
+        do
+        {
+            preprocessor.lex(&token);
+            std::ostringstream stream;
+            stream << "token " << token.type << " " << token.flags << " " << token.location.file
+                   << ":" << token.location.line << " " << token;
+            log.push_back(stream.str());
+        } while (token.type != pp::Token::LAST);
+
+        return log;
+    }
+
+    // Checks that the shader preprocesses the same when its leading strings are lexed, when they
+    // are cached, and when they are replayed from the cache.
+    static void ExpectSameAsScanning(const std::vector<const char *> &strings)
+    {
+        const std::vector<std::string> expected = Preprocess(strings, 0);
+        EXPECT_EQ(expected, Preprocess(strings, 1));
+        EXPECT_EQ(expected, Preprocess(strings, 1));
+    }
+
+    static bool IsCached(const char *string)
+    {
+        return pp::TokenStreamCache::Get(string, strlen(string)) != nullptr;
+    }
+};
+
+// Tests a prologue with macros, conditionals, comments and directives followed by the shader.
+TEST_F(TokenStreamCacheTest, Prologue)
+{
+    ExpectSameAsScanning({kPrologue, "void main() { float x = wave(uTime) * __LINE__; }"});
+    EXPECT_TRUE(IsCached(kPrologue));
+}
+
+// Tests several cached strings, with the shader and empty strings after them.
+TEST_F(TokenStreamCacheTest, SeveralStrings)
+{
+    ExpectSameAsScanning({kPrologue, "#define THREE 3\nint three = THREE;\n", "",
+                          "\nvoid main() { int file = __FILE__; }", "", ""});
+}
+
+// Tests that a #line directive in a cached string applies to the rest of the shader.
+TEST_F(TokenStreamCacheTest, LineDirective)
+{
+    ExpectSameAsScanning({"int a;\n#line 20 7\nint b = __LINE__ + __FILE__;\n", "int c;\n",
+                          "int d = __LINE__;"});
+    ExpectSameAsScanning({"int a;\n#line 20\n", "int b = __LINE__;"});
+    ExpectSameAsScanning({"#line 2147483646\n\nint a;\n\n", "int b;"});
+}
+
+// Tests strings whose tokens depend on the strings around them, which are never replayed, and a
+// string whose diagnostics come from the preprocessor rather than the tokenizer, which is.
+TEST_F(TokenStreamCacheTest, StringsThatCantBeReplayed)
+{
+    const char *const kTokenAcrossStrings  = "int fo";
+    const char *const kCommentAcrossString = "int a; /* comment\n";
+    const char *const kLineContinuation    = "#define A 1 \\\n + 2\nint a = A;\n";
+    const char *const kInvalidNumber       = "int a = 0x;\n";
+
+    ExpectSameAsScanning({kTokenAcrossStrings, "o;\n", "int b;"});
+    ExpectSameAsScanning({kCommentAcrossString, "*/ int b;\n", "int c;"});
+    ExpectSameAsScanning({kLineContinuation, "int b;"});
+    ExpectSameAsScanning({kInvalidNumber, "int b;"});
+
+    EXPECT_FALSE(IsCached(kTokenAcrossStrings));
+    EXPECT_FALSE(IsCached(kCommentAcrossString));
+    EXPECT_FALSE(IsCached(kLineContinuation));
+    EXPECT_TRUE(IsCached(kInvalidNumber));
+}
+
+// Tests that tokens longer than the maximum token size are still reported.
+TEST_F(TokenStreamCacheTest, LongToken)
+{
+    const std::string prologue = "int " + std::string(300, 'a') + ";\n";
+    ExpectSameAsScanning({prologue.c_str(), "int b;"});
+}
+
+// Tests invoking macros defined in a cached string.
+TEST_F(TokenStreamCacheTest, MacroInvocations)
+{
+    ExpectSameAsScanning({"#define EMPTY\n#define ONE 1\n#define TWO ONE + ONE\n",
+                          "int a = TWO;\n  TWO EMPTY ONE\n#define ONE 2\nONE TWO"});
+}
+
+}  // anonymous namespace
+
+}  // namespace angle
@@ -59,6 +59,8 @@ ConfigParameters::ConfigParameters()
       samples(-1),
       // The default value of EGL_CONTEXT_PROGRAM_BINARY_CACHE_ENABLED_ANGLE is EGL_TRUE.
       contextProgramCacheEnabled(true),
+      // The default value of EGL_CONTEXT_THREADED_COMMANDS_ANGLE is EGL_FALSE.
+      threadedCommands(false),
       resetStrategy(EGL_NO_RESET_NOTIFICATION_EXT),
       colorSpace(EGL_COLORSPACE_LINEAR),
       swapInterval(kDefaultSwapInterval)
@@ -571,6 +573,15 @@ EGLContext EGLWindow::createContext(EGLContext share, EGLint *extraAttributes)
         return EGL_NO_CONTEXT;
     }
 
+    bool hasThreadedCommandsExtension =
+        ANGLE_UNSAFE_TODO(strstr(displayExtensions, "EGL_ANGLE_context_threaded_commands")) !=
+        nullptr;
+    if (mConfigParams.threadedCommands && !hasThreadedCommandsExtension)
+    {
+        fprintf(stderr, "EGL_ANGLE_context_threaded_commands missing.\n");
+        return EGL_NO_CONTEXT;
+    }
+
     eglBindAPI(EGL_OPENGL_ES_API);
     if (eglGetError() != EGL_SUCCESS)
     {
@@ -668,6 +679,12 @@ EGLContext EGLWindow::createContext(EGLContext share, EGLint *extraAttributes)
             contextAttributes.push_back(EGL_ROBUST_RESOURCE_INITIALIZATION_ANGLE);
             contextAttributes.push_back(mConfigParams.robustResourceInit ? EGL_TRUE : EGL_FALSE);
         }
+
+        if (mConfigParams.threadedCommands)
+        {
+            contextAttributes.push_back(EGL_CONTEXT_THREADED_COMMANDS_ANGLE);
+            contextAttributes.push_back(EGL_TRUE);
+        }
     }
     contextAttributes.push_back(EGL_NONE);
 
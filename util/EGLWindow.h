@@ -60,6 +60,7 @@ struct ANGLE_UTIL_EXPORT ConfigParameters
     bool mutableRenderBuffer;
     EGLint samples;
     bool contextProgramCacheEnabled;
+    bool threadedCommands;
     EGLenum resetStrategy;
     EGLenum colorSpace;
     EGLint swapInterval;
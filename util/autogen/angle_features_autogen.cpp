@@ -46,6 +46,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::AlwaysCallUseProgramAfterLink, "alwaysCallUseProgramAfterLink"},
     {Feature::AlwaysEnableEmulatedMultidrawExtensions, "alwaysEnableEmulatedMultidrawExtensions"},
     {Feature::AlwaysPreferStagedTextureUploads, "alwaysPreferStagedTextureUploads"},
+    {Feature::AlwaysRunCompileJobsThreaded, "alwaysRunCompileJobsThreaded"},
     {Feature::AlwaysRunLinkSubJobsThreaded, "alwaysRunLinkSubJobsThreaded"},
     {Feature::AlwaysUnbindFramebufferTexture2D, "alwaysUnbindFramebufferTexture2D"},
     {Feature::AlwaysUseManagedStorageModeForBuffers, "alwaysUseManagedStorageModeForBuffers"},
@@ -79,7 +80,9 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ClipCullDistanceBrokenWithPassthroughShaders, "clipCullDistanceBrokenWithPassthroughShaders"},
     {Feature::ClipSrcRegionForBlitFramebuffer, "clipSrcRegionForBlitFramebuffer"},
     {Feature::ClSerializedExecution, "clSerializedExecution"},
+    {Feature::CoalesceDrawElements, "coalesceDrawElements"},
     {Feature::CompileJobIsThreadSafe, "compileJobIsThreadSafe"},
+    {Feature::CompressBlobCacheAsynchronously, "compressBlobCacheAsynchronously"},
     {Feature::CompressProgramBinaryBlob, "compressProgramBinaryBlob"},
     {Feature::ConvertLowpAndMediumpFloatUniformsTo16Bits, "convertLowpAndMediumpFloatUniformsTo16Bits"},
     {Feature::CopyIOSurfaceToNonIOSurfaceForReadOptimization, "copyIOSurfaceToNonIOSurfaceForReadOptimization"},
@@ -116,6 +119,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::DisableRWTextureTier2Support, "disableRWTextureTier2Support"},
     {Feature::DisableSemaphoreFd, "disableSemaphoreFd"},
     {Feature::DisableSeparateShaderObjects, "disableSeparateShaderObjects"},
+    {Feature::DisableSimdImageLoad, "disableSimdImageLoad"},
     {Feature::DisableStagedInitializationOfPackedTextureFormats, "disableStagedInitializationOfPackedTextureFormats"},
     {Feature::DisableSubmitCommandsOnSyncStatusCheckForTesting, "disableSubmitCommandsOnSyncStatusCheckForTesting"},
     {Feature::DisableSyncControlSupport, "disableSyncControlSupport"},
@@ -201,6 +205,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ForceDisableFullScreenExclusive, "forceDisableFullScreenExclusive"},
     {Feature::ForceFallbackFormat, "forceFallbackFormat"},
     {Feature::ForceFlushAfterDrawcallUsingShadowmap, "forceFlushAfterDrawcallUsingShadowmap"},
+    {Feature::ForceGenerateMipmapOnCPU, "forceGenerateMipmapOnCPU"},
     {Feature::ForceGlErrorChecking, "forceGlErrorChecking"},
     {Feature::ForceHostImageCopyForLuma, "forceHostImageCopyForLuma"},
     {Feature::ForceInitShaderVariables, "forceInitShaderVariables"},
@@ -503,6 +508,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::UseDepthWriteEnableDynamicState, "useDepthWriteEnableDynamicState"},
     {Feature::UseDualPipelineBlobCacheSlots, "useDualPipelineBlobCacheSlots"},
     {Feature::UseEmptyBlobsToEraseOldPipelineCacheFromBlobCache, "useEmptyBlobsToEraseOldPipelineCacheFromBlobCache"},
+    {Feature::UseFastBlobCacheCompression, "useFastBlobCacheCompression"},
     {Feature::UseFrontFaceDynamicState, "useFrontFaceDynamicState"},
     {Feature::UseIntermediateTextureForGenerateMipmap, "useIntermediateTextureForGenerateMipmap"},
     {Feature::UseIr, "useIr"},
@@ -525,6 +531,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::UseVkEventForBufferBarrier, "useVkEventForBufferBarrier"},
     {Feature::UseVkEventForImageBarrier, "useVkEventForImageBarrier"},
     {Feature::UseVmaForImageSuballocation, "useVmaForImageSuballocation"},
+    {Feature::UseWorkStealingThreadPool, "useWorkStealingThreadPool"},
     {Feature::ValidateMaxPerStageUniformBlocksAtCompileTime, "validateMaxPerStageUniformBlocksAtCompileTime"},
     {Feature::ValidateState, "validateState"},
     {Feature::VaryingsRequireMatchingPrecisionInSpirv, "varyingsRequireMatchingPrecisionInSpirv"},
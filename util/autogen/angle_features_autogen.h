@@ -46,6 +46,7 @@ enum class Feature
     AlwaysCallUseProgramAfterLink,
     AlwaysEnableEmulatedMultidrawExtensions,
     AlwaysPreferStagedTextureUploads,
+    AlwaysRunCompileJobsThreaded,
     AlwaysRunLinkSubJobsThreaded,
     AlwaysUnbindFramebufferTexture2D,
     AlwaysUseManagedStorageModeForBuffers,
@@ -79,7 +80,9 @@ enum class Feature
     ClipCullDistanceBrokenWithPassthroughShaders,
     ClipSrcRegionForBlitFramebuffer,
     ClSerializedExecution,
+    CoalesceDrawElements,
     CompileJobIsThreadSafe,
+    CompressBlobCacheAsynchronously,
     CompressProgramBinaryBlob,
     ConvertLowpAndMediumpFloatUniformsTo16Bits,
     CopyIOSurfaceToNonIOSurfaceForReadOptimization,
@@ -116,6 +119,7 @@ enum class Feature
     DisableRWTextureTier2Support,
     DisableSemaphoreFd,
     DisableSeparateShaderObjects,
+    DisableSimdImageLoad,
     DisableStagedInitializationOfPackedTextureFormats,
     DisableSubmitCommandsOnSyncStatusCheckForTesting,
     DisableSyncControlSupport,
@@ -201,6 +205,7 @@ enum class Feature
     ForceDisableFullScreenExclusive,
     ForceFallbackFormat,
     ForceFlushAfterDrawcallUsingShadowmap,
+    ForceGenerateMipmapOnCPU,
     ForceGlErrorChecking,
     ForceHostImageCopyForLuma,
     ForceInitShaderVariables,
@@ -503,6 +508,7 @@ enum class Feature
     UseDepthWriteEnableDynamicState,
     UseDualPipelineBlobCacheSlots,
     UseEmptyBlobsToEraseOldPipelineCacheFromBlobCache,
+    UseFastBlobCacheCompression,
     UseFrontFaceDynamicState,
     UseIntermediateTextureForGenerateMipmap,
     UseIr,
@@ -525,6 +531,7 @@ enum class Feature
     UseVkEventForBufferBarrier,
     UseVkEventForImageBarrier,
     UseVmaForImageSuballocation,
+    UseWorkStealingThreadPool,
     ValidateMaxPerStageUniformBlocksAtCompileTime,
     ValidateState,
     VaryingsRequireMatchingPrecisionInSpirv,